@@ -0,0 +1,760 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - Micro Benchmarks.
+
+   Measures the hot paths of the CLI core and prints the results as JSON
+   (one object per case), so the numbers of two builds can be compared:
+   - command lookup (cmd_core_key_find) for hits and misses, with the
+     commands registered in sorted and in random order
+   - command registration (cmd_core_key_add)
+   - argument preprocessing (remove_whitespaces, remove_prefix)
+   - cli_sscanf versus the libc sscanf for scalar and array formats
+   - help rendering (cmd_core_tree_print__file)
+   - end-to-end execution (cli_core_cmd_arg_exec__file to /dev/null)
+   - table dump rows with fprintf / snprintf versus the output builder
+
+   The core source is included to get access to the internal functions,
+   the benchmark is linked without the CLI library.
+
+   Usage:
+      cli_bench [-n <n>[,<n>...]] [-t <min time ms>] [-l <setup limit ms>]
+                [-s <seed>] [-o <file>]
+
+\remarks
+   The workload is reproducible: all key sequences are generated from the
+   given seed. The number of iterations depends on the minimum run time
+   per case.
+   The command tree is not balanced, a sorted registration degenerates it
+   into a list. The setup of a case is aborted after the setup limit, the
+   case is reported with "status":"skipped".
+*/
+
+#include "lib_cli_core.c"
+#if (CLI_SUPPORT_OUT_BUILDER == 1)
+#	include "lib_cli_out_builder.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+
+/** number of operations between two time checks */
+#define BENCH_BATCH		64
+/** size of the pregenerated key sequences (power of 2) */
+#define BENCH_SEQ_SIZE		4096
+/** max depth of the command tree for the (recursive) help rendering */
+#define BENCH_PRINT_DEPTH_MAX	20000
+/** number of commands registered for the end-to-end case */
+#define BENCH_EXEC_COMMANDS	1000
+/** max number of command counts given with "-n" */
+#define BENCH_MAX_SIZES		8
+/** size of a command name buffer */
+#define BENCH_NAME_SIZE		16
+
+/** Benchmark run control */
+struct bench_s
+{
+	/** JSON output */
+	FILE *p_out;
+	/** /dev/null for the printouts of the measured functions */
+	FILE *p_null;
+	/** minimum run time per case [ns] */
+	unsigned long long min_time_ns;
+	/** maximum setup time per case [ns] */
+	unsigned long long setup_limit_ns;
+	/** seed of the key sequences */
+	unsigned int seed;
+	/** number of printed results */
+	unsigned int n_results;
+};
+
+/** Command names of a key lookup case */
+struct bench_names_s
+{
+	/** number of commands */
+	unsigned int n_cmds;
+	/** short names, BENCH_NAME_SIZE per command */
+	char *p_short;
+	/** long names, BENCH_NAME_SIZE per command */
+	char *p_long;
+	/** missing names, BENCH_SEQ_SIZE entries */
+	char *p_miss;
+	/** registration order */
+	unsigned int *p_order;
+	/** key sequence for the lookups */
+	unsigned int seq[BENCH_SEQ_SIZE];
+};
+
+/** Run STATEMENT (batches of BENCH_BATCH) for at least the minimum time */
+#define BENCH_RUN(P_BENCH, ITER, NS, STATEMENT) \
+	do { \
+		unsigned long long bench_start_ = bench_time_ns_get(); \
+		unsigned int bench_j_; \
+		ITER = 0; \
+		do { \
+			for (bench_j_ = 0; bench_j_ < BENCH_BATCH; bench_j_++, ITER++) { \
+				STATEMENT; \
+			} \
+			NS = bench_time_ns_get() - bench_start_; \
+		} while (NS < (P_BENCH)->min_time_ns); \
+	} while (0)
+
+static unsigned long long bench_time_ns_get(void)
+{
+	struct timespec ts;
+
+	(void)clios_clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+/* xorshift32, reproducible across libc implementations */
+static unsigned int bench_rand(
+	unsigned int *p_state)
+{
+	unsigned int x = *p_state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*p_state = x;
+
+	return x;
+}
+
+static int bench_sink;
+
+/* prevent that the compiler drops the measured call */
+static void bench_use(
+	const void *p)
+{
+	bench_sink += (int)((unsigned long)p & 0x1);
+}
+
+/**
+   Print one result object.
+   p_params is a list of additional JSON members (with trailing comma) or "".
+*/
+static void bench_result(
+	struct bench_s *p_bench,
+	const char *p_name,
+	const char *p_params,
+	unsigned long long iterations,
+	unsigned long long ns)
+{
+	(void)fprintf(p_bench->p_out,
+		"%s\n    {\"name\":\"%s\",%s\"iterations\":%llu,\"ns_per_op\":%.2f}",
+		(p_bench->n_results == 0) ? "" : ",", p_name, p_params, iterations,
+		(iterations != 0) ? ((double)ns / (double)iterations) : 0.0);
+	p_bench->n_results++;
+}
+
+static void bench_skipped(
+	struct bench_s *p_bench,
+	const char *p_name,
+	const char *p_params,
+	const char *p_reason)
+{
+	(void)fprintf(p_bench->p_out,
+		"%s\n    {\"name\":\"%s\",%s\"status\":\"skipped\",\"reason\":\"%s\"}",
+		(p_bench->n_results == 0) ? "" : ",", p_name, p_params, p_reason);
+	p_bench->n_results++;
+}
+
+static int bench_cmd__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_file)
+{
+	int ret = 0;
+#ifndef CLI_DEBUG_DISABLE
+	static const char USAGE[] =
+		"Long Form: bench_command" CLI_CRLF
+		"Short Form: bc" CLI_CRLF
+		CLI_CRLF
+		"Output Parameter" CLI_CRLF
+		"- int errorcode" CLI_CRLF
+		CLI_CRLF;
+#else
+#undef USAGE
+#define USAGE ""
+#endif
+	if ((ret = cli_check_help__file(p_cmd, USAGE, p_file)) > 0)
+		return ret;
+
+	return clios_fprintf(p_file, "errorcode=0 " CLI_CRLF);
+}
+
+/* max depth of the command tree, iterative (the tree may be a list) */
+static unsigned int bench_tree_depth_get(
+	struct cli_cmd_core_s *p_cmd_core)
+{
+	struct cli_cmd_node_s **pp_stack;
+	unsigned int *p_depth, n = 0, depth, max_depth = 0;
+	struct cli_cmd_node_s *p_node;
+
+	if (p_cmd_core->p_root == IFX_NULL)
+		return 0;
+
+	pp_stack = malloc(p_cmd_core->n_used_nodes * sizeof(*pp_stack));
+	p_depth = malloc(p_cmd_core->n_used_nodes * sizeof(*p_depth));
+	if ((pp_stack == IFX_NULL) || (p_depth == IFX_NULL))
+	{
+		free(pp_stack);
+		free(p_depth);
+		return 0;
+	}
+
+	pp_stack[n] = p_cmd_core->p_root;
+	p_depth[n++] = 1;
+	while (n > 0)
+	{
+		p_node = pp_stack[--n];
+		depth = p_depth[n];
+		if (depth > max_depth)
+			max_depth = depth;
+		if (p_node->p_left != IFX_NULL)
+		{
+			pp_stack[n] = p_node->p_left;
+			p_depth[n++] = depth + 1;
+		}
+		if (p_node->p_right != IFX_NULL)
+		{
+			pp_stack[n] = p_node->p_right;
+			p_depth[n++] = depth + 1;
+		}
+	}
+
+	free(pp_stack);
+	free(p_depth);
+
+	return max_depth;
+}
+
+static void bench_names_free(
+	struct bench_names_s *p_names)
+{
+	free(p_names->p_short);
+	free(p_names->p_long);
+	free(p_names->p_miss);
+	free(p_names->p_order);
+	free(p_names);
+}
+
+static struct bench_names_s *bench_names_create(
+	unsigned int n_cmds,
+	int b_random,
+	unsigned int seed)
+{
+	struct bench_names_s *p_names;
+	unsigned int i, j, tmp, state = seed;
+
+	p_names = calloc(1, sizeof(struct bench_names_s));
+	if (p_names == IFX_NULL)
+		return IFX_NULL;
+
+	p_names->n_cmds = n_cmds;
+	p_names->p_short = malloc((size_t)n_cmds * BENCH_NAME_SIZE);
+	p_names->p_long = malloc((size_t)n_cmds * BENCH_NAME_SIZE);
+	p_names->p_miss = malloc((size_t)BENCH_SEQ_SIZE * BENCH_NAME_SIZE);
+	p_names->p_order = malloc((size_t)n_cmds * sizeof(unsigned int));
+	if ((p_names->p_short == IFX_NULL) || (p_names->p_long == IFX_NULL) ||
+	    (p_names->p_miss == IFX_NULL) || (p_names->p_order == IFX_NULL))
+	{
+		bench_names_free(p_names);
+		return IFX_NULL;
+	}
+
+	for (i = 0; i < n_cmds; i++)
+	{
+		(void)snprintf(p_names->p_short + i * BENCH_NAME_SIZE, BENCH_NAME_SIZE, "c%07u", i);
+		(void)snprintf(p_names->p_long + i * BENCH_NAME_SIZE, BENCH_NAME_SIZE, "cmd_%07u", i);
+		p_names->p_order[i] = i;
+	}
+
+	/* Fisher-Yates */
+	if (b_random)
+	{
+		for (i = n_cmds - 1; i > 0; i--)
+		{
+			j = bench_rand(&state) % (i + 1);
+			tmp = p_names->p_order[i];
+			p_names->p_order[i] = p_names->p_order[j];
+			p_names->p_order[j] = tmp;
+		}
+	}
+
+	/* the misses are spread over the key range */
+	for (i = 0; i < BENCH_SEQ_SIZE; i++)
+	{
+		p_names->seq[i] = bench_rand(&state) % n_cmds;
+		(void)snprintf(p_names->p_miss + i * BENCH_NAME_SIZE, BENCH_NAME_SIZE,
+			"cmd_%07u_", bench_rand(&state) % n_cmds);
+	}
+
+	return p_names;
+}
+
+/**
+   Key lookup, registration and help rendering for one tree
+*/
+static void bench_key_find(
+	struct bench_s *p_bench,
+	unsigned int n_cmds,
+	int b_random)
+{
+	struct bench_names_s *p_names;
+	struct cli_cmd_core_s cmd_core;
+	struct cli_cmd_data_s cmd_data = {IFX_NULL, 0, {IFX_NULL}, 0};
+	unsigned long long iter, ns, start;
+	unsigned int i, idx, out_size = 0, depth;
+	char params[128];
+	int ret = IFX_SUCCESS;
+
+	(void)snprintf(params, sizeof(params), "\"order\":\"%s\",\"commands\":%u,",
+		b_random ? "random" : "sorted", n_cmds);
+
+	p_names = bench_names_create(n_cmds, b_random, p_bench->seed);
+	if (p_names == IFX_NULL)
+	{
+		bench_skipped(p_bench, "key_add", params, "no memory");
+		return;
+	}
+
+	clios_memset(&cmd_core, 0x00, sizeof(cmd_core));
+	cmd_core.out_mode = cli_cmd_core_out_mode_file;
+	cmd_core.n_nodes = 2 * n_cmds;
+	cmd_core.p_node_array = calloc(cmd_core.n_nodes, sizeof(struct cli_cmd_node_s));
+	if (cmd_core.p_node_array == IFX_NULL)
+	{
+		bench_skipped(p_bench, "key_add", params, "no memory");
+		bench_names_free(p_names);
+		return;
+	}
+	cmd_core.e_state = e_cli_cmd_core_allocate;
+
+	/* registration */
+	start = bench_time_ns_get();
+	ns = 0;
+	for (i = 0; (i < n_cmds) && (ret == IFX_SUCCESS); i++)
+	{
+		idx = p_names->p_order[i];
+		ret = cmd_core_key_add(&cmd_core, CLI_USER_MASK_MISC,
+			p_names->p_short + idx * BENCH_NAME_SIZE,
+			p_names->p_long + idx * BENCH_NAME_SIZE,
+			IFX_NULL, bench_cmd__file);
+
+		if ((i % 256) == 255)
+		{
+			ns = bench_time_ns_get() - start;
+			if (ns > p_bench->setup_limit_ns)
+				break;
+		}
+	}
+	ns = bench_time_ns_get() - start;
+
+	if (ret != IFX_SUCCESS)
+	{
+		bench_skipped(p_bench, "key_add", params, "registration failed");
+		goto BENCH_END;
+	}
+	if (i < n_cmds)
+	{
+		bench_skipped(p_bench, "key_add", params, "setup limit exceeded");
+		goto BENCH_END;
+	}
+	bench_result(p_bench, "key_add", params, n_cmds, ns);
+	cmd_core.e_state = e_cli_cmd_core_active;
+
+	depth = bench_tree_depth_get(&cmd_core);
+	(void)snprintf(params, sizeof(params), "\"order\":\"%s\",\"commands\":%u,\"depth\":%u,",
+		b_random ? "random" : "sorted", n_cmds, depth);
+
+	BENCH_RUN(p_bench, iter, ns,
+		(void)cmd_core_key_find(&cmd_core,
+			p_names->p_long + p_names->seq[iter & (BENCH_SEQ_SIZE - 1)] * BENCH_NAME_SIZE,
+			&cmd_data));
+	bench_use(cmd_data.help);
+	bench_result(p_bench, "key_find_hit_long", params, iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		(void)cmd_core_key_find(&cmd_core,
+			p_names->p_short + p_names->seq[iter & (BENCH_SEQ_SIZE - 1)] * BENCH_NAME_SIZE,
+			&cmd_data));
+	bench_use(cmd_data.help);
+	bench_result(p_bench, "key_find_hit_short", params, iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		(void)cmd_core_key_find(&cmd_core,
+			p_names->p_miss + (iter & (BENCH_SEQ_SIZE - 1)) * BENCH_NAME_SIZE,
+			&cmd_data));
+	bench_result(p_bench, "key_find_miss", params, iter, ns);
+
+	/* "help" - the printout recurses along the tree */
+	if (depth > BENCH_PRINT_DEPTH_MAX)
+	{
+		bench_skipped(p_bench, "help_print", params, "tree too deep");
+	}
+	else
+	{
+		BENCH_RUN(p_bench, iter, ns,
+			cmd_core_tree_print__file(IFX_NULL, cmd_core.p_root, CLI_USER_MASK_MISC,
+				&out_size, p_bench->p_null));
+		bench_result(p_bench, "help_print", params, iter, ns);
+	}
+
+BENCH_END:
+	free(cmd_core.p_node_array);
+	bench_names_free(p_names);
+}
+
+/**
+   Argument preprocessing, the copy of the template is included
+*/
+static void bench_preprocess(
+	struct bench_s *p_bench)
+{
+	static const char cmd_line[] = "   set_value    1   0x20\t  abc    def   ";
+	static const char prefix_line[] = "CLI_set_value 1 0x20 abc def";
+	char buf[sizeof(cmd_line)];
+	unsigned long long iter, ns;
+	char *p;
+
+	BENCH_RUN(p_bench, iter, ns,
+		clios_memcpy(buf, cmd_line, sizeof(cmd_line));
+		p = remove_whitespaces(buf);
+		bench_use(p));
+	bench_result(p_bench, "remove_whitespaces", "\"length\":40,", iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		clios_memcpy(buf, prefix_line, sizeof(prefix_line));
+		p = remove_prefix(buf, "CLI_", 3);
+		bench_use(p));
+	bench_result(p_bench, "remove_prefix", "\"length\":28,", iter, ns);
+}
+
+/**
+   cli_sscanf versus sscanf
+*/
+static void bench_sscanf(
+	struct bench_s *p_bench)
+{
+	static const char scalar_line[] = "-12345 4000000000 0xdeadbeef";
+	static const char array_line[] = "1 2 3 4 5 6 7 8";
+	unsigned long long iter, ns;
+	int v32[8];
+	unsigned int u32 = 0, x32 = 0;
+	unsigned char u8[8];
+	int n = 0;
+
+	BENCH_RUN(p_bench, iter, ns,
+		n += cli_sscanf(scalar_line, "%d %u %x", &v32[0], &u32, &x32));
+	bench_result(p_bench, "cli_sscanf", "\"format\":\"%d %u %x\",", iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		n += sscanf(scalar_line, "%d %u %x", &v32[0], &u32, &x32));
+	bench_result(p_bench, "libc_sscanf", "\"format\":\"%d %u %x\",", iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		n += cli_sscanf(array_line, "%d[8]", v32));
+	bench_result(p_bench, "cli_sscanf", "\"format\":\"%d[8]\",", iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		n += sscanf(array_line, "%d %d %d %d %d %d %d %d",
+			&v32[0], &v32[1], &v32[2], &v32[3], &v32[4], &v32[5], &v32[6], &v32[7]));
+	bench_result(p_bench, "libc_sscanf", "\"format\":\"%d[8]\",", iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		n += cli_sscanf(array_line, "%bu[8]", u8));
+	bench_result(p_bench, "cli_sscanf", "\"format\":\"%bu[8]\",", iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		n += sscanf(array_line, "%hhu %hhu %hhu %hhu %hhu %hhu %hhu %hhu",
+			&u8[0], &u8[1], &u8[2], &u8[3], &u8[4], &u8[5], &u8[6], &u8[7]));
+	bench_result(p_bench, "libc_sscanf", "\"format\":\"%bu[8]\",", iter, ns);
+
+	bench_sink += n;
+}
+
+#if (CLI_SUPPORT_OUT_BUILDER == 1)
+/**
+   Table dump, one row per operation: index, address, value, counter, name.
+   printf path versus output builder, to /dev/null and into a buffer.
+*/
+static void bench_table(
+	struct bench_s *p_bench)
+{
+	static const struct cli_out_column_s cols[] = {{6, 1}, {10, 0}, {8, 0}, {12, 1}, {0, 0}};
+	static const char *names[4] = {"rx_packets", "tx_packets", "rx_errors", "tx_drops"};
+	struct cli_out_builder_s builder;
+	unsigned long long iter, ns;
+	char buf[4096];
+	unsigned int len = 0, row;
+	int n = 0;
+
+	BENCH_RUN(p_bench, iter, ns,
+		row = (unsigned int)iter;
+		n += fprintf(p_bench->p_null, "%6u 0x%08x %08x %12llu %s" CLI_CRLF,
+			row, 0x40000000U + row * 4, row * 2654435761U,
+			(unsigned long long)row * 1000003ULL, names[row & 3]));
+	bench_result(p_bench, "table_row_fprintf", "\"target\":\"file\",", iter, ns);
+
+	(void)cli_out_builder_init__file(&builder, (clios_file_io_t *)p_bench->p_null);
+	cli_out_table_set(&builder, cols, 5);
+	BENCH_RUN(p_bench, iter, ns,
+		row = (unsigned int)iter;
+		cli_out_row_start(&builder);
+		cli_out_dec(&builder, row, 0);
+		cli_out_cell_end(&builder);
+		cli_out_str(&builder, "0x");
+		cli_out_hex32(&builder, 0x40000000U + row * 4);
+		cli_out_cell_end(&builder);
+		cli_out_hex32(&builder, row * 2654435761U);
+		cli_out_cell_end(&builder);
+		cli_out_dec(&builder, (unsigned long long)row * 1000003ULL, 0);
+		cli_out_cell_end(&builder);
+		cli_out_str(&builder, names[row & 3]);
+		cli_out_row_end(&builder));
+	n += cli_out_builder_finish(&builder);
+	bench_result(p_bench, "table_row_builder", "\"target\":\"file\",", iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		row = (unsigned int)iter;
+		if (len > sizeof(buf) - 128)
+			len = 0;
+		len += (unsigned int)snprintf(buf + len, sizeof(buf) - len,
+			"%6u 0x%08x %08x %12llu %s" CLI_CRLF,
+			row, 0x40000000U + row * 4, row * 2654435761U,
+			(unsigned long long)row * 1000003ULL, names[row & 3]));
+	bench_result(p_bench, "table_row_snprintf", "\"target\":\"buffer\",", iter, ns);
+
+	(void)cli_out_builder_init__buffer(&builder, buf, sizeof(buf));
+	cli_out_table_set(&builder, cols, 5);
+	BENCH_RUN(p_bench, iter, ns,
+		row = (unsigned int)iter;
+		if (builder.len > sizeof(buf) - 128)
+			builder.len = 0;
+		cli_out_row_start(&builder);
+		cli_out_dec(&builder, row, 0);
+		cli_out_cell_end(&builder);
+		cli_out_str(&builder, "0x");
+		cli_out_hex32(&builder, 0x40000000U + row * 4);
+		cli_out_cell_end(&builder);
+		cli_out_hex32(&builder, row * 2654435761U);
+		cli_out_cell_end(&builder);
+		cli_out_dec(&builder, (unsigned long long)row * 1000003ULL, 0);
+		cli_out_cell_end(&builder);
+		cli_out_str(&builder, names[row & 3]);
+		cli_out_row_end(&builder));
+	n += cli_out_builder_finish(&builder);
+	bench_result(p_bench, "table_row_builder", "\"target\":\"buffer\",", iter, ns);
+
+	bench_sink += n + (int)len;
+}
+#endif	/* #if (CLI_SUPPORT_OUT_BUILDER == 1) */
+
+static int bench_cmd_register(
+	struct cli_core_context_s *p_core_ctx,
+	struct bench_names_s *p_names)
+{
+	unsigned int i, idx;
+	int ret = IFX_SUCCESS;
+
+	for (i = 0; (i < p_names->n_cmds) && (ret == IFX_SUCCESS); i++)
+	{
+		idx = p_names->p_order[i];
+		ret = cli_core_key_add__file(p_core_ctx, CLI_USER_MASK_MISC,
+			p_names->p_short + idx * BENCH_NAME_SIZE,
+			p_names->p_long + idx * BENCH_NAME_SIZE,
+			bench_cmd__file);
+	}
+
+	return ret;
+}
+
+/**
+   End-to-end execution via the file API (with the enabled statistics
+   and trace), the output goes to /dev/null
+*/
+static void bench_exec(
+	struct bench_s *p_bench)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct bench_names_s *p_names;
+	unsigned long long iter, ns;
+	char cmd[BENCH_NAME_SIZE], arg[32];
+	char params[64];
+	unsigned int idx;
+
+	(void)snprintf(params, sizeof(params), "\"commands\":%u,", BENCH_EXEC_COMMANDS);
+
+	p_names = bench_names_create(BENCH_EXEC_COMMANDS, 1, p_bench->seed);
+	if (p_names == IFX_NULL)
+	{
+		bench_skipped(p_bench, "exec", params, "no memory");
+		return;
+	}
+
+	if ((cli_core_init(&p_core_ctx, cli_cmd_core_out_mode_file, IFX_NULL) != IFX_SUCCESS) ||
+	    (bench_cmd_register(p_core_ctx, p_names) != IFX_SUCCESS) ||
+	    (cli_core_cfg_mode_cmd_reg(p_core_ctx) != IFX_SUCCESS) ||
+	    (bench_cmd_register(p_core_ctx, p_names) != IFX_SUCCESS) ||
+	    (cli_core_cfg_mode_active(p_core_ctx) != IFX_SUCCESS))
+	{
+		bench_skipped(p_bench, "exec", params, "core setup failed");
+		goto BENCH_END;
+	}
+
+	/* the command and the arguments are modified in place */
+	BENCH_RUN(p_bench, iter, ns,
+		idx = p_names->seq[iter & (BENCH_SEQ_SIZE - 1)];
+		clios_memcpy(cmd, p_names->p_long + idx * BENCH_NAME_SIZE, BENCH_NAME_SIZE);
+		clios_strcpy(arg, " 1  2 3 ");
+		(void)cli_core_cmd_arg_exec__file(p_core_ctx, cmd, arg,
+			(clios_file_io_t *)p_bench->p_null));
+	bench_result(p_bench, "exec", params, iter, ns);
+
+	BENCH_RUN(p_bench, iter, ns,
+		idx = p_names->seq[iter & (BENCH_SEQ_SIZE - 1)];
+		clios_memcpy(cmd, p_names->p_short + idx * BENCH_NAME_SIZE, BENCH_NAME_SIZE);
+		clios_strcpy(arg, "-h");
+		(void)cli_core_cmd_arg_exec__file(p_core_ctx, cmd, arg,
+			(clios_file_io_t *)p_bench->p_null));
+	bench_result(p_bench, "exec_help", params, iter, ns);
+
+BENCH_END:
+	if (p_core_ctx != IFX_NULL)
+		(void)cli_core_release(&p_core_ctx, cli_cmd_core_out_mode_file);
+	bench_names_free(p_names);
+}
+
+static void bench_usage(void)
+{
+	(void)fprintf(stderr,
+		"usage: cli_bench [-n <n>[,<n>...]] [-t <min time ms>] [-l <setup limit ms>]" CLI_CRLF
+		"                 [-s <seed>] [-o <file>]" CLI_CRLF
+		"   -n  command counts of the key lookup cases (default 10,1000,10000,100000)" CLI_CRLF
+		"   -t  minimum run time per case (default 200 ms)" CLI_CRLF
+		"   -l  setup time limit per case (default 10000 ms)" CLI_CRLF
+		"   -s  seed of the key sequences (default 1)" CLI_CRLF
+		"   -o  JSON output file (default stdout)" CLI_CRLF);
+}
+
+int main(int argc, char *argv[])
+{
+	struct bench_s bench;
+	unsigned int sizes[BENCH_MAX_SIZES] = {10, 1000, 10000, 100000};
+	unsigned int n_sizes = 4, i;
+	const char *p_out_name = IFX_NULL;
+	char *p, *p_end;
+
+	clios_memset(&bench, 0x00, sizeof(bench));
+	bench.min_time_ns = 200ULL * 1000000ULL;
+	bench.setup_limit_ns = 10000ULL * 1000000ULL;
+	bench.seed = 1;
+
+	for (i = 1; i < (unsigned int)argc; i++)
+	{
+		if ((argv[i][0] != '-') || (argv[i][1] == '\0') || (argv[i][2] != '\0') ||
+		    (i + 1 >= (unsigned int)argc))
+		{
+			bench_usage();
+			return -1;
+		}
+
+		p = argv[++i];
+		switch (argv[i - 1][1])
+		{
+		case 'n':
+			for (n_sizes = 0; (*p != '\0') && (n_sizes < BENCH_MAX_SIZES); p = p_end)
+			{
+				sizes[n_sizes] = (unsigned int)strtoul(p, &p_end, 0);
+				if ((p_end == p) || (sizes[n_sizes] == 0) || (sizes[n_sizes] > 9999999))
+				{
+					bench_usage();
+					return -1;
+				}
+				n_sizes++;
+				if (*p_end == ',')
+					p_end++;
+			}
+			break;
+		case 't':
+			bench.min_time_ns = strtoull(p, IFX_NULL, 0) * 1000000ULL;
+			break;
+		case 'l':
+			bench.setup_limit_ns = strtoull(p, IFX_NULL, 0) * 1000000ULL;
+			break;
+		case 's':
+			bench.seed = (unsigned int)strtoul(p, IFX_NULL, 0);
+			break;
+		case 'o':
+			p_out_name = p;
+			break;
+		default:
+			bench_usage();
+			return -1;
+		}
+	}
+	/* xorshift requires a non zero state */
+	if (bench.seed == 0)
+		bench.seed = 1;
+
+	bench.p_null = fopen("/dev/null", "w");
+	if (bench.p_null == IFX_NULL)
+	{
+		(void)fprintf(stderr, "cli_bench: cannot open /dev/null" CLI_CRLF);
+		return -1;
+	}
+
+	bench.p_out = (p_out_name != IFX_NULL) ? fopen(p_out_name, "w") : stdout;
+	if (bench.p_out == IFX_NULL)
+	{
+		(void)fprintf(stderr, "cli_bench: cannot open %s" CLI_CRLF, p_out_name);
+		(void)fclose(bench.p_null);
+		return -1;
+	}
+
+	(void)fprintf(bench.p_out,
+		"{\n  \"tool\":\"cli_bench\",\n  \"seed\":%u,\n  \"min_time_ms\":%llu,\n"
+		"  \"stats\":%d,\n  \"trace\":%d,\n  \"results\":[",
+		bench.seed, bench.min_time_ns / 1000000ULL,
+		CLI_SUPPORT_STATS, CLI_SUPPORT_TRACE);
+
+	for (i = 0; i < n_sizes; i++)
+	{
+		bench_key_find(&bench, sizes[i], 0);
+		bench_key_find(&bench, sizes[i], 1);
+	}
+	bench_preprocess(&bench);
+	bench_sscanf(&bench);
+#if (CLI_SUPPORT_OUT_BUILDER == 1)
+	bench_table(&bench);
+#endif
+	bench_exec(&bench);
+
+	(void)fprintf(bench.p_out, "\n  ]\n}\n");
+
+	if (bench.p_out != stdout)
+		(void)fclose(bench.p_out);
+	(void)fclose(bench.p_null);
+
+	return (bench_sink == -1) ? 1 : 0;
+}
+
+#else	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+
+int main(void)
+{
+	(void)fprintf(stderr, "cli_bench: requires CLI_SUPPORT_FILE_OUT" CLI_CRLF);
+	return -1;
+}
+
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
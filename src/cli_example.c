@@ -49,6 +49,8 @@ static struct dummy_cli_fct_data_s dummy_cli_fct_data[4] =
 	{3, "user data B"}
 };
 
+static struct cli_core_context_s *p_glb_core_ctx = IFX_NULL;
+
 #if (CLI_SUPPORT_FILE_OUT == 1)
 static int dummy_my_function_0__file(
 	void *p_ctx,
@@ -77,6 +79,18 @@ static int dummy_my_function_0__file(
 	return ret;
 }
 
+/* usage answered by the CLI core (see command_register__file) */
+static const struct cli_cmd_meta_s dummy_my_function_1_meta =
+{
+	"Input Parameter" CLI_CRLF
+	"- int value" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF CLI_CRLF,
+	"[<value>]",
+	0
+};
+
 static int dummy_my_function_1__file(
 	void *p_ctx,
 	const char *p_cmd,
@@ -84,9 +98,21 @@ static int dummy_my_function_1__file(
 {
 	int ret = 0;
 
+	ret = clios_fprintf(p_file,
+		"Dummy CLI Call 1" CLI_CRLF);
+
+	return ret;
+}
+
+static int group_function_0__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_file)
+{
+	int ret = 0;
 #ifndef CLI_DEBUG_DISABLE
 	static const char USAGE[] =
-		"Long Form: my_function_1" CLI_CRLF "Short Form: mf1" CLI_CRLF
+		"Long Form: group_function_0" CLI_CRLF "Short Form: gf0" CLI_CRLF
 		CLI_CRLF
 		"Input Parameter" CLI_CRLF
 		CLI_CRLF
@@ -100,20 +126,21 @@ static int dummy_my_function_1__file(
 		return ret;
 
 	ret = clios_fprintf(p_file,
-		"Dummy CLI Call 1" CLI_CRLF);
+		"Dummy CLI Call Group 0" CLI_CRLF);
 
 	return ret;
 }
 
-static int group_function_0__file(
+static int group_function_1__file(
 	void *p_ctx,
 	const char *p_cmd,
 	clios_file_io_t *p_file)
 {
 	int ret = 0;
+
 #ifndef CLI_DEBUG_DISABLE
 	static const char USAGE[] =
-		"Long Form: group_function_0" CLI_CRLF "Short Form: gf0" CLI_CRLF
+		"Long Form: group_function_1" CLI_CRLF "Short Form: gf1" CLI_CRLF
 		CLI_CRLF
 		"Input Parameter" CLI_CRLF
 		CLI_CRLF
@@ -127,23 +154,26 @@ static int group_function_0__file(
 		return ret;
 
 	ret = clios_fprintf(p_file,
-		"Dummy CLI Call Group 0" CLI_CRLF);
+		"Dummy CLI Call Group 1" CLI_CRLF);
 
 	return ret;
 }
 
-static int group_function_1__file(
+/* send the arguments as event, used by the load generator (cli_loadgen) */
+static int dummy_my_event_send__file(
 	void *p_ctx,
 	const char *p_cmd,
 	clios_file_io_t *p_file)
 {
 	int ret = 0;
+	char event[128];
 
 #ifndef CLI_DEBUG_DISABLE
 	static const char USAGE[] =
-		"Long Form: group_function_1" CLI_CRLF "Short Form: gf1" CLI_CRLF
+		"Long Form: my_event_send" CLI_CRLF "Short Form: mes" CLI_CRLF
 		CLI_CRLF
 		"Input Parameter" CLI_CRLF
+		"- char event[128]" CLI_CRLF
 		CLI_CRLF
 		"Output Parameter" CLI_CRLF
 		"- int errorcode" CLI_CRLF CLI_CRLF;
@@ -154,16 +184,47 @@ static int group_function_1__file(
 	if ((ret = cli_check_help__file(p_cmd, USAGE, p_file)) > 0)
 		return ret;
 
-	ret = clios_fprintf(p_file,
-		"Dummy CLI Call Group 1" CLI_CRLF);
+	clios_snprintf(event, sizeof(event), "%s", p_cmd);
+	ret = cli_user_if_event(p_glb_core_ctx, event);
 
-	return ret;
+	return clios_fprintf(p_file, "errorcode=%d" CLI_CRLF, ret);
+}
+
+/* send the arguments as dump, used by the load generator (cli_loadgen) */
+static int dummy_my_dump_send__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_file)
+{
+	int ret = 0;
+	char dump[128];
+
+#ifndef CLI_DEBUG_DISABLE
+	static const char USAGE[] =
+		"Long Form: my_dump_send" CLI_CRLF "Short Form: mds" CLI_CRLF
+		CLI_CRLF
+		"Input Parameter" CLI_CRLF
+		"- char dump[128]" CLI_CRLF
+		CLI_CRLF
+		"Output Parameter" CLI_CRLF
+		"- int errorcode" CLI_CRLF CLI_CRLF;
+#else
+#undef USAGE
+#define USAGE ""
+#endif
+	if ((ret = cli_check_help__file(p_cmd, USAGE, p_file)) > 0)
+		return ret;
+
+	clios_snprintf(dump, sizeof(dump), "%s", p_cmd);
+	ret = cli_user_if_dump(p_glb_core_ctx, dump);
+
+	return clios_fprintf(p_file, "errorcode=%d" CLI_CRLF, ret);
 }
 
 #endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
 
 /*
-   Register 2 dummy commands for testing
+   Register 4 dummy commands for testing
 */
 static int command_register__file(
 	struct cli_core_context_s *p_core_ctx)
@@ -171,7 +232,9 @@ static int command_register__file(
 	unsigned int group_mask = 0;
 
 	(void)cli_core_key_add__file(p_core_ctx, group_mask, "mf0", "my_function_0", dummy_my_function_0__file);
-	(void)cli_core_key_add__file(p_core_ctx, group_mask, "mf1", "my_function_1", dummy_my_function_1__file);
+	(void)cli_core_key_add_ext__file(p_core_ctx, "mf1", "my_function_1", &dummy_my_function_1_meta, dummy_my_function_1__file);
+	(void)cli_core_key_add__file(p_core_ctx, group_mask, "mes", "my_event_send", dummy_my_event_send__file);
+	(void)cli_core_key_add__file(p_core_ctx, group_mask, "mds", "my_dump_send", dummy_my_dump_send__file);
 
 	return 0;
 }
@@ -212,8 +275,6 @@ struct cli_group_key_entry_s cmd_group_key_list[] =
 	{IFX_NULL, 0xFF}
 };
 
-static struct cli_core_context_s *p_glb_core_ctx = IFX_NULL;
-
 #if (CLI_SUPPORT_PIPE == 1)
 static struct cli_pipe_context_s *p_cli_pipe_context = IFX_NULL;
 #endif
@@ -0,0 +1,703 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - Help Text Packer.
+
+   Build time tool, generates the compressed help store
+   (see \ref cli_core_help_store_set) from a usage text file as C source.
+
+   Input format: each entry starts with a line "@<long command name>",
+   the following lines up to the next entry are the usage text of the
+   command. A text line starting with '@' is given as "@@".
+
+   Usage:
+      cli_help_pack [-s <symbol>] [-b <block size>] [-d <dictionary size>]
+                    [-c] <usage text file> <output C file>
+
+   - -s  name of the generated struct cli_help_store_s (default cli_help_store)
+   - -b  uncompressed block size (default 3072)
+   - -d  max size of the shared dictionary (default 1024)
+   - -c  line end "\r\n" instead of "\n"
+
+\remarks
+   The generated store is decompressed again and compared with the input.
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "lib_cli_help_store.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if (CLI_SUPPORT_HELP_STORE == 1)
+
+/** max length of a text / block (16 bit offsets of the index) */
+#define PACK_LEN_MAX	65535
+/** size of the match hash table */
+#define PACK_HASH_SIZE	4096
+/** max number of candidates checked per position */
+#define PACK_CHAIN_MAX	256
+
+/** Usage text of a command */
+struct pack_entry_s
+{
+	/** long command name */
+	char *p_name;
+	/** usage text */
+	char *p_text;
+	/** length of the text */
+	unsigned int len;
+	/** index entry */
+	struct cli_help_store_entry_s idx;
+};
+
+/** Line of the dictionary statistics */
+struct pack_line_s
+{
+	/** line (incl. line end), points into a text */
+	const char *p_line;
+	/** length of the line */
+	unsigned int len;
+	/** number of occurrences */
+	unsigned int count;
+	/** line is part of the dictionary */
+	int b_dict;
+};
+
+/** Packer state */
+struct pack_s
+{
+	/** entries */
+	struct pack_entry_s *p_entries;
+	/** number of entries */
+	unsigned int n_entries;
+	/** shared dictionary */
+	unsigned char *p_dict;
+	/** length of the dictionary */
+	unsigned int dict_len;
+	/** compressed blocks */
+	unsigned char *p_data;
+	/** size of the compressed blocks */
+	unsigned int data_size;
+	/** allocated size of the compressed blocks */
+	unsigned int data_max;
+	/** block table */
+	struct cli_help_store_block_s *p_blocks;
+	/** number of blocks */
+	unsigned int n_blocks;
+	/** max decompressed block length */
+	unsigned int block_len_max;
+};
+
+static void pack_usage(void)
+{
+	(void)fprintf(stderr,
+		"usage: cli_help_pack [-s <symbol>] [-b <block size>] [-d <dictionary size>]\n"
+		"                     [-c] <usage text file> <output C file>\n"
+		"   -s  name of the generated help store (default cli_help_store)\n"
+		"   -b  uncompressed block size (default 3072)\n"
+		"   -d  max size of the shared dictionary (default 1024)\n"
+		"   -c  line end \"\\r\\n\"\n");
+}
+
+static void *pack_alloc(
+	size_t size)
+{
+	void *p = calloc(1, size ? size : 1);
+
+	if (p == IFX_NULL)
+	{
+		(void)fprintf(stderr, "cli_help_pack: no memory\n");
+		exit(-1);
+	}
+	return p;
+}
+
+/** Append a line to the text of the current entry */
+static void pack_text_append(
+	struct pack_entry_s *p_entry,
+	const char *p_line,
+	unsigned int len,
+	int b_crlf)
+{
+	p_entry->p_text = (char *)realloc(p_entry->p_text, p_entry->len + len + 2);
+	if (p_entry->p_text == IFX_NULL)
+	{
+		(void)fprintf(stderr, "cli_help_pack: no memory\n");
+		exit(-1);
+	}
+	memcpy(p_entry->p_text + p_entry->len, p_line, len);
+	p_entry->len += len;
+	if (b_crlf)
+		p_entry->p_text[p_entry->len++] = '\r';
+	p_entry->p_text[p_entry->len++] = '\n';
+}
+
+/** Read the usage text file */
+static int pack_read(
+	struct pack_s *p_pack,
+	const char *p_path,
+	int b_crlf)
+{
+	FILE *p_file;
+	char line[4096];
+	unsigned int len, n_max = 0;
+	struct pack_entry_s *p_entry = IFX_NULL;
+
+	p_file = fopen(p_path, "r");
+	if (p_file == IFX_NULL)
+	{
+		(void)fprintf(stderr, "cli_help_pack: cannot open %s\n", p_path);
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), p_file) != IFX_NULL)
+	{
+		len = (unsigned int)strlen(line);
+		if ((len > 0) && (line[len - 1] == '\n'))
+			line[--len] = '\0';
+		else if (!feof(p_file))
+		{
+			(void)fprintf(stderr, "cli_help_pack: line too long\n");
+			(void)fclose(p_file);
+			return -1;
+		}
+		if ((len > 0) && (line[len - 1] == '\r'))
+			line[--len] = '\0';
+
+		if ((line[0] == '@') && (line[1] != '@'))
+		{
+			if (p_pack->n_entries == n_max)
+			{
+				n_max = n_max ? n_max * 2 : 256;
+				p_pack->p_entries = (struct pack_entry_s *)realloc(
+					p_pack->p_entries, n_max * sizeof(struct pack_entry_s));
+				if (p_pack->p_entries == IFX_NULL)
+				{
+					(void)fprintf(stderr, "cli_help_pack: no memory\n");
+					exit(-1);
+				}
+			}
+			p_entry = &p_pack->p_entries[p_pack->n_entries++];
+			memset(p_entry, 0x00, sizeof(*p_entry));
+			p_entry->p_name = strdup(line + 1);
+			continue;
+		}
+		if (p_entry == IFX_NULL)
+		{
+			if (len == 0)
+				continue;
+			(void)fprintf(stderr, "cli_help_pack: text without command name\n");
+			(void)fclose(p_file);
+			return -1;
+		}
+		if (line[0] == '@')
+			pack_text_append(p_entry, line + 1, len - 1, b_crlf);
+		else
+			pack_text_append(p_entry, line, len, b_crlf);
+		if (p_entry->len > PACK_LEN_MAX)
+		{
+			(void)fprintf(stderr, "cli_help_pack: text of %s too long\n", p_entry->p_name);
+			(void)fclose(p_file);
+			return -1;
+		}
+	}
+	(void)fclose(p_file);
+
+	return 0;
+}
+
+static int pack_line_cmp(
+	const void *p_a,
+	const void *p_b)
+{
+	const struct pack_line_s *a = (const struct pack_line_s *)p_a;
+	const struct pack_line_s *b = (const struct pack_line_s *)p_b;
+	unsigned int n = (a->len < b->len) ? a->len : b->len;
+	int ret = memcmp(a->p_line, b->p_line, n);
+
+	if (ret != 0)
+		return ret;
+	return (a->len < b->len) ? -1 : (a->len > b->len) ? 1 : 0;
+}
+
+static int pack_line_score_cmp(
+	const void *p_a,
+	const void *p_b)
+{
+	const struct pack_line_s *a = (const struct pack_line_s *)p_a;
+	const struct pack_line_s *b = (const struct pack_line_s *)p_b;
+	unsigned long sa = (unsigned long)(a->count - 1) * a->len;
+	unsigned long sb = (unsigned long)(b->count - 1) * b->len;
+
+	return (sa < sb) ? 1 : (sa > sb) ? -1 : 0;
+}
+
+/** Build the shared dictionary from the most frequent lines */
+static void pack_dict_build(
+	struct pack_s *p_pack,
+	unsigned int dict_max)
+{
+	struct pack_line_s *p_lines;
+	unsigned int i, n = 0, n_max = 0, n_uniq = 0, pos, start, len;
+
+	for (i = 0; i < p_pack->n_entries; i++)
+		n_max += p_pack->p_entries[i].len;
+	p_lines = (struct pack_line_s *)pack_alloc((n_max + 1) * sizeof(struct pack_line_s));
+
+	/* collect all lines */
+	for (i = 0; i < p_pack->n_entries; i++)
+	{
+		for (start = 0, pos = 0; pos < p_pack->p_entries[i].len; pos++)
+		{
+			if (p_pack->p_entries[i].p_text[pos] != '\n')
+				continue;
+			p_lines[n].p_line = p_pack->p_entries[i].p_text + start;
+			p_lines[n].len = pos + 1 - start;
+			p_lines[n].count = 1;
+			p_lines[n].b_dict = 0;
+			n++;
+			start = pos + 1;
+		}
+	}
+
+	/* count the duplicates */
+	qsort(p_lines, n, sizeof(struct pack_line_s), pack_line_cmp);
+	for (i = 0; i < n; i++)
+	{
+		if ((n_uniq > 0) && (pack_line_cmp(&p_lines[n_uniq - 1], &p_lines[i]) == 0))
+			p_lines[n_uniq - 1].count++;
+		else
+			p_lines[n_uniq++] = p_lines[i];
+	}
+
+	/* most valuable lines at the end (next to the block) */
+	qsort(p_lines, n_uniq, sizeof(struct pack_line_s), pack_line_score_cmp);
+	p_pack->p_dict = (unsigned char *)pack_alloc(dict_max + 1);
+	len = 0;
+	for (i = 0; i < n_uniq; i++)
+	{
+		if (p_lines[i].count < 2)
+			break;
+		if ((p_lines[i].len >= CLI_HELP_STORE_MATCH_MIN) &&
+		    (len + p_lines[i].len <= dict_max))
+		{
+			p_lines[i].b_dict = 1;
+			len += p_lines[i].len;
+		}
+	}
+	p_pack->dict_len = len;
+	for (i = 0; (i < n_uniq) && (len > 0); i++)
+	{
+		if (p_lines[i].b_dict)
+		{
+			len -= p_lines[i].len;
+			memcpy(p_pack->p_dict + len, p_lines[i].p_line, p_lines[i].len);
+		}
+	}
+
+	free(p_lines);
+}
+
+static unsigned int pack_hash3(
+	const unsigned char *p)
+{
+	return (((unsigned int)p[0] << 8) ^ ((unsigned int)p[1] << 4) ^ p[2]) & (PACK_HASH_SIZE - 1);
+}
+
+/** Append to the compressed data */
+static void pack_data_put(
+	struct pack_s *p_pack,
+	unsigned char c)
+{
+	if (p_pack->data_size == p_pack->data_max)
+	{
+		p_pack->data_max = p_pack->data_max ? p_pack->data_max * 2 : 65536;
+		p_pack->p_data = (unsigned char *)realloc(p_pack->p_data, p_pack->data_max);
+		if (p_pack->p_data == IFX_NULL)
+		{
+			(void)fprintf(stderr, "cli_help_pack: no memory\n");
+			exit(-1);
+		}
+	}
+	p_pack->p_data[p_pack->data_size++] = c;
+}
+
+/** Compress a block (LZSS, the dictionary precedes the block) */
+static void pack_block_compress(
+	struct pack_s *p_pack,
+	const unsigned char *p_block,
+	unsigned int len)
+{
+	unsigned char *p_win;
+	int *p_prev, head[PACK_HASH_SIZE];
+	unsigned int win_len = p_pack->dict_len + len, i, h;
+	unsigned int best_len, best_dist, n, chain, ctrl_pos = 0, n_items = 0;
+	int cand;
+
+	p_win = (unsigned char *)pack_alloc(win_len + 1);
+	p_prev = (int *)pack_alloc((win_len + 1) * sizeof(int));
+	memcpy(p_win, p_pack->p_dict, p_pack->dict_len);
+	memcpy(p_win + p_pack->dict_len, p_block, len);
+	for (i = 0; i < PACK_HASH_SIZE; i++)
+		head[i] = -1;
+
+	for (i = 0; i < win_len; )
+	{
+		/* dictionary: only indexed */
+		if (i < p_pack->dict_len)
+		{
+			if (i + CLI_HELP_STORE_MATCH_MIN <= win_len)
+			{
+				h = pack_hash3(p_win + i);
+				p_prev[i] = head[h];
+				head[h] = (int)i;
+			}
+			i++;
+			continue;
+		}
+
+		if (n_items == 0)
+		{
+			ctrl_pos = p_pack->data_size;
+			pack_data_put(p_pack, 0);
+		}
+
+		best_len = 0;
+		best_dist = 0;
+		if (i + CLI_HELP_STORE_MATCH_MIN <= win_len)
+		{
+			h = pack_hash3(p_win + i);
+			for (cand = head[h], chain = 0;
+			     (cand >= 0) && (chain < PACK_CHAIN_MAX) &&
+			     (i - (unsigned int)cand <= CLI_HELP_STORE_DIST_MAX);
+			     cand = p_prev[cand], chain++)
+			{
+				for (n = 0; (n < CLI_HELP_STORE_MATCH_MAX) && (i + n < win_len) &&
+				     (p_win[(unsigned int)cand + n] == p_win[i + n]); n++)
+					;
+				if (n > best_len)
+				{
+					best_len = n;
+					best_dist = i - (unsigned int)cand;
+					if (n == CLI_HELP_STORE_MATCH_MAX)
+						break;
+				}
+			}
+		}
+
+		if (best_len >= CLI_HELP_STORE_MATCH_MIN)
+		{
+			pack_data_put(p_pack, (unsigned char)(best_dist & 0xFF));
+			pack_data_put(p_pack, (unsigned char)(((best_dist >> 4) & 0xF0) |
+				(best_len - CLI_HELP_STORE_MATCH_MIN)));
+			n = best_len;
+		}
+		else
+		{
+			p_pack->p_data[ctrl_pos] |= (unsigned char)(1 << n_items);
+			pack_data_put(p_pack, p_win[i]);
+			n = 1;
+		}
+		n_items = (n_items + 1) & 0x7;
+
+		/* index the consumed positions */
+		while (n--)
+		{
+			if (i + CLI_HELP_STORE_MATCH_MIN <= win_len)
+			{
+				h = pack_hash3(p_win + i);
+				p_prev[i] = head[h];
+				head[h] = (int)i;
+			}
+			i++;
+		}
+	}
+
+	free(p_prev);
+	free(p_win);
+}
+
+/** Split the texts into blocks and compress them */
+static int pack_blocks_build(
+	struct pack_s *p_pack,
+	unsigned int block_size)
+{
+	unsigned char *p_block;
+	unsigned int i, len = 0;
+
+	p_block = (unsigned char *)pack_alloc(PACK_LEN_MAX + 1);
+	p_pack->p_blocks = (struct cli_help_store_block_s *)pack_alloc(
+		(p_pack->n_entries + 1) * sizeof(struct cli_help_store_block_s));
+
+	for (i = 0; i <= p_pack->n_entries; i++)
+	{
+		if ((i == p_pack->n_entries) ||
+		    ((len > 0) && (len + p_pack->p_entries[i].len > block_size)))
+		{
+			if (len == 0)
+				break;
+			p_pack->p_blocks[p_pack->n_blocks].offset = p_pack->data_size;
+			p_pack->p_blocks[p_pack->n_blocks].len = len;
+			pack_block_compress(p_pack, p_block, len);
+			if (len > p_pack->block_len_max)
+				p_pack->block_len_max = len;
+			p_pack->n_blocks++;
+			len = 0;
+			if (i == p_pack->n_entries)
+				break;
+		}
+		p_pack->p_entries[i].idx.hash = cli_help_store_hash(p_pack->p_entries[i].p_name);
+		p_pack->p_entries[i].idx.block = (unsigned short)p_pack->n_blocks;
+		p_pack->p_entries[i].idx.offset = (unsigned short)len;
+		p_pack->p_entries[i].idx.len = (unsigned short)p_pack->p_entries[i].len;
+		memcpy(p_block + len, p_pack->p_entries[i].p_text, p_pack->p_entries[i].len);
+		len += p_pack->p_entries[i].len;
+	}
+	free(p_block);
+
+	return 0;
+}
+
+static int pack_entry_cmp(
+	const void *p_a,
+	const void *p_b)
+{
+	const struct pack_entry_s *a = (const struct pack_entry_s *)p_a;
+	const struct pack_entry_s *b = (const struct pack_entry_s *)p_b;
+
+	return (a->idx.hash < b->idx.hash) ? -1 : (a->idx.hash > b->idx.hash) ? 1 : 0;
+}
+
+/** Check the generated store: all texts are decompressed and compared */
+static int pack_verify(
+	struct pack_s *p_pack,
+	struct cli_help_store_entry_s *p_idx)
+{
+	struct cli_help_store_s store;
+	char *p_out;
+	unsigned int i;
+
+	store.p_dict = p_pack->p_dict;
+	store.dict_len = p_pack->dict_len;
+	store.p_data = p_pack->p_data;
+	store.data_size = p_pack->data_size;
+	store.p_blocks = p_pack->p_blocks;
+	store.n_blocks = p_pack->n_blocks;
+	store.p_entries = p_idx;
+	store.n_entries = p_pack->n_entries;
+	store.block_len_max = p_pack->block_len_max;
+
+	p_out = (char *)pack_alloc(p_pack->block_len_max + 1);
+	for (i = 0; i < p_pack->n_entries; i++)
+	{
+		if ((cli_help_store_decode(&store, p_idx[i].block, p_out) != IFX_SUCCESS) ||
+		    (memcmp(p_out + p_idx[i].offset, p_pack->p_entries[i].p_text,
+			    p_pack->p_entries[i].len) != 0))
+		{
+			(void)fprintf(stderr, "cli_help_pack: verification of %s failed\n",
+				p_pack->p_entries[i].p_name);
+			free(p_out);
+			return -1;
+		}
+	}
+	free(p_out);
+
+	return 0;
+}
+
+static void pack_bytes_write(
+	FILE *p_file,
+	const unsigned char *p_data,
+	unsigned int len)
+{
+	unsigned int i;
+
+	for (i = 0; i < len; i++)
+		(void)fprintf(p_file, "%s0x%02x,%s", (i % 12) ? " " : "\t", p_data[i],
+			((i % 12) == 11 || (i + 1 == len)) ? "\n" : "");
+	if (len == 0)
+		(void)fprintf(p_file, "\t0x00\n");
+}
+
+/** Write the store as C source */
+static int pack_write(
+	struct pack_s *p_pack,
+	struct cli_help_store_entry_s *p_idx,
+	const char *p_path,
+	const char *p_sym)
+{
+	FILE *p_file;
+	unsigned int i;
+
+	p_file = fopen(p_path, "w");
+	if (p_file == IFX_NULL)
+	{
+		(void)fprintf(stderr, "cli_help_pack: cannot open %s\n", p_path);
+		return -1;
+	}
+
+	(void)fprintf(p_file,
+		"/* generated by cli_help_pack, do not edit */\n"
+		"#include \"ifx_types.h\"\n"
+		"#include \"lib_cli_config.h\"\n"
+		"#include \"lib_cli_core.h\"\n"
+		"#include \"lib_cli_help_store.h\"\n\n");
+
+	(void)fprintf(p_file, "static const unsigned char %s_dict[] =\n{\n", p_sym);
+	pack_bytes_write(p_file, p_pack->p_dict, p_pack->dict_len);
+	(void)fprintf(p_file, "};\n\nstatic const unsigned char %s_data[] =\n{\n", p_sym);
+	pack_bytes_write(p_file, p_pack->p_data, p_pack->data_size);
+
+	(void)fprintf(p_file, "};\n\nstatic const struct cli_help_store_block_s %s_blocks[] =\n{\n", p_sym);
+	for (i = 0; i < p_pack->n_blocks; i++)
+		(void)fprintf(p_file, "\t{%u, %u},\n", p_pack->p_blocks[i].offset, p_pack->p_blocks[i].len);
+	if (p_pack->n_blocks == 0)
+		(void)fprintf(p_file, "\t{0, 0}\n");
+
+	(void)fprintf(p_file, "};\n\nstatic const struct cli_help_store_entry_s %s_entries[] =\n{\n", p_sym);
+	for (i = 0; i < p_pack->n_entries; i++)
+		(void)fprintf(p_file, "\t{0x%08xU, %u, %u, %u},\t/* %s */\n",
+			p_idx[i].hash, p_idx[i].block, p_idx[i].offset, p_idx[i].len,
+			p_pack->p_entries[i].p_name);
+	if (p_pack->n_entries == 0)
+		(void)fprintf(p_file, "\t{0, 0, 0, 0}\n");
+
+	(void)fprintf(p_file,
+		"};\n\nconst struct cli_help_store_s %s =\n{\n"
+		"\t%s_dict, %u,\n\t%s_data, %u,\n\t%s_blocks, %u,\n\t%s_entries, %u,\n\t%u\n};\n",
+		p_sym, p_sym, p_pack->dict_len, p_sym, p_pack->data_size,
+		p_sym, p_pack->n_blocks, p_sym, p_pack->n_entries, p_pack->block_len_max);
+
+	if (fclose(p_file) != 0)
+	{
+		(void)fprintf(stderr, "cli_help_pack: write error %s\n", p_path);
+		return -1;
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	struct pack_s pack;
+	struct cli_help_store_entry_s *p_idx = IFX_NULL;
+	const char *p_sym = "cli_help_store", *p_in = IFX_NULL, *p_out = IFX_NULL;
+	unsigned int block_size = 3072, dict_max = 1024, text_len = 0, i;
+	int b_crlf = 0, ret = -1;
+
+	memset(&pack, 0x00, sizeof(pack));
+
+	for (i = 1; i < (unsigned int)argc; i++)
+	{
+		if (argv[i][0] != '-')
+		{
+			if (p_in == IFX_NULL)
+				p_in = argv[i];
+			else if (p_out == IFX_NULL)
+				p_out = argv[i];
+			else
+				break;
+			continue;
+		}
+		if ((argv[i][1] == 'c') && (argv[i][2] == '\0'))
+		{
+			b_crlf = 1;
+			continue;
+		}
+		if ((argv[i][1] == '\0') || (argv[i][2] != '\0') || (i + 1 >= (unsigned int)argc))
+			break;
+
+		switch (argv[i][1])
+		{
+		case 's':
+			p_sym = argv[++i];
+			continue;
+		case 'b':
+			block_size = (unsigned int)strtoul(argv[++i], IFX_NULL, 0);
+			continue;
+		case 'd':
+			dict_max = (unsigned int)strtoul(argv[++i], IFX_NULL, 0);
+			continue;
+		default:
+			break;
+		}
+		break;
+	}
+	if ((i < (unsigned int)argc) || (p_in == IFX_NULL) || (p_out == IFX_NULL) ||
+	    (block_size == 0) || (block_size > PACK_LEN_MAX) ||
+	    (dict_max > CLI_HELP_STORE_DIST_MAX))
+	{
+		pack_usage();
+		return -1;
+	}
+
+	if (pack_read(&pack, p_in, b_crlf) != 0)
+		goto PACK_END;
+
+	pack_dict_build(&pack, dict_max);
+	if (pack_blocks_build(&pack, block_size) != 0)
+		goto PACK_END;
+
+	/* index sorted by hash, the names must not collide */
+	qsort(pack.p_entries, pack.n_entries, sizeof(struct pack_entry_s), pack_entry_cmp);
+	p_idx = (struct cli_help_store_entry_s *)pack_alloc(
+		(pack.n_entries + 1) * sizeof(struct cli_help_store_entry_s));
+	for (i = 0; i < pack.n_entries; i++)
+	{
+		if ((i > 0) && (pack.p_entries[i].idx.hash == pack.p_entries[i - 1].idx.hash))
+		{
+			(void)fprintf(stderr, "cli_help_pack: %s and %s have the same hash\n",
+				pack.p_entries[i - 1].p_name, pack.p_entries[i].p_name);
+			goto PACK_END;
+		}
+		p_idx[i] = pack.p_entries[i].idx;
+		text_len += pack.p_entries[i].len;
+	}
+
+	if ((pack_verify(&pack, p_idx) != 0) ||
+	    (pack_write(&pack, p_idx, p_out, p_sym) != 0))
+		goto PACK_END;
+
+	(void)printf("cli_help_pack: %u texts, %u bytes -> %u bytes "
+		"(dictionary %u, data %u, %u blocks, index %u)\n",
+		pack.n_entries, text_len,
+		(unsigned int)(pack.dict_len + pack.data_size +
+			pack.n_blocks * sizeof(struct cli_help_store_block_s) +
+			pack.n_entries * sizeof(struct cli_help_store_entry_s)),
+		pack.dict_len, pack.data_size, pack.n_blocks,
+		(unsigned int)(pack.n_entries * sizeof(struct cli_help_store_entry_s)));
+	ret = 0;
+
+PACK_END:
+	for (i = 0; i < pack.n_entries; i++)
+	{
+		free(pack.p_entries[i].p_name);
+		free(pack.p_entries[i].p_text);
+	}
+	free(pack.p_entries);
+	free(pack.p_dict);
+	free(pack.p_data);
+	free(pack.p_blocks);
+	free(p_idx);
+
+	return ret;
+}
+
+#else	/* #if (CLI_SUPPORT_HELP_STORE == 1) */
+
+int main(void)
+{
+	(void)fprintf(stderr, "cli_help_pack: requires CLI_SUPPORT_HELP_STORE\n");
+	return -1;
+}
+
+#endif	/* #if (CLI_SUPPORT_HELP_STORE == 1) */
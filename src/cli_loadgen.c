@@ -0,0 +1,873 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - Pipe Load Generator.
+
+   Drives a running CLI core through the "<name>_<num>_cmd" / "_ack" FIFOs
+   of the pipe interface (see \ref cli_pipe_init) and reports the result
+   as JSON:
+   - throughput, completed / failed / timed out commands
+   - command latency (p50, p99, p999), total and per command of the mix
+   - delivery lag of the events and dumps (FIFOs "_event" and "_dump")
+
+   The clients are distributed round robin over the pipes, the clients of
+   the same pipe are serialized (a pipe handles one command at a time).
+
+   Closed loop: each client sends the next command after the previous one
+   is completed.
+   Open loop: the commands are scheduled with the given total rate, the
+   latency is measured from the scheduled time (includes the queueing).
+
+   Within a command "%t" is replaced by the current time ("<sec>.<usec>",
+   CLOCK_REALTIME). An event / dump containing "ts=<sec>.<usec>" is taken
+   for the lag measurement, for example with the cli_example commands
+   "my_event_send ts=%t" and "my_dump_send ts=%t".
+
+   Usage:
+      cli_loadgen -p <pipe name> [-n <pipes>] [-c <clients>]
+                  [-m <cmd>[:<weight>][,<cmd>[:<weight>]...]]
+                  [-d <duration s>] [-r <rate/s>] [-t <timeout ms>]
+                  [-s <seed>] [-o <file>]
+
+\remarks
+   The transport is encapsulated in loadgen_pipe_exec, a further transport
+   only needs an own exec function.
+   After a timeout the command may still be executed by the CLI and the
+   response is read by the next client of the same pipe.
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_pipe.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <pthread.h>
+
+/** max number of commands of the mix */
+#define LOADGEN_MAX_MIX		16
+/** max length of a command line */
+#define LOADGEN_LINE_SIZE	256
+/** max number of clients */
+#define LOADGEN_MAX_CLIENTS	1024
+/** FIFO path length */
+#define LOADGEN_PATH_SIZE	256
+/** time to wait for late events / dumps after the run [ms] */
+#define LOADGEN_DRAIN_TIME	500
+
+/** Latency samples [us] */
+struct loadgen_samples_s
+{
+	unsigned int *p_val;
+	unsigned int n_val;
+	unsigned int n_max;
+};
+
+/** Command mix entry */
+struct loadgen_cmd_s
+{
+	char line[LOADGEN_LINE_SIZE];
+	unsigned int weight;
+};
+
+/** One pipe (shared by the clients with the same pipe number) */
+struct loadgen_pipe_s
+{
+	pthread_mutex_t lock;
+	char name_cmd[LOADGEN_PATH_SIZE];
+	char name_ack[LOADGEN_PATH_SIZE];
+};
+
+/** Event or dump listener of one pipe */
+struct loadgen_listener_s
+{
+	pthread_t thread;
+	char name[LOADGEN_PATH_SIZE];
+	struct loadgen_s *p_lg;
+	/** messages received */
+	unsigned long long n_msg;
+	/** lag samples */
+	struct loadgen_samples_s lag;
+};
+
+/** Client */
+struct loadgen_client_s
+{
+	pthread_t thread;
+	unsigned int number;
+	unsigned int rand_state;
+	struct loadgen_s *p_lg;
+	struct loadgen_pipe_s *p_pipe;
+	unsigned long long n_sent;
+	unsigned long long n_done;
+	unsigned long long n_error;
+	unsigned long long n_timeout;
+	unsigned long long n_bytes;
+	/** latency samples per mix entry */
+	struct loadgen_samples_s lat[LOADGEN_MAX_MIX];
+};
+
+/** Load generator */
+struct loadgen_s
+{
+	const char *p_pipe_name;
+	unsigned int n_pipes;
+	unsigned int n_clients;
+	unsigned int duration_ms;
+	unsigned int rate;
+	unsigned int timeout_ms;
+	unsigned int seed;
+	struct loadgen_cmd_s mix[LOADGEN_MAX_MIX];
+	unsigned int n_mix;
+	unsigned int weight_sum;
+	/** start / stop time (CLOCK_MONOTONIC) [ns] */
+	unsigned long long start_ns;
+	unsigned long long stop_ns;
+	/** stop flag of the listeners */
+	volatile int b_stop;
+	struct loadgen_pipe_s *p_pipes;
+	struct loadgen_client_s *p_clients;
+	struct loadgen_listener_s *p_events;
+	struct loadgen_listener_s *p_dumps;
+};
+
+static unsigned long long loadgen_time_ns_get(void)
+{
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+
+static unsigned long long loadgen_realtime_us_get(void)
+{
+	struct timespec ts;
+
+	(void)clock_gettime(CLOCK_REALTIME, &ts);
+	return (unsigned long long)ts.tv_sec * 1000000ULL + (unsigned long long)ts.tv_nsec / 1000ULL;
+}
+
+static void loadgen_sleep_until(
+	unsigned long long time_ns)
+{
+	struct timespec ts;
+
+	ts.tv_sec = (time_t)(time_ns / 1000000000ULL);
+	ts.tv_nsec = (long)(time_ns % 1000000000ULL);
+	while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, IFX_NULL) == EINTR)
+		;
+}
+
+/* xorshift32 */
+static unsigned int loadgen_rand(
+	unsigned int *p_state)
+{
+	unsigned int x = *p_state;
+
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*p_state = x;
+
+	return x;
+}
+
+static int loadgen_sample_add(
+	struct loadgen_samples_s *p_samples,
+	unsigned long long value)
+{
+	unsigned int *p_new;
+	unsigned int n_max;
+
+	if (p_samples->n_val == p_samples->n_max)
+	{
+		n_max = (p_samples->n_max == 0) ? 1024 : (p_samples->n_max * 2);
+		p_new = realloc(p_samples->p_val, n_max * sizeof(unsigned int));
+		if (p_new == IFX_NULL)
+			return IFX_ERROR;
+		p_samples->p_val = p_new;
+		p_samples->n_max = n_max;
+	}
+	p_samples->p_val[p_samples->n_val++] =
+		(value > 0xFFFFFFFFULL) ? 0xFFFFFFFFU : (unsigned int)value;
+
+	return IFX_SUCCESS;
+}
+
+static int loadgen_sample_append(
+	struct loadgen_samples_s *p_dst,
+	const struct loadgen_samples_s *p_src)
+{
+	unsigned int i;
+
+	for (i = 0; i < p_src->n_val; i++)
+	{
+		if (loadgen_sample_add(p_dst, p_src->p_val[i]) != IFX_SUCCESS)
+			return IFX_ERROR;
+	}
+
+	return IFX_SUCCESS;
+}
+
+static int loadgen_uint_cmp(
+	const void *p_a,
+	const void *p_b)
+{
+	unsigned int a = *(const unsigned int *)p_a, b = *(const unsigned int *)p_b;
+
+	return (a < b) ? -1 : ((a > b) ? 1 : 0);
+}
+
+/* nearest rank percentile of sorted samples, permille */
+static unsigned int loadgen_percentile(
+	const struct loadgen_samples_s *p_samples,
+	unsigned int permille)
+{
+	unsigned long long rank;
+
+	if (p_samples->n_val == 0)
+		return 0;
+
+	rank = ((unsigned long long)p_samples->n_val * permille + 999) / 1000;
+	if (rank == 0)
+		rank = 1;
+
+	return p_samples->p_val[rank - 1];
+}
+
+static void loadgen_samples_print(
+	FILE *p_out,
+	struct loadgen_samples_s *p_samples)
+{
+	qsort(p_samples->p_val, p_samples->n_val, sizeof(unsigned int), loadgen_uint_cmp);
+
+	(void)fprintf(p_out,
+		"{\"count\":%u,\"min\":%u,\"p50\":%u,\"p99\":%u,\"p999\":%u,\"max\":%u}",
+		p_samples->n_val,
+		(p_samples->n_val != 0) ? p_samples->p_val[0] : 0,
+		loadgen_percentile(p_samples, 500),
+		loadgen_percentile(p_samples, 990),
+		loadgen_percentile(p_samples, 999),
+		(p_samples->n_val != 0) ? p_samples->p_val[p_samples->n_val - 1] : 0);
+}
+
+/* expand "%t" to the current time */
+static void loadgen_line_expand(
+	const char *p_template,
+	char *p_line,
+	unsigned int size)
+{
+	unsigned long long now_us = loadgen_realtime_us_get();
+	unsigned int len = 0;
+	int n;
+
+	while ((*p_template != '\0') && (len + 1 < size))
+	{
+		if ((p_template[0] == '%') && (p_template[1] == 't'))
+		{
+			n = snprintf(p_line + len, size - len, "%llu.%06llu",
+				now_us / 1000000ULL, now_us % 1000000ULL);
+			if ((n < 0) || ((unsigned int)n >= size - len))
+				break;
+			len += (unsigned int)n;
+			p_template += 2;
+			continue;
+		}
+		p_line[len++] = *p_template++;
+	}
+	p_line[len] = '\0';
+}
+
+/* "errorcode=<n>" within the response, 0 if not found */
+static int loadgen_errorcode_get(
+	const char *p_buf)
+{
+	const char *p = strstr(p_buf, "errorcode=");
+
+	if (p == IFX_NULL)
+		return 0;
+
+	return atoi(p + sizeof("errorcode=") - 1);
+}
+
+/**
+   Execute one command via the _cmd / _ack FIFOs of the pipe.
+
+\return
+   number of response bytes
+   -1: transport error
+   -2: timeout
+*/
+static int loadgen_pipe_exec(
+	struct loadgen_pipe_s *p_pipe,
+	const char *p_line,
+	unsigned long long deadline_ns,
+	int *p_errorcode)
+{
+	char buf[4096];
+	struct pollfd pfd;
+	unsigned long long now_ns;
+	int fd_ack, fd_cmd = -1, n, len, total = 0, b_first = 1;
+
+	*p_errorcode = 0;
+
+	/* the read side is opened first - the CLI opens the _ack FIFO blocking */
+	fd_ack = open(p_pipe->name_ack, O_RDONLY | O_NONBLOCK);
+	if (fd_ack < 0)
+		return -1;
+
+	/* the _cmd FIFO can be opened if the pipe thread waits for a command */
+	while (fd_cmd < 0)
+	{
+		fd_cmd = open(p_pipe->name_cmd, O_WRONLY | O_NONBLOCK);
+		if (fd_cmd >= 0)
+			break;
+		if ((errno != ENXIO) && (errno != EINTR))
+		{
+			(void)close(fd_ack);
+			return -1;
+		}
+		if (loadgen_time_ns_get() >= deadline_ns)
+		{
+			(void)close(fd_ack);
+			return -2;
+		}
+		(void)usleep(200);
+	}
+
+	len = (int)strlen(p_line);
+	n = (int)write(fd_cmd, p_line, (size_t)len);
+	(void)close(fd_cmd);
+	if (n != len)
+	{
+		(void)close(fd_ack);
+		return -1;
+	}
+
+	/* read up to EOF, the pipe thread closes the _ack FIFO after the command */
+	pfd.fd = fd_ack;
+	pfd.events = POLLIN;
+	for (;;)
+	{
+		now_ns = loadgen_time_ns_get();
+		if (now_ns >= deadline_ns)
+		{
+			total = -2;
+			break;
+		}
+		n = poll(&pfd, 1, (int)((deadline_ns - now_ns + 999999ULL) / 1000000ULL));
+		if (n < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			total = -1;
+			break;
+		}
+		if (n == 0)
+			continue;
+
+		n = (int)read(fd_ack, buf, sizeof(buf) - 1);
+		if (n < 0)
+		{
+			if ((errno == EAGAIN) || (errno == EINTR))
+				continue;
+			total = -1;
+			break;
+		}
+		if (n == 0)
+			break;
+
+		if (b_first)
+		{
+			buf[n] = '\0';
+			*p_errorcode = loadgen_errorcode_get(buf);
+			b_first = 0;
+		}
+		total += n;
+	}
+	(void)close(fd_ack);
+
+	return total;
+}
+
+static unsigned int loadgen_mix_select(
+	struct loadgen_s *p_lg,
+	unsigned int *p_rand_state)
+{
+	unsigned int i, r = loadgen_rand(p_rand_state) % p_lg->weight_sum;
+
+	for (i = 0; i < p_lg->n_mix - 1; i++)
+	{
+		if (r < p_lg->mix[i].weight)
+			break;
+		r -= p_lg->mix[i].weight;
+	}
+
+	return i;
+}
+
+static void *loadgen_client_thread(
+	void *p_arg)
+{
+	struct loadgen_client_s *p_client = (struct loadgen_client_s *)p_arg;
+	struct loadgen_s *p_lg = p_client->p_lg;
+	char line[LOADGEN_LINE_SIZE + 32];
+	unsigned long long interval_ns = 0, sched_ns, start_ns, now_ns;
+	unsigned int idx;
+	int ret, errorcode;
+
+	/* open loop: the total rate is distributed, the clients are staggered */
+	if (p_lg->rate != 0)
+	{
+		interval_ns = 1000000000ULL * p_lg->n_clients / p_lg->rate;
+		sched_ns = p_lg->start_ns + (1000000000ULL / p_lg->rate) * p_client->number;
+	}
+	else
+	{
+		sched_ns = p_lg->start_ns;
+	}
+
+	for (;;)
+	{
+		if (interval_ns != 0)
+		{
+			if (sched_ns >= p_lg->stop_ns)
+				break;
+			loadgen_sleep_until(sched_ns);
+			start_ns = sched_ns;
+			sched_ns += interval_ns;
+		}
+		else
+		{
+			start_ns = loadgen_time_ns_get();
+			if (start_ns >= p_lg->stop_ns)
+				break;
+		}
+
+		idx = loadgen_mix_select(p_lg, &p_client->rand_state);
+		p_client->n_sent++;
+
+		(void)pthread_mutex_lock(&p_client->p_pipe->lock);
+		loadgen_line_expand(p_lg->mix[idx].line, line, sizeof(line) - 1);
+		(void)strcat(line, "\n");
+		ret = loadgen_pipe_exec(p_client->p_pipe, line,
+			start_ns + (unsigned long long)p_lg->timeout_ms * 1000000ULL, &errorcode);
+		(void)pthread_mutex_unlock(&p_client->p_pipe->lock);
+
+		now_ns = loadgen_time_ns_get();
+		if (ret == -2)
+		{
+			p_client->n_timeout++;
+			continue;
+		}
+		if (ret < 0)
+		{
+			p_client->n_error++;
+			continue;
+		}
+
+		p_client->n_done++;
+		p_client->n_bytes += (unsigned long long)ret;
+		if (errorcode < 0)
+			p_client->n_error++;
+		(void)loadgen_sample_add(&p_client->lat[idx], (now_ns - start_ns) / 1000ULL);
+	}
+
+	return IFX_NULL;
+}
+
+/* take the lag of all "ts=<sec>.<usec>" stamps within the received data */
+static void loadgen_listener_parse(
+	struct loadgen_listener_s *p_listener,
+	char *p_buf)
+{
+	unsigned long long now_us = loadgen_realtime_us_get(), ts_us;
+	unsigned long sec, usec;
+	char *p, *p_end;
+
+	for (p = strchr(p_buf, '\n'); p != IFX_NULL; p = strchr(p + 1, '\n'))
+		p_listener->n_msg++;
+
+	for (p = strstr(p_buf, "ts="); p != IFX_NULL; p = strstr(p, "ts="))
+	{
+		p += 3;
+		sec = strtoul(p, &p_end, 10);
+		if ((p_end == p) || (*p_end != '.'))
+			continue;
+		p = p_end + 1;
+		usec = strtoul(p, &p_end, 10);
+		if (p_end == p)
+			continue;
+		p = p_end;
+		ts_us = (unsigned long long)sec * 1000000ULL + usec;
+		(void)loadgen_sample_add(&p_listener->lag, (now_us > ts_us) ? (now_us - ts_us) : 0);
+	}
+}
+
+static void *loadgen_listener_thread(
+	void *p_arg)
+{
+	struct loadgen_listener_s *p_listener = (struct loadgen_listener_s *)p_arg;
+	char buf[4096];
+	char line[4096];
+	struct pollfd pfd;
+	unsigned int len = 0;
+	char *p_nl;
+	int n;
+
+	/* read / write open: keeps the FIFO open for the (non blocking) writer
+	   of the pipe log thread and avoids EOF between the messages */
+	pfd.fd = open(p_listener->name, O_RDWR | O_NONBLOCK);
+	if (pfd.fd < 0)
+		return IFX_NULL;
+	pfd.events = POLLIN;
+
+	while (!p_listener->p_lg->b_stop)
+	{
+		if (poll(&pfd, 1, 100) <= 0)
+			continue;
+
+		n = (int)read(pfd.fd, buf, sizeof(buf) - 1);
+		if (n <= 0)
+			continue;
+		buf[n] = '\0';
+
+		/* parse complete lines only */
+		if (len + (unsigned int)n >= sizeof(line))
+			len = 0;
+		memcpy(line + len, buf, (size_t)n + 1);
+		len += (unsigned int)n;
+		p_nl = strrchr(line, '\n');
+		if (p_nl == IFX_NULL)
+			continue;
+		*p_nl = '\0';
+		p_listener->n_msg++;
+		loadgen_listener_parse(p_listener, line);
+		len = (unsigned int)strlen(p_nl + 1);
+		memmove(line, p_nl + 1, (size_t)len + 1);
+	}
+	(void)close(pfd.fd);
+
+	return IFX_NULL;
+}
+
+static int loadgen_mix_parse(
+	struct loadgen_s *p_lg,
+	char *p_mix)
+{
+	char *p_entry, *p_tok = IFX_NULL, *p_weight, *p_end;
+	unsigned long weight;
+
+	p_lg->n_mix = 0;
+	p_lg->weight_sum = 0;
+
+	for (p_entry = strtok_r(p_mix, ",", &p_tok); p_entry != IFX_NULL;
+	     p_entry = strtok_r(IFX_NULL, ",", &p_tok))
+	{
+		if (p_lg->n_mix >= LOADGEN_MAX_MIX)
+			return IFX_ERROR;
+
+		weight = 1;
+		p_weight = strrchr(p_entry, ':');
+		if (p_weight != IFX_NULL)
+		{
+			weight = strtoul(p_weight + 1, &p_end, 10);
+			if ((p_end == p_weight + 1) || (*p_end != '\0') || (weight == 0) || (weight > 1000000))
+				return IFX_ERROR;
+			*p_weight = '\0';
+		}
+		if ((*p_entry == '\0') || (strlen(p_entry) >= LOADGEN_LINE_SIZE))
+			return IFX_ERROR;
+
+		(void)snprintf(p_lg->mix[p_lg->n_mix].line, LOADGEN_LINE_SIZE, "%s", p_entry);
+		p_lg->mix[p_lg->n_mix].weight = (unsigned int)weight;
+		p_lg->weight_sum += (unsigned int)weight;
+		p_lg->n_mix++;
+	}
+
+	return (p_lg->n_mix > 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+
+/* escape a command for the JSON output */
+static void loadgen_json_string_print(
+	FILE *p_out,
+	const char *p_str)
+{
+	(void)fputc('"', p_out);
+	for (; *p_str != '\0'; p_str++)
+	{
+		if ((*p_str == '"') || (*p_str == '\\'))
+			(void)fputc('\\', p_out);
+		if ((unsigned char)*p_str >= 0x20)
+			(void)fputc(*p_str, p_out);
+	}
+	(void)fputc('"', p_out);
+}
+
+static void loadgen_report(
+	struct loadgen_s *p_lg,
+	FILE *p_out,
+	unsigned long long run_ns)
+{
+	struct loadgen_samples_s all = {IFX_NULL, 0, 0}, cmd, lag_ev = {IFX_NULL, 0, 0},
+		lag_dump = {IFX_NULL, 0, 0};
+	unsigned long long n_sent = 0, n_done = 0, n_error = 0, n_timeout = 0, n_bytes = 0;
+	unsigned long long n_events = 0, n_dumps = 0;
+	unsigned int c, i;
+
+	for (c = 0; c < p_lg->n_clients; c++)
+	{
+		n_sent += p_lg->p_clients[c].n_sent;
+		n_done += p_lg->p_clients[c].n_done;
+		n_error += p_lg->p_clients[c].n_error;
+		n_timeout += p_lg->p_clients[c].n_timeout;
+		n_bytes += p_lg->p_clients[c].n_bytes;
+		for (i = 0; i < p_lg->n_mix; i++)
+			(void)loadgen_sample_append(&all, &p_lg->p_clients[c].lat[i]);
+	}
+	for (i = 0; i < p_lg->n_pipes; i++)
+	{
+		n_events += p_lg->p_events[i].n_msg;
+		n_dumps += p_lg->p_dumps[i].n_msg;
+		(void)loadgen_sample_append(&lag_ev, &p_lg->p_events[i].lag);
+		(void)loadgen_sample_append(&lag_dump, &p_lg->p_dumps[i].lag);
+	}
+
+	(void)fprintf(p_out,
+		"{\n  \"tool\":\"cli_loadgen\",\n  \"pipe\":");
+	loadgen_json_string_print(p_out, p_lg->p_pipe_name);
+	(void)fprintf(p_out,
+		",\n  \"pipes\":%u,\n  \"clients\":%u,\n  \"mode\":\"%s\",\n  \"rate\":%u,\n"
+		"  \"duration_s\":%.3f,\n  \"timeout_ms\":%u,\n  \"seed\":%u,\n"
+		"  \"sent\":%llu,\n  \"completed\":%llu,\n  \"errors\":%llu,\n  \"timeouts\":%llu,\n"
+		"  \"response_bytes\":%llu,\n  \"throughput_per_s\":%.1f,\n  \"latency_us\":",
+		p_lg->n_pipes, p_lg->n_clients, (p_lg->rate != 0) ? "open" : "closed", p_lg->rate,
+		(double)run_ns / 1e9, p_lg->timeout_ms, p_lg->seed,
+		n_sent, n_done, n_error, n_timeout, n_bytes,
+		(run_ns != 0) ? ((double)n_done * 1e9 / (double)run_ns) : 0.0);
+	loadgen_samples_print(p_out, &all);
+
+	(void)fprintf(p_out, ",\n  \"commands\":[");
+	for (i = 0; i < p_lg->n_mix; i++)
+	{
+		cmd.p_val = IFX_NULL;
+		cmd.n_val = 0;
+		cmd.n_max = 0;
+		for (c = 0; c < p_lg->n_clients; c++)
+			(void)loadgen_sample_append(&cmd, &p_lg->p_clients[c].lat[i]);
+
+		(void)fprintf(p_out, "%s\n    {\"cmd\":", (i == 0) ? "" : ",");
+		loadgen_json_string_print(p_out, p_lg->mix[i].line);
+		(void)fprintf(p_out, ",\"weight\":%u,\"latency_us\":", p_lg->mix[i].weight);
+		loadgen_samples_print(p_out, &cmd);
+		(void)fprintf(p_out, "}");
+		free(cmd.p_val);
+	}
+
+	(void)fprintf(p_out, "\n  ],\n  \"events\":{\"received\":%llu,\"lag_us\":", n_events);
+	loadgen_samples_print(p_out, &lag_ev);
+	(void)fprintf(p_out, "},\n  \"dumps\":{\"received\":%llu,\"lag_us\":", n_dumps);
+	loadgen_samples_print(p_out, &lag_dump);
+	(void)fprintf(p_out, "}\n}\n");
+
+	free(all.p_val);
+	free(lag_ev.p_val);
+	free(lag_dump.p_val);
+}
+
+static void loadgen_usage(void)
+{
+	(void)fprintf(stderr,
+		"usage: cli_loadgen -p <pipe name> [-n <pipes>] [-c <clients>]\n"
+		"                   [-m <cmd>[:<weight>][,<cmd>[:<weight>]...]]\n"
+		"                   [-d <duration s>] [-r <rate/s>] [-t <timeout ms>]\n"
+		"                   [-s <seed>] [-o <file>]\n"
+		"   -p  pipe name as given to cli_pipe_init (including the FIFO directory)\n"
+		"   -n  number of pipes (default 1)\n"
+		"   -c  number of clients (default 1)\n"
+		"   -m  command mix (default \"help\"), \"%%t\" is replaced by the time\n"
+		"   -d  duration (default 10 s)\n"
+		"   -r  total rate, open loop (default 0: closed loop)\n"
+		"   -t  command timeout (default 5000 ms)\n"
+		"   -s  seed of the command selection (default 1)\n"
+		"   -o  JSON output file (default stdout)\n");
+}
+
+int main(int argc, char *argv[])
+{
+	static struct loadgen_s lg;
+	char default_mix[] = "help";
+	char *p_mix = default_mix;
+	const char *p_out_name = IFX_NULL;
+	unsigned long long run_ns;
+	unsigned int i, n_started = 0, n_listeners = 0;
+	FILE *p_out;
+	int ret = 0;
+
+	lg.n_pipes = 1;
+	lg.n_clients = 1;
+	lg.duration_ms = 10000;
+	lg.timeout_ms = 5000;
+	lg.seed = 1;
+
+	for (i = 1; i < (unsigned int)argc; i++)
+	{
+		if ((argv[i][0] != '-') || (argv[i][1] == '\0') || (argv[i][2] != '\0') ||
+		    (i + 1 >= (unsigned int)argc))
+		{
+			loadgen_usage();
+			return -1;
+		}
+
+		switch (argv[i][1])
+		{
+		case 'p':
+			lg.p_pipe_name = argv[++i];
+			break;
+		case 'n':
+			lg.n_pipes = (unsigned int)strtoul(argv[++i], IFX_NULL, 0);
+			break;
+		case 'c':
+			lg.n_clients = (unsigned int)strtoul(argv[++i], IFX_NULL, 0);
+			break;
+		case 'm':
+			p_mix = argv[++i];
+			break;
+		case 'd':
+			lg.duration_ms = (unsigned int)(strtod(argv[++i], IFX_NULL) * 1000.0);
+			break;
+		case 'r':
+			lg.rate = (unsigned int)strtoul(argv[++i], IFX_NULL, 0);
+			break;
+		case 't':
+			lg.timeout_ms = (unsigned int)strtoul(argv[++i], IFX_NULL, 0);
+			break;
+		case 's':
+			lg.seed = (unsigned int)strtoul(argv[++i], IFX_NULL, 0);
+			break;
+		case 'o':
+			p_out_name = argv[++i];
+			break;
+		default:
+			loadgen_usage();
+			return -1;
+		}
+	}
+
+	if ((lg.p_pipe_name == IFX_NULL) || (lg.n_pipes == 0) || (lg.n_pipes > MAX_CLI_PIPES) ||
+	    (lg.n_clients == 0) || (lg.n_clients > LOADGEN_MAX_CLIENTS) ||
+	    (lg.duration_ms == 0) || (lg.timeout_ms == 0) ||
+	    (loadgen_mix_parse(&lg, p_mix) != IFX_SUCCESS))
+	{
+		loadgen_usage();
+		return -1;
+	}
+	if (lg.seed == 0)
+		lg.seed = 1;
+
+	lg.p_pipes = calloc(lg.n_pipes, sizeof(struct loadgen_pipe_s));
+	lg.p_events = calloc(lg.n_pipes, sizeof(struct loadgen_listener_s));
+	lg.p_dumps = calloc(lg.n_pipes, sizeof(struct loadgen_listener_s));
+	lg.p_clients = calloc(lg.n_clients, sizeof(struct loadgen_client_s));
+	if ((lg.p_pipes == IFX_NULL) || (lg.p_events == IFX_NULL) ||
+	    (lg.p_dumps == IFX_NULL) || (lg.p_clients == IFX_NULL))
+	{
+		(void)fprintf(stderr, "cli_loadgen: no memory\n");
+		return -1;
+	}
+
+	for (i = 0; i < lg.n_pipes; i++)
+	{
+		(void)pthread_mutex_init(&lg.p_pipes[i].lock, IFX_NULL);
+		(void)snprintf(lg.p_pipes[i].name_cmd, LOADGEN_PATH_SIZE,
+			CLI_PIPE_NAME_FORMAT "cmd", lg.p_pipe_name, i);
+		(void)snprintf(lg.p_pipes[i].name_ack, LOADGEN_PATH_SIZE,
+			CLI_PIPE_NAME_FORMAT "ack", lg.p_pipe_name, i);
+		if (access(lg.p_pipes[i].name_cmd, W_OK) != 0)
+		{
+			(void)fprintf(stderr, "cli_loadgen: cannot access %s\n",
+				lg.p_pipes[i].name_cmd);
+			return -1;
+		}
+
+		lg.p_events[i].p_lg = &lg;
+		(void)snprintf(lg.p_events[i].name, LOADGEN_PATH_SIZE,
+			CLI_PIPE_NAME_FORMAT "event", lg.p_pipe_name, i);
+		lg.p_dumps[i].p_lg = &lg;
+		(void)snprintf(lg.p_dumps[i].name, LOADGEN_PATH_SIZE,
+			CLI_PIPE_NAME_FORMAT "dump", lg.p_pipe_name, i);
+	}
+
+	for (i = 0; i < lg.n_pipes; i++)
+	{
+		if (pthread_create(&lg.p_events[i].thread, IFX_NULL,
+				loadgen_listener_thread, &lg.p_events[i]) != 0)
+			break;
+		if (pthread_create(&lg.p_dumps[i].thread, IFX_NULL,
+				loadgen_listener_thread, &lg.p_dumps[i]) != 0)
+		{
+			lg.b_stop = 1;
+			(void)pthread_join(lg.p_events[i].thread, IFX_NULL);
+			break;
+		}
+		n_listeners++;
+	}
+
+	lg.start_ns = loadgen_time_ns_get() + 10000000ULL;
+	lg.stop_ns = lg.start_ns + (unsigned long long)lg.duration_ms * 1000000ULL;
+
+	for (i = 0; i < lg.n_clients; i++)
+	{
+		lg.p_clients[i].number = i;
+		lg.p_clients[i].p_lg = &lg;
+		lg.p_clients[i].p_pipe = &lg.p_pipes[i % lg.n_pipes];
+		lg.p_clients[i].rand_state = lg.seed + i * 0x9E3779B9U;
+		if (lg.p_clients[i].rand_state == 0)
+			lg.p_clients[i].rand_state = 1;
+		if (pthread_create(&lg.p_clients[i].thread, IFX_NULL,
+				loadgen_client_thread, &lg.p_clients[i]) != 0)
+		{
+			(void)fprintf(stderr, "cli_loadgen: cannot start client %u\n", i);
+			ret = -1;
+			break;
+		}
+		n_started++;
+	}
+
+	for (i = 0; i < n_started; i++)
+		(void)pthread_join(lg.p_clients[i].thread, IFX_NULL);
+	run_ns = loadgen_time_ns_get() - lg.start_ns;
+
+	/* late events / dumps */
+	(void)usleep(LOADGEN_DRAIN_TIME * 1000);
+	lg.b_stop = 1;
+	for (i = 0; i < n_listeners; i++)
+	{
+		(void)pthread_join(lg.p_events[i].thread, IFX_NULL);
+		(void)pthread_join(lg.p_dumps[i].thread, IFX_NULL);
+	}
+
+	lg.n_clients = n_started;
+	p_out = (p_out_name != IFX_NULL) ? fopen(p_out_name, "w") : stdout;
+	if (p_out == IFX_NULL)
+	{
+		(void)fprintf(stderr, "cli_loadgen: cannot open %s\n", p_out_name);
+		return -1;
+	}
+	loadgen_report(&lg, p_out, run_ns);
+	if (p_out != stdout)
+		(void)fclose(p_out);
+
+	return ret;
+}
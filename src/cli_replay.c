@@ -0,0 +1,273 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - Record Log Replay.
+
+   Replays a record log (see \ref cli_core_record_start) against a fresh
+   CLI core in the calling process and prints a summary as JSON.
+
+   The commands of the recording application are not available here, each
+   recorded key is registered as a stub command which returns "errorcode=0".
+   The built-in commands (except "quit" and "record") are executed as
+   recorded. The tool measures the CLI core (parsing, lookup, dispatch,
+   statistics, trace) under a recorded production workload.
+
+   Usage:
+      cli_replay [-x <speed %>] [-o <output file>] <record log>
+
+\remarks
+   The log is read twice, the first pass collects the keys for the
+   registration.
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "lib_cli_record.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if (CLI_SUPPORT_RECORD == 1) && (CLI_SUPPORT_FILE_OUT == 1)
+
+/** size of the stub long name buffer */
+#define REPLAY_LONG_NAME_SIZE	24
+
+/** Collected keys of the record log */
+struct replay_keys_s
+{
+	/** number of keys */
+	unsigned int n_keys;
+	/** size of the key arrays */
+	unsigned int n_max;
+	/** keys (short names of the stub commands) */
+	char **pp_key;
+	/** long names of the stub commands */
+	char (*p_long)[REPLAY_LONG_NAME_SIZE];
+	/** number of entries */
+	unsigned long long n_entries;
+	/** offset of the last entry [us] */
+	unsigned long long span_us;
+};
+
+/** Stub command, registered for each recorded key */
+static int replay_stub__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_file)
+{
+	(void)p_ctx;
+	(void)p_cmd;
+
+	return fprintf((FILE *)p_file, "errorcode=0\n");
+}
+
+/** Record read callback, collects the unique keys */
+static int replay_key_collect(
+	void *p_data,
+	const struct cli_record_entry_s *p_entry)
+{
+	struct replay_keys_s *p_keys = (struct replay_keys_s *)p_data;
+	unsigned int i, n_max;
+	char **pp_key;
+	char (*p_long)[REPLAY_LONG_NAME_SIZE];
+
+	p_keys->n_entries++;
+	p_keys->span_us = p_entry->offset_us;
+
+	for (i = 0; i < p_keys->n_keys; i++)
+	{
+		if (strcmp(p_keys->pp_key[i], p_entry->p_key) == 0)
+			return 0;
+	}
+
+	if (p_keys->n_keys == p_keys->n_max)
+	{
+		n_max = (p_keys->n_max == 0) ? 64 : p_keys->n_max * 2;
+		pp_key = (char **)realloc(p_keys->pp_key, n_max * sizeof(*pp_key));
+		if (pp_key == IFX_NULL)
+			return -1;
+		p_keys->pp_key = pp_key;
+		p_long = realloc(p_keys->p_long, n_max * sizeof(*p_long));
+		if (p_long == IFX_NULL)
+			return -1;
+		p_keys->p_long = p_long;
+		p_keys->n_max = n_max;
+	}
+
+	p_keys->pp_key[p_keys->n_keys] = strdup(p_entry->p_key);
+	if (p_keys->pp_key[p_keys->n_keys] == IFX_NULL)
+		return -1;
+	(void)snprintf(p_keys->p_long[p_keys->n_keys], REPLAY_LONG_NAME_SIZE,
+		"replay_stub_%u", p_keys->n_keys);
+	p_keys->n_keys++;
+
+	return 0;
+}
+
+static void replay_keys_free(
+	struct replay_keys_s *p_keys)
+{
+	unsigned int i;
+
+	for (i = 0; i < p_keys->n_keys; i++)
+		free(p_keys->pp_key[i]);
+	free(p_keys->pp_key);
+	free(p_keys->p_long);
+}
+
+/** Register the built-in and the stub commands (count and add phase) */
+static int replay_cmd_register(
+	struct cli_core_context_s *p_core_ctx,
+	struct replay_keys_s *p_keys)
+{
+	unsigned int i;
+
+	if (cli_core_buildin_register(p_core_ctx,
+		CLI_USER_MASK_ALL & ~(CLI_BUILDIN_REG_QUIT | CLI_BUILDIN_REG_RECORD)) != IFX_SUCCESS)
+		return IFX_ERROR;
+
+	/* a key of a built-in command is reported as duplicate and ignored */
+	for (i = 0; i < p_keys->n_keys; i++)
+		(void)cli_core_key_add__file(p_core_ctx, 0,
+			p_keys->pp_key[i], p_keys->p_long[i], replay_stub__file);
+
+	return IFX_SUCCESS;
+}
+
+static unsigned long long replay_time_us_get(void)
+{
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		return 0;
+
+	return (unsigned long long)ts.tv_sec * 1000000ULL +
+		(unsigned long long)(ts.tv_nsec / 1000);
+}
+
+static void replay_usage(void)
+{
+	(void)fprintf(stderr,
+		"usage: cli_replay [-x <speed %%>] [-o <output file>] <record log>\n"
+		"   -x  pacing in percent of the recorded speed (default 100)\n"
+		"       0: as fast as possible\n"
+		"   -o  output of the commands (default: discarded)\n");
+}
+
+int main(int argc, char *argv[])
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct replay_keys_s keys;
+	unsigned int speed = 100;
+	const char *p_out_name = IFX_NULL, *p_path = IFX_NULL;
+	FILE *p_out = IFX_NULL;
+	unsigned long long start_us, elapsed_us;
+	int i, n_exec, ret = -1;
+
+	memset(&keys, 0x00, sizeof(keys));
+
+	for (i = 1; i < argc; i++)
+	{
+		if ((argv[i][0] != '-') && (i == argc - 1))
+		{
+			p_path = argv[i];
+			break;
+		}
+		if ((argv[i][0] != '-') || (argv[i][1] == '\0') || (argv[i][2] != '\0') ||
+		    (i + 1 >= argc))
+		{
+			replay_usage();
+			return -1;
+		}
+
+		switch (argv[i][1])
+		{
+		case 'x':
+			speed = (unsigned int)strtoul(argv[++i], IFX_NULL, 0);
+			break;
+		case 'o':
+			p_out_name = argv[++i];
+			break;
+		default:
+			replay_usage();
+			return -1;
+		}
+	}
+	if (p_path == IFX_NULL)
+	{
+		replay_usage();
+		return -1;
+	}
+
+	if (cli_record_read(p_path, replay_key_collect, &keys) < 0)
+	{
+		(void)fprintf(stderr, "cli_replay: cannot read %s\n", p_path);
+		goto REPLAY_END;
+	}
+
+	if (p_out_name != IFX_NULL)
+	{
+		p_out = fopen(p_out_name, "w");
+		if (p_out == IFX_NULL)
+		{
+			(void)fprintf(stderr, "cli_replay: cannot open %s\n", p_out_name);
+			goto REPLAY_END;
+		}
+	}
+
+	if ((cli_core_init(&p_core_ctx, cli_cmd_core_out_mode_file, IFX_NULL) != IFX_SUCCESS) ||
+	    (replay_cmd_register(p_core_ctx, &keys) != IFX_SUCCESS) ||
+	    (cli_core_cfg_mode_cmd_reg(p_core_ctx) != IFX_SUCCESS) ||
+	    (replay_cmd_register(p_core_ctx, &keys) != IFX_SUCCESS) ||
+	    (cli_core_cfg_mode_active(p_core_ctx) != IFX_SUCCESS))
+	{
+		(void)fprintf(stderr, "cli_replay: core setup failed\n");
+		goto REPLAY_END;
+	}
+
+	start_us = replay_time_us_get();
+	n_exec = cli_core_record_replay(p_core_ctx, p_path, speed, (clios_file_io_t *)p_out);
+	elapsed_us = replay_time_us_get() - start_us;
+	if (n_exec < 0)
+	{
+		(void)fprintf(stderr, "cli_replay: replay of %s failed\n", p_path);
+		goto REPLAY_END;
+	}
+
+	(void)printf(
+		"{\n  \"tool\":\"cli_replay\",\n  \"log\":\"%s\",\n  \"speed\":%u,\n"
+		"  \"entries\":%llu,\n  \"keys\":%u,\n  \"executed\":%d,\n"
+		"  \"recorded_span_us\":%llu,\n  \"elapsed_us\":%llu,\n"
+		"  \"rate_per_s\":%.1f\n}\n",
+		p_path, speed, keys.n_entries, keys.n_keys, n_exec,
+		keys.span_us, elapsed_us,
+		(elapsed_us != 0) ? (double)n_exec * 1000000.0 / (double)elapsed_us : 0.0);
+	ret = 0;
+
+REPLAY_END:
+	if (p_core_ctx != IFX_NULL)
+		(void)cli_core_release(&p_core_ctx, cli_cmd_core_out_mode_file);
+	if (p_out != IFX_NULL)
+		(void)fclose(p_out);
+	replay_keys_free(&keys);
+
+	return ret;
+}
+
+#else	/* #if (CLI_SUPPORT_RECORD == 1) && (CLI_SUPPORT_FILE_OUT == 1) */
+
+int main(void)
+{
+	(void)fprintf(stderr, "cli_replay: requires CLI_SUPPORT_RECORD and CLI_SUPPORT_FILE_OUT\n");
+	return -1;
+}
+
+#endif	/* #if (CLI_SUPPORT_RECORD == 1) && (CLI_SUPPORT_FILE_OUT == 1) */
@@ -0,0 +1,94 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _CLI_TEST_H
+#define _CLI_TEST_H
+
+/** \file
+   Command Line Interface (CLI) - helpers of the unit tests ("make check").
+
+   Each test is a small program which returns
+   - 0 if all checks passed
+   - 1 on the first failed check (file, line and condition on stderr)
+   - CLI_TEST_SKIP if the tested feature is not part of the build
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#include <stdio.h>
+
+/** exit code of a skipped test (automake) */
+#define CLI_TEST_SKIP	77
+
+/** Check a condition, a failure ends the test function with 1 */
+#define CLI_TEST_CHECK(COND) \
+	do { \
+		if (!(COND)) \
+		{ \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #COND); \
+			return 1; \
+		} \
+	} while (0)
+
+/** Run a test function, a failure ends the calling function with 1 */
+#define CLI_TEST_RUN(FCT) \
+	do { \
+		if ((FCT)() != 0) \
+		{ \
+			fprintf(stderr, "FAIL: %s\n", #FCT); \
+			return 1; \
+		} \
+		printf("PASS: %s\n", #FCT); \
+	} while (0)
+
+/** User command of a test, registered by \ref cli_test_core_init */
+struct cli_test_cmd_s
+{
+	/** registration mask, for example CLI_CMD_MASK_CONCURRENT */
+	unsigned int mask;
+	/** short name (key) */
+	const char *p_short_name;
+	/** long name */
+	const char *p_long_name;
+	/** handler of a buffer mode core (or IFX_NULL) */
+	cli_cmd_user_fct_buf_t fct_buf;
+	/** handler of a file mode core (or IFX_NULL) */
+	cli_cmd_user_fct_file_t fct_file;
+};
+
+/** Setup the CLI core of a test: init, the built-in commands and the user
+    commands in the config mode and in the active mode.
+
+\param
+   pp_core_ctx - returns the CLI core context
+\param
+   out_mode - printout mode of the core (buffer or file)
+\param
+   buildin_mask - built-in commands, see \ref cli_core_buildin_register
+\param
+   p_cmds - user commands, ends with a IFX_NULL short name (or IFX_NULL)
+
+\return
+   0 on success, 1 on a failed check
+*/
+extern int cli_test_core_init(
+	struct cli_core_context_s **pp_core_ctx,
+	enum cli_cmd_core_out_mode_e out_mode,
+	unsigned int buildin_mask,
+	const struct cli_test_cmd_s *p_cmds);
+
+/** Release the CLI core of a test (see \ref cli_test_core_init)
+
+\return
+   0 on success, 1 on a failed check
+*/
+extern int cli_test_core_release(
+	struct cli_core_context_s **pp_core_ctx,
+	enum cli_cmd_core_out_mode_e out_mode);
+
+#endif	/* #ifndef _CLI_TEST_H */
@@ -0,0 +1,367 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - unit test of the asynchronous execution.
+
+   - no pool: not queued, no completion
+   - a deferring handler completes synchronously outside of the pool
+   - immediate and deferred completions with status and output
+   - release of the CLI core with pending requests (deferred release)
+   - release of the pool with queued requests (completed with IFX_ERROR)
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "cli_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#if (CLI_SUPPORT_ASYNC == 1)
+#include "lib_cli_pool.h"
+#include "lib_cli_async.h"
+#include "lib_cli_out_sink.h"
+
+/** number of requests of a test run, half of them deferred */
+#define TEST_REQUESTS	80
+/** status of the immediate completion ("rd") */
+#define TEST_STATUS_RD	3
+/** status of the deferred completion ("fw") */
+#define TEST_STATUS_FW	7
+/** status of the synchronous "fw" */
+#define TEST_STATUS_SYNC	5
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/** Deferred executions, completed by the completer thread */
+static struct cli_exec_ctx_s *g_p_pending[TEST_REQUESTS];
+static unsigned int g_n_pending;
+/** hold the "hold" handler until set */
+static int g_b_go;
+
+/** Completion of a request */
+struct test_request_s
+{
+	struct cli_out_sink_s sink;
+	int b_done;
+	int status;
+	char out[128];
+};
+
+static struct test_request_s g_request[TEST_REQUESTS];
+static unsigned int g_n_done;
+static unsigned int g_n_bad;
+
+static int test_cmd_fw(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	struct cli_exec_ctx_s *p_exec_ctx = cli_cmd_defer();
+
+	(void)p_ctx;
+	if (p_exec_ctx == IFX_NULL)
+	{
+		(void)fprintf((FILE *)p_out, "fw sync\n");
+		return TEST_STATUS_SYNC;
+	}
+
+	(void)cli_out_sink_printf(p_exec_ctx->p_sink, "fw started %s\n", p_cmd_arg);
+	pthread_mutex_lock(&g_lock);
+	if (g_n_pending < TEST_REQUESTS)
+		g_p_pending[g_n_pending++] = p_exec_ctx;
+	pthread_mutex_unlock(&g_lock);
+
+	return 0;
+}
+
+static int test_cmd_rd(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	(void)p_ctx;
+	(void)fprintf((FILE *)p_out, "rd %s\n", p_cmd_arg);
+
+	return TEST_STATUS_RD;
+}
+
+static int test_cmd_hold(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	int b_go = 0;
+
+	(void)p_ctx;
+	(void)p_cmd_arg;
+	while (!b_go)
+	{
+		usleep(1000);
+		pthread_mutex_lock(&g_lock);
+		b_go = g_b_go;
+		pthread_mutex_unlock(&g_lock);
+	}
+	(void)fprintf((FILE *)p_out, "hold done\n");
+
+	return 0;
+}
+
+static const struct cli_test_cmd_s g_test_cmds[] =
+{
+	{0, "fw", "fw_download", IFX_NULL, test_cmd_fw},
+	{CLI_CMD_MASK_CONCURRENT, "rd", "read_x", IFX_NULL, test_cmd_rd},
+	{0, "hold", "hold_x", IFX_NULL, test_cmd_hold},
+	{0, IFX_NULL, IFX_NULL, IFX_NULL, IFX_NULL}
+};
+
+static int test_core_init(
+	struct cli_core_context_s **pp_core_ctx)
+{
+	return cli_test_core_init(pp_core_ctx, cli_cmd_core_out_mode_file,
+		CLI_USER_MASK_ALL, g_test_cmds);
+}
+
+static void test_done_fct(
+	void *p_user,
+	int status,
+	struct cli_out_sink_s *p_sink)
+{
+	struct test_request_s *p_request = (struct test_request_s *)p_user;
+	char *p_buf = IFX_NULL;
+
+	(void)cli_out_sink_detach(p_sink, &p_buf, IFX_NULL);
+
+	pthread_mutex_lock(&g_lock);
+	if (p_request->b_done || (p_sink != &p_request->sink))
+		g_n_bad++;
+	p_request->b_done = 1;
+	p_request->status = status;
+	snprintf(p_request->out, sizeof(p_request->out), "%s", (p_buf != IFX_NULL) ? p_buf : "");
+	g_n_done++;
+	pthread_mutex_unlock(&g_lock);
+
+	cli_out_sink_buf_free(p_buf);
+}
+
+static unsigned int test_done_get(void)
+{
+	unsigned int n_done;
+
+	pthread_mutex_lock(&g_lock);
+	n_done = g_n_done;
+	pthread_mutex_unlock(&g_lock);
+
+	return n_done;
+}
+
+static void test_requests_reset(void)
+{
+	unsigned int i;
+
+	pthread_mutex_lock(&g_lock);
+	for (i = 0; i < TEST_REQUESTS; i++)
+	{
+		memset(&g_request[i], 0x00, sizeof(g_request[i]));
+		(void)cli_out_sink_init(&g_request[i].sink);
+		g_p_pending[i] = IFX_NULL;
+	}
+	g_n_pending = 0;
+	g_n_done = 0;
+	g_n_bad = 0;
+	g_b_go = 0;
+	pthread_mutex_unlock(&g_lock);
+}
+
+static void test_requests_release(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < TEST_REQUESTS; i++)
+		cli_out_sink_release(&g_request[i].sink);
+}
+
+/* completes the deferred requests in the order of deferral */
+static void *test_completer_thread(void *p_arg)
+{
+	unsigned int n = (unsigned int)(unsigned long)p_arg, k = 0;
+	struct cli_exec_ctx_s *p_exec_ctx;
+
+	while (k < n)
+	{
+		p_exec_ctx = IFX_NULL;
+		pthread_mutex_lock(&g_lock);
+		if (k < g_n_pending)
+			p_exec_ctx = g_p_pending[k++];
+		pthread_mutex_unlock(&g_lock);
+
+		if (p_exec_ctx == IFX_NULL)
+		{
+			usleep(100);
+			continue;
+		}
+		(void)cli_out_sink_printf(p_exec_ctx->p_sink, "fw done %s\n", p_exec_ctx->p_cmd);
+		(void)cli_cmd_complete(p_exec_ctx, TEST_STATUS_FW);
+	}
+
+	return IFX_NULL;
+}
+
+static int test_async_no_pool(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	FILE *p_null;
+	char buf[64];
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+	test_requests_reset();
+
+	CLI_TEST_CHECK(cli_core_cmd_exec_async(p_core_ctx, "rd 1",
+		&g_request[0].sink, test_done_fct, &g_request[0]) == IFX_ERROR);
+	CLI_TEST_CHECK(test_done_get() == 0);
+
+	/* outside of the pool the handler completes synchronously */
+	p_null = fopen("/dev/null", "w");
+	CLI_TEST_CHECK(p_null != IFX_NULL);
+	snprintf(buf, sizeof(buf), "fw x");
+	CLI_TEST_CHECK(cli_core_cmd_exec__file(p_core_ctx, buf, p_null) == TEST_STATUS_SYNC);
+	fclose(p_null);
+
+	test_requests_release();
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+
+	return 0;
+}
+
+static int test_async_release_order(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct cli_pool_s *p_pool = IFX_NULL;
+	struct test_request_s *p_request;
+	pthread_t thread;
+	unsigned int i;
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+	CLI_TEST_CHECK(cli_pool_init(&p_pool, 2) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_core_async_pool_set(p_core_ctx, p_pool) == IFX_SUCCESS);
+	test_requests_reset();
+
+	/* the completer starts after all requests are queued */
+	for (i = 0; i < TEST_REQUESTS; i++)
+	{
+		CLI_TEST_CHECK(cli_core_cmd_exec_async(p_core_ctx, (i & 1) ? "rd 7" : "fw img",
+			&g_request[i].sink, test_done_fct, &g_request[i]) == IFX_SUCCESS);
+	}
+
+	/* release the CLI core while requests are pending - deferred */
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+	CLI_TEST_CHECK(pthread_create(&thread, IFX_NULL, test_completer_thread,
+		(void *)(unsigned long)(TEST_REQUESTS / 2)) == 0);
+	(void)pthread_join(thread, IFX_NULL);
+	while (test_done_get() < TEST_REQUESTS)
+		usleep(1000);
+
+	CLI_TEST_CHECK(g_n_bad == 0);
+	for (i = 0; i < TEST_REQUESTS; i++)
+	{
+		p_request = &g_request[i];
+		CLI_TEST_CHECK(p_request->b_done);
+		if (i & 1)
+		{
+			CLI_TEST_CHECK(p_request->status == TEST_STATUS_RD);
+			CLI_TEST_CHECK(strstr(p_request->out, "rd 7") != IFX_NULL);
+		}
+		else
+		{
+			/* output of the handler and of the completion, in order */
+			CLI_TEST_CHECK(p_request->status == TEST_STATUS_FW);
+			CLI_TEST_CHECK(strstr(p_request->out, "fw started img") != IFX_NULL);
+			CLI_TEST_CHECK(strstr(p_request->out, "fw done") >
+				strstr(p_request->out, "fw started img"));
+		}
+	}
+
+	test_requests_release();
+	CLI_TEST_CHECK(cli_pool_release(&p_pool) == IFX_SUCCESS);
+
+	return 0;
+}
+
+static void *test_go_thread(void *p_arg)
+{
+	(void)p_arg;
+
+	usleep(50000);
+	pthread_mutex_lock(&g_lock);
+	g_b_go = 1;
+	pthread_mutex_unlock(&g_lock);
+
+	return IFX_NULL;
+}
+
+static int test_async_pool_release(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct cli_pool_s *p_pool = IFX_NULL;
+	pthread_t thread;
+	unsigned int i;
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+	CLI_TEST_CHECK(cli_pool_init(&p_pool, 1) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_core_async_pool_set(p_core_ctx, p_pool) == IFX_SUCCESS);
+	test_requests_reset();
+
+	/* the first request holds the only worker */
+	for (i = 0; i < TEST_REQUESTS; i++)
+	{
+		CLI_TEST_CHECK(cli_core_cmd_exec_async(p_core_ctx, (i == 0) ? "hold" : "rd 1",
+			&g_request[i].sink, test_done_fct, &g_request[i]) == IFX_SUCCESS);
+	}
+	usleep(10000);
+
+	/* release the pool while the first request runs */
+	CLI_TEST_CHECK(cli_core_async_pool_set(p_core_ctx, IFX_NULL) == IFX_SUCCESS);
+	CLI_TEST_CHECK(pthread_create(&thread, IFX_NULL, test_go_thread, IFX_NULL) == 0);
+	CLI_TEST_CHECK(cli_pool_release(&p_pool) == IFX_SUCCESS);
+	(void)pthread_join(thread, IFX_NULL);
+
+	/* each request completed once, the queued ones not executed */
+	CLI_TEST_CHECK(test_done_get() == TEST_REQUESTS);
+	CLI_TEST_CHECK(g_n_bad == 0);
+	CLI_TEST_CHECK(g_request[0].status == 0);
+	CLI_TEST_CHECK(strstr(g_request[0].out, "hold done") != IFX_NULL);
+	for (i = 1; i < TEST_REQUESTS; i++)
+		CLI_TEST_CHECK(g_request[i].status == IFX_ERROR);
+
+	test_requests_release();
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+
+	return 0;
+}
+
+int main(void)
+{
+	CLI_TEST_RUN(test_async_no_pool);
+	CLI_TEST_RUN(test_async_release_order);
+	CLI_TEST_RUN(test_async_pool_release);
+
+	return 0;
+}
+
+#else	/* #if (CLI_SUPPORT_ASYNC == 1) */
+
+int main(void)
+{
+	return CLI_TEST_SKIP;
+}
+
+#endif	/* #if (CLI_SUPPORT_ASYNC == 1) */
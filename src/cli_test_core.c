@@ -0,0 +1,57 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - CLI core setup shared by the unit tests.
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "cli_test.h"
+
+/* register the built-in and the user commands in the current core mode */
+static void cli_test_cmd_register(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int buildin_mask,
+	const struct cli_test_cmd_s *p_cmds)
+{
+	(void)cli_core_buildin_register(p_core_ctx, buildin_mask);
+	for (; (p_cmds != IFX_NULL) && (p_cmds->p_short_name != IFX_NULL); p_cmds++)
+	{
+		if (p_cmds->fct_buf != IFX_NULL)
+			(void)cli_core_key_add__buffer(p_core_ctx, p_cmds->mask,
+				p_cmds->p_short_name, p_cmds->p_long_name, p_cmds->fct_buf);
+		if (p_cmds->fct_file != IFX_NULL)
+			(void)cli_core_key_add__file(p_core_ctx, p_cmds->mask,
+				p_cmds->p_short_name, p_cmds->p_long_name, p_cmds->fct_file);
+	}
+}
+
+int cli_test_core_init(
+	struct cli_core_context_s **pp_core_ctx,
+	enum cli_cmd_core_out_mode_e out_mode,
+	unsigned int buildin_mask,
+	const struct cli_test_cmd_s *p_cmds)
+{
+	CLI_TEST_CHECK(cli_core_init(pp_core_ctx, out_mode, IFX_NULL) == IFX_SUCCESS);
+	cli_test_cmd_register(*pp_core_ctx, buildin_mask, p_cmds);
+	CLI_TEST_CHECK(cli_core_cfg_mode_cmd_reg(*pp_core_ctx) == IFX_SUCCESS);
+	cli_test_cmd_register(*pp_core_ctx, buildin_mask, p_cmds);
+	CLI_TEST_CHECK(cli_core_cfg_mode_active(*pp_core_ctx) == IFX_SUCCESS);
+
+	return 0;
+}
+
+int cli_test_core_release(
+	struct cli_core_context_s **pp_core_ctx,
+	enum cli_cmd_core_out_mode_e out_mode)
+{
+	CLI_TEST_CHECK(cli_core_release(pp_core_ctx, out_mode) == IFX_SUCCESS);
+
+	return 0;
+}
@@ -0,0 +1,226 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - unit test of the event limiter.
+
+   - events without a rule are passed
+   - coalescing window: first event passed, latest one flushed with count
+   - full key table with active keys: new keys share the rule state
+   - full key table with idle keys: eviction keeps all active keys reachable
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "lib_cli_event_limit.h"
+#include "cli_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+
+/** coalescing window of the tests [ms] */
+#define TEST_WINDOW_MS	300
+/** sleep to let a window expire [us] */
+#define TEST_WINDOW_EXPIRE_US	((TEST_WINDOW_MS + 100) * 1000)
+
+/** Delivered events */
+struct test_deliver_s
+{
+	unsigned int n;
+	char last[CLI_EVENT_LIMIT_TEXT_SIZE];
+};
+
+static int test_deliver_fct(
+	void *p_data,
+	char *p_event)
+{
+	struct test_deliver_s *p_deliver = (struct test_deliver_s *)p_data;
+
+	p_deliver->n++;
+	snprintf(p_deliver->last, sizeof(p_deliver->last), "%s", p_event);
+
+	return 0;
+}
+
+static int test_event_process(
+	struct cli_event_limit_s *p_limit,
+	const char *p_format,
+	unsigned int n,
+	struct test_deliver_s *p_deliver)
+{
+	char event[64];
+
+	snprintf(event, sizeof(event), p_format, n);
+	return cli_event_limit_process(p_limit, event, test_deliver_fct, p_deliver);
+}
+
+static int test_event_limit_coalesce(void)
+{
+	struct cli_event_limit_s *p_limit = IFX_NULL;
+	struct cli_event_limit_rule_info_s info;
+	struct test_deliver_s deliver;
+	unsigned int i, wait_ms;
+
+	CLI_TEST_CHECK(cli_event_limit_init(&p_limit) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_event_limit_rule_set(p_limit, "link*", TEST_WINDOW_MS, 0, 0) == IFX_SUCCESS);
+
+	/* no matching rule - passed */
+	memset(&deliver, 0x00, sizeof(deliver));
+	for (i = 0; i < 10; i++)
+		CLI_TEST_CHECK(test_event_process(p_limit, "other %u", i, &deliver) == IFX_SUCCESS);
+	CLI_TEST_CHECK(deliver.n == 10);
+	CLI_TEST_CHECK(cli_event_limit_due_get(p_limit, &wait_ms) == 0);
+
+	/* first passed, the rest collapsed */
+	memset(&deliver, 0x00, sizeof(deliver));
+	for (i = 0; i < 10; i++)
+		CLI_TEST_CHECK(test_event_process(p_limit, "link_up port=%u", i, &deliver) == IFX_SUCCESS);
+	CLI_TEST_CHECK(deliver.n == 1);
+	CLI_TEST_CHECK(strcmp(deliver.last, "link_up port=0") == 0);
+
+	CLI_TEST_CHECK(cli_event_limit_due_get(p_limit, &wait_ms) == 1);
+	CLI_TEST_CHECK(wait_ms <= TEST_WINDOW_MS);
+	/* not due yet */
+	CLI_TEST_CHECK(cli_event_limit_flush(p_limit, test_deliver_fct, &deliver) == 0);
+
+	/* end of the window - latest value with the count */
+	usleep(TEST_WINDOW_EXPIRE_US);
+	CLI_TEST_CHECK(cli_event_limit_due_get(p_limit, &wait_ms) == 1);
+	CLI_TEST_CHECK(wait_ms == 0);
+	CLI_TEST_CHECK(cli_event_limit_flush(p_limit, test_deliver_fct, &deliver) == 1);
+	CLI_TEST_CHECK(deliver.n == 2);
+	CLI_TEST_CHECK(strncmp(deliver.last, "link_up port=9", strlen("link_up port=9")) == 0);
+	CLI_TEST_CHECK(strstr(deliver.last, "coalesced=9") != IFX_NULL);
+	CLI_TEST_CHECK(cli_event_limit_due_get(p_limit, &wait_ms) == 0);
+
+	CLI_TEST_CHECK(cli_event_limit_rule_get(p_limit, 0, &info) == IFX_SUCCESS);
+	CLI_TEST_CHECK(strcmp(info.key, "link*") == 0);
+	/* 10 events: the first passed, the latest flushed, 8 dropped */
+	CLI_TEST_CHECK((info.n_passed == 2) && (info.n_coalesced == 8) && (info.n_overflow == 0));
+	CLI_TEST_CHECK(cli_event_limit_rule_get(p_limit, 1, &info) == IFX_ERROR);
+
+	/* rule removed - passed again */
+	CLI_TEST_CHECK(cli_event_limit_rule_set(p_limit, "link*", 0, 0, 0) == IFX_SUCCESS);
+	memset(&deliver, 0x00, sizeof(deliver));
+	for (i = 0; i < 10; i++)
+		CLI_TEST_CHECK(test_event_process(p_limit, "link_up port=%u", i, &deliver) == IFX_SUCCESS);
+	CLI_TEST_CHECK(deliver.n == 10);
+
+	CLI_TEST_CHECK(cli_event_limit_release(&p_limit) == IFX_SUCCESS);
+	CLI_TEST_CHECK(p_limit == IFX_NULL);
+
+	return 0;
+}
+
+static int test_event_limit_overflow(void)
+{
+	struct cli_event_limit_s *p_limit = IFX_NULL;
+	struct cli_event_limit_rule_info_s info;
+	struct test_deliver_s deliver;
+	unsigned int i, wait_ms;
+
+	CLI_TEST_CHECK(cli_event_limit_init(&p_limit) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_event_limit_rule_set(p_limit, "k*", TEST_WINDOW_MS, 0, 0) == IFX_SUCCESS);
+
+	/* fill the key table, each key with an open window */
+	memset(&deliver, 0x00, sizeof(deliver));
+	for (i = 0; i < CLI_EVENT_LIMIT_MAX_KEYS; i++)
+		CLI_TEST_CHECK(test_event_process(p_limit, "k%u x", i, &deliver) == IFX_SUCCESS);
+	CLI_TEST_CHECK(deliver.n == CLI_EVENT_LIMIT_MAX_KEYS);
+
+	/* all keys active - new keys share the state of the rule */
+	memset(&deliver, 0x00, sizeof(deliver));
+	for (i = 0; i < 10; i++)
+		CLI_TEST_CHECK(test_event_process(p_limit, "knew%u", i, &deliver) == IFX_SUCCESS);
+	CLI_TEST_CHECK(deliver.n == 1);
+	CLI_TEST_CHECK(cli_event_limit_rule_get(p_limit, 0, &info) == IFX_SUCCESS);
+	CLI_TEST_CHECK((info.n_overflow == 10) && (info.n_coalesced == 8));
+
+	/* the overflow state is flushed as well */
+	usleep(TEST_WINDOW_EXPIRE_US);
+	CLI_TEST_CHECK(cli_event_limit_due_get(p_limit, &wait_ms) == 1);
+	CLI_TEST_CHECK(cli_event_limit_flush(p_limit, test_deliver_fct, &deliver) == 1);
+	CLI_TEST_CHECK(strstr(deliver.last, "knew9") == deliver.last);
+	CLI_TEST_CHECK(cli_event_limit_due_get(p_limit, &wait_ms) == 0);
+
+	/* all windows expired - idle keys are evicted, no overflow */
+	memset(&deliver, 0x00, sizeof(deliver));
+	for (i = 0; i < CLI_EVENT_LIMIT_MAX_KEYS; i++)
+		CLI_TEST_CHECK(test_event_process(p_limit, "kother%u", i, &deliver) == IFX_SUCCESS);
+	CLI_TEST_CHECK(deliver.n == CLI_EVENT_LIMIT_MAX_KEYS);
+	CLI_TEST_CHECK(cli_event_limit_rule_get(p_limit, 0, &info) == IFX_SUCCESS);
+	CLI_TEST_CHECK(info.n_overflow == 10);
+
+	CLI_TEST_CHECK(cli_event_limit_release(&p_limit) == IFX_SUCCESS);
+
+	return 0;
+}
+
+static int test_event_limit_evict(void)
+{
+	struct cli_event_limit_s *p_limit = IFX_NULL;
+	struct cli_event_limit_rule_info_s info;
+	struct test_deliver_s deliver;
+	unsigned int i, wait_ms;
+
+	CLI_TEST_CHECK(cli_event_limit_init(&p_limit) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_event_limit_rule_set(p_limit, "a*", 50, 0, 0) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_event_limit_rule_set(p_limit, "b*", 10000, 0, 0) == IFX_SUCCESS);
+
+	/* half of the keys expire soon, the other half stays active */
+	memset(&deliver, 0x00, sizeof(deliver));
+	for (i = 0; i < CLI_EVENT_LIMIT_MAX_KEYS / 2; i++)
+	{
+		CLI_TEST_CHECK(test_event_process(p_limit, "a%u", i, &deliver) == IFX_SUCCESS);
+		CLI_TEST_CHECK(test_event_process(p_limit, "b%u", i, &deliver) == IFX_SUCCESS);
+	}
+	CLI_TEST_CHECK(deliver.n == CLI_EVENT_LIMIT_MAX_KEYS);
+	usleep(100000);
+
+	/* new keys evict the idle "a" keys */
+	for (i = 0; i < CLI_EVENT_LIMIT_MAX_KEYS / 2; i++)
+		CLI_TEST_CHECK(test_event_process(p_limit, "anew%u", i, &deliver) == IFX_SUCCESS);
+
+	/* each active "b" key still found after the moves - collapsed */
+	memset(&deliver, 0x00, sizeof(deliver));
+	for (i = 0; i < CLI_EVENT_LIMIT_MAX_KEYS / 2; i++)
+		CLI_TEST_CHECK(test_event_process(p_limit, "b%u", i, &deliver) == IFX_SUCCESS);
+	CLI_TEST_CHECK(deliver.n == 0);
+
+	CLI_TEST_CHECK(cli_event_limit_rule_get(p_limit, 0, &info) == IFX_SUCCESS);
+	CLI_TEST_CHECK(info.n_overflow == 0);
+	CLI_TEST_CHECK(cli_event_limit_rule_get(p_limit, 1, &info) == IFX_SUCCESS);
+	CLI_TEST_CHECK(info.n_overflow == 0);
+	CLI_TEST_CHECK(cli_event_limit_due_get(p_limit, &wait_ms) == 1);
+
+	CLI_TEST_CHECK(cli_event_limit_release(&p_limit) == IFX_SUCCESS);
+
+	return 0;
+}
+
+int main(void)
+{
+	CLI_TEST_RUN(test_event_limit_coalesce);
+	CLI_TEST_RUN(test_event_limit_overflow);
+	CLI_TEST_RUN(test_event_limit_evict);
+
+	return 0;
+}
+
+#else	/* #if (CLI_SUPPORT_EVENT_LIMIT == 1) */
+
+int main(void)
+{
+	return CLI_TEST_SKIP;
+}
+
+#endif	/* #if (CLI_SUPPORT_EVENT_LIMIT == 1) */
@@ -0,0 +1,227 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - unit test of the bounded buffer mode
+   executions (continued execution, execution into a sink).
+
+   - an output which fits is complete, also close to the buffer end
+   - an output cut by the handler (refused write) is reported
+   - a help listing cut by the core is reported
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "lib_cli_out_sink.h"
+#include "cli_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+
+/** output buffer of the continued executions */
+#define TEST_CURSOR_SIZE	1024
+/** user buffer of a chunk */
+#define TEST_CHUNK_SIZE	100
+/** length of an output line of the "fill" command (with the line end) */
+#define TEST_LINE_LEN	64
+/** number of dummy commands, the help listing exceeds the smallest cursor */
+#define TEST_DUMMY_CMDS	32
+
+/** number of output lines of the "fill" command */
+static unsigned int g_fill_lines;
+
+/* writes g_fill_lines lines, stops with the first line which does not fit */
+static int test_cmd_fill(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	unsigned int i, len = 0;
+
+	(void)p_ctx;
+	(void)p_cmd_arg;
+	for (i = 0; i < g_fill_lines; i++)
+	{
+		if (len + TEST_LINE_LEN >= bufsize_max)
+		{
+			cli_exec_overflow_set(IFX_NULL);
+			break;
+		}
+		memset(p_out + len, 'a' + (i % 26), TEST_LINE_LEN - 1);
+		p_out[len + TEST_LINE_LEN - 1] = '\n';
+		len += TEST_LINE_LEN;
+	}
+	p_out[len] = '\0';
+
+	return (int)len;
+}
+
+static int test_cmd_dummy(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	(void)p_ctx;
+	(void)p_cmd_arg;
+
+	return snprintf(p_out, bufsize_max, "errorcode=0\n");
+}
+
+static char g_dummy_keys[TEST_DUMMY_CMDS][2][32];
+
+/* "fill", the dummy commands and the end of the table */
+static struct cli_test_cmd_s g_test_cmds[1 + TEST_DUMMY_CMDS + 1];
+
+static int test_core_init(
+	struct cli_core_context_s **pp_core_ctx)
+{
+	struct cli_test_cmd_s *p_cmd = g_test_cmds;
+	unsigned int i;
+
+	memset(g_test_cmds, 0, sizeof(g_test_cmds));
+	p_cmd->p_short_name = "fill";
+	p_cmd->p_long_name = "fill_lines";
+	p_cmd->fct_buf = test_cmd_fill;
+	for (i = 0; i < TEST_DUMMY_CMDS; i++)
+	{
+		p_cmd++;
+		snprintf(g_dummy_keys[i][0], sizeof(g_dummy_keys[i][0]), "d%u", i);
+		snprintf(g_dummy_keys[i][1], sizeof(g_dummy_keys[i][1]), "dummy_command_%u", i);
+		p_cmd->p_short_name = g_dummy_keys[i][0];
+		p_cmd->p_long_name = g_dummy_keys[i][1];
+		p_cmd->fct_buf = test_cmd_dummy;
+	}
+
+	return cli_test_core_init(pp_core_ctx, cli_cmd_core_out_mode_buffer,
+		CLI_BUILDIN_REG_HELP, g_test_cmds);
+}
+
+/** Collect the chunks of a continued execution, returns the last return
+    value, IFX_ERROR if the chunks differ */
+static int test_exec_cont(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	unsigned int *p_len)
+{
+	struct cli_exec_cursor_s *p_cursor = IFX_NULL;
+	char buf[TEST_CHUNK_SIZE];
+	int ret, first = 0;
+	unsigned int n = 0;
+
+	*p_len = 0;
+	snprintf(buf, sizeof(buf), "%s", p_cmd);
+	do
+	{
+		ret = cli_core_cmd_exec_cont__buffer(p_core_ctx, buf, sizeof(buf), &p_cursor);
+		if (n++ == 0)
+			first = ret;
+		else if (ret != first)
+			ret = IFX_ERROR;
+		if (ret == IFX_ERROR)
+			break;
+		*p_len += (unsigned int)strlen(buf);
+	} while (p_cursor != IFX_NULL);
+	cli_core_exec_cursor_release(&p_cursor);
+
+	return ret;
+}
+
+static int test_exec_cont_complete(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	unsigned int len;
+	int ret;
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+	CLI_TEST_CHECK(cli_core_exec_cursor_size_set(p_core_ctx, TEST_CURSOR_SIZE) == IFX_SUCCESS);
+
+	/* close to the buffer end, but complete */
+	g_fill_lines = (TEST_CURSOR_SIZE - 1) / TEST_LINE_LEN;
+	ret = test_exec_cont(p_core_ctx, "fill", &len);
+	CLI_TEST_CHECK(ret == (int)(g_fill_lines * TEST_LINE_LEN));
+	CLI_TEST_CHECK(len == g_fill_lines * TEST_LINE_LEN);
+
+	/* cut by the handler */
+	g_fill_lines = 2 * TEST_CURSOR_SIZE / TEST_LINE_LEN;
+	ret = test_exec_cont(p_core_ctx, "fill", &len);
+	CLI_TEST_CHECK(ret == CLI_EXEC_TRUNCATED);
+	CLI_TEST_CHECK((len > 0) && (len < TEST_CURSOR_SIZE));
+
+	/* help listing cut by the core */
+	CLI_TEST_CHECK(cli_core_exec_cursor_size_set(p_core_ctx, 256) == IFX_SUCCESS);
+	ret = test_exec_cont(p_core_ctx, "help", &len);
+	CLI_TEST_CHECK(ret == CLI_EXEC_TRUNCATED);
+	CLI_TEST_CHECK((len > 0) && (len < 256));
+
+	/* the complete help listing */
+	CLI_TEST_CHECK(cli_core_exec_cursor_size_set(p_core_ctx, 0) == IFX_SUCCESS);
+	ret = test_exec_cont(p_core_ctx, "help", &len);
+	CLI_TEST_CHECK((ret >= 0) && (len > 256));
+
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_buffer) == 0);
+
+	return 0;
+}
+
+#if (CLI_SUPPORT_OUT_SINK == 1)
+static int test_exec_sink(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct cli_out_sink_s sink;
+	char cmd[16];
+	int ret;
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+
+	/* close to the buffer end, but complete */
+	g_fill_lines = (CLI_OUT_SINK_EXEC_BUFFER_SIZE - 1) / TEST_LINE_LEN;
+	(void)cli_out_sink_init(&sink);
+	snprintf(cmd, sizeof(cmd), "fill");
+	ret = cli_core_cmd_exec__sink(p_core_ctx, cmd, &sink);
+	CLI_TEST_CHECK(ret == (int)(g_fill_lines * TEST_LINE_LEN));
+	CLI_TEST_CHECK(sink.len == g_fill_lines * TEST_LINE_LEN);
+	cli_out_sink_release(&sink);
+
+	/* cut by the handler */
+	g_fill_lines = 2 * CLI_OUT_SINK_EXEC_BUFFER_SIZE / TEST_LINE_LEN;
+	(void)cli_out_sink_init(&sink);
+	snprintf(cmd, sizeof(cmd), "fill");
+	ret = cli_core_cmd_exec__sink(p_core_ctx, cmd, &sink);
+	CLI_TEST_CHECK(ret == CLI_EXEC_TRUNCATED);
+	CLI_TEST_CHECK((sink.len > 0) && (sink.len < CLI_OUT_SINK_EXEC_BUFFER_SIZE));
+	cli_out_sink_release(&sink);
+
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_buffer) == 0);
+
+	return 0;
+}
+#endif	/* #if (CLI_SUPPORT_OUT_SINK == 1) */
+
+int main(void)
+{
+	CLI_TEST_RUN(test_exec_cont_complete);
+#if (CLI_SUPPORT_OUT_SINK == 1)
+	CLI_TEST_RUN(test_exec_sink);
+#endif
+
+	return 0;
+}
+
+#else	/* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+int main(void)
+{
+	return CLI_TEST_SKIP;
+}
+
+#endif	/* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
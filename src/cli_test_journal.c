@@ -0,0 +1,347 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - unit test of the event / dump journal.
+
+   - ring wrap: only the last n_slots entries are kept, in order
+   - entry text cut to the slot size
+   - reopen with the same geometry continues the numbering
+   - concurrent writers on a small ring (entries not mixed, per writer order)
+   - a refused entry is not skipped, "journal <seq>" into a small buffer
+     continues with the first entry which did not fit
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "lib_cli_journal.h"
+#include "cli_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#if (CLI_SUPPORT_JOURNAL == 1)
+
+/** journal file of the test (build directory) */
+#define TEST_JOURNAL_FILE	"cli_test_journal.jrn"
+/** number of slots of the test journal */
+#define TEST_JOURNAL_SLOTS	8
+/** slot size of the test journal */
+#define TEST_JOURNAL_SLOT_SIZE	64
+/** number of concurrent writers */
+#define TEST_WRITERS	4
+/** entries per writer */
+#define TEST_WRITER_ENTRIES	20000
+/** buffer of the "journal <seq>" printout, a few entries + the trailer */
+#define TEST_REPLAY_BUFFER_SIZE	200
+
+/** Collected entries of a read */
+struct test_read_s
+{
+	unsigned int n;
+	unsigned long long seq[TEST_JOURNAL_SLOTS];
+	unsigned int type[TEST_JOURNAL_SLOTS];
+	char text[TEST_JOURNAL_SLOTS][TEST_JOURNAL_SLOT_SIZE];
+};
+
+static int test_read_fct(
+	void *p_data,
+	unsigned long long seq,
+	unsigned long long time_ms,
+	unsigned int type,
+	const char *p_text)
+{
+	struct test_read_s *p_read = (struct test_read_s *)p_data;
+
+	(void)time_ms;
+	if (p_read->n >= TEST_JOURNAL_SLOTS)
+		return 1;
+	p_read->seq[p_read->n] = seq;
+	p_read->type[p_read->n] = type;
+	snprintf(p_read->text[p_read->n], sizeof(p_read->text[0]), "%s", p_text);
+	p_read->n++;
+
+	return 0;
+}
+
+static int test_journal_wrap(void)
+{
+	struct cli_journal_s *p_journal = IFX_NULL;
+	struct test_read_s read;
+	unsigned long long first, next;
+	char text[32];
+	unsigned int i;
+
+	(void)unlink(TEST_JOURNAL_FILE);
+	CLI_TEST_CHECK(cli_journal_open(TEST_JOURNAL_FILE,
+		TEST_JOURNAL_SLOTS, TEST_JOURNAL_SLOT_SIZE, &p_journal) == IFX_SUCCESS);
+
+	for (i = 0; i < 20; i++)
+	{
+		snprintf(text, sizeof(text), "ev %u", i);
+		CLI_TEST_CHECK(cli_journal_append(p_journal,
+			(i & 1) ? CLI_JOURNAL_TYPE_DUMP : CLI_JOURNAL_TYPE_EVENT, text) == IFX_SUCCESS);
+	}
+
+	CLI_TEST_CHECK(cli_journal_seq_get(p_journal, &first, &next) == IFX_SUCCESS);
+	CLI_TEST_CHECK(next == 20);
+	CLI_TEST_CHECK(first == 20 - TEST_JOURNAL_SLOTS);
+
+	/* a read from 0 starts with the oldest kept entry */
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_journal_read(p_journal, 0, 0, test_read_fct, &read, &next) ==
+		TEST_JOURNAL_SLOTS);
+	CLI_TEST_CHECK(next == 20);
+	for (i = 0; i < TEST_JOURNAL_SLOTS; i++)
+	{
+		snprintf(text, sizeof(text), "ev %u", (unsigned int)first + i);
+		CLI_TEST_CHECK(read.seq[i] == first + i);
+		CLI_TEST_CHECK(strcmp(read.text[i], text) == 0);
+		CLI_TEST_CHECK(read.type[i] == (((first + i) & 1) ?
+			CLI_JOURNAL_TYPE_DUMP : CLI_JOURNAL_TYPE_EVENT));
+	}
+
+	/* max_entries and continuation */
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_journal_read(p_journal, 15, 2, test_read_fct, &read, &next) == 2);
+	CLI_TEST_CHECK((read.seq[0] == 15) && (read.seq[1] == 16) && (next == 17));
+
+	CLI_TEST_CHECK(cli_journal_close(&p_journal) == IFX_SUCCESS);
+	CLI_TEST_CHECK(p_journal == IFX_NULL);
+
+	return 0;
+}
+
+static int test_journal_text_cut(void)
+{
+	struct cli_journal_s *p_journal = IFX_NULL;
+	struct test_read_s read;
+	char text[TEST_JOURNAL_SLOT_SIZE * 2];
+	unsigned long long next;
+
+	memset(text, 'x', sizeof(text) - 1);
+	text[sizeof(text) - 1] = '\0';
+
+	CLI_TEST_CHECK(cli_journal_open(TEST_JOURNAL_FILE,
+		TEST_JOURNAL_SLOTS, TEST_JOURNAL_SLOT_SIZE, &p_journal) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_journal_append(p_journal, CLI_JOURNAL_TYPE_EVENT, text) == IFX_SUCCESS);
+
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_journal_read(p_journal, 20, 0, test_read_fct, &read, &next) == 1);
+	CLI_TEST_CHECK(strlen(read.text[0]) > 0);
+	CLI_TEST_CHECK(strlen(read.text[0]) < TEST_JOURNAL_SLOT_SIZE);
+	CLI_TEST_CHECK(strncmp(read.text[0], text, strlen(read.text[0])) == 0);
+
+	CLI_TEST_CHECK(cli_journal_close(&p_journal) == IFX_SUCCESS);
+
+	return 0;
+}
+
+static int test_journal_reopen(void)
+{
+	struct cli_journal_s *p_journal = IFX_NULL;
+	unsigned long long first, next;
+
+	/* same geometry - the numbering continues */
+	CLI_TEST_CHECK(cli_journal_open(TEST_JOURNAL_FILE,
+		TEST_JOURNAL_SLOTS, TEST_JOURNAL_SLOT_SIZE, &p_journal) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_journal_seq_get(p_journal, &first, &next) == IFX_SUCCESS);
+	CLI_TEST_CHECK(next == 21);
+	CLI_TEST_CHECK(cli_journal_close(&p_journal) == IFX_SUCCESS);
+
+	/* other geometry - re-initialized */
+	CLI_TEST_CHECK(cli_journal_open(TEST_JOURNAL_FILE,
+		TEST_JOURNAL_SLOTS * 2, TEST_JOURNAL_SLOT_SIZE, &p_journal) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_journal_seq_get(p_journal, &first, &next) == IFX_SUCCESS);
+	CLI_TEST_CHECK((first == 0) && (next == 0));
+	CLI_TEST_CHECK(cli_journal_close(&p_journal) == IFX_SUCCESS);
+
+	return 0;
+}
+
+/** Read callback which refuses the entries after the first two */
+static int test_read_two_fct(
+	void *p_data,
+	unsigned long long seq,
+	unsigned long long time_ms,
+	unsigned int type,
+	const char *p_text)
+{
+	unsigned int *p_n = (unsigned int *)p_data;
+
+	(void)seq;
+	(void)time_ms;
+	(void)type;
+	(void)p_text;
+	if (*p_n >= 2)
+		return 1;
+	(*p_n)++;
+
+	return 0;
+}
+
+static int test_journal_read_stop(void)
+{
+	struct cli_journal_s *p_journal = IFX_NULL;
+	unsigned long long next;
+	unsigned int n = 0;
+
+	(void)unlink(TEST_JOURNAL_FILE);
+	CLI_TEST_CHECK(cli_journal_open(TEST_JOURNAL_FILE,
+		TEST_JOURNAL_SLOTS, TEST_JOURNAL_SLOT_SIZE, &p_journal) == IFX_SUCCESS);
+	for (n = 0; n < 5; n++)
+		CLI_TEST_CHECK(cli_journal_append(p_journal, CLI_JOURNAL_TYPE_EVENT, "ev") == IFX_SUCCESS);
+
+	/* the third entry is refused - not counted, the next read starts with it */
+	n = 0;
+	CLI_TEST_CHECK(cli_journal_read(p_journal, 0, 0, test_read_two_fct, &n, &next) == 2);
+	CLI_TEST_CHECK((n == 2) && (next == 2));
+
+	CLI_TEST_CHECK(cli_journal_close(&p_journal) == IFX_SUCCESS);
+
+	return 0;
+}
+
+static int test_journal_replay_small_buffer(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	char buf[TEST_REPLAY_BUFFER_SIZE], event[32];
+	unsigned long long seq, next_seq, expected = 0;
+	const char *p_line;
+	unsigned int i, n_calls = 0;
+
+	(void)unlink(TEST_JOURNAL_FILE);
+	CLI_TEST_CHECK(cli_test_core_init(&p_core_ctx, cli_cmd_core_out_mode_buffer,
+		CLI_BUILDIN_REG_JOURNAL, IFX_NULL) == 0);
+	CLI_TEST_CHECK(cli_core_journal_open(p_core_ctx, TEST_JOURNAL_FILE,
+		TEST_JOURNAL_SLOTS, TEST_JOURNAL_SLOT_SIZE) == IFX_SUCCESS);
+
+	for (i = 0; i < TEST_JOURNAL_SLOTS; i++)
+	{
+		snprintf(event, sizeof(event), "ev %u", i);
+		CLI_TEST_CHECK(cli_user_if_event(p_core_ctx, event) == IFX_SUCCESS);
+	}
+
+	/* replay in pieces: each printout ends with the trailer, next_seq is
+	   the first entry which is not printed */
+	while (expected < TEST_JOURNAL_SLOTS)
+	{
+		CLI_TEST_CHECK(++n_calls <= TEST_JOURNAL_SLOTS);
+		snprintf(buf, sizeof(buf), "journal %llu", expected);
+		(void)cli_core_cmd_exec__buffer(p_core_ctx, buf, sizeof(buf));
+
+		for (p_line = buf; sscanf(p_line, "seq=%llu", &seq) == 1; )
+		{
+			CLI_TEST_CHECK(seq == expected);
+			expected++;
+			p_line = strchr(p_line, '\n');
+			CLI_TEST_CHECK(p_line != IFX_NULL);
+			p_line += strspn(p_line, "\r\n");
+		}
+		CLI_TEST_CHECK(sscanf(p_line, "errorcode=0 next_seq=%llu", &next_seq) == 1);
+		CLI_TEST_CHECK(next_seq == expected);
+	}
+	/* several entries per call, but not all in one */
+	CLI_TEST_CHECK((n_calls > 1) && (n_calls < TEST_JOURNAL_SLOTS));
+
+	CLI_TEST_CHECK(cli_core_journal_close(p_core_ctx) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_buffer) == 0);
+
+	return 0;
+}
+
+/** Writer thread argument */
+struct test_writer_s
+{
+	struct cli_journal_s *p_journal;
+	unsigned int id;
+};
+
+static void *test_writer_thread(void *p_arg)
+{
+	struct test_writer_s *p_writer = (struct test_writer_s *)p_arg;
+	char text[32];
+	unsigned int i;
+
+	for (i = 0; i < TEST_WRITER_ENTRIES; i++)
+	{
+		snprintf(text, sizeof(text), "w%u %u", p_writer->id, i);
+		(void)cli_journal_append(p_writer->p_journal, 1 + (p_writer->id & 1), text);
+	}
+
+	return IFX_NULL;
+}
+
+static int test_journal_writers(void)
+{
+	struct cli_journal_s *p_journal = IFX_NULL;
+	struct test_writer_s writer[TEST_WRITERS];
+	pthread_t thread[TEST_WRITERS];
+	struct test_read_s read;
+	unsigned long long next;
+	unsigned int i, id, n, last[TEST_WRITERS];
+
+	(void)unlink(TEST_JOURNAL_FILE);
+	CLI_TEST_CHECK(cli_journal_open(TEST_JOURNAL_FILE,
+		TEST_JOURNAL_SLOTS, TEST_JOURNAL_SLOT_SIZE, &p_journal) == IFX_SUCCESS);
+
+	for (i = 0; i < TEST_WRITERS; i++)
+	{
+		writer[i].p_journal = p_journal;
+		writer[i].id = i;
+		CLI_TEST_CHECK(pthread_create(&thread[i], IFX_NULL, test_writer_thread, &writer[i]) == 0);
+	}
+	for (i = 0; i < TEST_WRITERS; i++)
+		(void)pthread_join(thread[i], IFX_NULL);
+
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_journal_read(p_journal, 0, 0, test_read_fct, &read, &next) > 0);
+	CLI_TEST_CHECK(next == TEST_WRITERS * TEST_WRITER_ENTRIES);
+
+	/* each entry complete (type matches the writer), per writer in order */
+	memset(last, 0x00, sizeof(last));
+	for (i = 0; i < read.n; i++)
+	{
+		CLI_TEST_CHECK(sscanf(read.text[i], "w%u %u", &id, &n) == 2);
+		CLI_TEST_CHECK(id < TEST_WRITERS);
+		CLI_TEST_CHECK(read.type[i] == 1 + (id & 1));
+		/* last[]: next expected minimum of the writer */
+		CLI_TEST_CHECK(n >= last[id]);
+		last[id] = n + 1;
+	}
+
+	CLI_TEST_CHECK(cli_journal_close(&p_journal) == IFX_SUCCESS);
+	(void)unlink(TEST_JOURNAL_FILE);
+
+	return 0;
+}
+
+int main(void)
+{
+	CLI_TEST_RUN(test_journal_wrap);
+	CLI_TEST_RUN(test_journal_text_cut);
+	CLI_TEST_RUN(test_journal_reopen);
+	CLI_TEST_RUN(test_journal_read_stop);
+	CLI_TEST_RUN(test_journal_replay_small_buffer);
+	CLI_TEST_RUN(test_journal_writers);
+
+	(void)unlink(TEST_JOURNAL_FILE);
+	return 0;
+}
+
+#else	/* #if (CLI_SUPPORT_JOURNAL == 1) */
+
+int main(void)
+{
+	return CLI_TEST_SKIP;
+}
+
+#endif	/* #if (CLI_SUPPORT_JOURNAL == 1) */
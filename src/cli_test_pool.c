@@ -0,0 +1,551 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - unit test of the executor pool.
+
+   - concurrent jobs run in parallel, exclusive jobs alone
+   - an exclusive job is not starved by a stream of concurrent jobs
+   - command classification (CLI_CMD_MASK_CONCURRENT) and execution by
+     cli_pool_cmd_exec__file
+   - release completes the queued jobs with IFX_ERROR
+   - interactive lane first, weighted fair queueing of the sessions
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "lib_cli_pool.h"
+#include "cli_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#if (CLI_SUPPORT_POOL == 1)
+
+/** number of workers of the test pool */
+#define TEST_WORKERS	4
+/** number of jobs of a test run */
+#define TEST_JOBS	200
+/** number of submitting threads */
+#define TEST_THREADS	8
+/** command lines per submitting thread */
+#define TEST_THREAD_CMDS	200
+
+/** Running jobs, shared by the job functions */
+struct test_run_s
+{
+	pthread_mutex_t lock;
+	/** running concurrent jobs */
+	unsigned int n_concurrent;
+	/** running exclusive jobs */
+	unsigned int n_exclusive;
+	/** max number of parallel concurrent jobs */
+	unsigned int n_concurrent_max;
+	/** number of overlaps with an exclusive job */
+	unsigned int n_bad;
+	/** start order */
+	unsigned int n_started;
+	/** number of completed jobs */
+	unsigned int n_done;
+	/** number of jobs completed with IFX_ERROR */
+	unsigned int n_done_err;
+	/** hold the jobs until set */
+	int b_go;
+};
+
+static struct test_run_s g_run;
+
+/** Job of the tests */
+struct test_job_s
+{
+	struct cli_pool_job_s job;
+	/** start position */
+	unsigned int start;
+};
+
+static void test_run_reset(void)
+{
+	pthread_mutex_lock(&g_run.lock);
+	g_run.n_concurrent = 0;
+	g_run.n_exclusive = 0;
+	g_run.n_concurrent_max = 0;
+	g_run.n_bad = 0;
+	g_run.n_started = 0;
+	g_run.n_done = 0;
+	g_run.n_done_err = 0;
+	g_run.b_go = 1;
+	pthread_mutex_unlock(&g_run.lock);
+}
+
+static int test_go_get(void)
+{
+	int b_go;
+
+	pthread_mutex_lock(&g_run.lock);
+	b_go = g_run.b_go;
+	pthread_mutex_unlock(&g_run.lock);
+
+	return b_go;
+}
+
+/** Enter / leave a job, counts the overlaps */
+static void test_job_enter(
+	int b_concurrent,
+	unsigned int *p_start)
+{
+	pthread_mutex_lock(&g_run.lock);
+	if (p_start != IFX_NULL)
+		*p_start = g_run.n_started;
+	g_run.n_started++;
+	if (g_run.n_exclusive != 0)
+		g_run.n_bad++;
+	if (b_concurrent)
+	{
+		g_run.n_concurrent++;
+		if (g_run.n_concurrent > g_run.n_concurrent_max)
+			g_run.n_concurrent_max = g_run.n_concurrent;
+	}
+	else
+	{
+		if (g_run.n_concurrent != 0)
+			g_run.n_bad++;
+		g_run.n_exclusive++;
+	}
+	pthread_mutex_unlock(&g_run.lock);
+}
+
+static void test_job_leave(
+	int b_concurrent)
+{
+	pthread_mutex_lock(&g_run.lock);
+	if (b_concurrent)
+		g_run.n_concurrent--;
+	else
+		g_run.n_exclusive--;
+	pthread_mutex_unlock(&g_run.lock);
+}
+
+static int test_job_fct(
+	void *p_data)
+{
+	struct test_job_s *p_job = (struct test_job_s *)p_data;
+
+	while (!test_go_get())
+		usleep(100);
+
+	test_job_enter(p_job->job.b_concurrent, &p_job->start);
+	usleep(300);
+	test_job_leave(p_job->job.b_concurrent);
+
+	return IFX_SUCCESS;
+}
+
+static void test_done_fct(
+	void *p_data,
+	int ret)
+{
+	(void)p_data;
+
+	pthread_mutex_lock(&g_run.lock);
+	g_run.n_done++;
+	if (ret == IFX_ERROR)
+		g_run.n_done_err++;
+	pthread_mutex_unlock(&g_run.lock);
+}
+
+static unsigned int test_done_get(void)
+{
+	unsigned int n_done;
+
+	pthread_mutex_lock(&g_run.lock);
+	n_done = g_run.n_done;
+	pthread_mutex_unlock(&g_run.lock);
+
+	return n_done;
+}
+
+static void test_job_set(
+	struct test_job_s *p_job,
+	int b_concurrent,
+	unsigned int session)
+{
+	memset(p_job, 0x00, sizeof(struct test_job_s));
+	p_job->job.job_fct = test_job_fct;
+	p_job->job.done_fct = test_done_fct;
+	p_job->job.p_data = p_job;
+	p_job->job.b_concurrent = b_concurrent;
+	p_job->job.session = session;
+}
+
+static int test_pool_gating(void)
+{
+	static struct test_job_s jobs[TEST_JOBS];
+	struct cli_pool_s *p_pool = IFX_NULL;
+	unsigned int i;
+
+	CLI_TEST_CHECK(cli_pool_init(&p_pool, 0) == IFX_ERROR);
+	CLI_TEST_CHECK(cli_pool_init(&p_pool, TEST_WORKERS) == IFX_SUCCESS);
+	test_run_reset();
+
+	/* mixed jobs of several sessions, every 10th one exclusive */
+	for (i = 0; i < TEST_JOBS; i++)
+	{
+		test_job_set(&jobs[i], (i % 10) != 0, i % 3);
+		CLI_TEST_CHECK(cli_pool_submit(p_pool, &jobs[i].job) == IFX_SUCCESS);
+	}
+	while (test_done_get() < TEST_JOBS)
+		usleep(1000);
+
+	CLI_TEST_CHECK(g_run.n_bad == 0);
+	CLI_TEST_CHECK(g_run.n_done_err == 0);
+	CLI_TEST_CHECK(g_run.n_concurrent_max > 1);
+	CLI_TEST_CHECK(g_run.n_concurrent_max <= TEST_WORKERS);
+
+	/* synchronous run */
+	CLI_TEST_CHECK(cli_pool_run(p_pool, 1, test_job_fct, &jobs[0], 0) == IFX_SUCCESS);
+
+	CLI_TEST_CHECK(cli_pool_release(&p_pool) == IFX_SUCCESS);
+	CLI_TEST_CHECK(p_pool == IFX_NULL);
+
+	return 0;
+}
+
+static int test_pool_no_starvation(void)
+{
+	static struct test_job_s jobs[TEST_JOBS];
+	struct cli_pool_s *p_pool = IFX_NULL;
+	unsigned int i, excl = TEST_JOBS / 4;
+
+	CLI_TEST_CHECK(cli_pool_init(&p_pool, TEST_WORKERS) == IFX_SUCCESS);
+	test_run_reset();
+	g_run.b_go = 0;
+
+	/* a stream of concurrent jobs with a single exclusive job in between */
+	for (i = 0; i < TEST_JOBS; i++)
+	{
+		test_job_set(&jobs[i], (i != excl), 1);
+		CLI_TEST_CHECK(cli_pool_submit(p_pool, &jobs[i].job) == IFX_SUCCESS);
+	}
+	pthread_mutex_lock(&g_run.lock);
+	g_run.b_go = 1;
+	pthread_mutex_unlock(&g_run.lock);
+	while (test_done_get() < TEST_JOBS)
+		usleep(1000);
+
+	CLI_TEST_CHECK(g_run.n_bad == 0);
+	/* the following jobs wait for the exclusive job */
+	CLI_TEST_CHECK(jobs[excl].start == excl);
+	for (i = excl + 1; i < TEST_JOBS; i++)
+		CLI_TEST_CHECK(jobs[i].start > excl);
+
+	CLI_TEST_CHECK(cli_pool_release(&p_pool) == IFX_SUCCESS);
+
+	return 0;
+}
+
+static void *test_go_thread(void *p_arg)
+{
+	(void)p_arg;
+
+	usleep(50000);
+	pthread_mutex_lock(&g_run.lock);
+	g_run.b_go = 1;
+	pthread_mutex_unlock(&g_run.lock);
+
+	return IFX_NULL;
+}
+
+static int test_pool_release(void)
+{
+	static struct test_job_s jobs[TEST_JOBS];
+	struct cli_pool_s *p_pool = IFX_NULL;
+	pthread_t thread;
+	unsigned int i;
+
+	CLI_TEST_CHECK(cli_pool_init(&p_pool, 1) == IFX_SUCCESS);
+	test_run_reset();
+	g_run.b_go = 0;
+
+	for (i = 0; i < TEST_JOBS; i++)
+	{
+		test_job_set(&jobs[i], 0, 1);
+		CLI_TEST_CHECK(cli_pool_submit(p_pool, &jobs[i].job) == IFX_SUCCESS);
+	}
+
+	/* release while the first job is running, the job ends later */
+	usleep(10000);
+	CLI_TEST_CHECK(pthread_create(&thread, IFX_NULL, test_go_thread, IFX_NULL) == 0);
+	CLI_TEST_CHECK(cli_pool_release(&p_pool) == IFX_SUCCESS);
+	(void)pthread_join(thread, IFX_NULL);
+
+	/* each job completed once, the queued ones not executed */
+	CLI_TEST_CHECK(g_run.n_done == TEST_JOBS);
+	CLI_TEST_CHECK(g_run.n_started == 1);
+	CLI_TEST_CHECK(g_run.n_done_err == TEST_JOBS - 1);
+
+	return 0;
+}
+
+/* command handlers of the core test, "rd" concurrent, "wr" exclusive */
+static int test_cmd_rd(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	(void)p_ctx;
+	(void)p_cmd_arg;
+
+	test_job_enter(1, IFX_NULL);
+	usleep(200);
+	test_job_leave(1);
+
+	return fprintf((FILE *)p_out, "errorcode=0\n");
+}
+
+static int test_cmd_wr(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	(void)p_ctx;
+	(void)p_cmd_arg;
+
+	test_job_enter(0, IFX_NULL);
+	usleep(200);
+	test_job_leave(0);
+
+	return fprintf((FILE *)p_out, "errorcode=0\n");
+}
+
+static const struct cli_test_cmd_s g_test_cmds[] =
+{
+	{CLI_CMD_MASK_CONCURRENT, "rd", "read_x", IFX_NULL, test_cmd_rd},
+	{0, "wr", "write_x", IFX_NULL, test_cmd_wr},
+	{0, IFX_NULL, IFX_NULL, IFX_NULL, IFX_NULL}
+};
+
+/** Submitting thread of the core test */
+struct test_thread_s
+{
+	struct cli_pool_s *p_pool;
+	struct cli_core_context_s *p_core_ctx;
+	unsigned int id;
+};
+
+static void *test_exec_thread(void *p_arg)
+{
+	struct test_thread_s *p_thread = (struct test_thread_s *)p_arg;
+	FILE *p_null;
+	char cmd[64];
+	unsigned int i;
+
+	p_null = fopen("/dev/null", "w");
+	if (p_null == IFX_NULL)
+		return IFX_NULL;
+
+	for (i = 0; i < TEST_THREAD_CMDS; i++)
+	{
+		snprintf(cmd, sizeof(cmd), "%s",
+			((i % TEST_THREADS) == p_thread->id) ? "wr 1" : "rd 1\nread_x 2\nhelp");
+		(void)cli_pool_cmd_exec__file(p_thread->p_pool, p_thread->id,
+			p_thread->p_core_ctx, cmd, p_null);
+	}
+	fclose(p_null);
+
+	return IFX_NULL;
+}
+
+static int test_pool_cmd_exec(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct cli_pool_s *p_pool = IFX_NULL;
+	struct test_thread_s thread_arg[TEST_THREADS];
+	pthread_t thread[TEST_THREADS];
+	unsigned int i;
+
+	CLI_TEST_CHECK(cli_test_core_init(&p_core_ctx, cli_cmd_core_out_mode_file,
+		CLI_USER_MASK_ALL, g_test_cmds) == 0);
+
+	CLI_TEST_CHECK(cli_core_cmd_concurrent_get(p_core_ctx, "rd 1") == IFX_TRUE);
+	CLI_TEST_CHECK(cli_core_cmd_concurrent_get(p_core_ctx, "read_x") == IFX_TRUE);
+	CLI_TEST_CHECK(cli_core_cmd_concurrent_get(p_core_ctx, "write_x") == IFX_FALSE);
+	CLI_TEST_CHECK(cli_core_cmd_concurrent_get(p_core_ctx, "rd\r\nwr 2") == IFX_FALSE);
+	CLI_TEST_CHECK(cli_core_cmd_concurrent_get(p_core_ctx, "  help") == IFX_TRUE);
+
+	CLI_TEST_CHECK(cli_pool_init(&p_pool, TEST_WORKERS) == IFX_SUCCESS);
+	test_run_reset();
+
+	for (i = 0; i < TEST_THREADS; i++)
+	{
+		thread_arg[i].p_pool = p_pool;
+		thread_arg[i].p_core_ctx = p_core_ctx;
+		thread_arg[i].id = i;
+		CLI_TEST_CHECK(pthread_create(&thread[i], IFX_NULL, test_exec_thread, &thread_arg[i]) == 0);
+	}
+	for (i = 0; i < TEST_THREADS; i++)
+		(void)pthread_join(thread[i], IFX_NULL);
+
+	CLI_TEST_CHECK(g_run.n_bad == 0);
+	CLI_TEST_CHECK(g_run.n_concurrent_max > 1);
+
+	CLI_TEST_CHECK(cli_pool_release(&p_pool) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+
+	return 0;
+}
+
+/** Queue metrics of the fairness test */
+struct test_walk_s
+{
+	unsigned long long n_jobs[4];
+	unsigned long long n_jobs_interactive;
+};
+
+static int test_walk_fct(
+	void *p_data,
+	const struct cli_pool_queue_stats_s *p_stats)
+{
+	struct test_walk_s *p_walk = (struct test_walk_s *)p_data;
+
+	if (p_stats->session == CLI_POOL_SESSION_INTERACTIVE)
+		p_walk->n_jobs_interactive = p_stats->n_jobs;
+	else if (p_stats->session < 4)
+		p_walk->n_jobs[p_stats->session] = p_stats->n_jobs;
+
+	return 0;
+}
+
+static int test_pool_fairness(void)
+{
+	static struct test_job_s jobs[TEST_JOBS];
+	struct cli_pool_s *p_pool = IFX_NULL;
+	struct test_walk_s walk;
+	unsigned int i, k = 0, n_1 = 0, n_3 = 0;
+	unsigned int first_2, last_2 = 0, interactive;
+
+	/* one worker - the start order is the scheduling order */
+	CLI_TEST_CHECK(cli_pool_init(&p_pool, 1) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_pool_session_weight_set(p_pool, 3, 0) == IFX_ERROR);
+	CLI_TEST_CHECK(cli_pool_session_weight_set(p_pool, 3, CLI_POOL_WEIGHT_MAX + 1) == IFX_ERROR);
+	CLI_TEST_CHECK(cli_pool_session_weight_set(p_pool,
+		CLI_POOL_SESSION_INTERACTIVE, CLI_POOL_WEIGHT_DEFAULT) == IFX_ERROR);
+	CLI_TEST_CHECK(cli_pool_session_weight_set(p_pool, 3, 2 * CLI_POOL_WEIGHT_DEFAULT) == IFX_SUCCESS);
+	test_run_reset();
+	g_run.b_go = 0;
+
+	/* the blocker occupies the worker while the queues are filled */
+	test_job_set(&jobs[k], 0, 0);
+	CLI_TEST_CHECK(cli_pool_submit(p_pool, &jobs[k++].job) == IFX_SUCCESS);
+	usleep(20000);
+
+	/* bulk script of session 1, then session 2, session 3 double weight */
+	for (i = 0; i < 100; i++)
+	{
+		test_job_set(&jobs[k], 1, 1);
+		CLI_TEST_CHECK(cli_pool_submit(p_pool, &jobs[k++].job) == IFX_SUCCESS);
+	}
+	first_2 = k;
+	for (i = 0; i < 10; i++)
+	{
+		test_job_set(&jobs[k], 1, 2);
+		CLI_TEST_CHECK(cli_pool_submit(p_pool, &jobs[k++].job) == IFX_SUCCESS);
+	}
+	for (i = 0; i < 60; i++)
+	{
+		test_job_set(&jobs[k], 1, 3);
+		CLI_TEST_CHECK(cli_pool_submit(p_pool, &jobs[k++].job) == IFX_SUCCESS);
+	}
+	interactive = k;
+	test_job_set(&jobs[k], 1, CLI_POOL_SESSION_INTERACTIVE);
+	CLI_TEST_CHECK(cli_pool_submit(p_pool, &jobs[k++].job) == IFX_SUCCESS);
+
+	pthread_mutex_lock(&g_run.lock);
+	g_run.b_go = 1;
+	pthread_mutex_unlock(&g_run.lock);
+	while (test_done_get() < k)
+		usleep(1000);
+
+	/* the interactive lane is served first (after the blocker) */
+	CLI_TEST_CHECK(jobs[0].start == 0);
+	CLI_TEST_CHECK(jobs[interactive].start == 1);
+
+	/* session 2 is not delayed by the bulk script of session 1, it gets
+	   its share (1/4) of the starts, FIFO order would start it after 111 */
+	for (i = first_2; i < first_2 + 10; i++)
+		if (jobs[i].start > last_2)
+			last_2 = jobs[i].start;
+	CLI_TEST_CHECK(last_2 < 2 + 10 * 4 + 10);
+
+	/* session 3 (double weight) gets about twice the starts of session 1
+	   while both are active */
+	for (i = 1; i < k; i++)
+	{
+		if (jobs[i].start >= 2 + 60)
+			continue;
+		if (jobs[i].job.session == 1)
+			n_1++;
+		else if (jobs[i].job.session == 3)
+			n_3++;
+	}
+	CLI_TEST_CHECK((n_3 >= n_1 + n_1 / 2) && (n_3 <= 3 * n_1));
+
+	/* queue metrics */
+	memset(&walk, 0x00, sizeof(walk));
+	CLI_TEST_CHECK(cli_pool_queue_walk(p_pool, test_walk_fct, &walk) == IFX_SUCCESS);
+	CLI_TEST_CHECK((walk.n_jobs[1] == 100) && (walk.n_jobs[2] == 10) && (walk.n_jobs[3] == 60));
+	CLI_TEST_CHECK(walk.n_jobs_interactive == 1);
+
+	CLI_TEST_CHECK(cli_pool_release(&p_pool) == IFX_SUCCESS);
+
+	return 0;
+}
+
+static int test_pool_interactive_get(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+
+	CLI_TEST_CHECK(cli_test_core_init(&p_core_ctx, cli_cmd_core_out_mode_file,
+		CLI_USER_MASK_ALL, g_test_cmds) == 0);
+
+	CLI_TEST_CHECK(cli_core_cmd_interactive_get(p_core_ctx, "help") == IFX_TRUE);
+	CLI_TEST_CHECK(cli_core_cmd_interactive_get(p_core_ctx, "rd -h") == IFX_TRUE);
+	CLI_TEST_CHECK(cli_core_cmd_interactive_get(p_core_ctx, "rd") == IFX_FALSE);
+	CLI_TEST_CHECK(cli_core_cmd_interactive_get(p_core_ctx, "help\nrd") == IFX_FALSE);
+	CLI_TEST_CHECK(cli_core_cmd_interactive_get(p_core_ctx, "\n") == IFX_FALSE);
+
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+
+	return 0;
+}
+
+int main(void)
+{
+	pthread_mutex_init(&g_run.lock, IFX_NULL);
+
+	CLI_TEST_RUN(test_pool_gating);
+	CLI_TEST_RUN(test_pool_no_starvation);
+	CLI_TEST_RUN(test_pool_release);
+	CLI_TEST_RUN(test_pool_cmd_exec);
+	CLI_TEST_RUN(test_pool_fairness);
+	CLI_TEST_RUN(test_pool_interactive_get);
+
+	pthread_mutex_destroy(&g_run.lock);
+	return 0;
+}
+
+#else	/* #if (CLI_SUPPORT_POOL == 1) */
+
+int main(void)
+{
+	return CLI_TEST_SKIP;
+}
+
+#endif	/* #if (CLI_SUPPORT_POOL == 1) */
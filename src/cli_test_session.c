@@ -0,0 +1,547 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - unit test of the sessions.
+
+   - concurrent execution, each handler sees its own session
+   - event delivery to the subscribed sessions
+   - unsubscribe / close wait for a running callback, no callback after
+     the return
+   - unsubscribe and close from within an event callback
+   - deferred release of the CLI core with the last session
+   - output format per session (structured output)
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "lib_cli_session.h"
+#include "cli_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#if (CLI_SUPPORT_SESSION == 1)
+
+/** number of sessions / threads */
+#define TEST_SESSIONS	4
+/** command executions per thread */
+#define TEST_EXECS	2000
+/** open / close cycles per churn thread */
+#define TEST_CHURN	500
+
+static pthread_mutex_t g_lock = PTHREAD_MUTEX_INITIALIZER;
+/** number of failed checks within callbacks and handlers */
+static unsigned int g_n_bad;
+
+static void test_bad_add(void)
+{
+	pthread_mutex_lock(&g_lock);
+	g_n_bad++;
+	pthread_mutex_unlock(&g_lock);
+}
+
+static unsigned int test_bad_get(void)
+{
+	unsigned int n_bad;
+
+	pthread_mutex_lock(&g_lock);
+	n_bad = g_n_bad;
+	pthread_mutex_unlock(&g_lock);
+
+	return n_bad;
+}
+
+/* the user data of a session is its instance number + 1 */
+static int test_cmd_who(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	struct cli_session_s *p_session = cli_session_get();
+
+	(void)p_cmd_arg;
+	if ((p_session == IFX_NULL) ||
+	    ((unsigned long)p_ctx != (unsigned long)cli_session_inst_num_get(p_session) + 1) ||
+	    (cli_session_user_data_get(p_session) != p_ctx))
+		test_bad_add();
+
+	return fprintf((FILE *)p_out, "errorcode=0\n");
+}
+
+static const struct cli_test_cmd_s g_test_cmds[] =
+{
+	{0, "who", "who_am_i", IFX_NULL, test_cmd_who},
+	{0, IFX_NULL, IFX_NULL, IFX_NULL, IFX_NULL}
+};
+
+static int test_core_init(
+	struct cli_core_context_s **pp_core_ctx)
+{
+	return cli_test_core_init(pp_core_ctx, cli_cmd_core_out_mode_file,
+		CLI_USER_MASK_ALL, g_test_cmds);
+}
+
+static void test_event_send(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_event)
+{
+	char event[64];
+
+	snprintf(event, sizeof(event), "%s", p_event);
+	(void)cli_user_if_event(p_core_ctx, event);
+}
+
+/** Event counter of a session */
+struct test_count_s
+{
+	unsigned int n;
+	/** set after the close / unsubscribe returned */
+	int b_closed;
+	/** callback running */
+	int b_running;
+};
+
+static int test_event_count(
+	void *p_data,
+	char *p_event)
+{
+	struct test_count_s *p_count = (struct test_count_s *)p_data;
+
+	(void)p_event;
+	pthread_mutex_lock(&g_lock);
+	if (p_count->b_closed)
+		g_n_bad++;
+	p_count->n++;
+	pthread_mutex_unlock(&g_lock);
+
+	return 0;
+}
+
+static struct cli_session_s *g_p_session[TEST_SESSIONS];
+
+static void *test_exec_thread(void *p_arg)
+{
+	unsigned long id = (unsigned long)p_arg;
+	FILE *p_null;
+	char cmd[64];
+	unsigned int i;
+
+	p_null = fopen("/dev/null", "w");
+	if (p_null == IFX_NULL)
+		return IFX_NULL;
+	for (i = 0; i < TEST_EXECS; i++)
+	{
+		snprintf(cmd, sizeof(cmd), "%s", (i & 1) ? "who" : "who_am_i");
+		(void)cli_session_cmd_exec__file(g_p_session[id], cmd, p_null);
+	}
+	fclose(p_null);
+
+	return IFX_NULL;
+}
+
+/** Execute "who" within a session, check the printout */
+static int test_session_exec_check(
+	struct cli_session_s *p_session)
+{
+	FILE *p_file;
+	char buf[256];
+
+	p_file = tmpfile();
+	CLI_TEST_CHECK(p_file != IFX_NULL);
+	snprintf(buf, sizeof(buf), "who");
+	CLI_TEST_CHECK(cli_session_cmd_exec__file(p_session, buf, p_file) >= 0);
+	rewind(p_file);
+	memset(buf, 0x00, sizeof(buf));
+	CLI_TEST_CHECK(fread(buf, 1, sizeof(buf) - 1, p_file) > 0);
+	fclose(p_file);
+	CLI_TEST_CHECK(strstr(buf, "errorcode=0") != IFX_NULL);
+	CLI_TEST_CHECK(test_bad_get() == 0);
+
+	return 0;
+}
+
+static int test_session_exec(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct test_count_s count[TEST_SESSIONS];
+	pthread_t thread[TEST_SESSIONS];
+	unsigned long i;
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+	memset(count, 0x00, sizeof(count));
+
+	for (i = 0; i < TEST_SESSIONS; i++)
+	{
+		CLI_TEST_CHECK(cli_session_open(p_core_ctx, (unsigned int)i,
+			(void *)(i + 1), &g_p_session[i]) == IFX_SUCCESS);
+		CLI_TEST_CHECK(cli_session_subscribe(g_p_session[i], test_event_count, &count[i]) == IFX_SUCCESS);
+	}
+	CLI_TEST_CHECK(cli_core_num_of_sessions_get(p_core_ctx) == TEST_SESSIONS);
+	/* unsubscribed */
+	CLI_TEST_CHECK(cli_session_subscribe(g_p_session[TEST_SESSIONS - 1], IFX_NULL, IFX_NULL) == IFX_SUCCESS);
+
+	for (i = 0; i < TEST_SESSIONS; i++)
+		CLI_TEST_CHECK(pthread_create(&thread[i], IFX_NULL, test_exec_thread, (void *)i) == 0);
+	for (i = 0; i < TEST_SESSIONS; i++)
+		(void)pthread_join(thread[i], IFX_NULL);
+	CLI_TEST_CHECK(test_bad_get() == 0);
+
+	/* the session is set during the execution only */
+	CLI_TEST_CHECK(test_session_exec_check(g_p_session[1]) == 0);
+	CLI_TEST_CHECK(cli_session_get() == IFX_NULL);
+
+	test_event_send(p_core_ctx, "EVT x");
+	for (i = 0; i < TEST_SESSIONS - 1; i++)
+		CLI_TEST_CHECK(count[i].n == 1);
+	CLI_TEST_CHECK(count[TEST_SESSIONS - 1].n == 0);
+
+	for (i = 0; i < TEST_SESSIONS; i++)
+	{
+		CLI_TEST_CHECK(cli_session_close(&g_p_session[i]) == IFX_SUCCESS);
+		CLI_TEST_CHECK(g_p_session[i] == IFX_NULL);
+	}
+	CLI_TEST_CHECK(cli_core_num_of_sessions_get(p_core_ctx) == 0);
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+
+	return 0;
+}
+
+static struct cli_session_s *g_p_self;
+static struct cli_session_s *g_p_victim;
+static struct cli_core_context_s *g_p_core_ctx;
+static unsigned int g_n_self;
+
+/* unsubscribes its own session */
+static int test_event_self(
+	void *p_data,
+	char *p_event)
+{
+	(void)p_data;
+	(void)p_event;
+	g_n_self++;
+	if (cli_session_subscribe(g_p_self, IFX_NULL, IFX_NULL) != IFX_SUCCESS)
+		test_bad_add();
+
+	return 0;
+}
+
+/* closes another session, opens and closes a new one */
+static int test_event_closer(
+	void *p_data,
+	char *p_event)
+{
+	struct cli_session_s *p_session = IFX_NULL;
+
+	(void)p_data;
+	(void)p_event;
+	if (g_p_victim != IFX_NULL)
+	{
+		if (cli_session_close(&g_p_victim) != IFX_SUCCESS)
+			test_bad_add();
+	}
+	if ((cli_session_open(g_p_core_ctx, 9, IFX_NULL, &p_session) != IFX_SUCCESS) ||
+	    (cli_session_close(&p_session) != IFX_SUCCESS))
+		test_bad_add();
+
+	return 0;
+}
+
+static int test_session_callback(void)
+{
+	struct cli_session_s *p_closer = IFX_NULL;
+	struct test_count_s count;
+
+	CLI_TEST_CHECK(test_core_init(&g_p_core_ctx) == 0);
+	memset(&count, 0x00, sizeof(count));
+
+	CLI_TEST_CHECK(cli_session_open(g_p_core_ctx, 1, IFX_NULL, &g_p_self) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_session_subscribe(g_p_self, test_event_self, IFX_NULL) == IFX_SUCCESS);
+	test_event_send(g_p_core_ctx, "E1 a");
+	test_event_send(g_p_core_ctx, "E1 b");
+	CLI_TEST_CHECK(g_n_self == 1);
+
+	CLI_TEST_CHECK(cli_session_open(g_p_core_ctx, 3, IFX_NULL, &p_closer) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_session_subscribe(p_closer, test_event_closer, IFX_NULL) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_session_open(g_p_core_ctx, 2, IFX_NULL, &g_p_victim) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_session_subscribe(g_p_victim, test_event_count, &count) == IFX_SUCCESS);
+	test_event_send(g_p_core_ctx, "E2 a");
+	CLI_TEST_CHECK(g_p_victim == IFX_NULL);
+	CLI_TEST_CHECK(test_bad_get() == 0);
+	CLI_TEST_CHECK(cli_core_num_of_sessions_get(g_p_core_ctx) == 2);
+
+	CLI_TEST_CHECK(cli_session_close(&p_closer) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_session_close(&g_p_self) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_test_core_release(&g_p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+
+	return 0;
+}
+
+static int g_b_stop;
+static unsigned int g_n_churn_done;
+
+static int test_stop_get(void)
+{
+	int b_stop;
+
+	pthread_mutex_lock(&g_lock);
+	b_stop = g_b_stop;
+	pthread_mutex_unlock(&g_lock);
+
+	return b_stop;
+}
+
+/* a slow callback, the close must wait for it */
+static int test_event_slow(
+	void *p_data,
+	char *p_event)
+{
+	struct test_count_s *p_count = (struct test_count_s *)p_data;
+
+	(void)p_event;
+	pthread_mutex_lock(&g_lock);
+	if (p_count->b_closed)
+		g_n_bad++;
+	p_count->n++;
+	p_count->b_running = 1;
+	pthread_mutex_unlock(&g_lock);
+
+	usleep(50);
+
+	pthread_mutex_lock(&g_lock);
+	p_count->b_running = 0;
+	pthread_mutex_unlock(&g_lock);
+
+	return 0;
+}
+
+static void *test_churn_thread(void *p_arg)
+{
+	struct cli_core_context_s *p_core_ctx = (struct cli_core_context_s *)p_arg;
+	struct test_count_s *p_count;
+	struct cli_session_s *p_session;
+	unsigned int i, n, wait;
+
+	/* one counter per cycle, a late callback finds b_closed set */
+	p_count = (struct test_count_s *)calloc(TEST_CHURN, sizeof(struct test_count_s));
+	if (p_count == IFX_NULL)
+	{
+		test_bad_add();
+		return IFX_NULL;
+	}
+
+	for (i = 0; i < TEST_CHURN; i++)
+	{
+		p_session = IFX_NULL;
+		if (cli_session_open(p_core_ctx, 1, IFX_NULL, &p_session) != IFX_SUCCESS)
+		{
+			test_bad_add();
+			break;
+		}
+		(void)cli_session_subscribe(p_session, test_event_count, &p_count[i]);
+		(void)cli_session_subscribe(p_session, test_event_slow, &p_count[i]);
+
+		/* close while the events are delivered */
+		for (wait = 0; wait < 10000; wait++)
+		{
+			pthread_mutex_lock(&g_lock);
+			n = p_count[i].n;
+			pthread_mutex_unlock(&g_lock);
+			if (n > 0)
+				break;
+			usleep(10);
+		}
+		if (n == 0)
+			test_bad_add();
+
+		if (i & 1)
+		{
+			/* unsubscribe waits for the running callback */
+			(void)cli_session_subscribe(p_session, IFX_NULL, IFX_NULL);
+			pthread_mutex_lock(&g_lock);
+			if (p_count[i].b_running)
+				g_n_bad++;
+			p_count[i].b_closed = 1;
+			pthread_mutex_unlock(&g_lock);
+		}
+		(void)cli_session_close(&p_session);
+		pthread_mutex_lock(&g_lock);
+		if (p_count[i].b_running)
+			g_n_bad++;
+		p_count[i].b_closed = 1;
+		pthread_mutex_unlock(&g_lock);
+	}
+
+	pthread_mutex_lock(&g_lock);
+	g_n_churn_done++;
+	pthread_mutex_unlock(&g_lock);
+
+	/* keep the counters until the emitters are done */
+	while (!test_stop_get())
+		usleep(1000);
+	free(p_count);
+
+	return IFX_NULL;
+}
+
+static void *test_emit_thread(void *p_arg)
+{
+	struct cli_core_context_s *p_core_ctx = (struct cli_core_context_s *)p_arg;
+
+	while (!test_stop_get())
+		test_event_send(p_core_ctx, "EVT churn");
+
+	return IFX_NULL;
+}
+
+static int test_session_churn(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	pthread_t churn[2], emit[2];
+	unsigned int i, n_done = 0;
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+
+	for (i = 0; i < 2; i++)
+	{
+		CLI_TEST_CHECK(pthread_create(&emit[i], IFX_NULL, test_emit_thread, p_core_ctx) == 0);
+		CLI_TEST_CHECK(pthread_create(&churn[i], IFX_NULL, test_churn_thread, p_core_ctx) == 0);
+	}
+
+	/* the emitters run until all cycles are done */
+	while (n_done < 2)
+	{
+		usleep(1000);
+		pthread_mutex_lock(&g_lock);
+		n_done = g_n_churn_done;
+		pthread_mutex_unlock(&g_lock);
+	}
+	pthread_mutex_lock(&g_lock);
+	g_b_stop = 1;
+	pthread_mutex_unlock(&g_lock);
+	for (i = 0; i < 2; i++)
+	{
+		(void)pthread_join(emit[i], IFX_NULL);
+		(void)pthread_join(churn[i], IFX_NULL);
+	}
+
+	CLI_TEST_CHECK(test_bad_get() == 0);
+	CLI_TEST_CHECK(cli_core_num_of_sessions_get(p_core_ctx) == 0);
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+
+	return 0;
+}
+
+static int test_session_core_release(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL, *p_core_ref;
+	struct cli_session_s *p_session = IFX_NULL, *p_other = IFX_NULL;
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+	CLI_TEST_CHECK(cli_session_open(p_core_ctx, 4, (void *)5UL, &p_session) == IFX_SUCCESS);
+
+	/* the core is released with the last session */
+	p_core_ref = p_core_ctx;
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+	CLI_TEST_CHECK(cli_session_open(p_core_ref, 5, IFX_NULL, &p_other) == IFX_ERROR);
+
+	/* still usable by the open session */
+	CLI_TEST_CHECK(test_session_exec_check(p_session) == 0);
+
+	CLI_TEST_CHECK(cli_session_close(&p_session) == IFX_SUCCESS);
+
+	return 0;
+}
+
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+/** Execute a command line within a session, returns the output */
+static int test_session_exec_out(
+	struct cli_session_s *p_session,
+	const char *p_cmd_line,
+	char *p_out,
+	unsigned int out_size)
+{
+	FILE *p_file = tmpfile();
+	char line[64];
+	size_t len;
+
+	CLI_TEST_CHECK(p_file != IFX_NULL);
+	snprintf(line, sizeof(line), "%s", p_cmd_line);
+	(void)cli_session_cmd_exec__file(p_session, line, p_file);
+	rewind(p_file);
+	len = fread(p_out, 1, out_size - 1, p_file);
+	p_out[len] = '\0';
+	fclose(p_file);
+
+	return 0;
+}
+
+static int test_session_format(void)
+{
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct cli_session_s *p_json = IFX_NULL, *p_text = IFX_NULL;
+	char out[256];
+
+	CLI_TEST_CHECK(test_core_init(&p_core_ctx) == 0);
+	CLI_TEST_CHECK(cli_session_open(p_core_ctx, 0, (void *)1UL, &p_json) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_session_open(p_core_ctx, 1, (void *)2UL, &p_text) == IFX_SUCCESS);
+
+	CLI_TEST_CHECK(cli_session_format_set(p_json, cli_struct_format_jsonl) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_session_format_get(p_json) == cli_struct_format_jsonl);
+	CLI_TEST_CHECK(cli_session_format_get(p_text) == cli_struct_format_text);
+
+	/* JSON lines (the errorcode of the text is the status), the other
+	   session unchanged */
+	CLI_TEST_CHECK(test_session_exec_out(p_json, "who", out, sizeof(out)) == 0);
+	CLI_TEST_CHECK(strcmp(out, "{\"status\":0}\n") == 0);
+	CLI_TEST_CHECK(test_session_exec_out(p_text, "who", out, sizeof(out)) == 0);
+	CLI_TEST_CHECK(strcmp(out, "errorcode=0\n") == 0);
+	CLI_TEST_CHECK(test_bad_get() == 0);
+
+	/* the built-in command sets the format of its own session */
+	CLI_TEST_CHECK(test_session_exec_out(p_text, "format jsonl", out, sizeof(out)) == 0);
+	CLI_TEST_CHECK(cli_session_format_get(p_text) == cli_struct_format_jsonl);
+	CLI_TEST_CHECK(test_session_exec_out(p_json, "format text", out, sizeof(out)) == 0);
+	CLI_TEST_CHECK(cli_session_format_get(p_json) == cli_struct_format_text);
+	CLI_TEST_CHECK(cli_session_format_get(p_text) == cli_struct_format_jsonl);
+	CLI_TEST_CHECK(cli_struct_session_format_get() == cli_struct_format_text);
+
+	CLI_TEST_CHECK(cli_session_format_set(p_text, (enum cli_struct_format_e)7) == IFX_ERROR);
+
+	CLI_TEST_CHECK(cli_session_close(&p_json) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_session_close(&p_text) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_test_core_release(&p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+
+	return 0;
+}
+#endif	/* #if (CLI_SUPPORT_STRUCT_OUT == 1) */
+
+int main(void)
+{
+	CLI_TEST_RUN(test_session_exec);
+	CLI_TEST_RUN(test_session_callback);
+	CLI_TEST_RUN(test_session_churn);
+	CLI_TEST_RUN(test_session_core_release);
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+	CLI_TEST_RUN(test_session_format);
+#endif
+
+	return 0;
+}
+
+#else	/* #if (CLI_SUPPORT_SESSION == 1) */
+
+int main(void)
+{
+	return CLI_TEST_SKIP;
+}
+
+#endif	/* #if (CLI_SUPPORT_SESSION == 1) */
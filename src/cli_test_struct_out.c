@@ -0,0 +1,299 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - unit test of the structured output.
+
+   - JSON lines: records, string escaping (\uXXXX for control characters
+     of a field, short escapes in the text record), integer limits, text
+     record of a handler without structured support, status record
+   - TLV: byte exact encoding of records, text and status
+   - a field which does not fit into the record is dropped
+   - text format: output passed unchanged
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "cli_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+#include "lib_cli_out_sink.h"
+#include "lib_cli_struct_out.h"
+
+/** Output of an execution */
+struct test_out_s
+{
+	int ret;
+	int status;
+	unsigned int len;
+	char data[2 * CLI_STRUCT_OUT_RECORD_SIZE];
+};
+
+/* structured records, text if the execution is not structured */
+static int test_cmd_cnt(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	struct cli_struct_out_s *p_so = cli_struct_out_get();
+
+	(void)p_ctx;
+	(void)p_cmd_arg;
+	if (p_so == IFX_NULL)
+		return fprintf((FILE *)p_out, "errorcode=3 rx=1\n");
+
+	(void)cli_struct_rec_start(p_so, "counter");
+	cli_struct_u64(p_so, "rx", 18446744073709551615ULL);
+	cli_struct_s64(p_so, "delta", -42);
+	cli_struct_str(p_so, "name", "eth\"0\n");
+	(void)cli_struct_rec_end(p_so);
+	cli_struct_status_set(p_so, 3);
+
+	return 0;
+}
+
+/* string escaping */
+static int test_cmd_esc(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	struct cli_struct_out_s *p_so = cli_struct_out_get();
+
+	(void)p_ctx;
+	(void)p_cmd_arg;
+	(void)p_out;
+	if (p_so == IFX_NULL)
+		return 0;
+
+	(void)cli_struct_rec_start(p_so, "esc");
+	cli_struct_str(p_so, "s", "a\"b\\c\td\x01" "e\r\n");
+	cli_struct_s64(p_so, "min", -9223372036854775807LL - 1);
+	(void)cli_struct_rec_end(p_so);
+
+	return 0;
+}
+
+/* a field larger than the record buffer, the status reports the drops */
+static int test_cmd_big(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	struct cli_struct_out_s *p_so = cli_struct_out_get();
+	static char big[CLI_STRUCT_OUT_RECORD_SIZE + 1];
+
+	(void)p_ctx;
+	(void)p_cmd_arg;
+	(void)p_out;
+	if (p_so == IFX_NULL)
+		return 0;
+
+	memset(big, 'x', sizeof(big) - 1);
+	big[sizeof(big) - 1] = '\0';
+	(void)cli_struct_rec_start(p_so, "big");
+	cli_struct_str(p_so, "big", big);
+	cli_struct_u64(p_so, "small", 1);
+	(void)cli_struct_rec_end(p_so);
+	cli_struct_status_set(p_so, (int)p_so->n_dropped);
+
+	return 0;
+}
+
+/* text output only */
+static int test_cmd_old(
+	void *p_ctx,
+	const char *p_cmd_arg,
+	clios_file_io_t *p_out)
+{
+	(void)p_ctx;
+	return fprintf((FILE *)p_out, "errorcode=-5 old \"style\" %s\n", p_cmd_arg);
+}
+
+static const struct cli_test_cmd_s g_test_cmds[] =
+{
+	{0, "cnt", "counter_get", IFX_NULL, test_cmd_cnt},
+	{0, "esc", "escape_get", IFX_NULL, test_cmd_esc},
+	{0, "big", "big_get", IFX_NULL, test_cmd_big},
+	{0, "old", "old_style", IFX_NULL, test_cmd_old},
+	{0, IFX_NULL, IFX_NULL, IFX_NULL, IFX_NULL}
+};
+
+static struct cli_core_context_s *g_p_core_ctx;
+
+static int test_exec(
+	const char *p_cmd_line,
+	enum cli_struct_format_e format,
+	struct test_out_s *p_out)
+{
+	struct cli_out_sink_s sink;
+	char cmd[128];
+	char *p_buf = IFX_NULL;
+
+	memset(p_out, 0x00, sizeof(struct test_out_s));
+	snprintf(cmd, sizeof(cmd), "%s", p_cmd_line);
+	CLI_TEST_CHECK(cli_out_sink_init(&sink) == IFX_SUCCESS);
+	p_out->ret = cli_core_cmd_exec__struct(g_p_core_ctx, cmd, format, &sink, &p_out->status);
+	CLI_TEST_CHECK(cli_out_sink_detach(&sink, &p_buf, &p_out->len) == IFX_SUCCESS);
+	CLI_TEST_CHECK(p_out->len < sizeof(p_out->data));
+	if (p_buf != IFX_NULL)
+		memcpy(p_out->data, p_buf, p_out->len);
+	cli_out_sink_buf_free(p_buf);
+	cli_out_sink_release(&sink);
+
+	return 0;
+}
+
+static int test_struct_jsonl(void)
+{
+	struct test_out_s out;
+
+	CLI_TEST_CHECK(test_exec("cnt", cli_struct_format_jsonl, &out) == 0);
+	CLI_TEST_CHECK((out.ret == 0) && (out.status == 3));
+	CLI_TEST_CHECK(strcmp(out.data,
+		"{\"rec\":\"counter\",\"rx\":18446744073709551615,\"delta\":-42,"
+		"\"name\":\"eth\\\"0\\u000a\"}\n"
+		"{\"status\":3}\n") == 0);
+
+	CLI_TEST_CHECK(test_exec("esc", cli_struct_format_jsonl, &out) == 0);
+	CLI_TEST_CHECK(out.status == 0);
+	CLI_TEST_CHECK(strcmp(out.data,
+		"{\"rec\":\"esc\",\"s\":\"a\\\"b\\\\c\\u0009d\\u0001e\\u000d\\u000a\","
+		"\"min\":-9223372036854775808}\n"
+		"{\"status\":0}\n") == 0);
+
+	/* text record, the status taken from the errorcode */
+	CLI_TEST_CHECK(test_exec("old a1 a2", cli_struct_format_jsonl, &out) == 0);
+	CLI_TEST_CHECK(out.status == -5);
+	CLI_TEST_CHECK(strcmp(out.data,
+		"{\"text\":\"old \\\"style\\\" a1 a2\\n\"}\n"
+		"{\"status\":-5}\n") == 0);
+
+	/* error of the CLI core */
+	CLI_TEST_CHECK(test_exec("unknown_cmd", cli_struct_format_jsonl, &out) == 0);
+	CLI_TEST_CHECK(out.status < 0);
+	CLI_TEST_CHECK(strncmp(out.data, "{\"text\":", 8) == 0);
+	CLI_TEST_CHECK(strstr(out.data, "}\n{\"status\":-") != IFX_NULL);
+
+	return 0;
+}
+
+/** TLV header at the given position */
+static int test_tlv_check(
+	const struct test_out_s *p_out,
+	unsigned int pos,
+	unsigned char type,
+	unsigned int len)
+{
+	const unsigned char *p = (const unsigned char *)p_out->data + pos;
+
+	CLI_TEST_CHECK(pos + CLI_STRUCT_TLV_HDR_SIZE + len <= p_out->len);
+	CLI_TEST_CHECK(p[0] == type);
+	CLI_TEST_CHECK((((unsigned int)p[1] << 24) | ((unsigned int)p[2] << 16) |
+		((unsigned int)p[3] << 8) | (unsigned int)p[4]) == len);
+
+	return 0;
+}
+
+static int test_struct_tlv(void)
+{
+	static const unsigned char cnt[] = {
+		0x01, 0x00, 0x00, 0x00, 0x3f,
+		0x10, 0x00, 0x00, 0x00, 0x07, 'c', 'o', 'u', 'n', 't', 'e', 'r',
+		0x11, 0x00, 0x00, 0x00, 0x0b, 0x02, 'r', 'x',
+			0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+		0x12, 0x00, 0x00, 0x00, 0x0e, 0x05, 'd', 'e', 'l', 't', 'a',
+			0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6,
+		0x13, 0x00, 0x00, 0x00, 0x0b, 0x04, 'n', 'a', 'm', 'e',
+			'e', 't', 'h', '"', '0', '\n',
+		0x03, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x03 };
+	struct test_out_s out;
+	unsigned int text_len;
+
+	CLI_TEST_CHECK(test_exec("cnt", cli_struct_format_tlv, &out) == 0);
+	CLI_TEST_CHECK((out.ret == 0) && (out.status == 3));
+	CLI_TEST_CHECK(out.len == sizeof(cnt));
+	CLI_TEST_CHECK(memcmp(out.data, cnt, sizeof(cnt)) == 0);
+
+	/* text record with the printout (errorcode removed), status -5 */
+	CLI_TEST_CHECK(test_exec("old a1", cli_struct_format_tlv, &out) == 0);
+	CLI_TEST_CHECK(out.status == -5);
+	text_len = (unsigned int)strlen("old \"style\" a1\n");
+	CLI_TEST_CHECK(test_tlv_check(&out, 0, CLI_STRUCT_TLV_TEXT, text_len) == 0);
+	CLI_TEST_CHECK(memcmp(out.data + CLI_STRUCT_TLV_HDR_SIZE, "old \"style\" a1\n", text_len) == 0);
+	CLI_TEST_CHECK(test_tlv_check(&out, CLI_STRUCT_TLV_HDR_SIZE + text_len,
+		CLI_STRUCT_TLV_STATUS, 4) == 0);
+	CLI_TEST_CHECK(memcmp(out.data + 2 * CLI_STRUCT_TLV_HDR_SIZE + text_len,
+		"\xff\xff\xff\xfb", 4) == 0);
+	CLI_TEST_CHECK(out.len == 2 * CLI_STRUCT_TLV_HDR_SIZE + text_len + 4);
+
+	return 0;
+}
+
+static int test_struct_record_full(void)
+{
+	struct test_out_s out;
+
+	/* the large field is dropped, the record stays valid */
+	CLI_TEST_CHECK(test_exec("big", cli_struct_format_jsonl, &out) == 0);
+	CLI_TEST_CHECK(out.status == 1);
+	CLI_TEST_CHECK(strcmp(out.data,
+		"{\"rec\":\"big\",\"small\":1}\n"
+		"{\"status\":1}\n") == 0);
+
+	CLI_TEST_CHECK(test_exec("big", cli_struct_format_tlv, &out) == 0);
+	CLI_TEST_CHECK(out.status == 1);
+	/* record: name (5 + 3), small (5 + 1 + 5 + 8) */
+	CLI_TEST_CHECK(test_tlv_check(&out, 0, CLI_STRUCT_TLV_RECORD, 8 + 19) == 0);
+	CLI_TEST_CHECK(test_tlv_check(&out, CLI_STRUCT_TLV_HDR_SIZE + 27,
+		CLI_STRUCT_TLV_STATUS, 4) == 0);
+
+	return 0;
+}
+
+static int test_struct_text(void)
+{
+	struct test_out_s out;
+
+	CLI_TEST_CHECK(test_exec("cnt", cli_struct_format_text, &out) == 0);
+	CLI_TEST_CHECK(out.status == 3);
+	CLI_TEST_CHECK(strcmp(out.data, "errorcode=3 rx=1\n") == 0);
+
+	CLI_TEST_CHECK(test_exec("old x", cli_struct_format_text, &out) == 0);
+	CLI_TEST_CHECK(out.status == -5);
+	CLI_TEST_CHECK(strcmp(out.data, "errorcode=-5 old \"style\" x\n") == 0);
+
+	return 0;
+}
+
+int main(void)
+{
+	CLI_TEST_CHECK(cli_test_core_init(&g_p_core_ctx, cli_cmd_core_out_mode_file,
+		CLI_USER_MASK_ALL, g_test_cmds) == 0);
+
+	CLI_TEST_RUN(test_struct_jsonl);
+	CLI_TEST_RUN(test_struct_tlv);
+	CLI_TEST_RUN(test_struct_record_full);
+	CLI_TEST_RUN(test_struct_text);
+
+	CLI_TEST_CHECK(cli_test_core_release(&g_p_core_ctx, cli_cmd_core_out_mode_file) == 0);
+	return 0;
+}
+
+#else	/* #if (CLI_SUPPORT_STRUCT_OUT == 1) */
+
+int main(void)
+{
+	return CLI_TEST_SKIP;
+}
+
+#endif	/* #if (CLI_SUPPORT_STRUCT_OUT == 1) */
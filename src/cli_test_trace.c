@@ -0,0 +1,260 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+
+/** \file
+   Command Line Interface (CLI) - unit test of the flight recorder ring.
+
+   - ring wrap: only the last n_entries are kept, oldest first
+   - read of the last n entries, stop by the callback
+   - clear drops all entries, the numbering continues
+   - concurrent writers and a reader (no torn entries delivered)
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#include "lib_cli_trace.h"
+#include "cli_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#if (CLI_SUPPORT_TRACE == 1)
+
+/** number of entries of the test ring */
+#define TEST_TRACE_ENTRIES	8
+/** number of concurrent writers */
+#define TEST_WRITERS	4
+/** entries per writer */
+#define TEST_WRITER_ENTRIES	50000
+
+/** Collected entries of a read */
+struct test_read_s
+{
+	unsigned int n;
+	unsigned int n_stop;
+	unsigned long long seq[TEST_TRACE_ENTRIES];
+	unsigned int inst[TEST_TRACE_ENTRIES];
+	char key[TEST_TRACE_ENTRIES][CLI_TRACE_KEY_SIZE];
+	char args[TEST_TRACE_ENTRIES][CLI_TRACE_ARGS_SIZE];
+};
+
+static int test_read_fct(
+	void *p_data,
+	const struct cli_trace_entry_s *p_entry)
+{
+	struct test_read_s *p_read = (struct test_read_s *)p_data;
+
+	if (p_read->n >= TEST_TRACE_ENTRIES)
+		return 1;
+	p_read->seq[p_read->n] = p_entry->seq;
+	p_read->inst[p_read->n] = p_entry->inst;
+	snprintf(p_read->key[p_read->n], sizeof(p_read->key[0]), "%s", p_entry->key);
+	snprintf(p_read->args[p_read->n], sizeof(p_read->args[0]), "%s", p_entry->args);
+	p_read->n++;
+
+	return ((p_read->n_stop != 0) && (p_read->n >= p_read->n_stop)) ? 1 : 0;
+}
+
+static void test_entry_set(
+	struct cli_trace_entry_s *p_entry,
+	unsigned int id,
+	unsigned int n)
+{
+	memset(p_entry, 0x00, sizeof(struct cli_trace_entry_s));
+	p_entry->session = -1;
+	p_entry->inst = id;
+	snprintf(p_entry->key, sizeof(p_entry->key), "k%u", n);
+	snprintf(p_entry->args, sizeof(p_entry->args), "w%u %u", id, n);
+}
+
+static int test_trace_wrap(void)
+{
+	struct cli_trace_s *p_trace = IFX_NULL;
+	struct cli_trace_entry_s entry;
+	struct test_read_s read;
+	char text[CLI_TRACE_ARGS_SIZE];
+	unsigned int i;
+
+	CLI_TEST_CHECK(cli_trace_init(&p_trace, 0) == IFX_ERROR);
+	CLI_TEST_CHECK(cli_trace_init(&p_trace, TEST_TRACE_ENTRIES) == IFX_SUCCESS);
+	CLI_TEST_CHECK(cli_trace_mem_size_get(p_trace) >=
+		TEST_TRACE_ENTRIES * sizeof(struct cli_trace_entry_s));
+
+	/* empty */
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_trace_read(p_trace, 0, test_read_fct, &read) == 0);
+
+	for (i = 0; i < 20; i++)
+	{
+		test_entry_set(&entry, 0, i);
+		cli_trace_record(p_trace, &entry);
+	}
+
+	/* all kept entries, oldest first */
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_trace_read(p_trace, 0, test_read_fct, &read) == TEST_TRACE_ENTRIES);
+	for (i = 0; i < TEST_TRACE_ENTRIES; i++)
+	{
+		CLI_TEST_CHECK(read.seq[i] == 20 - TEST_TRACE_ENTRIES + i);
+		snprintf(text, sizeof(text), "w0 %u", 20 - TEST_TRACE_ENTRIES + i);
+		CLI_TEST_CHECK(strcmp(read.args[i], text) == 0);
+	}
+
+	/* last entries, more than the ring size is limited */
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_trace_read(p_trace, 3, test_read_fct, &read) == 3);
+	CLI_TEST_CHECK((read.seq[0] == 17) && (read.seq[2] == 19));
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_trace_read(p_trace, 100, test_read_fct, &read) == TEST_TRACE_ENTRIES);
+
+	/* stop by the callback */
+	memset(&read, 0x00, sizeof(read));
+	read.n_stop = 2;
+	CLI_TEST_CHECK(cli_trace_read(p_trace, 0, test_read_fct, &read) == 2);
+	CLI_TEST_CHECK(read.seq[0] == 20 - TEST_TRACE_ENTRIES);
+
+	CLI_TEST_CHECK(cli_trace_release(&p_trace) == IFX_SUCCESS);
+	CLI_TEST_CHECK(p_trace == IFX_NULL);
+
+	return 0;
+}
+
+static int test_trace_clear(void)
+{
+	struct cli_trace_s *p_trace = IFX_NULL;
+	struct cli_trace_entry_s entry;
+	struct test_read_s read;
+	unsigned int i;
+
+	CLI_TEST_CHECK(cli_trace_init(&p_trace, TEST_TRACE_ENTRIES) == IFX_SUCCESS);
+	for (i = 0; i < 5; i++)
+	{
+		test_entry_set(&entry, 0, i);
+		cli_trace_record(p_trace, &entry);
+	}
+	CLI_TEST_CHECK(cli_trace_clear(p_trace) == IFX_SUCCESS);
+
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_trace_read(p_trace, 0, test_read_fct, &read) == 0);
+
+	/* the numbering continues after a clear */
+	test_entry_set(&entry, 0, 5);
+	cli_trace_record(p_trace, &entry);
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_trace_read(p_trace, 0, test_read_fct, &read) == 1);
+	CLI_TEST_CHECK((read.seq[0] == 5) && (strcmp(read.key[0], "k5") == 0));
+
+	CLI_TEST_CHECK(cli_trace_release(&p_trace) == IFX_SUCCESS);
+
+	return 0;
+}
+
+/** Writer thread argument */
+struct test_writer_s
+{
+	struct cli_trace_s *p_trace;
+	unsigned int id;
+};
+
+static void *test_writer_thread(void *p_arg)
+{
+	struct test_writer_s *p_writer = (struct test_writer_s *)p_arg;
+	struct cli_trace_entry_s entry;
+	unsigned int i;
+
+	for (i = 0; i < TEST_WRITER_ENTRIES; i++)
+	{
+		test_entry_set(&entry, p_writer->id, i);
+		cli_trace_record(p_writer->p_trace, &entry);
+	}
+
+	return IFX_NULL;
+}
+
+/** Check the delivered entries: each one complete, per writer in order */
+static int test_read_verify(
+	const struct test_read_s *p_read)
+{
+	unsigned int i, id, n, last[TEST_WRITERS];
+	char key[CLI_TRACE_KEY_SIZE];
+
+	memset(last, 0x00, sizeof(last));
+	for (i = 0; i < p_read->n; i++)
+	{
+		CLI_TEST_CHECK((i == 0) || (p_read->seq[i] > p_read->seq[i - 1]));
+		CLI_TEST_CHECK(sscanf(p_read->args[i], "w%u %u", &id, &n) == 2);
+		CLI_TEST_CHECK((id < TEST_WRITERS) && (p_read->inst[i] == id));
+		snprintf(key, sizeof(key), "k%u", n);
+		CLI_TEST_CHECK(strcmp(p_read->key[i], key) == 0);
+		CLI_TEST_CHECK(n >= last[id]);
+		last[id] = n + 1;
+	}
+
+	return 0;
+}
+
+static int test_trace_writers(void)
+{
+	struct cli_trace_s *p_trace = IFX_NULL;
+	struct test_writer_s writer[TEST_WRITERS];
+	pthread_t thread[TEST_WRITERS];
+	struct test_read_s read;
+	unsigned int i, n_reads = 0;
+	int ret = 0;
+
+	CLI_TEST_CHECK(cli_trace_init(&p_trace, TEST_TRACE_ENTRIES) == IFX_SUCCESS);
+
+	for (i = 0; i < TEST_WRITERS; i++)
+	{
+		writer[i].p_trace = p_trace;
+		writer[i].id = i;
+		CLI_TEST_CHECK(pthread_create(&thread[i], IFX_NULL, test_writer_thread, &writer[i]) == 0);
+	}
+
+	/* read while writing, an entry overwritten meanwhile is dropped */
+	while ((ret == 0) && (n_reads < 2000))
+	{
+		memset(&read, 0x00, sizeof(read));
+		(void)cli_trace_read(p_trace, 0, test_read_fct, &read);
+		ret = test_read_verify(&read);
+		n_reads++;
+	}
+
+	for (i = 0; i < TEST_WRITERS; i++)
+		(void)pthread_join(thread[i], IFX_NULL);
+	CLI_TEST_CHECK(ret == 0);
+
+	memset(&read, 0x00, sizeof(read));
+	CLI_TEST_CHECK(cli_trace_read(p_trace, 0, test_read_fct, &read) == TEST_TRACE_ENTRIES);
+	CLI_TEST_CHECK(read.seq[TEST_TRACE_ENTRIES - 1] == TEST_WRITERS * TEST_WRITER_ENTRIES - 1);
+	CLI_TEST_CHECK(test_read_verify(&read) == 0);
+
+	CLI_TEST_CHECK(cli_trace_release(&p_trace) == IFX_SUCCESS);
+
+	return 0;
+}
+
+int main(void)
+{
+	CLI_TEST_RUN(test_trace_wrap);
+	CLI_TEST_RUN(test_trace_clear);
+	CLI_TEST_RUN(test_trace_writers);
+
+	return 0;
+}
+
+#else	/* #if (CLI_SUPPORT_TRACE == 1) */
+
+int main(void)
+{
+	return CLI_TEST_SKIP;
+}
+
+#endif	/* #if (CLI_SUPPORT_TRACE == 1) */
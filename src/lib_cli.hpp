@@ -0,0 +1,857 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_HPP
+#define _LIB_CLI_HPP
+
+/**
+   \file lib_cli.hpp
+   Command Line Interface - C++20 coroutine command handlers
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_CPP CLI C++ Coroutine Handlers
+
+   Command handlers written as C++20 coroutines:
+   \code
+   static cli::task<int> fw_download(cli::ctx &c, std::string_view args)
+   {
+      c.printf("download %.*s" CLI_CRLF, (int)args.size(), args.data());
+      while (!fw_ready()) {
+         if (c.cancelled())
+            co_return -1;
+         co_await cli::sleep_for(std::chrono::milliseconds(100));
+      }
+      co_return 0;
+   }
+
+   cli::key_add<fw_download>(p_core_ctx, 0, "fwd", "fw_download");
+   \endcode
+
+   The registration passes a trampoline (plain file mode handler) to
+   \ref cli_core_key_add__file, the command is executed like any other
+   command:
+   - asynchronous execution (\ref cli_core_cmd_exec_async): the trampoline
+     defers the command (\ref cli_cmd_defer) and returns, the coroutine
+     resumes on the threads of the library executor
+     (\ref cli::default_executor, an executor pool) and completes the
+     command with its result (\ref cli_cmd_complete). A suspended command
+     does not hold a thread.
+   - synchronous execution (pipes, console, cli_core_cmd_exec__file): the
+     calling thread runs the coroutine and waits for its completion.
+
+   Awaitables:
+   - \ref cli::sleep_for - timer.
+   - \ref cli::completion - completed from any thread, for example by the
+     callback of a hardware driver.
+   - \ref cli::schedule - continue on the executor threads.
+   - \ref cli::task - nested coroutine.
+
+\remarks
+   - The command is executed exclusively (executor pool) up to the first
+     suspension only.
+   - A command of a released executor (process exit) is not resumed.
+  @{
+*/
+
+#if !defined(__cplusplus) || (__cplusplus < 202002L)
+#	error "lib_cli.hpp requires C++20"
+#endif
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_ASYNC != 1) || (CLI_SUPPORT_FILE_OUT != 1)
+#	error "lib_cli.hpp requires CLI_SUPPORT_ASYNC and CLI_SUPPORT_FILE_OUT"
+#endif
+
+#include "lib_cli_out_sink.h"
+#include "lib_cli_pool.h"
+#include "lib_cli_async.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdarg>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef CLI_HPP_WORKERS
+	/** number of worker threads of the library executor */
+#	define CLI_HPP_WORKERS	2
+#endif
+
+namespace cli {
+
+namespace detail {
+
+/** Resumes suspended coroutines (executor threads or a waiting caller) */
+struct scheduler
+{
+	/** Resume the coroutine on a thread of the scheduler */
+	virtual void post(std::coroutine_handle<> h) = 0;
+
+protected:
+	~scheduler() = default;
+};
+
+/** Scheduler of the coroutine running in this thread */
+inline scheduler *&current_scheduler() noexcept
+{
+	static thread_local scheduler *p_current = nullptr;
+
+	return p_current;
+}
+
+/** Set the scheduler of this thread for a scope */
+class scheduler_scope
+{
+public:
+	explicit scheduler_scope(scheduler *p_scheduler) noexcept
+		: p_prev_(current_scheduler())
+	{
+		current_scheduler() = p_scheduler;
+	}
+
+	~scheduler_scope()
+	{
+		current_scheduler() = p_prev_;
+	}
+
+	scheduler_scope(const scheduler_scope &) = delete;
+	scheduler_scope &operator=(const scheduler_scope &) = delete;
+
+private:
+	scheduler *p_prev_;
+};
+
+} /* namespace detail */
+
+/** Library executor: an executor pool (\ref LIB_CLI_POOL) which resumes the
+   coroutines, and a timer thread */
+class executor final : public detail::scheduler
+{
+public:
+	/** clock of the timers */
+	using clock = std::chrono::steady_clock;
+
+	explicit executor(unsigned int n_workers = CLI_HPP_WORKERS)
+	{
+		if (cli_pool_init(&p_pool_, n_workers) != IFX_SUCCESS)
+			throw std::runtime_error("cli: executor pool init failed");
+		timer_ = std::thread([this] { timer_run(); });
+	}
+
+	~executor()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mtx_);
+			b_stop_ = true;
+		}
+		cv_.notify_all();
+		timer_.join();
+		(void)cli_pool_release(&p_pool_);
+	}
+
+	executor(const executor &) = delete;
+	executor &operator=(const executor &) = delete;
+
+	/** Executor pool, may also be set for the asynchronous executions
+	   (\ref cli_core_async_pool_set) */
+	struct cli_pool_s *pool() noexcept
+	{
+		return p_pool_;
+	}
+
+	void post(std::coroutine_handle<> h) override
+	{
+		resume_job *p_job = new resume_job;
+
+		p_job->job.job_fct = &resume_job::run;
+		p_job->job.done_fct = &resume_job::done;
+		p_job->job.p_data = p_job;
+		p_job->job.b_concurrent = 1;
+		p_job->job.session = CLI_ASYNC_SESSION;
+		p_job->h = h;
+		p_job->p_executor = this;
+		/* released pool: the coroutine is not resumed */
+		if (cli_pool_submit(p_pool_, &p_job->job) != IFX_SUCCESS)
+			delete p_job;
+	}
+
+	/** Resume a coroutine by a scheduler at the given time */
+	void post_at(
+		clock::time_point tp,
+		std::coroutine_handle<> h,
+		detail::scheduler *p_scheduler)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mtx_);
+			timers_.push(timer_entry{tp, seq_++, h, p_scheduler});
+		}
+		cv_.notify_one();
+	}
+
+private:
+	/** Pool job, resumes a coroutine */
+	struct resume_job
+	{
+		struct cli_pool_job_s job = {};
+		std::coroutine_handle<> h;
+		executor *p_executor = nullptr;
+
+		static int run(void *p_data)
+		{
+			resume_job *p_job = static_cast<resume_job *>(p_data);
+			detail::scheduler_scope scope(p_job->p_executor);
+
+			p_job->h.resume();
+			return IFX_SUCCESS;
+		}
+
+		static void done(void *p_data, int)
+		{
+			delete static_cast<resume_job *>(p_data);
+		}
+	};
+
+	/** Timer, ordered by time and submission */
+	struct timer_entry
+	{
+		clock::time_point tp;
+		unsigned long long seq;
+		std::coroutine_handle<> h;
+		detail::scheduler *p_scheduler;
+
+		bool operator>(const timer_entry &other) const noexcept
+		{
+			return (tp != other.tp) ? (tp > other.tp) : (seq > other.seq);
+		}
+	};
+
+	void timer_run()
+	{
+		std::unique_lock<std::mutex> lock(mtx_);
+
+		while (!b_stop_)
+		{
+			if (timers_.empty())
+			{
+				cv_.wait(lock);
+				continue;
+			}
+			/* copy, a new timer reallocates the queue during the wait */
+			clock::time_point tp = timers_.top().tp;
+
+			if (clock::now() < tp)
+			{
+				cv_.wait_until(lock, tp);
+				continue;
+			}
+
+			timer_entry entry = timers_.top();
+			timers_.pop();
+			lock.unlock();
+			entry.p_scheduler->post(entry.h);
+			lock.lock();
+		}
+	}
+
+	struct cli_pool_s *p_pool_ = nullptr;
+	std::thread timer_;
+	std::mutex mtx_;
+	std::condition_variable cv_;
+	std::priority_queue<timer_entry, std::vector<timer_entry>,
+		std::greater<timer_entry>> timers_;
+	unsigned long long seq_ = 0;
+	bool b_stop_ = false;
+};
+
+/** Library executor, started with the first use */
+inline executor &default_executor()
+{
+	static executor ex;
+
+	return ex;
+}
+
+namespace detail {
+
+/** Scheduler of this thread, the library executor outside of a command */
+inline scheduler *scheduler_get()
+{
+	scheduler *p_scheduler = current_scheduler();
+
+	return (p_scheduler != nullptr) ? p_scheduler : &default_executor();
+}
+
+/** Scheduler of a synchronous caller, the caller resumes the coroutines
+   until the command is done */
+class run_loop final : public scheduler
+{
+public:
+	void post(std::coroutine_handle<> h) override
+	{
+		std::lock_guard<std::mutex> lock(mtx_);
+
+		queue_.push_back(h);
+		cv_.notify_one();
+	}
+
+	void finish()
+	{
+		std::lock_guard<std::mutex> lock(mtx_);
+
+		b_done_ = true;
+		cv_.notify_one();
+	}
+
+	void run()
+	{
+		scheduler_scope scope(this);
+		std::unique_lock<std::mutex> lock(mtx_);
+
+		for (;;)
+		{
+			if (!queue_.empty())
+			{
+				std::coroutine_handle<> h = queue_.front();
+
+				queue_.pop_front();
+				lock.unlock();
+				h.resume();
+				lock.lock();
+				continue;
+			}
+			if (b_done_)
+				break;
+			cv_.wait(lock);
+		}
+	}
+
+private:
+	std::mutex mtx_;
+	std::condition_variable cv_;
+	std::deque<std::coroutine_handle<>> queue_;
+	bool b_done_ = false;
+};
+
+/** Result storage of a task */
+template <typename T>
+struct task_result
+{
+	std::optional<T> value;
+
+	template <typename U>
+	void return_value(U &&v)
+	{
+		value.emplace(std::forward<U>(v));
+	}
+
+	T take()
+	{
+		return std::move(*value);
+	}
+};
+
+template <>
+struct task_result<void>
+{
+	void return_void() noexcept
+	{
+	}
+
+	void take() noexcept
+	{
+	}
+};
+
+} /* namespace detail */
+
+/** Coroutine with a result, started when awaited (lazy), the awaiting
+   coroutine continues on the thread which completes the task */
+template <typename T = void>
+class task
+{
+public:
+	struct promise_type : detail::task_result<T>
+	{
+		std::coroutine_handle<> continuation;
+		std::exception_ptr error;
+
+		task get_return_object() noexcept
+		{
+			return task(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+
+		std::suspend_always initial_suspend() noexcept
+		{
+			return {};
+		}
+
+		struct final_awaiter
+		{
+			bool await_ready() noexcept
+			{
+				return false;
+			}
+
+			std::coroutine_handle<> await_suspend(
+				std::coroutine_handle<promise_type> h) noexcept
+			{
+				std::coroutine_handle<> c = h.promise().continuation;
+
+				return c ? c : std::noop_coroutine();
+			}
+
+			void await_resume() noexcept
+			{
+			}
+		};
+
+		final_awaiter final_suspend() noexcept
+		{
+			return {};
+		}
+
+		void unhandled_exception() noexcept
+		{
+			error = std::current_exception();
+		}
+	};
+
+	task(task &&other) noexcept
+		: h_(std::exchange(other.h_, nullptr))
+	{
+	}
+
+	task &operator=(task &&other) noexcept
+	{
+		if (this != &other)
+		{
+			if (h_)
+				h_.destroy();
+			h_ = std::exchange(other.h_, nullptr);
+		}
+		return *this;
+	}
+
+	~task()
+	{
+		if (h_)
+			h_.destroy();
+	}
+
+	task(const task &) = delete;
+	task &operator=(const task &) = delete;
+
+	auto operator co_await() noexcept
+	{
+		struct awaiter
+		{
+			std::coroutine_handle<promise_type> h;
+
+			bool await_ready() noexcept
+			{
+				return !h || h.done();
+			}
+
+			std::coroutine_handle<> await_suspend(
+				std::coroutine_handle<> caller) noexcept
+			{
+				h.promise().continuation = caller;
+				return h;
+			}
+
+			T await_resume()
+			{
+				if (h.promise().error)
+					std::rethrow_exception(h.promise().error);
+				return h.promise().take();
+			}
+		};
+
+		return awaiter{h_};
+	}
+
+private:
+	explicit task(std::coroutine_handle<promise_type> h) noexcept
+		: h_(h)
+	{
+	}
+
+	std::coroutine_handle<promise_type> h_;
+};
+
+/** Continue on a thread of the library executor */
+inline auto schedule() noexcept
+{
+	struct awaiter
+	{
+		bool await_ready() noexcept
+		{
+			return false;
+		}
+
+		void await_suspend(std::coroutine_handle<> h)
+		{
+			default_executor().post(h);
+		}
+
+		void await_resume() noexcept
+		{
+		}
+	};
+
+	return awaiter{};
+}
+
+/** Suspend until the given time */
+inline auto sleep_until(executor::clock::time_point tp) noexcept
+{
+	struct awaiter
+	{
+		executor::clock::time_point tp;
+
+		bool await_ready() noexcept
+		{
+			return tp <= executor::clock::now();
+		}
+
+		void await_suspend(std::coroutine_handle<> h)
+		{
+			default_executor().post_at(tp, h, detail::scheduler_get());
+		}
+
+		void await_resume() noexcept
+		{
+		}
+	};
+
+	return awaiter{tp};
+}
+
+/** Suspend for the given time */
+template <typename Rep, typename Period>
+inline auto sleep_for(std::chrono::duration<Rep, Period> d) noexcept
+{
+	return sleep_until(executor::clock::now() +
+		std::chrono::duration_cast<executor::clock::duration>(d));
+}
+
+/** Result of an operation completed by another thread (driver callback).
+   Awaited once, \ref set is called once from any thread. */
+template <typename T = int>
+class completion
+{
+public:
+	completion() = default;
+	completion(const completion &) = delete;
+	completion &operator=(const completion &) = delete;
+
+	/** Complete the operation, the awaiting coroutine is resumed by its
+	   scheduler */
+	void set(T value)
+	{
+		std::coroutine_handle<> h;
+		detail::scheduler *p_scheduler;
+
+		{
+			std::lock_guard<std::mutex> lock(mtx_);
+			value_.emplace(std::move(value));
+			h = std::exchange(h_, nullptr);
+			p_scheduler = p_scheduler_;
+		}
+		if (h)
+			p_scheduler->post(h);
+	}
+
+	auto operator co_await() noexcept
+	{
+		struct awaiter
+		{
+			completion &c;
+
+			bool await_ready()
+			{
+				std::lock_guard<std::mutex> lock(c.mtx_);
+
+				return c.value_.has_value();
+			}
+
+			bool await_suspend(std::coroutine_handle<> h)
+			{
+				std::lock_guard<std::mutex> lock(c.mtx_);
+
+				if (c.value_.has_value())
+					return false;
+				c.h_ = h;
+				c.p_scheduler_ = detail::scheduler_get();
+				return true;
+			}
+
+			T await_resume()
+			{
+				return std::move(*c.value_);
+			}
+		};
+
+		return awaiter{*this};
+	}
+
+private:
+	std::mutex mtx_;
+	std::optional<T> value_;
+	std::coroutine_handle<> h_;
+	detail::scheduler *p_scheduler_ = nullptr;
+};
+
+/** Context of a coroutine command: user data, output, cancel request */
+class ctx
+{
+public:
+	ctx(void *p_user_data,
+		struct cli_exec_ctx_s *p_exec_ctx,
+		struct cli_out_sink_s *p_sink) noexcept
+		: p_user_data_(p_user_data), p_exec_ctx_(p_exec_ctx), p_sink_(p_sink)
+	{
+	}
+
+	ctx(const ctx &) = delete;
+	ctx &operator=(const ctx &) = delete;
+
+	/** User data of the handler call (CLI core or session) */
+	void *user_data() const noexcept
+	{
+		return p_user_data_;
+	}
+
+	/** Execution context (deferred context of an asynchronous execution) */
+	struct cli_exec_ctx_s *exec_ctx() const noexcept
+	{
+		return p_exec_ctx_;
+	}
+
+	/** Command name */
+	const char *cmd() const noexcept
+	{
+		return ((p_exec_ctx_ != nullptr) && (p_exec_ctx_->p_cmd != nullptr)) ?
+			p_exec_ctx_->p_cmd : "";
+	}
+
+	/** Cancel request of the command (see \ref cli_exec_cancel) */
+	bool cancelled() const noexcept
+	{
+		return cli_exec_cancelled(p_exec_ctx_) != 0;
+	}
+
+	/** Output sink of the command */
+	struct cli_out_sink_s *sink() const noexcept
+	{
+		return p_sink_;
+	}
+
+	/** Append output */
+	int write(std::string_view s)
+	{
+		return cli_out_sink_write(p_sink_, s.data(), (unsigned int)s.size());
+	}
+
+	/** Append formatted output */
+	int printf(const char *p_format, ...)
+#ifdef __GNUC__
+		__attribute__ ((format (printf, 2, 3)))
+#endif
+	{
+		va_list ap;
+		int ret;
+
+		va_start(ap, p_format);
+		ret = cli_out_sink_vprintf(p_sink_, p_format, ap);
+		va_end(ap);
+
+		return ret;
+	}
+
+private:
+	void *p_user_data_;
+	struct cli_exec_ctx_s *p_exec_ctx_;
+	struct cli_out_sink_s *p_sink_;
+};
+
+/** Coroutine command handler */
+using handler_t = task<int> (*)(ctx &, std::string_view);
+
+namespace detail {
+
+/** Coroutine which runs a command and reports the result, not awaited */
+struct detached
+{
+	struct promise_type
+	{
+		detached get_return_object() noexcept
+		{
+			return {};
+		}
+
+		std::suspend_never initial_suspend() noexcept
+		{
+			return {};
+		}
+
+		std::suspend_never final_suspend() noexcept
+		{
+			return {};
+		}
+
+		void return_void() noexcept
+		{
+		}
+
+		void unhandled_exception() noexcept
+		{
+			std::terminate();
+		}
+	};
+};
+
+/** Run a command coroutine, an exception results in IFX_ERROR */
+template <typename F>
+detached spawn(task<int> t, F done_fct)
+{
+	int ret;
+
+	try
+	{
+		ret = co_await t;
+	}
+	catch (...)
+	{
+		ret = IFX_ERROR;
+	}
+	done_fct(ret);
+}
+
+/** Command call, kept until the completion of a deferred command */
+struct call
+{
+	call(void *p_user_data,
+		struct cli_exec_ctx_s *p_exec_ctx,
+		struct cli_out_sink_s *p_sink,
+		const char *p_cmd)
+		: c(p_user_data, p_exec_ctx, p_sink), args(p_cmd != nullptr ? p_cmd : "")
+	{
+	}
+
+	ctx c;
+	std::string args;
+};
+
+/** Execute a coroutine command (see cli::key_add) */
+inline int call_run(
+	handler_t fn,
+	void *p_user_data,
+	const char *p_cmd,
+	clios_file_io_t *p_out)
+{
+	struct cli_exec_ctx_s *p_deferred = cli_cmd_defer();
+
+	if (p_deferred != nullptr)
+	{
+		/* asynchronous execution: continue on the executor threads,
+		   the handler call returns with the first suspension */
+		call *p_call = new call(p_user_data, p_deferred, p_deferred->p_sink, p_cmd);
+		scheduler_scope scope(&default_executor());
+
+		spawn(fn(p_call->c, p_call->args), [p_call](int ret) {
+			struct cli_exec_ctx_s *p_exec_ctx = p_call->c.exec_ctx();
+
+			delete p_call;
+			(void)cli_cmd_complete(p_exec_ctx, ret);
+		});
+		return IFX_SUCCESS;
+	}
+
+	/* synchronous execution: the caller runs the coroutine */
+	struct cli_out_sink_s sink;
+	run_loop loop;
+	int result = IFX_ERROR;
+
+	if (cli_out_sink_init__file(&sink, p_out) != IFX_SUCCESS)
+		return IFX_ERROR;
+	{
+		call sync_call(p_user_data, cli_exec_ctx_get(), &sink, p_cmd);
+
+		{
+			scheduler_scope scope(&loop);
+
+			spawn(fn(sync_call.c, sync_call.args), [&result, &loop](int ret) {
+				result = ret;
+				loop.finish();
+			});
+		}
+		loop.run();
+	}
+	(void)cli_out_sink_flush(&sink);
+	cli_out_sink_release(&sink);
+
+	return result;
+}
+
+/** File mode handler of a coroutine command */
+template <handler_t Fn>
+int trampoline(void *p_user_data, const char *p_cmd, clios_file_io_t *p_out)
+{
+	return call_run(Fn, p_user_data, p_cmd, p_out);
+}
+
+} /* namespace detail */
+
+/** Register a coroutine command (see \ref cli_core_key_add__file).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   group_mask  selection mask and registration flags.
+\param
+   p_short_name  short command name.
+\param
+   p_long_name  long command name.
+
+\return
+   see \ref cli_core_key_add__file
+*/
+template <handler_t Fn>
+int key_add(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int group_mask,
+	const char *p_short_name,
+	const char *p_long_name)
+{
+	return cli_core_key_add__file(p_core_ctx, group_mask,
+		p_short_name, p_long_name, &detail::trampoline<Fn>);
+}
+
+} /* namespace cli */
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_HPP */
@@ -0,0 +1,860 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_apropos.c
+   Command Line Interface - apropos and did-you-mean index
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_APROPOS == 1)
+#include "lib_cli_apropos.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** initial number of trigram / command pairs */
+#define CLI_APROPOS_PAIRS_INIT	4096
+
+/** max number of trigrams of a search term */
+#define CLI_APROPOS_TERM_TRI_MAX \
+	(CLI_APROPOS_WORDS_MAX * (CLI_APROPOS_NAME_LEN_MAX - 2))
+
+/** lower case of an ASCII character */
+#define CLI_APROPOS_LOWER(c) \
+	((((c) >= 'A') && ((c) <= 'Z')) ? (unsigned char)((c) + ('a' - 'A')) : (unsigned char)(c))
+
+/** trigram key (24 bit) */
+#define CLI_APROPOS_TRI(c0, c1, c2) \
+	(((unsigned int)(c0) << 16) | ((unsigned int)(c1) << 8) | (unsigned int)(c2))
+
+/** Command of the index */
+struct cli_apropos_cmd_s
+{
+	/** short name, IFX_NULL: none */
+	const char *p_short_name;
+	/** long name */
+	const char *p_long_name;
+	/** command data for the callbacks */
+	void *p_cmd_data;
+};
+
+/** Trigram of a command (build data) */
+struct cli_apropos_pair_s
+{
+	/** trigram key */
+	unsigned int tri;
+	/** command number */
+	unsigned int cmd;
+};
+
+/** BK-tree node */
+struct cli_apropos_bk_node_s
+{
+	/** name of the node */
+	const char *p_name;
+	/** command number */
+	unsigned int cmd;
+	/** distance to the parent node */
+	unsigned int dist;
+	/** first child + 1, 0: none */
+	unsigned int child;
+	/** next sibling + 1, 0: none */
+	unsigned int sibling;
+};
+
+/** Apropos index */
+struct cli_apropos_s
+{
+	/** max number of commands */
+	unsigned int n_cmds_max;
+	/** number of commands */
+	unsigned int n_cmds;
+	/** commands, sorted by the long name */
+	struct cli_apropos_cmd_s *p_cmds;
+
+	/** trigram / command pairs, in command order (until the build) */
+	struct cli_apropos_pair_s *p_pairs;
+	/** number of pairs */
+	unsigned int n_pairs;
+	/** size of the pair array */
+	unsigned int pairs_size;
+	/** trigrams of the current command (build data) */
+	unsigned int *p_cmd_tri;
+	/** size of the trigram array of the current command */
+	unsigned int cmd_tri_size;
+
+	/** number of distinct trigrams */
+	unsigned int n_tri;
+	/** distinct trigrams, sorted */
+	unsigned int *p_tri;
+	/** start of the posting list of each trigram, n_tri + 1 entries */
+	unsigned int *p_tri_start;
+	/** posting lists (command numbers, sorted) */
+	unsigned int *p_post;
+
+	/** BK-tree nodes, node 0 is the root */
+	struct cli_apropos_bk_node_s *p_bk;
+	/** number of BK-tree nodes */
+	unsigned int n_bk;
+
+	/** index is complete */
+	unsigned int b_built;
+};
+
+/** Nearest names of a did-you-mean search */
+struct cli_apropos_near_s
+{
+	/** search name (lower case) */
+	unsigned char name[CLI_APROPOS_NAME_LEN_MAX];
+	/** length of the search name */
+	unsigned int len;
+	/** max distance */
+	unsigned int tolerance;
+	/** max number of results */
+	unsigned int n_max;
+	/** number of results */
+	unsigned int n_found;
+	/** results, sorted by distance and command number */
+	struct
+	{
+		const char *p_name;
+		unsigned int cmd;
+		unsigned int dist;
+	} found[CLI_APROPOS_SUGGEST_MAX];
+};
+
+/** Heap sort of a trigram array (sift down) */
+CLI_STATIC void apropos_sift_down(
+	unsigned int *p_val,
+	unsigned int root,
+	unsigned int n)
+{
+	unsigned int child, tmp;
+
+	while ((child = 2 * root + 1) < n)
+	{
+		if ((child + 1 < n) && (p_val[child] < p_val[child + 1]))
+			child++;
+		if (p_val[root] >= p_val[child])
+			return;
+		tmp = p_val[root];
+		p_val[root] = p_val[child];
+		p_val[child] = tmp;
+		root = child;
+	}
+}
+
+/** Heap sort of a trigram array */
+CLI_STATIC void apropos_sort(
+	unsigned int *p_val,
+	unsigned int n)
+{
+	unsigned int i, tmp;
+
+	if (n < 2)
+		return;
+	for (i = n / 2; i > 0; i--)
+		apropos_sift_down(p_val, i - 1, n);
+	for (i = n - 1; i > 0; i--)
+	{
+		tmp = p_val[0];
+		p_val[0] = p_val[i];
+		p_val[i] = tmp;
+		apropos_sift_down(p_val, 0, i);
+	}
+}
+
+/** Add the trigrams of a text to the trigram array of the current command */
+CLI_STATIC int apropos_text_tri_add(
+	struct cli_apropos_s *p_apropos,
+	unsigned int *p_n_tri,
+	const char *p_text,
+	unsigned int len)
+{
+	unsigned int i, size, *p_new;
+
+	if ((p_text == IFX_NULL) || (len < 3))
+		return IFX_SUCCESS;
+
+	if (*p_n_tri + len > p_apropos->cmd_tri_size)
+	{
+		size = 2 * (*p_n_tri + len);
+		p_new = (unsigned int *)clios_memalloc(size * sizeof(unsigned int));
+		if (p_new == IFX_NULL)
+			return IFX_ERROR;
+		if (p_apropos->p_cmd_tri != IFX_NULL)
+		{
+			clios_memcpy(p_new, p_apropos->p_cmd_tri, *p_n_tri * sizeof(unsigned int));
+			clios_memfree(p_apropos->p_cmd_tri);
+		}
+		p_apropos->p_cmd_tri = p_new;
+		p_apropos->cmd_tri_size = size;
+	}
+
+	for (i = 0; i + 2 < len; i++)
+	{
+		p_apropos->p_cmd_tri[(*p_n_tri)++] = CLI_APROPOS_TRI(
+			CLI_APROPOS_LOWER(p_text[i]),
+			CLI_APROPOS_LOWER(p_text[i + 1]),
+			CLI_APROPOS_LOWER(p_text[i + 2]));
+	}
+
+	return IFX_SUCCESS;
+}
+
+/** Append the (distinct) trigrams of the current command to the pairs */
+CLI_STATIC int apropos_pairs_add(
+	struct cli_apropos_s *p_apropos,
+	unsigned int cmd,
+	unsigned int n_tri)
+{
+	struct cli_apropos_pair_s *p_new;
+	unsigned int i, size;
+
+	apropos_sort(p_apropos->p_cmd_tri, n_tri);
+
+	if (p_apropos->n_pairs + n_tri > p_apropos->pairs_size)
+	{
+		size = 2 * p_apropos->pairs_size;
+		if (size < CLI_APROPOS_PAIRS_INIT)
+			size = CLI_APROPOS_PAIRS_INIT;
+		if (size < p_apropos->n_pairs + n_tri)
+			size = p_apropos->n_pairs + n_tri;
+		p_new = (struct cli_apropos_pair_s *)clios_memalloc(
+			size * sizeof(struct cli_apropos_pair_s));
+		if (p_new == IFX_NULL)
+			return IFX_ERROR;
+		if (p_apropos->p_pairs != IFX_NULL)
+		{
+			clios_memcpy(p_new, p_apropos->p_pairs,
+				p_apropos->n_pairs * sizeof(struct cli_apropos_pair_s));
+			clios_memfree(p_apropos->p_pairs);
+		}
+		p_apropos->p_pairs = p_new;
+		p_apropos->pairs_size = size;
+	}
+
+	for (i = 0; i < n_tri; i++)
+	{
+		if ((i > 0) && (p_apropos->p_cmd_tri[i] == p_apropos->p_cmd_tri[i - 1]))
+			continue;
+		p_apropos->p_pairs[p_apropos->n_pairs].tri = p_apropos->p_cmd_tri[i];
+		p_apropos->p_pairs[p_apropos->n_pairs].cmd = cmd;
+		p_apropos->n_pairs++;
+	}
+
+	return IFX_SUCCESS;
+}
+
+/** Levenshtein distance of a name (lower case) and a node name,
+   case insensitive, the names are cut to CLI_APROPOS_NAME_LEN_MAX */
+CLI_STATIC unsigned int apropos_distance(
+	const unsigned char *p_name,
+	unsigned int len,
+	const char *p_other)
+{
+	unsigned int row[2][CLI_APROPOS_NAME_LEN_MAX + 1];
+	unsigned int i, j, cost, val, *p_prev, *p_curr;
+	unsigned char c;
+
+	for (j = 0; j <= len; j++)
+		row[0][j] = j;
+
+	p_prev = row[0];
+	p_curr = row[1];
+	for (i = 0; (p_other[i] != '\0') && (i < CLI_APROPOS_NAME_LEN_MAX); i++)
+	{
+		c = CLI_APROPOS_LOWER(p_other[i]);
+		p_curr[0] = i + 1;
+		for (j = 1; j <= len; j++)
+		{
+			cost = (p_name[j - 1] == c) ? 0 : 1;
+			val = p_prev[j - 1] + cost;
+			if (p_prev[j] + 1 < val)
+				val = p_prev[j] + 1;
+			if (p_curr[j - 1] + 1 < val)
+				val = p_curr[j - 1] + 1;
+			p_curr[j] = val;
+		}
+		p_prev = p_curr;
+		p_curr = (p_curr == row[1]) ? row[0] : row[1];
+	}
+
+	return p_prev[len];
+}
+
+/** Lower case copy of a name for the distance calculation */
+CLI_STATIC unsigned int apropos_name_lower(
+	unsigned char *p_out,
+	const char *p_name)
+{
+	unsigned int len = 0;
+
+	while ((p_name[len] != '\0') && (len < CLI_APROPOS_NAME_LEN_MAX))
+	{
+		p_out[len] = CLI_APROPOS_LOWER(p_name[len]);
+		len++;
+	}
+
+	return len;
+}
+
+/** Insert a name into the BK-tree */
+CLI_STATIC void apropos_bk_insert(
+	struct cli_apropos_s *p_apropos,
+	const char *p_name,
+	unsigned int cmd)
+{
+	struct cli_apropos_bk_node_s *p_node, *p_new;
+	unsigned char name[CLI_APROPOS_NAME_LEN_MAX];
+	unsigned int len, dist, next;
+
+	p_new = &p_apropos->p_bk[p_apropos->n_bk];
+	p_new->p_name = p_name;
+	p_new->cmd = cmd;
+	p_new->dist = 0;
+	p_new->child = 0;
+	p_new->sibling = 0;
+	if (p_apropos->n_bk == 0)
+	{
+		p_apropos->n_bk = 1;
+		return;
+	}
+
+	len = apropos_name_lower(name, p_name);
+	p_node = &p_apropos->p_bk[0];
+	for (;;)
+	{
+		dist = apropos_distance(name, len, p_node->p_name);
+		if (dist == 0)
+			/* same name (case insensitive), the first one is kept */
+			return;
+
+		for (next = p_node->child; next != 0; next = p_apropos->p_bk[next - 1].sibling)
+		{
+			if (p_apropos->p_bk[next - 1].dist == dist)
+				break;
+		}
+		if (next == 0)
+		{
+			p_new->dist = dist;
+			p_new->sibling = p_node->child;
+			p_node->child = ++p_apropos->n_bk;
+			return;
+		}
+		p_node = &p_apropos->p_bk[next - 1];
+	}
+}
+
+/** Add a name to the nearest names (sorted by distance and command) */
+CLI_STATIC void apropos_near_add(
+	struct cli_apropos_near_s *p_near,
+	const char *p_name,
+	unsigned int cmd,
+	unsigned int dist)
+{
+	unsigned int i, pos;
+
+	/* one name per command */
+	for (i = 0; i < p_near->n_found; i++)
+	{
+		if (p_near->found[i].cmd != cmd)
+			continue;
+		if (p_near->found[i].dist <= dist)
+			return;
+		for (; i + 1 < p_near->n_found; i++)
+			p_near->found[i] = p_near->found[i + 1];
+		p_near->n_found--;
+		break;
+	}
+
+	for (pos = p_near->n_found; pos > 0; pos--)
+	{
+		if ((p_near->found[pos - 1].dist < dist) ||
+		    ((p_near->found[pos - 1].dist == dist) && (p_near->found[pos - 1].cmd < cmd)))
+			break;
+	}
+	if (pos >= p_near->n_max)
+		return;
+
+	if (p_near->n_found < p_near->n_max)
+		p_near->n_found++;
+	for (i = p_near->n_found - 1; i > pos; i--)
+		p_near->found[i] = p_near->found[i - 1];
+	p_near->found[pos].p_name = p_name;
+	p_near->found[pos].cmd = cmd;
+	p_near->found[pos].dist = dist;
+
+	/* the list is full, only better names are of interest */
+	if ((p_near->n_found == p_near->n_max) &&
+	    (p_near->found[p_near->n_found - 1].dist < p_near->tolerance))
+		p_near->tolerance = p_near->found[p_near->n_found - 1].dist;
+}
+
+/** Search the BK-tree for the names within the tolerance */
+CLI_STATIC void apropos_bk_search(
+	const struct cli_apropos_s *p_apropos,
+	unsigned int node,
+	struct cli_apropos_near_s *p_near)
+{
+	const struct cli_apropos_bk_node_s *p_node = &p_apropos->p_bk[node];
+	unsigned int dist, next, child_dist;
+
+	dist = apropos_distance(p_near->name, p_near->len, p_node->p_name);
+	if (dist <= p_near->tolerance)
+		apropos_near_add(p_near, p_node->p_name, p_node->cmd, dist);
+
+	for (next = p_node->child; next != 0; next = p_apropos->p_bk[next - 1].sibling)
+	{
+		/* triangle inequality, the tolerance may shrink */
+		child_dist = p_apropos->p_bk[next - 1].dist;
+		if ((child_dist + p_near->tolerance >= dist) &&
+		    (child_dist <= dist + p_near->tolerance))
+			apropos_bk_search(p_apropos, next - 1, p_near);
+	}
+}
+
+/** Find the posting list of a trigram */
+CLI_STATIC int apropos_tri_find(
+	const struct cli_apropos_s *p_apropos,
+	unsigned int tri)
+{
+	unsigned int lo = 0, hi = p_apropos->n_tri, mid;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (p_apropos->p_tri[mid] == tri)
+			return (int)mid;
+		if (p_apropos->p_tri[mid] < tri)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return IFX_ERROR;
+}
+
+/** Check if a sorted list contains a value, starts at *p_pos (advanced) */
+CLI_STATIC int apropos_post_contains(
+	const unsigned int *p_list,
+	unsigned int n,
+	unsigned int *p_pos,
+	unsigned int val)
+{
+	unsigned int lo = *p_pos, hi = n, mid;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (p_list[mid] < val)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	*p_pos = lo;
+
+	return ((lo < n) && (p_list[lo] == val)) ? 1 : 0;
+}
+
+/** Check if a command contains all search words */
+CLI_STATIC int apropos_cmd_match(
+	const struct cli_apropos_cmd_s *p_cmd,
+	char word[][CLI_APROPOS_NAME_LEN_MAX],
+	unsigned int n_words,
+	cli_apropos_usage_fct_t usage_fct,
+	void *p_data)
+{
+	unsigned int w;
+
+	for (w = 0; w < n_words; w++)
+	{
+		if (cli_apropos_text_find(p_cmd->p_long_name,
+			(unsigned int)clios_strlen(p_cmd->p_long_name), word[w]))
+			continue;
+		if ((p_cmd->p_short_name != IFX_NULL) &&
+		    cli_apropos_text_find(p_cmd->p_short_name,
+			(unsigned int)clios_strlen(p_cmd->p_short_name), word[w]))
+			continue;
+		if ((usage_fct != IFX_NULL) && usage_fct(p_data, p_cmd->p_cmd_data, word[w]))
+			continue;
+		return 0;
+	}
+
+	return 1;
+}
+
+int cli_apropos_text_find(
+	const char *p_text,
+	unsigned int len,
+	const char *p_word)
+{
+	unsigned int i, j;
+
+	if ((p_text == IFX_NULL) || (p_word == IFX_NULL))
+		return 0;
+
+	for (i = 0; p_word[0] != '\0' && i < len; i++)
+	{
+		for (j = 0; (p_word[j] != '\0') && (i + j < len); j++)
+		{
+			if (CLI_APROPOS_LOWER(p_text[i + j]) != (unsigned char)p_word[j])
+				break;
+		}
+		if (p_word[j] == '\0')
+			return 1;
+		if (i + j >= len)
+			break;
+	}
+
+	return 0;
+}
+
+int cli_apropos_init(
+	struct cli_apropos_s **pp_apropos,
+	unsigned int n_cmds_max)
+{
+	struct cli_apropos_s *p_apropos;
+
+	if ((pp_apropos == IFX_NULL) || (*pp_apropos != IFX_NULL) || (n_cmds_max == 0))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Apropos: init - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_apropos = (struct cli_apropos_s *)clios_memalloc(sizeof(struct cli_apropos_s));
+	if (p_apropos == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Apropos: init - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_apropos, 0x00, sizeof(struct cli_apropos_s));
+
+	p_apropos->p_cmds = (struct cli_apropos_cmd_s *)clios_memalloc(
+		n_cmds_max * sizeof(struct cli_apropos_cmd_s));
+	p_apropos->p_bk = (struct cli_apropos_bk_node_s *)clios_memalloc(
+		2 * n_cmds_max * sizeof(struct cli_apropos_bk_node_s));
+	if ((p_apropos->p_cmds == IFX_NULL) || (p_apropos->p_bk == IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Apropos: init - no memory" CLI_CRLF));
+		(void)cli_apropos_release(&p_apropos);
+		return IFX_ERROR;
+	}
+	p_apropos->n_cmds_max = n_cmds_max;
+
+	*pp_apropos = p_apropos;
+	return IFX_SUCCESS;
+}
+
+int cli_apropos_release(
+	struct cli_apropos_s **pp_apropos)
+{
+	struct cli_apropos_s *p_apropos;
+
+	if ((pp_apropos == IFX_NULL) || (*pp_apropos == IFX_NULL))
+		return IFX_ERROR;
+
+	p_apropos = *pp_apropos;
+	*pp_apropos = IFX_NULL;
+
+	if (p_apropos->p_cmds != IFX_NULL)
+		clios_memfree(p_apropos->p_cmds);
+	if (p_apropos->p_pairs != IFX_NULL)
+		clios_memfree(p_apropos->p_pairs);
+	if (p_apropos->p_cmd_tri != IFX_NULL)
+		clios_memfree(p_apropos->p_cmd_tri);
+	if (p_apropos->p_tri != IFX_NULL)
+		clios_memfree(p_apropos->p_tri);
+	if (p_apropos->p_tri_start != IFX_NULL)
+		clios_memfree(p_apropos->p_tri_start);
+	if (p_apropos->p_post != IFX_NULL)
+		clios_memfree(p_apropos->p_post);
+	if (p_apropos->p_bk != IFX_NULL)
+		clios_memfree(p_apropos->p_bk);
+	clios_memfree(p_apropos);
+
+	return IFX_SUCCESS;
+}
+
+int cli_apropos_cmd_add(
+	struct cli_apropos_s *p_apropos,
+	const char *p_short_name,
+	const char *p_long_name,
+	const char *p_usage,
+	unsigned int usage_len,
+	void *p_cmd_data)
+{
+	struct cli_apropos_cmd_s *p_cmd;
+	unsigned int n_tri = 0;
+
+	if ((p_apropos == IFX_NULL) || (p_long_name == IFX_NULL) || p_apropos->b_built)
+		return IFX_ERROR;
+	if (p_apropos->n_cmds >= p_apropos->n_cmds_max)
+		return IFX_ERROR;
+
+	if ((apropos_text_tri_add(p_apropos, &n_tri, p_long_name,
+		(unsigned int)clios_strlen(p_long_name)) != IFX_SUCCESS) ||
+	    ((p_short_name != IFX_NULL) &&
+	     (apropos_text_tri_add(p_apropos, &n_tri, p_short_name,
+		(unsigned int)clios_strlen(p_short_name)) != IFX_SUCCESS)) ||
+	    (apropos_text_tri_add(p_apropos, &n_tri, p_usage, usage_len) != IFX_SUCCESS) ||
+	    (apropos_pairs_add(p_apropos, p_apropos->n_cmds, n_tri) != IFX_SUCCESS))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Apropos: add - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_cmd = &p_apropos->p_cmds[p_apropos->n_cmds];
+	p_cmd->p_short_name = p_short_name;
+	p_cmd->p_long_name = p_long_name;
+	p_cmd->p_cmd_data = p_cmd_data;
+	p_apropos->n_cmds++;
+
+	return IFX_SUCCESS;
+}
+
+int cli_apropos_build(
+	struct cli_apropos_s *p_apropos)
+{
+	struct cli_apropos_pair_s *p_tmp, *p_in, *p_out, *p_swap;
+	unsigned int count[256];
+	unsigned int i, shift, pos, n, cmd;
+
+	if ((p_apropos == IFX_NULL) || p_apropos->b_built)
+		return IFX_ERROR;
+
+	n = p_apropos->n_pairs;
+	p_tmp = (struct cli_apropos_pair_s *)clios_memalloc(
+		(n ? n : 1) * sizeof(struct cli_apropos_pair_s));
+	p_apropos->p_tri = (unsigned int *)clios_memalloc((n ? n : 1) * sizeof(unsigned int));
+	p_apropos->p_tri_start = (unsigned int *)clios_memalloc((n + 1) * sizeof(unsigned int));
+	p_apropos->p_post = (unsigned int *)clios_memalloc((n ? n : 1) * sizeof(unsigned int));
+	if ((p_tmp == IFX_NULL) || (p_apropos->p_tri == IFX_NULL) ||
+	    (p_apropos->p_tri_start == IFX_NULL) || (p_apropos->p_post == IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Apropos: build - no memory" CLI_CRLF));
+		if (p_tmp != IFX_NULL)
+			clios_memfree(p_tmp);
+		return IFX_ERROR;
+	}
+
+	/* stable radix sort by trigram, the commands stay sorted per trigram */
+	p_in = p_apropos->p_pairs;
+	p_out = p_tmp;
+	for (shift = 0; shift < 24; shift += 8)
+	{
+		clios_memset(count, 0x00, sizeof(count));
+		for (i = 0; i < n; i++)
+			count[(p_in[i].tri >> shift) & 0xFF]++;
+		for (i = 0, pos = 0; i < 256; i++)
+		{
+			cmd = count[i];
+			count[i] = pos;
+			pos += cmd;
+		}
+		for (i = 0; i < n; i++)
+			p_out[count[(p_in[i].tri >> shift) & 0xFF]++] = p_in[i];
+		p_swap = p_in;
+		p_in = p_out;
+		p_out = p_swap;
+	}
+
+	/* trigram table and posting lists */
+	p_apropos->n_tri = 0;
+	for (i = 0; i < n; i++)
+	{
+		if ((i == 0) || (p_in[i].tri != p_in[i - 1].tri))
+		{
+			p_apropos->p_tri[p_apropos->n_tri] = p_in[i].tri;
+			p_apropos->p_tri_start[p_apropos->n_tri] = i;
+			p_apropos->n_tri++;
+		}
+		p_apropos->p_post[i] = p_in[i].cmd;
+	}
+	p_apropos->p_tri_start[p_apropos->n_tri] = n;
+
+	clios_memfree(p_tmp);
+	clios_memfree(p_apropos->p_pairs);
+	p_apropos->p_pairs = IFX_NULL;
+	p_apropos->n_pairs = 0;
+	if (p_apropos->p_cmd_tri != IFX_NULL)
+	{
+		clios_memfree(p_apropos->p_cmd_tri);
+		p_apropos->p_cmd_tri = IFX_NULL;
+	}
+
+	/* BK-tree of the names */
+	p_apropos->n_bk = 0;
+	for (cmd = 0; cmd < p_apropos->n_cmds; cmd++)
+	{
+		apropos_bk_insert(p_apropos, p_apropos->p_cmds[cmd].p_long_name, cmd);
+		if (p_apropos->p_cmds[cmd].p_short_name != IFX_NULL)
+			apropos_bk_insert(p_apropos, p_apropos->p_cmds[cmd].p_short_name, cmd);
+	}
+
+	p_apropos->b_built = 1;
+
+	return IFX_SUCCESS;
+}
+
+int cli_apropos_find(
+	const struct cli_apropos_s *p_apropos,
+	const char *p_term,
+	cli_apropos_usage_fct_t usage_fct,
+	cli_apropos_result_fct_t result_fct,
+	void *p_data)
+{
+	char word[CLI_APROPOS_WORDS_MAX][CLI_APROPOS_NAME_LEN_MAX];
+	unsigned int list[CLI_APROPOS_TERM_TRI_MAX];
+	unsigned int pos[CLI_APROPOS_TERM_TRI_MAX];
+	unsigned int n_words = 0, n_lists = 0, shortest = 0;
+	unsigned int w, i, l, len, cmd, n_cand, start, n;
+	unsigned int *p_cand = IFX_NULL;
+	const struct cli_apropos_cmd_s *p_cmd;
+	int idx, n_found = 0;
+
+	if ((p_apropos == IFX_NULL) || (p_term == IFX_NULL) ||
+	    (result_fct == IFX_NULL) || !p_apropos->b_built)
+		return IFX_ERROR;
+
+	/* lower case words, the remaining words are ignored */
+	while ((*p_term != '\0') && (n_words < CLI_APROPOS_WORDS_MAX))
+	{
+		while ((*p_term == ' ') || (*p_term == '\t'))
+			p_term++;
+		if (*p_term == '\0')
+			break;
+		len = 0;
+		while ((*p_term != '\0') && (*p_term != ' ') && (*p_term != '\t'))
+		{
+			if (len < CLI_APROPOS_NAME_LEN_MAX - 1)
+				word[n_words][len++] = (char)CLI_APROPOS_LOWER(*p_term);
+			p_term++;
+		}
+		word[n_words][len] = '\0';
+		n_words++;
+	}
+	if (n_words == 0)
+		return IFX_ERROR;
+
+	/* posting lists of all trigrams, a missing trigram gives no result */
+	for (w = 0; w < n_words; w++)
+	{
+		len = (unsigned int)clios_strlen(word[w]);
+		for (i = 0; i + 2 < len; i++)
+		{
+			idx = apropos_tri_find(p_apropos, CLI_APROPOS_TRI(
+				(unsigned char)word[w][i],
+				(unsigned char)word[w][i + 1],
+				(unsigned char)word[w][i + 2]));
+			if (idx < 0)
+				return 0;
+			list[n_lists] = (unsigned int)idx;
+			pos[n_lists] = 0;
+			if ((p_apropos->p_tri_start[idx + 1] - p_apropos->p_tri_start[idx]) <
+			    (p_apropos->p_tri_start[list[shortest] + 1] - p_apropos->p_tri_start[list[shortest]]))
+				shortest = n_lists;
+			n_lists++;
+		}
+	}
+
+	if (n_lists == 0)
+	{
+		/* short words only, check all commands */
+		for (cmd = 0; cmd < p_apropos->n_cmds; cmd++)
+		{
+			p_cmd = &p_apropos->p_cmds[cmd];
+			if (!apropos_cmd_match(p_cmd, word, n_words, usage_fct, p_data))
+				continue;
+			n_found++;
+			if (result_fct(p_data, p_cmd->p_short_name, p_cmd->p_long_name, p_cmd->p_cmd_data))
+				break;
+		}
+		return n_found;
+	}
+
+	/* intersect the posting lists, starting with the shortest */
+	start = p_apropos->p_tri_start[list[shortest]];
+	n_cand = p_apropos->p_tri_start[list[shortest] + 1] - start;
+	p_cand = (unsigned int *)clios_memalloc(n_cand * sizeof(unsigned int));
+	if (p_cand == IFX_NULL)
+		return IFX_ERROR;
+	clios_memcpy(p_cand, &p_apropos->p_post[start], n_cand * sizeof(unsigned int));
+
+	for (l = 0; (l < n_lists) && (n_cand > 0); l++)
+	{
+		if ((l == shortest) || ((l > 0) && (list[l] == list[l - 1])))
+			continue;
+		start = p_apropos->p_tri_start[list[l]];
+		n = p_apropos->p_tri_start[list[l] + 1] - start;
+		for (i = 0, w = 0; i < n_cand; i++)
+		{
+			if (apropos_post_contains(&p_apropos->p_post[start], n, &pos[l], p_cand[i]))
+				p_cand[w++] = p_cand[i];
+		}
+		n_cand = w;
+	}
+
+	/* verify the candidates (trigrams of a word may be spread) */
+	for (i = 0; i < n_cand; i++)
+	{
+		p_cmd = &p_apropos->p_cmds[p_cand[i]];
+		if (!apropos_cmd_match(p_cmd, word, n_words, usage_fct, p_data))
+			continue;
+		n_found++;
+		if (result_fct(p_data, p_cmd->p_short_name, p_cmd->p_long_name, p_cmd->p_cmd_data))
+			break;
+	}
+	clios_memfree(p_cand);
+
+	return n_found;
+}
+
+unsigned int cli_apropos_suggest(
+	const struct cli_apropos_s *p_apropos,
+	const char *p_name,
+	const char **pp_names,
+	unsigned int n_max)
+{
+	struct cli_apropos_near_s near;
+	unsigned int i;
+
+	if ((p_apropos == IFX_NULL) || (p_name == IFX_NULL) || (pp_names == IFX_NULL) ||
+	    !p_apropos->b_built || (p_apropos->n_bk == 0))
+		return 0;
+
+	near.len = apropos_name_lower(near.name, p_name);
+	if (near.len == 0)
+		return 0;
+	/* one typo for very short names, a swapped pair of characters counts 2 */
+	near.tolerance = (near.len <= 3) ? 1 : ((near.len <= 10) ? 2 : 3);
+	near.n_max = (n_max < CLI_APROPOS_SUGGEST_MAX) ? n_max : CLI_APROPOS_SUGGEST_MAX;
+	near.n_found = 0;
+	if (near.n_max == 0)
+		return 0;
+
+	apropos_bk_search(p_apropos, 0, &near);
+
+	for (i = 0; i < near.n_found; i++)
+		pp_names[i] = near.found[i].p_name;
+
+	return near.n_found;
+}
+
+#endif	/* #if (CLI_SUPPORT_APROPOS == 1) */
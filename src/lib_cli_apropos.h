@@ -0,0 +1,241 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_APROPOS_H
+#define _LIB_CLI_APROPOS_H
+
+/**
+   \file lib_cli_apropos.h
+   Command Line Interface - apropos and did-you-mean index
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_APROPOS CLI Apropos Index
+
+   Search index over the command names and usage texts, built by the CLI
+   core on activation (\ref cli_core_cfg_mode_active).
+
+   - trigram index: the lower case trigrams of the long name, the short name
+     and the usage text (metadata or help store) of each command, sorted
+     trigram table with a posting list (sorted command numbers) per trigram.
+     A search intersects the posting lists of the trigrams of all search
+     words (shortest list first) and verifies the candidates with a substring
+     check. Search words shorter than 3 characters do not narrow down the
+     candidates.
+   - BK-tree over the short and long names (Levenshtein distance, case
+     insensitive): the nearest names of an unknown command.
+
+   The built-in command "apropos <word> [<word> ...]" lists the commands
+   containing all words, an unknown command error names the nearest
+   commands:
+   \code
+   errorcode=-1 (unknown command, did you mean: vlan_add vlan_del)
+   \endcode
+
+\remarks
+   The index refers to the command names of the CLI core (not copied),
+   it is rebuilt with the next activation after a command shutdown.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** max length of a name for the distance calculation (longer names are cut) */
+#define CLI_APROPOS_NAME_LEN_MAX	64
+
+/** max number of words of a search term */
+#define CLI_APROPOS_WORDS_MAX	4
+
+/** Forward declaration, apropos index */
+struct cli_apropos_s;
+
+/** Usage text check, called for the candidates of a search.
+
+\param
+   p_data  user data, given with the search call.
+\param
+   p_cmd_data  command data, given with \ref cli_apropos_cmd_add.
+\param
+   p_word  search word (lower case).
+
+\return
+   1 - the usage text contains the word
+   0 - else
+*/
+typedef int (*cli_apropos_usage_fct_t)(
+	void *p_data,
+	void *p_cmd_data,
+	const char *p_word);
+
+/** Search result callback, called in the order of the long names.
+
+\param
+   p_data  user data, given with the search call.
+\param
+   p_short_name  short name of the command, IFX_NULL: none.
+\param
+   p_long_name  long name of the command.
+\param
+   p_cmd_data  command data, given with \ref cli_apropos_cmd_add.
+
+\return
+   0 - continue
+   else - stop
+*/
+typedef int (*cli_apropos_result_fct_t)(
+	void *p_data,
+	const char *p_short_name,
+	const char *p_long_name,
+	void *p_cmd_data);
+
+/** Create an (empty) apropos index.
+
+\param
+   pp_apropos  returns the index.
+\param
+   n_cmds_max  max number of commands.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_apropos_init(
+	struct cli_apropos_s **pp_apropos,
+	unsigned int n_cmds_max);
+
+/** Release an apropos index.
+
+\param
+   pp_apropos  index to release.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_apropos_release(
+	struct cli_apropos_s **pp_apropos);
+
+/** Add a command to the index, the commands are added in the order of the
+   long names (the order of the search results).
+
+\param
+   p_apropos  apropos index.
+\param
+   p_short_name  short name (not copied), IFX_NULL: none.
+\param
+   p_long_name  long name (not copied).
+\param
+   p_usage  usage text (indexed, not kept), IFX_NULL: none.
+\param
+   usage_len  length of the usage text.
+\param
+   p_cmd_data  command data for the callbacks.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (index full, no memory).
+*/
+extern int cli_apropos_cmd_add(
+	struct cli_apropos_s *p_apropos,
+	const char *p_short_name,
+	const char *p_long_name,
+	const char *p_usage,
+	unsigned int usage_len,
+	void *p_cmd_data);
+
+/** Complete the index (posting lists, BK-tree), no commands can be added
+   afterwards.
+
+\param
+   p_apropos  apropos index.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (no memory).
+*/
+extern int cli_apropos_build(
+	struct cli_apropos_s *p_apropos);
+
+/** Search the commands containing all words of a term (within a name or
+   the usage text, case insensitive).
+
+\param
+   p_apropos  apropos index.
+\param
+   p_term  search term, words separated by spaces.
+\param
+   usage_fct  usage text check, IFX_NULL: search the names only.
+\param
+   result_fct  result callback.
+\param
+   p_data  user data for the callbacks.
+
+\return
+   number of reported commands
+   IFX_ERROR - failed (invalid term, no memory).
+*/
+extern int cli_apropos_find(
+	const struct cli_apropos_s *p_apropos,
+	const char *p_term,
+	cli_apropos_usage_fct_t usage_fct,
+	cli_apropos_result_fct_t result_fct,
+	void *p_data);
+
+/** Get the nearest command names of an unknown name (did-you-mean).
+
+\param
+   p_apropos  apropos index.
+\param
+   p_name  unknown name.
+\param
+   pp_names  returns the nearest names (best first, one per command).
+\param
+   n_max  max number of names.
+
+\return
+   number of returned names
+*/
+extern unsigned int cli_apropos_suggest(
+	const struct cli_apropos_s *p_apropos,
+	const char *p_name,
+	const char **pp_names,
+	unsigned int n_max);
+
+/** Case insensitive substring search within a text.
+
+\param
+   p_text  text (not zero terminated).
+\param
+   len  length of the text.
+\param
+   p_word  search word (lower case).
+
+\return
+   1 - found
+   0 - else
+*/
+extern int cli_apropos_text_find(
+	const char *p_text,
+	unsigned int len,
+	const char *p_word);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_APROPOS_H */
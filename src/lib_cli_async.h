@@ -0,0 +1,160 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_ASYNC_H
+#define _LIB_CLI_ASYNC_H
+
+/**
+   \file lib_cli_async.h
+   Command Line Interface - asynchronous command execution
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_ASYNC CLI Asynchronous Command Execution
+
+   \ref cli_core_cmd_exec_async queues a command line to the executor pool
+   of the CLI core (\ref cli_core_async_pool_set) and returns immediately.
+   The output is appended to the given sink, the completion callback is
+   called with the result on the thread which finishes the command.
+
+   A handler which waits on the hardware (firmware download, table scan)
+   releases the worker thread with \ref cli_cmd_defer and finishes later
+   from any thread with \ref cli_cmd_complete:
+   \code
+   static int my_fw_download(void *p_ctx, const char *p_cmd, clios_file_io_t *p_out)
+   {
+      struct cli_exec_ctx_s *p_exec_ctx = cli_cmd_defer();
+
+      if (p_exec_ctx == IFX_NULL)
+         return my_fw_download_wait(p_cmd, p_out);   synchronous caller
+
+      my_fw_download_start(p_cmd, p_exec_ctx);
+      return 0;
+   }
+
+   ... firmware callback:
+      (void)cli_out_sink_printf(p_exec_ctx->p_sink, "errorcode=0" CLI_CRLF);
+      (void)cli_cmd_complete(p_exec_ctx, 0);
+   \endcode
+
+\remarks
+   - The request holds a reference to the CLI core, a release of the CLI
+     core is deferred until the last request is completed.
+   - The statistics, the flight recorder and the post hooks see the return
+     value of the handler call, not the status of a deferred completion.
+   - The pipe and the console interfaces keep the synchronous execution.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Pool session of the asynchronous executions outside of a pipe session */
+#define CLI_ASYNC_SESSION	0xFFFFFFFE
+
+/** Forward declaration, executor pool */
+struct cli_pool_s;
+
+/** Completion callback of an asynchronous execution.
+
+\param
+   p_user  user data, given with \ref cli_core_cmd_exec_async.
+\param
+   status  result of the command (return value of the handler, status
+      of \ref cli_cmd_complete), IFX_ERROR: not executed.
+\param
+   p_sink  output sink of the execution (not flushed).
+*/
+typedef void (*cli_cmd_done_fct_t)(
+	void *p_user,
+	int status,
+	struct cli_out_sink_s *p_sink);
+
+/** Set the executor pool of the asynchronous executions of a CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_pool  executor pool, IFX_NULL: no asynchronous execution.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+
+\remarks
+   Queued requests of a released pool are completed with IFX_ERROR.
+*/
+extern int cli_core_async_pool_set(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_pool_s *p_pool);
+
+/** Execute a command line asynchronously by the executor pool.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_cmd_line  command line (copied).
+\param
+   p_sink  output sink, valid until the completion callback.
+\param
+   done_fct  completion callback, IFX_NULL: none.
+\param
+   p_user  user data of the completion callback.
+
+\return
+   IFX_SUCCESS - queued, the completion callback reports the result
+   IFX_ERROR - failed (no pool, CLI core not active, no memory), the
+      completion callback is not called.
+*/
+extern int cli_core_cmd_exec_async(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd_line,
+	struct cli_out_sink_s *p_sink,
+	cli_cmd_done_fct_t done_fct,
+	void *p_user);
+
+/** Defer the completion of the running command handler, the handler
+   returns and releases the worker thread.
+
+\return
+   execution context for \ref cli_cmd_complete, valid until the completion
+   (the output sink of the context collects the later output)
+   IFX_NULL - no asynchronous execution, the handler completes the
+      command synchronously.
+*/
+extern struct cli_exec_ctx_s *cli_cmd_defer(void);
+
+/** Complete a deferred command, called once from any thread.
+
+\param
+   p_exec_ctx  execution context returned by \ref cli_cmd_defer.
+\param
+   status  result of the command.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_cmd_complete(
+	struct cli_exec_ctx_s *p_exec_ctx,
+	int status);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_ASYNC_H */
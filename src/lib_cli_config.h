@@ -110,6 +110,392 @@ extern "C"
 #	define CLI_SUPPORT_PIPE	0
 #endif
 
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_THREAD_LOCAL
+#		undef CLI_SUPPORT_THREAD_LOCAL
+#	endif
+#	define CLI_SUPPORT_THREAD_LOCAL	0
+#else
+#	ifndef CLI_SUPPORT_THREAD_LOCAL
+		/** thread local storage available (per call execution context, sessions,
+		    output sink, statistics shards, flight recorder) */
+#		define CLI_SUPPORT_THREAD_LOCAL	1
+#	endif
+#endif
+
+#if defined(LINUX) && !defined(__KERNEL__)
+#	ifndef CLI_SUPPORT_JOURNAL
+		/** enable the persistent event / dump journal (memory mapped file) */
+#		define CLI_SUPPORT_JOURNAL	1
+#	endif
+#else
+#	ifdef CLI_SUPPORT_JOURNAL
+#		undef CLI_SUPPORT_JOURNAL
+#	endif
+#	define CLI_SUPPORT_JOURNAL	0
+#endif
+
+#ifndef CLI_JOURNAL_DEFAULT_SLOTS
+	/** default number of journal entries (slots) */
+#	define CLI_JOURNAL_DEFAULT_SLOTS	1024
+#endif
+
+#ifndef CLI_JOURNAL_DEFAULT_SLOT_SIZE
+	/** default size of a journal entry (slot header + text) */
+#	define CLI_JOURNAL_DEFAULT_SLOT_SIZE	256
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_EVENT_LIMIT
+#		undef CLI_SUPPORT_EVENT_LIMIT
+#	endif
+#	define CLI_SUPPORT_EVENT_LIMIT	0
+#else
+#	ifndef CLI_SUPPORT_EVENT_LIMIT
+		/** enable event coalescing and rate limiting (per event key) */
+#		define CLI_SUPPORT_EVENT_LIMIT	1
+#	endif
+#endif
+
+#ifndef CLI_EVENT_LIMIT_MAX_RULES
+	/** max number of event limit rules */
+#	define CLI_EVENT_LIMIT_MAX_RULES	16
+#endif
+
+#ifndef CLI_EVENT_LIMIT_MAX_KEYS
+	/** max number of event keys tracked by the event limiter */
+#	define CLI_EVENT_LIMIT_MAX_KEYS	64
+#endif
+
+#ifndef CLI_EVENT_LIMIT_KEY_SIZE
+	/** max size of an event key (first word of the event text) */
+#	define CLI_EVENT_LIMIT_KEY_SIZE	32
+#endif
+
+#ifndef CLI_EVENT_LIMIT_TEXT_SIZE
+	/** max size of a coalesced (pending) event text */
+#	define CLI_EVENT_LIMIT_TEXT_SIZE	256
+#endif
+
+#if (defined(LINUX) && defined(__KERNEL__)) || (CLI_SUPPORT_THREAD_LOCAL == 0)
+#	ifdef CLI_SUPPORT_STATS
+#		undef CLI_SUPPORT_STATS
+#	endif
+#	define CLI_SUPPORT_STATS	0
+#else
+#	ifndef CLI_SUPPORT_STATS
+		/** enable the per command statistics (call counter, latency histogram) */
+#		define CLI_SUPPORT_STATS	1
+#	endif
+#endif
+
+#ifndef CLI_STATS_SHARDS
+	/** number of statistic shards (threads are spread over the shards) */
+#	define CLI_STATS_SHARDS	4
+#endif
+
+#ifndef CLI_STATS_HIST_BUCKETS
+	/** number of latency histogram buckets (log2 [us], last one open) */
+#	define CLI_STATS_HIST_BUCKETS	20
+#endif
+
+#if (defined(LINUX) && defined(__KERNEL__)) || (CLI_SUPPORT_THREAD_LOCAL == 0)
+#	ifdef CLI_SUPPORT_TRACE
+#		undef CLI_SUPPORT_TRACE
+#	endif
+#	define CLI_SUPPORT_TRACE	0
+#else
+#	ifndef CLI_SUPPORT_TRACE
+		/** enable the flight recorder (trace of the last command executions) */
+#		define CLI_SUPPORT_TRACE	1
+#	endif
+#endif
+
+#ifndef CLI_TRACE_DEFAULT_ENTRIES
+	/** number of flight recorder entries per CLI core (0: no flight recorder) */
+#	define CLI_TRACE_DEFAULT_ENTRIES	128
+#endif
+
+#ifndef CLI_TRACE_KEY_SIZE
+	/** max size of the command key within a trace entry */
+#	define CLI_TRACE_KEY_SIZE	32
+#endif
+
+#ifndef CLI_TRACE_ARGS_SIZE
+	/** max size of the (truncated) arguments within a trace entry */
+#	define CLI_TRACE_ARGS_SIZE	64
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_METRICS
+#		undef CLI_SUPPORT_METRICS
+#	endif
+#	define CLI_SUPPORT_METRICS	0
+#else
+#	ifndef CLI_SUPPORT_METRICS
+		/** enable the OpenMetrics exporter (built-in command, file / socket writer) */
+#		define CLI_SUPPORT_METRICS	1
+#	endif
+#endif
+
+#ifndef CLI_METRICS_BUFFER_SIZE
+	/** initial size of the metrics render buffer (allocated once per CLI core) */
+#	define CLI_METRICS_BUFFER_SIZE	16384
+#endif
+
+#ifndef CLI_METRICS_BUFFER_MAX
+	/** max size of the metrics render buffer (the buffer grows on demand) */
+#	define CLI_METRICS_BUFFER_MAX	(1024 * 1024)
+#endif
+
+#ifndef CLI_METRICS_MAX_SOURCES
+	/** max number of additional metrics sources (pipe interfaces, user) */
+#	define CLI_METRICS_MAX_SOURCES	4
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_RECORD
+#		undef CLI_SUPPORT_RECORD
+#	endif
+#	define CLI_SUPPORT_RECORD	0
+#else
+#	ifndef CLI_SUPPORT_RECORD
+		/** enable the command recording (binary log) and replay */
+#		define CLI_SUPPORT_RECORD	1
+#	endif
+#endif
+
+#ifndef CLI_RECORD_BUFFER_SIZE
+	/** size of the record buffer (allocated on start of the recording) */
+#	define CLI_RECORD_BUFFER_SIZE	65536
+#endif
+
+#ifndef CLI_RECORD_KEY_MAX
+	/** max recorded length of a command key */
+#	define CLI_RECORD_KEY_MAX	128
+#endif
+
+#ifndef CLI_RECORD_ARGS_MAX
+	/** max recorded length of the command arguments, longer ones are truncated */
+#	define CLI_RECORD_ARGS_MAX	4096
+#endif
+
+#ifndef CLI_EXEC_CURSOR_BUFFER_SIZE
+#	if defined(LINUX) && defined(__KERNEL__)
+		/** output buffer of a continued buffer mode execution (kernel) */
+#		define CLI_EXEC_CURSOR_BUFFER_SIZE	16384
+#	else
+		/** output buffer of a continued buffer mode execution */
+#		define CLI_EXEC_CURSOR_BUFFER_SIZE	65536
+#	endif
+#endif
+
+#if (defined(LINUX) && defined(__KERNEL__)) || (CLI_SUPPORT_THREAD_LOCAL == 0)
+#	ifdef CLI_SUPPORT_OUT_SINK
+#		undef CLI_SUPPORT_OUT_SINK
+#	endif
+#	define CLI_SUPPORT_OUT_SINK	0
+#else
+#	ifndef CLI_SUPPORT_OUT_SINK
+		/** enable the buffered output sink (see cli_core_cmd_exec__sink) */
+#		define CLI_SUPPORT_OUT_SINK	1
+#	endif
+#endif
+
+#ifndef CLI_OUT_SINK_INLINE_SIZE
+	/** size of the storage embedded in the sink (first chunk) */
+#	define CLI_OUT_SINK_INLINE_SIZE	512
+#endif
+
+#ifndef CLI_OUT_SINK_CHUNK_MAX
+	/** max size of an allocated chunk (larger only for a single printout) */
+#	define CLI_OUT_SINK_CHUNK_MAX	65536
+#endif
+
+#ifndef CLI_OUT_SINK_EXEC_BUFFER_SIZE
+	/** command / output buffer for the execution into a sink (buffer mode) */
+#	define CLI_OUT_SINK_EXEC_BUFFER_SIZE	65536
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_OUT_BUILDER
+#		undef CLI_SUPPORT_OUT_BUILDER
+#	endif
+#	define CLI_SUPPORT_OUT_BUILDER	0
+#else
+#	ifndef CLI_SUPPORT_OUT_BUILDER
+		/** enable the typed output builder (see cli_out_builder_init__buffer) */
+#		define CLI_SUPPORT_OUT_BUILDER	1
+#	endif
+#endif
+
+#ifndef CLI_OUT_BUILDER_STAGE_SIZE
+	/** embedded output buffer of a file mode builder */
+#	define CLI_OUT_BUILDER_STAGE_SIZE	1024
+#endif
+
+#if (defined(LINUX) && defined(__KERNEL__)) || (CLI_SUPPORT_OUT_SINK == 0)
+#	ifdef CLI_SUPPORT_STRUCT_OUT
+#		undef CLI_SUPPORT_STRUCT_OUT
+#	endif
+#	define CLI_SUPPORT_STRUCT_OUT	0
+#else
+#	ifndef CLI_SUPPORT_STRUCT_OUT
+		/** enable the structured output (JSON lines / TLV, requires the output sink) */
+#		define CLI_SUPPORT_STRUCT_OUT	1
+#	endif
+#endif
+
+#ifndef CLI_STRUCT_OUT_RECORD_SIZE
+	/** max size of a structured output record, larger fields are dropped */
+#	define CLI_STRUCT_OUT_RECORD_SIZE	1024
+#endif
+
+#ifndef CLI_SUPPORT_HELP_CACHE
+	/** enable the cache of the pre-rendered help listings */
+#	define CLI_SUPPORT_HELP_CACHE	1
+#endif
+
+#ifndef CLI_HELP_CACHE_ENTRIES
+	/** max number of cached help listings (short, detailed, ...) */
+#	define CLI_HELP_CACHE_ENTRIES	4
+#endif
+
+#ifndef CLI_HELP_CACHE_BUFFER_SIZE
+#	if defined(LINUX) && defined(__KERNEL__)
+		/** render buffer of a buffer mode help listing (kernel) */
+#		define CLI_HELP_CACHE_BUFFER_SIZE	16384
+#	else
+		/** render buffer of a buffer mode help listing */
+#		define CLI_HELP_CACHE_BUFFER_SIZE	65536
+#	endif
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_HELP_STORE
+#		undef CLI_SUPPORT_HELP_STORE
+#	endif
+#	define CLI_SUPPORT_HELP_STORE	0
+#else
+#	ifndef CLI_SUPPORT_HELP_STORE
+		/** enable the compressed help text store (see cli_core_help_store_set) */
+#		define CLI_SUPPORT_HELP_STORE	1
+#	endif
+#endif
+
+#ifndef CLI_HELP_STORE_LRU_ENTRIES
+	/** number of decompressed help store blocks kept in the cache */
+#	define CLI_HELP_STORE_LRU_ENTRIES	2
+#endif
+
+#ifndef CLI_SUPPORT_GROUP_INDEX
+	/** enable the group index (more than 15 groups, command lists per group) */
+#	define CLI_SUPPORT_GROUP_INDEX	1
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_APROPOS
+#		undef CLI_SUPPORT_APROPOS
+#	endif
+#	define CLI_SUPPORT_APROPOS	0
+#else
+#	ifndef CLI_SUPPORT_APROPOS
+		/** enable the apropos index and the did-you-mean of unknown commands */
+#		define CLI_SUPPORT_APROPOS	1
+#	endif
+#endif
+
+#ifndef CLI_APROPOS_RESULTS_MAX
+	/** max number of commands listed by the built-in command "apropos" */
+#	define CLI_APROPOS_RESULTS_MAX	64
+#endif
+
+#ifndef CLI_APROPOS_SUGGEST_MAX
+	/** max number of suggestions for an unknown command */
+#	define CLI_APROPOS_SUGGEST_MAX	3
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_NAMESPACE
+#		undef CLI_SUPPORT_NAMESPACE
+#	endif
+#	define CLI_SUPPORT_NAMESPACE	0
+#else
+#	ifndef CLI_SUPPORT_NAMESPACE
+		/** enable the hierarchical command registration (see cli_core_key_add_path__file) */
+#		define CLI_SUPPORT_NAMESPACE	1
+#	endif
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_HOOKS
+#		undef CLI_SUPPORT_HOOKS
+#	endif
+#	define CLI_SUPPORT_HOOKS	0
+#else
+#	ifndef CLI_SUPPORT_HOOKS
+		/** enable the command execution hooks (see cli_core_hook_add) */
+#		define CLI_SUPPORT_HOOKS	1
+#	endif
+#endif
+
+#ifndef CLI_HOOKS_MAX
+	/** max number of installed hooks per CLI core */
+#	define CLI_HOOKS_MAX	8
+#endif
+
+#if (defined(LINUX) && defined(__KERNEL__)) || (CLI_SUPPORT_THREAD_LOCAL == 0)
+#	ifdef CLI_SUPPORT_SESSION
+#		undef CLI_SUPPORT_SESSION
+#	endif
+#	define CLI_SUPPORT_SESSION	0
+#else
+#	ifndef CLI_SUPPORT_SESSION
+		/** enable the sessions on a shared command table (see cli_session_open) */
+#		define CLI_SUPPORT_SESSION	1
+#	endif
+#endif
+
+#if defined(LINUX) && defined(__KERNEL__)
+#	ifdef CLI_SUPPORT_POOL
+#		undef CLI_SUPPORT_POOL
+#	endif
+#	define CLI_SUPPORT_POOL	0
+#else
+#	ifndef CLI_SUPPORT_POOL
+		/** enable the executor pool (see cli_pool_init) */
+#		define CLI_SUPPORT_POOL	1
+#	endif
+#endif
+
+#ifndef CLI_POOL_MAX_WORKERS
+	/** max number of worker threads of an executor pool */
+#	define CLI_POOL_MAX_WORKERS	16
+#endif
+
+#ifndef CLI_POOL_MAX_SESSIONS
+	/** max number of session queues of an executor pool (fair scheduling) */
+#	define CLI_POOL_MAX_SESSIONS	16
+#endif
+
+#if (CLI_SUPPORT_POOL == 0) || (CLI_SUPPORT_OUT_SINK == 0)
+#	ifdef CLI_SUPPORT_ASYNC
+#		undef CLI_SUPPORT_ASYNC
+#	endif
+#	define CLI_SUPPORT_ASYNC	0
+#else
+#	ifndef CLI_SUPPORT_ASYNC
+		/** enable the asynchronous command execution (see
+		    cli_core_cmd_exec_async, requires the pool and the output sink) */
+#		define CLI_SUPPORT_ASYNC	1
+#	endif
+#endif
+
+#ifndef CLI_CORE_PRINT_LINE_SIZE
+	/** max line size of the built-in command printout to file */
+#	define CLI_CORE_PRINT_LINE_SIZE	512
+#endif
+
 #ifndef MAX_CLI_PIPES
 	/** max number of pipe interfaces */
 #	define MAX_CLI_PIPES	3
@@ -18,6 +18,9 @@
 #include "lib_cli_debug.h"
 #include "lib_cli_core.h"
 #include "lib_cli_console.h"
+#if (CLI_SUPPORT_POOL == 1)
+#	include "lib_cli_pool.h"
+#endif
 
 #ifdef CLI_STATIC
 #	undef CLI_STATIC
@@ -88,6 +91,10 @@ struct cli_console_context_s {
 	cli_console_prompt_fct_t fct_cons_prompt_get;
 	/** default prompt, can be set from outside, used of no prompt function is set */
 	char default_prompt[CLI_CONSOLE_PROMPT_SIZE];
+#if (CLI_SUPPORT_POOL == 1)
+	/** executor pool of the commands, IFX_NULL: console thread */
+	struct cli_pool_s *p_pool;
+#endif
 #if (CLI_CONSOLE_NON_BLOCKING == 1)
 	/*
 	   console non-blocking mode via select, supported under:
@@ -380,6 +387,27 @@ CLI_STATIC int cli_complete_prepare(const char *cli_cmd, void *user_data)
 	return 0;
 }
 
+/* Iterate over the candidates of the last token of the input line
+ * (`shared->input`): the commands for the first token, else the sub-commands
+ * of the level given by the previous tokens (path commands). */
+CLI_STATIC void cli_complete_traverse(struct cli_core_context_s *p_core_ctx,
+	const char *p_line,
+	struct cli_console_complete_s *shared,
+	int (*handler)(const char *s, void *user_data))
+{
+	char level[CLI_MAX_COMMAND_LINE_LENGTH];
+	unsigned int len = (unsigned int)(shared->input - p_line);
+
+	if (len == 0) {
+		cli_traverse(p_core_ctx, handler, shared);
+		return;
+	}
+
+	clios_memcpy(level, p_line, len);
+	level[len] = '\0';
+	(void)cli_traverse_level(p_core_ctx, level, handler, shared);
+}
+
 /* Iterate over all registered CLI commands and print the matched ones
  * taking into account that we need to print at most `shared->matches_per_line`
  * commands on a line. Also, pad each command to the left with spaces (up to
@@ -665,6 +693,62 @@ CLI_STATIC void console_prompt_print(
 	return;
 }
 
+#if (CLI_SUPPORT_POOL == 1)
+/** Console command, executed by the executor pool */
+struct cli_console_cmd_s
+{
+	/** CLI core */
+	struct cli_core_context_s *p_cli_core_ctx;
+	/** command key */
+	char *p_cmd;
+	/** command arguments */
+	char *p_arg;
+	/** console output */
+	clios_file_t *p_out;
+};
+
+/** Job function of a console command */
+CLI_STATIC int console_cmd_job(void *p_data)
+{
+	struct cli_console_cmd_s *p_cmd = (struct cli_console_cmd_s *)p_data;
+
+	return cli_core_cmd_arg_exec__file(
+		p_cmd->p_cli_core_ctx, p_cmd->p_cmd, p_cmd->p_arg, p_cmd->p_out);
+}
+#endif
+
+/** Execute a console command, by the executor pool (if set)
+
+   \param[in] p_console_ctx Console context pointer
+*/
+CLI_STATIC int console_cmd_exec(
+	struct cli_console_context_s *p_console_ctx,
+	struct cli_core_context_s *p_cli_core_ctx,
+	char *p_cmd,
+	char *p_arg,
+	clios_file_t *p_out)
+{
+#if (CLI_SUPPORT_POOL == 1)
+	struct cli_console_cmd_s cmd;
+
+	if (p_console_ctx->p_pool != IFX_NULL)
+	{
+		cmd.p_cli_core_ctx = p_cli_core_ctx;
+		cmd.p_cmd = p_cmd;
+		cmd.p_arg = p_arg;
+		cmd.p_out = p_out;
+
+		return cli_pool_run(p_console_ctx->p_pool, CLI_POOL_SESSION_INTERACTIVE,
+			console_cmd_job, &cmd,
+			cli_core_cmd_concurrent_get(p_cli_core_ctx, p_cmd));
+	}
+#else
+	(void)p_console_ctx;
+#endif
+
+	return cli_core_cmd_arg_exec__file(p_cli_core_ctx, p_cmd, p_arg, p_out);
+}
+
 /** Handle console input
 
    \param[in] p_console_ctx Console context pointer
@@ -683,6 +767,7 @@ CLI_STATIC int console_handle(
 #if (CLI_SUPPORT_AUTO_COMPLETION == 1)
 	struct cli_console_complete_s shared;
 	int terminal_width = clios_terminal_width_get();
+	char *p_token, *p_char;
 #endif
 
 	if (p_console_ctx == IFX_NULL) {
@@ -831,17 +916,23 @@ CLI_STATIC int console_handle(
 
 #if (CLI_SUPPORT_AUTO_COMPLETION == 1)
 		case KEY_INPUT_TAB:
-			/* tab */
-			shared.input = p_console_ctx->prompt_line;
+			/* tab - complete the last token */
+			p_token = p_console_ctx->prompt_line;
+			for (p_char = p_token; *p_char != '\0'; p_char++)
+				if (*p_char == ' ')
+					p_token = p_char + 1;
+
+			shared.input = p_token;
 			shared.p_out = p_out;
 			shared.match_i = 0;
 			shared.match_num = 0;
-			shared.match_chars = sizeof(p_console_ctx->prompt_line) - 1;
+			shared.match_chars = sizeof(p_console_ctx->prompt_line) - 1 -
+				(int)(p_token - p_console_ctx->prompt_line);
 			shared.max_match_len = 0;
 			shared.match = IFX_NULL;
 
-			cli_traverse(p_console_ctx->p_cli_core_ctx,
-				cli_complete_prepare, &shared);
+			cli_complete_traverse(p_console_ctx->p_cli_core_ctx,
+				p_console_ctx->prompt_line, &shared, cli_complete_prepare);
 
 			shared.matches_per_line = terminal_width / (shared.max_match_len + 1);
 
@@ -853,22 +944,22 @@ CLI_STATIC int console_handle(
 			if (shared.match_num == 1)
 			{
 				/* we found exactly one match, so just use it */
-				clios_strcpy(p_console_ctx->prompt_line, shared.match);
+				clios_strcpy(p_token, shared.match);
 			}
 			else
 			{
 				/* print all possible matches */
 				(void)clios_fprintf(p_out, CLI_CRLF);
-				cli_traverse(p_console_ctx->p_cli_core_ctx,
-					cli_complete_print, &shared);
+				cli_complete_traverse(p_console_ctx->p_cli_core_ctx,
+					p_console_ctx->prompt_line, &shared, cli_complete_print);
 
 				(void)clios_fprintf(p_out, CLI_CRLF);
 
 				if (shared.match_num > 1 && shared.match_chars)
 				{
 					/* use longest common sequence as our input */
-					clios_memcpy(p_console_ctx->prompt_line, shared.match, shared.match_chars);
-					p_console_ctx->prompt_line[shared.match_chars] = '\0';
+					clios_memcpy(p_token, shared.match, shared.match_chars);
+					p_token[shared.match_chars] = '\0';
 				}
 			}
 			b_upd_prompt = 1;
@@ -921,7 +1012,7 @@ CLI_STATIC int console_handle(
 		(void)clios_fflush(p_out);
 #		endif
 
-		result = cli_core_cmd_arg_exec__file(
+		result = console_cmd_exec(p_console_ctx,
 			p_cli_core_ctx, p_console_ctx->user_cmd, p_console_ctx->prompt_line + len + 1, p_out);
 
 #		if defined(IFXOS_HAVE_FILE_ACCESS) && (IFXOS_HAVE_FILE_ACCESS == 1)
@@ -1228,6 +1319,20 @@ int cli_console_char_read_fct_set(
 	return IFX_SUCCESS;
 }
 
+#if (CLI_SUPPORT_POOL == 1)
+int cli_console_pool_set(
+	struct cli_console_context_s *p_console_ctx,
+	struct cli_pool_s *p_pool)
+{
+	if (p_console_ctx == IFX_NULL)
+		return IFX_ERROR;
+
+	p_console_ctx->p_pool = p_pool;
+
+	return IFX_SUCCESS;
+}
+#endif
+
 /** @} */
 
 #endif /* #if (CLI_SUPPORT_CONSOLE == 1) */
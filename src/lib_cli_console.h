@@ -38,6 +38,9 @@ extern "C" {
 
 /* forward declaration */
 struct cli_console_context_s;
+#if (CLI_SUPPORT_POOL == 1)
+struct cli_pool_s;
+#endif
 
 
 
@@ -239,6 +242,29 @@ extern int cli_console_char_read_fct_set(
 	struct cli_console_context_s *p_console_ctx,
 	const cli_console_char_read_fct f_char_read);
 
+#if (CLI_SUPPORT_POOL == 1)
+/**
+   Execute the console commands by an executor pool, within the interactive
+   lane (served before the sessions of the pipes, see \ref LIB_CLI_POOL).
+
+\param[in]
+   p_console_ctx   points to the console context.
+\param[in]
+   p_pool  executor pool, IFX_NULL: executed by the console thread.
+
+\return
+   - IFX_ERROR On error
+   - IFX_SUCCESS On success
+
+\remarks
+   The console waits for the execution. The pool must be reset (or the
+   console released) before the pool is released.
+*/
+extern int cli_console_pool_set(
+	struct cli_console_context_s *p_console_ctx,
+	struct cli_pool_s *p_pool);
+#endif
+
 
 
 /** @} */
@@ -15,6 +15,49 @@
 #include "lib_cli_osmap.h"
 #include "lib_cli_debug.h"
 #include "lib_cli_core.h"
+#if (CLI_SUPPORT_JOURNAL == 1)
+#	include "lib_cli_journal.h"
+#endif
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+#	include "lib_cli_event_limit.h"
+#endif
+#if (CLI_SUPPORT_STATS == 1)
+#	include "lib_cli_stats.h"
+#endif
+#if (CLI_SUPPORT_TRACE == 1)
+#	include "lib_cli_trace.h"
+#endif
+#if (CLI_SUPPORT_METRICS == 1)
+#	include "lib_cli_metrics.h"
+#endif
+#if (CLI_SUPPORT_RECORD == 1)
+#	include "lib_cli_record.h"
+#endif
+#if (CLI_SUPPORT_OUT_SINK == 1)
+#	include "lib_cli_out_sink.h"
+#endif
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+#	include "lib_cli_struct_out.h"
+#endif
+#if (CLI_SUPPORT_HELP_STORE == 1)
+#	include "lib_cli_help_store.h"
+#endif
+#if (CLI_SUPPORT_APROPOS == 1)
+#	include "lib_cli_apropos.h"
+#endif
+#if (CLI_SUPPORT_NAMESPACE == 1)
+#	include "lib_cli_ns.h"
+#endif
+#if (CLI_SUPPORT_HOOKS == 1)
+#	include "lib_cli_hooks.h"
+#endif
+#if (CLI_SUPPORT_SESSION == 1)
+#	include "lib_cli_session.h"
+#endif
+#if (CLI_SUPPORT_ASYNC == 1)
+#	include "lib_cli_pool.h"
+#	include "lib_cli_async.h"
+#endif
 
 #ifdef CLI_STATIC
 #	undef CLI_STATIC
@@ -42,6 +85,21 @@
 /** max number of user specific groups */
 #define CLI_MAX_USER_GROUPS 15
 
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+/** max number of user specific groups (group number of the key entries) */
+#	define CLI_GROUP_INDEX_MAX_GROUPS	256
+#endif
+/** number of tags of the selection mask bits, behind the user groups */
+#define CLI_GROUP_TAG_LEGACY_NUM	16
+/** tag of the selection mask bit (not registered groups, misc) */
+#define CLI_GROUP_TAG_LEGACY(p_group, bit)	((unsigned int)(p_group)->n_reg_groups + (bit))
+/** tag of the misc commands (CLI_USER_MASK_MISC) */
+#define CLI_GROUP_TAG_MISC(p_group)	CLI_GROUP_TAG_LEGACY(p_group, 15)
+/** tag of the built-in commands */
+#define CLI_GROUP_TAG_BUILTIN(p_group)	CLI_GROUP_TAG_LEGACY(p_group, CLI_GROUP_TAG_LEGACY_NUM)
+/** number of tags */
+#define CLI_GROUP_TAG_NUM(p_group)	(CLI_GROUP_TAG_BUILTIN(p_group) + 1)
+
 /** selection mask - device */
 #define CLI_USER_MASK_MISC	0x00008000
 
@@ -57,6 +115,21 @@
 /** short form of the command */
 #define CLI_INTERN_MASK_BUILTIN		0x80000000
 
+/** registration flags, kept with the selection mask */
+#define CLI_CMD_MASK_FLAGS		CLI_CMD_MASK_CONCURRENT
+
+/** line length checked by cli_core_cmd_concurrent_get and
+   cli_core_cmd_interactive_get (arguments are cut) */
+#define CLI_CMD_CONCURRENT_LINE_LEN	256
+
+/** min output buffer size of a continued buffer mode execution */
+#define CLI_EXEC_CURSOR_SIZE_MIN	256
+
+/** max path length of a file written by a built-in command */
+#define CLI_CORE_FILE_PATH_SIZE	256
+
+/** max wait time for a wakeup [ms], the wait condition is checked again */
+#define CLI_CORE_WAIT_TIMEOUT	100
 
 #define CLI_EMPTY_CMD " "
 #define CLI_EMPTY_CMD_HELP "n/a"
@@ -68,6 +141,47 @@
 		else { return IFX_ERROR;}\
 	} while (0)
 
+#if (CLI_SUPPORT_STATS == 1) || (CLI_SUPPORT_TRACE == 1)
+/** take the start time (and the trace data) of a command execution */
+#define CLI_CMD_MEAS_START(P_CORE_CTX, MEAS, P_KEY, P_ARG) \
+	cmd_meas_start((P_CORE_CTX), &(MEAS), (P_KEY), (P_ARG))
+
+/** count / trace a command execution */
+#define CLI_CMD_MEAS_STOP(P_CORE_CTX, MEAS, CMD_IDX, RET, P_OUT) \
+	cmd_meas_stop((P_CORE_CTX), &(MEAS), (CMD_IDX), (RET), (P_OUT))
+
+/** count / trace an unknown command */
+#define CLI_CMD_MEAS_UNKNOWN(P_CORE_CTX, MEAS, P_KEY, P_ARG) \
+	do {\
+		cmd_meas_start((P_CORE_CTX), &(MEAS), (P_KEY), (P_ARG));\
+		cmd_meas_stop((P_CORE_CTX), &(MEAS), 0, IFX_ERROR, IFX_NULL);\
+	} while (0)
+#else
+#define CLI_CMD_MEAS_START(P_CORE_CTX, MEAS, P_KEY, P_ARG)	(void)(MEAS)
+#define CLI_CMD_MEAS_STOP(P_CORE_CTX, MEAS, CMD_IDX, RET, P_OUT)	do {} while (0)
+#define CLI_CMD_MEAS_UNKNOWN(P_CORE_CTX, MEAS, P_KEY, P_ARG)	(void)(MEAS)
+#endif
+
+#if (CLI_SUPPORT_RECORD == 1)
+/** add the command line to the record log (if recording) */
+#define CLI_CMD_RECORD(P_CORE_CTX, P_KEY, P_ARG) \
+	do {\
+		struct cli_record_s *p_record_ = clios_atomic_load(&(P_CORE_CTX)->p_record);\
+		if (p_record_ != IFX_NULL) \
+			(void)cli_record_append(p_record_, cmd_session_get(), \
+				(P_CORE_CTX)->cli_instance_num, (P_KEY), (P_ARG));\
+	} while (0)
+#else
+#define CLI_CMD_RECORD(P_CORE_CTX, P_KEY, P_ARG)	do {} while (0)
+#endif
+
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+/** set the status of a structured output execution (errors of the core) */
+#define CLI_CMD_STRUCT_STATUS(STATUS)	cli_struct_out_error_set(STATUS)
+#else
+#define CLI_CMD_STRUCT_STATUS(STATUS)	do {} while (0)
+#endif
+
 /** 'less then' definition for binary tree, (a < b)*/
 #define comp_lt(a,b) (clios_strcmp(a,b) < 0)
 /** 'equal' definition for binary tree, (a == b)*/
@@ -95,12 +209,26 @@ struct cli_cmd_data_s
 	IFX_char_t const *help;
 	IFX_uint32_t mask;
 	union cli_cmd_user_fct_u user_fct;
+	/** command index (short and long form), 0: unknown command */
+	unsigned int cmd_idx;
+	/** usage metadata, IFX_NULL: the handler answers the help request */
+	const struct cli_cmd_meta_s *p_meta;
 };
 
+/** decompression cache of the help store (optional) */
+struct cli_help_store_cache_s;
+
+#if (CLI_SUPPORT_HELP_STORE == 1)
+#	define CLI_CORE_HELP_STORE(P_CORE_CTX)	((P_CORE_CTX)->p_help_store)
+#else
+#	define CLI_CORE_HELP_STORE(P_CORE_CTX)	IFX_NULL
+#endif
+
 struct cli_tree_print_buffer_s
 {
 	unsigned int buf_size;
 	char *p_out;
+	struct cli_help_store_cache_s *p_help_store;
 };
 
 /** CLI cmd core - binary tree node element */
@@ -118,6 +246,19 @@ struct cli_cmd_node_s
 	struct cli_cmd_data_s cmd_data;
 };
 
+#if (CLI_SUPPORT_HELP_CACHE == 1)
+/** Pre-rendered help listing */
+struct cli_help_cache_s
+{
+	/** selection mask of the listing, 0: free entry */
+	unsigned int mask;
+	/** listing (zero terminated) */
+	char *p_text;
+	/** length of the listing */
+	unsigned int len;
+};
+#endif
+
 /** CLI cmd core - control struct */
 struct cli_cmd_core_s
 {
@@ -133,10 +274,29 @@ struct cli_cmd_core_s
 	struct cli_cmd_node_s *p_node_array;
 	/** root of the binary CLI command tree */
 	struct cli_cmd_node_s *p_root;
-    /** Name of the command that is being executed */
-    const char *curr_cmd;
+	/** number of registered commands (command index) */
+	unsigned int n_cmds;
+#if (CLI_SUPPORT_THREAD_LOCAL == 0)
+	/** name of the command that is being executed (no per call context) */
+	const char *curr_cmd;
+#endif
 };
 
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+/** Prefix trie node of the group search keys */
+struct cli_group_trie_node_s
+{
+	/** first child, 0: none */
+	unsigned int child;
+	/** next sibling, 0: none */
+	unsigned int sibling;
+	/** group of the search key ending at this node + 1, 0: none */
+	unsigned short group;
+	/** character of the node */
+	char c;
+};
+#endif
+
 /** basic structure to manage groups */
 struct cli_group_s
 {
@@ -158,6 +318,25 @@ struct cli_group_s
 	char const *p_misc_group;
 	/** group descriptor for builtin commands */
 	char const *p_builtin_group;
+
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+	/** prefix trie of the search keys, node 0 is the root */
+	struct cli_group_trie_node_s *p_trie;
+	/** number of trie nodes */
+	unsigned int n_trie_nodes;
+
+	/** words of the tag bitset of a command */
+	unsigned int tag_words;
+	/** number of tag bitsets (max command index + 1) */
+	unsigned int n_cmd_tags;
+	/** tag bitsets of the commands, by command index */
+	unsigned int *p_cmd_tags;
+	/** start of the command list of each tag within pp_tag_nodes,
+	    number of tags + 1 entries (built on activation) */
+	unsigned int *p_tag_start;
+	/** command lists of the tags (short name nodes, sorted) */
+	struct cli_cmd_node_s **pp_tag_nodes;
+#endif
 };
 
 /** CLI context to control a CLI */
@@ -188,6 +367,207 @@ struct cli_core_context_s
 	unsigned int n_cli_core_clones;
 	/** points to the parent CLI core (if this is a clone) */
 	struct cli_core_context_s *p_cli_core_parent;
+
+	/** references to the command table (clones, sessions), the release is
+	    deferred until the last reference is dropped */
+	unsigned int n_refs;
+	/** release requested (see cli_core_release) */
+	IFX_boolean_t b_release;
+	/** output mode of a deferred release */
+	enum cli_cmd_core_out_mode_e release_out_mode;
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	/** output buffer size of a continued execution, 0: default
+	    (see cli_core_exec_cursor_size_set) */
+	unsigned int exec_cursor_size;
+#endif
+
+#if (CLI_SUPPORT_JOURNAL == 1)
+	/** persistent event / dump journal (optional) */
+	struct cli_journal_s *p_journal;
+	/** number of running journal accesses (see journal_get), the close
+	    waits until the last access is done */
+	int journal_users;
+	/** number of threads waiting in cli_core_journal_close() */
+	int journal_closers;
+	/** signaled by the last journal access for a waiting close */
+	IFXOS_event_t event_journal_idle;
+#endif
+
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+	/** event coalescing / rate limiting (optional) */
+	struct cli_event_limit_s *p_event_limit;
+#endif
+
+#if (CLI_SUPPORT_STATS == 1)
+	/** per command statistics */
+	struct cli_stats_s *p_stats;
+#endif
+
+#if (CLI_SUPPORT_TRACE == 1)
+	/** flight recorder (last command executions) */
+	struct cli_trace_s *p_trace;
+	/** flight recorder enabled */
+	IFX_boolean_t b_trace;
+	/** flight recorder file, written on release */
+	char *p_trace_file;
+#endif
+
+#if (CLI_SUPPORT_METRICS == 1) || (CLI_SUPPORT_RECORD == 1)
+	/** directory for the files of the built-in commands, IFX_NULL: none
+	    (see cli_core_file_dir_set) */
+	char *p_file_dir;
+#endif
+
+#if (CLI_SUPPORT_METRICS == 1)
+	/** protects the metrics render buffer and the metrics sources */
+	IFXOS_lock_t lock_metrics;
+	/** metrics render buffer (allocated on the first scrape) */
+	char *p_metrics_buf;
+	/** size of the metrics render buffer */
+	unsigned int metrics_buf_size;
+	/** additional metrics sources */
+	struct
+	{
+		/** render callback, IFX_NULL: free entry */
+		cli_metrics_source_fct_t source_fct;
+		/** user data for the callback */
+		void *p_data;
+	} metrics_src[CLI_METRICS_MAX_SOURCES];
+#endif
+
+#if (CLI_SUPPORT_RECORD == 1)
+	/** command recording (optional) */
+	struct cli_record_s *p_record;
+#endif
+
+#if (CLI_SUPPORT_HELP_CACHE == 1)
+	/** pre-rendered help listings, valid while the command set is active */
+	struct cli_help_cache_s help_cache[CLI_HELP_CACHE_ENTRIES];
+#endif
+
+#if (CLI_SUPPORT_HELP_STORE == 1)
+	/** compressed usage texts (optional, shared with the clones) */
+	struct cli_help_store_cache_s *p_help_store;
+#endif
+
+#if (CLI_SUPPORT_APROPOS == 1)
+	/** apropos / did-you-mean index, built on activation (shared with the clones) */
+	struct cli_apropos_s *p_apropos;
+#endif
+
+#if (CLI_SUPPORT_NAMESPACE == 1)
+	/** hierarchical command namespace, path commands (shared with the clones) */
+	struct cli_ns_s *p_ns;
+#endif
+
+#if (CLI_SUPPORT_HOOKS == 1)
+	/** command execution hooks, IFX_NULL: none installed */
+	struct cli_hook_chain_s *p_hooks;
+	/** replaced hook chains, released with the CLI core */
+	struct cli_hook_chain_s *p_hooks_retired;
+#endif
+
+#if (CLI_SUPPORT_SESSION == 1)
+	/** open sessions (protected by lock_ctx) */
+	struct cli_session_s *p_session_head;
+	/** number of open sessions */
+	unsigned int n_sessions;
+#endif
+
+#if (CLI_SUPPORT_ASYNC == 1)
+	/** executor pool of the asynchronous executions, IFX_NULL: none */
+	struct cli_pool_s *p_async_pool;
+#endif
+};
+
+#if (CLI_SUPPORT_SESSION == 1)
+/** Session on the command table of a CLI core */
+struct cli_session_s
+{
+	/** CLI core (referenced) */
+	struct cli_core_context_s *p_core_ctx;
+	/** user data - used for the user command calls */
+	void *p_user_fct_data;
+	/** instance number */
+	unsigned int inst_num;
+	/** event callback, IFX_NULL: not subscribed */
+	cli_session_event_fct_t event_fct;
+	/** user data of the event callback */
+	void *p_event_data;
+	/** references - the owner and the running event deliveries, the session
+	    is unlinked and freed with the last one (protected by lock_ctx) */
+	unsigned int n_refs;
+	/** number of running event callbacks (protected by lock_ctx) */
+	unsigned int n_event_calls;
+	/** number of threads waiting for the running event callbacks
+	    (protected by lock_ctx) */
+	unsigned int n_event_waiters;
+	/** signaled by the last running event callback for the waiters */
+	IFXOS_event_t event_calls_done;
+	/** closed, skipped by the event delivery */
+	IFX_boolean_t b_closed;
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+	/** output format of the command executions (see cli_session_format_set) */
+	enum cli_struct_format_e format;
+#endif
+	/** session list of the CLI core */
+	struct cli_session_s *p_prev;
+	/** session list of the CLI core */
+	struct cli_session_s *p_next;
+};
+#endif
+
+#if (CLI_SUPPORT_ASYNC == 1)
+/** Asynchronous command execution (see cli_core_cmd_exec_async) */
+struct cli_async_req_s
+{
+	/** execution context of a deferred handler, first member
+	    (see cli_cmd_complete) */
+	struct cli_exec_ctx_s exec_ctx;
+	/** pool job */
+	struct cli_pool_job_s job;
+	/** CLI core (referenced) */
+	struct cli_core_context_s *p_core_ctx;
+	/** output sink of the caller */
+	struct cli_out_sink_s *p_sink;
+	/** completion callback */
+	cli_cmd_done_fct_t done_fct;
+	/** user data of the completion callback */
+	void *p_user;
+	/** session of the submitting thread (pipe number), -1: none */
+	int session;
+	/** references: worker, deferred handler */
+	int n_refs;
+	/** the handler completes later (see cli_cmd_defer) */
+	IFX_boolean_t b_deferred;
+	/** status of the execution */
+	int status;
+	/** command key of a deferred handler (allocated with the request, the
+	    buffer mode execution has the key in a temporary buffer) */
+	char *p_key;
+	/** size of the command line */
+	unsigned int line_size;
+	/** output of a deferred handler, appended on the completion (the
+	    worker may still write to the sink of the caller) */
+	struct cli_out_sink_s defer_sink;
+	/** command line (allocated with the request), followed by the key */
+	char line[1];
+};
+#endif
+
+/** Command execution measurement (statistics, flight recorder) */
+struct cli_cmd_meas_s
+{
+	/** start time [us], 0: not measured */
+	unsigned long long start_us;
+#if (CLI_SUPPORT_TRACE == 1)
+	/** flight recorder entry, key and arguments are taken before the
+	   execution (the buffer mode output overwrites the command line) */
+	struct cli_trace_entry_s trace;
+	/** trace this execution */
+	IFX_boolean_t b_trace;
+#endif
 };
 
 /** CLI dummy interface, used for wait on quit */
@@ -200,6 +580,232 @@ struct cli_dummy_interface_s
 const char g_cli_version_what[] = CLI_WHAT_STR;
 CLI_PRN_MODULE_CREATE(LIB_CLI, CLI_PRN_LOW);
 
+#if (CLI_SUPPORT_THREAD_LOCAL == 1)
+/** execution context of the command handler running in this thread */
+static clios_thread_local struct cli_exec_ctx_s *g_p_cli_exec_ctx = IFX_NULL;
+#endif
+
+#if (CLI_SUPPORT_SESSION == 1)
+/** session of the command line executed in this thread */
+static clios_thread_local struct cli_session_s *g_p_cli_session = IFX_NULL;
+/** session of the event callback running in this thread */
+static clios_thread_local struct cli_session_s *g_p_cli_session_event = IFX_NULL;
+#endif
+
+#if (CLI_SUPPORT_ASYNC == 1)
+/** asynchronous execution of this thread (pool worker) */
+static clios_thread_local struct cli_async_req_s *g_p_cli_async_req = IFX_NULL;
+#endif
+
+/** Session of the calling thread (pipe number), -1: none */
+CLI_STATIC int cmd_session_get(void)
+{
+#	if (CLI_SUPPORT_TRACE == 1)
+	return cli_trace_session_get();
+#	else
+	return -1;
+#	endif
+}
+
+/** Enter the execution context of a handler call (calling thread) */
+CLI_STATIC void exec_ctx_enter(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_exec_ctx_s *p_exec_ctx,
+	const char *p_cmd)
+{
+	p_exec_ctx->p_core_ctx = p_core_ctx;
+	p_exec_ctx->p_cmd = p_cmd;
+	p_exec_ctx->session = cmd_session_get();
+#	if (CLI_SUPPORT_OUT_SINK == 1)
+	p_exec_ctx->p_sink = cli_out_sink_active_get();
+#	else
+	p_exec_ctx->p_sink = IFX_NULL;
+#	endif
+	p_exec_ctx->b_cancel = 0;
+	p_exec_ctx->b_overflow = 0;
+#	if (CLI_SUPPORT_THREAD_LOCAL == 1)
+	p_exec_ctx->p_outer = g_p_cli_exec_ctx;
+#	else
+	/* no thread local storage (kernel), the context is passed explicitly
+	   only, the command name is kept per CLI core */
+	p_exec_ctx->p_outer = IFX_NULL;
+	p_core_ctx->cmd_core.curr_cmd = p_cmd;
+#	endif
+#	if (CLI_SUPPORT_SESSION == 1)
+	/* a nested execution on another CLI core is not part of the session */
+	p_exec_ctx->p_session = ((g_p_cli_session != IFX_NULL) &&
+		(g_p_cli_session->p_core_ctx == p_core_ctx)) ? g_p_cli_session : IFX_NULL;
+#	else
+	p_exec_ctx->p_session = IFX_NULL;
+#	endif
+#	if (CLI_SUPPORT_THREAD_LOCAL == 1)
+	g_p_cli_exec_ctx = p_exec_ctx;
+#	endif
+}
+
+/** User data of a handler call: the CLI core for the built-in commands,
+    else the user data of the session or of the CLI core */
+CLI_STATIC void *exec_ctx_user_data_get(
+	struct cli_core_context_s *p_core_ctx,
+	const struct cli_exec_ctx_s *p_exec_ctx,
+	unsigned int mask)
+{
+	if (mask & CLI_INTERN_MASK_BUILTIN)
+		return (void *)p_core_ctx;
+#	if (CLI_SUPPORT_SESSION == 1)
+	if (p_exec_ctx->p_session != IFX_NULL)
+		return p_exec_ctx->p_session->p_user_fct_data;
+#	else
+	(void)p_exec_ctx;
+#	endif
+
+	return p_core_ctx->p_user_fct_data;
+}
+
+/** Leave the execution context, the outer context (nested execution) is
+    active again */
+CLI_STATIC void exec_ctx_leave(
+	struct cli_exec_ctx_s *p_exec_ctx)
+{
+#	if (CLI_SUPPORT_THREAD_LOCAL == 1)
+	g_p_cli_exec_ctx = p_exec_ctx->p_outer;
+#	else
+	(void)p_exec_ctx;
+#	endif
+}
+
+#if (CLI_SUPPORT_STATS == 1) || (CLI_SUPPORT_TRACE == 1)
+/** Current time [us] (monotonic), used for the execution time */
+CLI_STATIC unsigned long long cmd_meas_time_us_get(void)
+{
+#	if defined(LINUX) && !defined(__KERNEL__)
+	struct timespec ts;
+
+	if (clios_clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		return 0;
+
+	return (unsigned long long)ts.tv_sec * 1000000ULL +
+		(unsigned long long)(ts.tv_nsec / 1000);
+#	else
+	return (unsigned long long)clios_elapsed_time_msec_get(0) * 1000ULL;
+#	endif
+}
+
+#	if (CLI_SUPPORT_TRACE == 1)
+/** Current time [ms since epoch], used for the flight recorder */
+CLI_STATIC unsigned long long cmd_meas_time_ms_get(void)
+{
+#		if defined(LINUX) && !defined(__KERNEL__)
+	struct timespec ts;
+
+	if (clios_clock_gettime(CLOCK_REALTIME, &ts) != 0)
+		return 0;
+
+	return (unsigned long long)ts.tv_sec * 1000ULL +
+		(unsigned long long)(ts.tv_nsec / 1000000);
+#		else
+	return (unsigned long long)clios_elapsed_time_msec_get(0);
+#		endif
+}
+
+/** Get the error code of a buffer mode output ("errorcode=<n> ...") */
+CLI_STATIC int cmd_meas_errorcode_get(
+	const char *p_out,
+	int ret)
+{
+	const char *p_val;
+	int sign = 1, errorcode = 0;
+
+	if (ret < 0)
+		return ret;
+	if ((p_out == IFX_NULL) || (clios_strncmp(p_out, "errorcode=", 10) != 0))
+		return 0;
+
+	p_val = p_out + 10;
+	if (*p_val == '-')
+	{
+		sign = -1;
+		p_val++;
+	}
+	while ((*p_val >= '0') && (*p_val <= '9'))
+	{
+		errorcode = errorcode * 10 + (*p_val - '0');
+		p_val++;
+	}
+
+	return sign * errorcode;
+}
+#	endif
+
+CLI_STATIC void cmd_meas_start(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_cmd_meas_s *p_meas,
+	const char *p_key,
+	const char *p_arg)
+{
+	IFX_boolean_t b_measure = IFX_FALSE;
+
+#	if (CLI_SUPPORT_STATS == 1)
+	if (p_core_ctx->p_stats != IFX_NULL)
+		b_measure = IFX_TRUE;
+#	endif
+
+#	if (CLI_SUPPORT_TRACE == 1)
+	p_meas->b_trace = ((p_core_ctx->p_trace != IFX_NULL) &&
+		(p_core_ctx->b_trace == IFX_TRUE)) ? IFX_TRUE : IFX_FALSE;
+	if (p_meas->b_trace == IFX_TRUE)
+	{
+		b_measure = IFX_TRUE;
+		(void)clios_strncpy(p_meas->trace.key,
+			(p_key != IFX_NULL) ? p_key : "", CLI_TRACE_KEY_SIZE - 1);
+		p_meas->trace.key[CLI_TRACE_KEY_SIZE - 1] = '\0';
+		(void)clios_strncpy(p_meas->trace.args,
+			(p_arg != IFX_NULL) ? p_arg : "", CLI_TRACE_ARGS_SIZE - 1);
+		p_meas->trace.args[CLI_TRACE_ARGS_SIZE - 1] = '\0';
+	}
+#	else
+	(void)p_key;
+	(void)p_arg;
+#	endif
+
+	p_meas->start_us = (b_measure == IFX_TRUE) ? cmd_meas_time_us_get() : 0;
+}
+
+CLI_STATIC void cmd_meas_stop(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_cmd_meas_s *p_meas,
+	unsigned int cmd_idx,
+	int ret,
+	const char *p_out)
+{
+	unsigned long long time_us;
+
+	time_us = (p_meas->start_us != 0) ? (cmd_meas_time_us_get() - p_meas->start_us) : 0;
+
+#	if (CLI_SUPPORT_STATS == 1)
+	if (p_core_ctx->p_stats != IFX_NULL)
+		cli_stats_record(p_core_ctx->p_stats, cmd_idx, time_us, ret);
+#	else
+	(void)cmd_idx;
+#	endif
+
+#	if (CLI_SUPPORT_TRACE == 1)
+	if (p_meas->b_trace == IFX_TRUE)
+	{
+		p_meas->trace.time_ms = cmd_meas_time_ms_get() - time_us / 1000;
+		p_meas->trace.duration_us = (unsigned int)time_us;
+		p_meas->trace.session = cli_trace_session_get();
+		p_meas->trace.inst = p_core_ctx->cli_instance_num;
+		p_meas->trace.ret = ret;
+		p_meas->trace.errorcode = cmd_meas_errorcode_get(p_out, ret);
+		cli_trace_record(p_core_ctx->p_trace, &p_meas->trace);
+	}
+#	else
+	(void)p_out;
+#	endif
+}
+#endif	/* #if (CLI_SUPPORT_STATS == 1) || (CLI_SUPPORT_TRACE == 1) */
+
 #if (CLI_SUPPORT_AUTO_COMPLETION == 1)
 CLI_STATIC void cli_traverse_node(struct cli_cmd_node_s *p_node,
 				  int (*handler)(const char *s, void *user_data),
@@ -209,6 +815,10 @@ CLI_STATIC void cli_traverse_node(struct cli_cmd_node_s *p_node,
 		cli_traverse_node(p_node->p_left, handler, user_data);
 
 	if (clios_strcmp(p_node->p_key, CLI_EMPTY_CMD) != 0)
+#		if (CLI_SUPPORT_NAMESPACE == 1)
+		/* path commands are completed per level */
+		if (clios_strstr(p_node->p_key, " ") == IFX_NULL)
+#		endif
 		if (handler(p_node->p_key, user_data))
 			return;
 
@@ -266,13 +876,51 @@ unsigned long long cli_strtoull(const char *cp, char **endp, unsigned int base)
 
 #endif	/* #if defined(LINUX) && defined(__KERNEL__) */
 
-CLI_STATIC unsigned int user_group_mask_get(
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+/** Group of the longest search key which is a prefix of the name,
+   -1 if none matches */
+CLI_STATIC int group_trie_match(
+	const struct cli_group_s *p_group,
+	char const *p_long_name)
+{
+	const struct cli_group_trie_node_s *p_trie = p_group->p_trie;
+	unsigned int node = 0;
+	int best_match = -1;
+
+	if (p_trie == IFX_NULL)
+		return -1;
+
+	while (*p_long_name)
+	{
+		node = p_trie[node].child;
+		while ((node != 0) && (p_trie[node].c != *p_long_name))
+			node = p_trie[node].sibling;
+		if (node == 0)
+			break;
+		if (p_trie[node].group != 0)
+			best_match = (int)p_trie[node].group - 1;
+		p_long_name++;
+	}
+
+	return best_match;
+}
+#endif	/* #if (CLI_SUPPORT_GROUP_INDEX == 1) */
+
+/** Selection mask of a new command, returns the group of the matching
+   search key in p_group (-1: none) */
+CLI_STATIC unsigned int user_group_sel_get(
 	struct cli_core_context_s *p_core_ctx,
 	unsigned int user_mask,
-	char const *p_long_name)
+	char const *p_long_name,
+	int *p_group)
 {
-	int i, best_match = -1;
+	int best_match = -1;
+#if (CLI_SUPPORT_GROUP_INDEX == 0)
+	int i;
 	struct cli_group_key_entry_s *p_entry;
+#endif
+
+	*p_group = -1;
 
 	if ((user_mask & CLI_USER_MASK_ALL) & ~p_core_ctx->group.reg_group_mask)
 	{
@@ -283,6 +931,15 @@ CLI_STATIC unsigned int user_group_mask_get(
 	if (user_mask & CLI_USER_MASK_ALL)
 		return (user_mask & CLI_USER_MASK_ALL);
 
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+	best_match = group_trie_match(&p_core_ctx->group, p_long_name);
+	if (best_match == -1)
+		return CLI_USER_MASK_MISC;
+
+	*p_group = best_match;
+	/* the groups beyond the selection mask are only kept as tag */
+	return (best_match < CLI_MAX_USER_GROUPS) ? (unsigned int)(0x1 << best_match) : 0;
+#else
 	for (i = 0; i < p_core_ctx->group.n_key_entries; i++)
 	{
 		p_entry = &p_core_ctx->group.p_key_entries[i];
@@ -308,50 +965,314 @@ CLI_STATIC unsigned int user_group_mask_get(
 	if (best_match == -1)
 		return CLI_USER_MASK_MISC;
 
+	*p_group = (int)p_core_ctx->group.p_key_entries[best_match].group_num;
 	return (unsigned int)(0x1 << p_core_ctx->group.p_key_entries[best_match].group_num);
+#endif
 }
 
-/**
-   allocate node for data and insert in tree
-*/
-CLI_STATIC enum cli_cmd_status_e cmd_core_key_insert(
-	struct cli_cmd_core_s *p_cmd_core,
-	char const *p_key,
-	struct cli_cmd_data_s *p_cmd_data)
+/** Mask of a new command: selection mask and registration flags */
+CLI_STATIC unsigned int user_group_mask_get(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int user_mask,
+	char const *p_long_name,
+	int *p_group)
 {
-	struct cli_cmd_node_s *x, *curr, *parent;
+	return user_group_sel_get(p_core_ctx, user_mask, p_long_name, p_group) |
+		(user_mask & CLI_CMD_MASK_FLAGS);
+}
 
-	if (p_key == IFX_NULL)
-		return e_cli_status_key_invalid;
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+/** Build the prefix trie of the search keys */
+CLI_STATIC int group_trie_build(
+	struct cli_group_s *p_group)
+{
+	struct cli_group_trie_node_s *p_trie;
+	unsigned int n_nodes = 1, node, next;
+	const char *p_key;
+	int i;
 
-	/* find future parent */
-	curr = p_cmd_core->p_root;
-	parent = IFX_NULL;
-	while (curr)
-	{
-		if ((!comp_eq(p_key, CLI_EMPTY_CMD)) && comp_eq(p_key, curr->p_key))
-			return e_cli_status_duplicate_key;
-		parent = curr;
-		curr = comp_lt(p_key, curr->p_key) ? curr->p_left : curr->p_right;
-	}
+	for (i = 0; i < p_group->n_key_entries; i++)
+		n_nodes += (unsigned int)clios_strlen(p_group->p_key_entries[i].p_search_key);
 
-	/* setup new node */
-	if ((p_cmd_core->p_node_array != IFX_NULL) &&
-	    (p_cmd_core->n_used_nodes < p_cmd_core->n_nodes) &&
-	    (p_cmd_core->e_state == e_cli_cmd_core_allocate))
-	{
-		x = (p_cmd_core->p_node_array + p_cmd_core->n_used_nodes);
-		p_cmd_core->n_used_nodes++;
-	}
-	else
+	p_trie = (struct cli_group_trie_node_s *)clios_memalloc(
+		n_nodes * sizeof(struct cli_group_trie_node_s));
+	if (p_trie == IFX_NULL)
+		return IFX_ERROR;
+	clios_memset(p_trie, 0x00, n_nodes * sizeof(struct cli_group_trie_node_s));
+	p_group->p_trie = p_trie;
+	p_group->n_trie_nodes = 1;
+
+	for (i = 0; i < p_group->n_key_entries; i++)
 	{
-		return e_cli_status_mem_exhausted;
+		p_key = p_group->p_key_entries[i].p_search_key;
+		if (*p_key == '\0')
+			continue;
+
+		node = 0;
+		while (*p_key)
+		{
+			next = p_trie[node].child;
+			while ((next != 0) && (p_trie[next].c != *p_key))
+				next = p_trie[next].sibling;
+			if (next == 0)
+			{
+				next = p_group->n_trie_nodes++;
+				p_trie[next].c = *p_key;
+				p_trie[next].sibling = p_trie[node].child;
+				p_trie[node].child = next;
+			}
+			node = next;
+			p_key++;
+		}
+		/* same search key twice - the first entry is used */
+		if (p_trie[node].group == 0)
+			p_trie[node].group = (unsigned short)(p_group->p_key_entries[i].group_num + 1);
 	}
-	x->p_parent = parent;
-	x->p_left = IFX_NULL;
-	x->p_right = IFX_NULL;
-	x->p_key = p_key;
-	clios_memcpy((void *)&x->cmd_data, (void *)p_cmd_data, sizeof(struct cli_cmd_data_s));
+
+	return IFX_SUCCESS;
+}
+
+/** Set a tag of a command */
+CLI_STATIC void group_tag_set(
+	struct cli_group_s *p_group,
+	unsigned int cmd_idx,
+	unsigned int tag)
+{
+	if ((p_group->p_cmd_tags == IFX_NULL) || (cmd_idx >= p_group->n_cmd_tags) ||
+	    (tag >= CLI_GROUP_TAG_NUM(p_group)))
+		return;
+
+	p_group->p_cmd_tags[cmd_idx * p_group->tag_words + tag / 32] |= (0x1U << (tag % 32));
+}
+
+/** Add the tags of the selection mask bits (not registered groups, misc,
+   built-in) to the tags of a command */
+CLI_STATIC void group_tag_mask_merge(
+	struct cli_group_s *p_group,
+	const struct cli_cmd_data_s *p_cmd_data)
+{
+	unsigned int bit;
+
+	for (bit = 0; bit < CLI_GROUP_TAG_LEGACY_NUM; bit++)
+	{
+		if ((p_cmd_data->mask & (0x1U << bit)) == 0)
+			continue;
+		if (p_group->reg_group_mask & (0x1U << bit))
+			group_tag_set(p_group, p_cmd_data->cmd_idx, bit);
+		else
+			group_tag_set(p_group, p_cmd_data->cmd_idx, CLI_GROUP_TAG_LEGACY(p_group, bit));
+	}
+
+	if (p_cmd_data->mask & CLI_INTERN_MASK_BUILTIN)
+		group_tag_set(p_group, p_cmd_data->cmd_idx, CLI_GROUP_TAG_BUILTIN(p_group));
+}
+
+/** Count (pp_tag_nodes == IFX_NULL) or add the short name nodes to the
+   command lists of their tags, in order of the tree */
+CLI_STATIC void group_index_walk(
+	struct cli_group_s *p_group,
+	struct cli_cmd_node_s *p_node)
+{
+	const unsigned int *p_tags;
+	unsigned int w, bits, tag;
+
+	if (p_node == IFX_NULL)
+		return;
+
+	group_index_walk(p_group, p_node->p_left);
+
+	if (((p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) == 0) &&
+	    (p_node->cmd_data.cmd_idx < p_group->n_cmd_tags))
+	{
+		if (p_group->pp_tag_nodes == IFX_NULL)
+			group_tag_mask_merge(p_group, &p_node->cmd_data);
+
+		p_tags = &p_group->p_cmd_tags[p_node->cmd_data.cmd_idx * p_group->tag_words];
+		for (w = 0; w < p_group->tag_words; w++)
+		{
+			bits = p_tags[w];
+			for (tag = w * 32; bits != 0; tag++, bits >>= 1)
+			{
+				if ((bits & 0x1) == 0)
+					continue;
+				if (p_group->pp_tag_nodes == IFX_NULL)
+					p_group->p_tag_start[tag + 1]++;
+				else
+					p_group->pp_tag_nodes[p_group->p_tag_start[tag]++] = p_node;
+			}
+		}
+	}
+
+	group_index_walk(p_group, p_node->p_right);
+}
+
+/** Release the command lists and the tags of the commands */
+CLI_STATIC void group_index_release(
+	struct cli_group_s *p_group)
+{
+	if (p_group->pp_tag_nodes != IFX_NULL)
+		clios_memfree(p_group->pp_tag_nodes);
+	if (p_group->p_tag_start != IFX_NULL)
+		clios_memfree(p_group->p_tag_start);
+	if (p_group->p_cmd_tags != IFX_NULL)
+		clios_memfree(p_group->p_cmd_tags);
+
+	p_group->pp_tag_nodes = IFX_NULL;
+	p_group->p_tag_start = IFX_NULL;
+	p_group->p_cmd_tags = IFX_NULL;
+	p_group->n_cmd_tags = 0;
+	p_group->tag_words = 0;
+}
+
+/** Allocate the tags of the commands (before the registration) */
+CLI_STATIC int group_tags_alloc(
+	struct cli_group_s *p_group,
+	unsigned int n_cmds)
+{
+	group_index_release(p_group);
+
+	p_group->tag_words = (CLI_GROUP_TAG_NUM(p_group) + 31) / 32;
+	p_group->p_cmd_tags = (unsigned int *)clios_memalloc(
+		(n_cmds + 1) * p_group->tag_words * sizeof(unsigned int));
+	if (p_group->p_cmd_tags == IFX_NULL)
+	{
+		p_group->tag_words = 0;
+		return IFX_ERROR;
+	}
+	clios_memset(p_group->p_cmd_tags, 0x00,
+		(n_cmds + 1) * p_group->tag_words * sizeof(unsigned int));
+	p_group->n_cmd_tags = n_cmds + 1;
+
+	return IFX_SUCCESS;
+}
+
+/** Build the command lists of the tags (on activation) */
+CLI_STATIC int group_index_build(
+	struct cli_group_s *p_group,
+	struct cli_cmd_node_s *p_root)
+{
+	unsigned int n_tags = CLI_GROUP_TAG_NUM(p_group), tag;
+
+	if ((p_group->p_cmd_tags == IFX_NULL) || (p_group->pp_tag_nodes != IFX_NULL))
+		return IFX_ERROR;
+
+	p_group->p_tag_start = (unsigned int *)clios_memalloc((n_tags + 1) * sizeof(unsigned int));
+	if (p_group->p_tag_start == IFX_NULL)
+		return IFX_ERROR;
+	clios_memset(p_group->p_tag_start, 0x00, (n_tags + 1) * sizeof(unsigned int));
+
+	/* count the commands of each tag */
+	group_index_walk(p_group, p_root);
+	for (tag = 0; tag < n_tags; tag++)
+		p_group->p_tag_start[tag + 1] += p_group->p_tag_start[tag];
+
+	p_group->pp_tag_nodes = (struct cli_cmd_node_s **)clios_memalloc(
+		(p_group->p_tag_start[n_tags] + 1) * sizeof(struct cli_cmd_node_s *));
+	if (p_group->pp_tag_nodes == IFX_NULL)
+	{
+		clios_memfree(p_group->p_tag_start);
+		p_group->p_tag_start = IFX_NULL;
+		return IFX_ERROR;
+	}
+
+	/* fill, the start of each list is moved to its end */
+	group_index_walk(p_group, p_root);
+	for (tag = n_tags; tag > 0; tag--)
+		p_group->p_tag_start[tag] = p_group->p_tag_start[tag - 1];
+	p_group->p_tag_start[0] = 0;
+
+	return IFX_SUCCESS;
+}
+#endif	/* #if (CLI_SUPPORT_GROUP_INDEX == 1) */
+
+/** Tag of a group given by number or name, IFX_ERROR if not found */
+CLI_STATIC int group_tag_find(
+	const struct cli_group_s *p_group,
+	const char *p_name)
+{
+	char *p_end = IFX_NULL;
+	long num;
+	int i;
+
+	if ((p_name[0] >= '0') && (p_name[0] <= '9'))
+	{
+		num = CLI_STRTOL(p_name, &p_end, 10);
+		if ((p_end != IFX_NULL) && (*p_end == '\0') &&
+		    (num >= 0) && (num < p_group->n_reg_groups))
+			return (int)num;
+	}
+
+	for (i = 0; i < p_group->n_reg_groups; i++)
+	{
+		if (clios_strcmp(p_group->pp_group_list[i], p_name) == 0)
+			return i;
+	}
+	if ((p_group->p_misc_group != IFX_NULL) &&
+	    (clios_strcmp(p_group->p_misc_group, p_name) == 0))
+		return (int)CLI_GROUP_TAG_MISC(p_group);
+	if ((p_group->p_builtin_group != IFX_NULL) &&
+	    (clios_strcmp(p_group->p_builtin_group, p_name) == 0))
+		return (int)CLI_GROUP_TAG_BUILTIN(p_group);
+
+	return IFX_ERROR;
+}
+
+/** Selection mask bit of a tag (tree walk without index), 0: none */
+CLI_STATIC unsigned int group_tag_mask(
+	const struct cli_group_s *p_group,
+	unsigned int tag)
+{
+	if (tag < (unsigned int)p_group->n_reg_groups)
+		return (tag < CLI_MAX_USER_GROUPS) ? (0x1U << tag) : 0;
+	if (tag < CLI_GROUP_TAG_BUILTIN(p_group))
+		return 0x1U << (tag - CLI_GROUP_TAG_LEGACY(p_group, 0));
+	if (tag == CLI_GROUP_TAG_BUILTIN(p_group))
+		return CLI_INTERN_MASK_BUILTIN;
+
+	return 0;
+}
+
+/**
+   allocate node for data and insert in tree
+*/
+CLI_STATIC enum cli_cmd_status_e cmd_core_key_insert(
+	struct cli_cmd_core_s *p_cmd_core,
+	char const *p_key,
+	struct cli_cmd_data_s *p_cmd_data)
+{
+	struct cli_cmd_node_s *x, *curr, *parent;
+
+	if (p_key == IFX_NULL)
+		return e_cli_status_key_invalid;
+
+	/* find future parent */
+	curr = p_cmd_core->p_root;
+	parent = IFX_NULL;
+	while (curr)
+	{
+		if ((!comp_eq(p_key, CLI_EMPTY_CMD)) && comp_eq(p_key, curr->p_key))
+			return e_cli_status_duplicate_key;
+		parent = curr;
+		curr = comp_lt(p_key, curr->p_key) ? curr->p_left : curr->p_right;
+	}
+
+	/* setup new node */
+	if ((p_cmd_core->p_node_array != IFX_NULL) &&
+	    (p_cmd_core->n_used_nodes < p_cmd_core->n_nodes) &&
+	    (p_cmd_core->e_state == e_cli_cmd_core_allocate))
+	{
+		x = (p_cmd_core->p_node_array + p_cmd_core->n_used_nodes);
+		p_cmd_core->n_used_nodes++;
+	}
+	else
+	{
+		return e_cli_status_mem_exhausted;
+	}
+	x->p_parent = parent;
+	x->p_left = IFX_NULL;
+	x->p_right = IFX_NULL;
+	x->p_key = p_key;
+	clios_memcpy((void *)&x->cmd_data, (void *)p_cmd_data, sizeof(struct cli_cmd_data_s));
 
 
 	/* insert x in tree */
@@ -392,11 +1313,32 @@ CLI_STATIC enum cli_cmd_status_e cmd_core_key_find(
 	return e_cli_status_key_not_found;
 }
 
-CLI_STATIC int cmd_core_key_add(
+#if (CLI_SUPPORT_NAMESPACE == 1)
+/**
+   find the node of a key (stable within the node array)
+*/
+CLI_STATIC struct cli_cmd_node_s *cmd_core_node_find(
+	struct cli_cmd_core_s *p_cmd_core,
+	char const *p_key)
+{
+	struct cli_cmd_node_s *curr = p_cmd_core->p_root;
+
+	while (curr != IFX_NULL)
+	{
+		if (comp_eq(p_key, curr->p_key))
+			return curr;
+		curr = comp_lt(p_key, curr->p_key) ? curr->p_left : curr->p_right;
+	}
+	return IFX_NULL;
+}
+#endif	/* #if (CLI_SUPPORT_NAMESPACE == 1) */
+
+CLI_STATIC int cmd_core_key_meta_add(
 	struct cli_cmd_core_s *p_cmd_core,
 	unsigned int group_mask,
 	char const *p_short_name,
 	char const *p_long_name,
+	const struct cli_cmd_meta_s *p_meta,
 	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf,
 	cli_cmd_user_fct_file_t cli_cmd_user_fct_file)
 {
@@ -412,6 +1354,8 @@ CLI_STATIC int cmd_core_key_add(
 		return IFX_ERROR;
 
 	cmd_data.mask = group_mask;
+	cmd_data.cmd_idx = ++p_cmd_core->n_cmds;
+	cmd_data.p_meta = p_meta;
 
 	if (p_short_name == IFX_NULL)
 	{
@@ -506,6 +1450,19 @@ CLI_STATIC int cmd_core_key_add(
 	return IFX_SUCCESS;
 }
 
+CLI_STATIC int cmd_core_key_add(
+	struct cli_cmd_core_s *p_cmd_core,
+	unsigned int group_mask,
+	char const *p_short_name,
+	char const *p_long_name,
+	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf,
+	cli_cmd_user_fct_file_t cli_cmd_user_fct_file)
+{
+	return cmd_core_key_meta_add(p_cmd_core, group_mask,
+		p_short_name, p_long_name, IFX_NULL,
+		cli_cmd_user_fct_buf, cli_cmd_user_fct_file);
+}
+
 /* Detect spaces. */
 CLI_STATIC int cli_isspace(char c)
 {
@@ -610,30 +1567,26 @@ CLI_STATIC int cmd_check_help(
 	const char *p_cmd)
 {
 	int i = 0;
-	char *p_pos = IFX_NULL;
+	unsigned int len;
 
 	if (p_cmd == IFX_NULL)
 		{return IFX_SUCCESS;}
 
+	/* all help tokens start with '-' or '/' */
+	if ((p_cmd[0] != '-') && (p_cmd[0] != '/'))
+		{return IFX_SUCCESS;}
+
 	while (p_help_str[i] != IFX_NULL)
 	{
-		if ((p_pos = clios_strstr(p_cmd, p_help_str[i])) != IFX_NULL)
+		/* Check: token must be a standalone string
+		   - token at the beginning (ignore if not as first argument)
+		   - token at the end or separated by a space
+		 */
+		len = (unsigned int)clios_strlen(p_help_str[i]);
+		if ((clios_strncmp(p_cmd, p_help_str[i], len) == 0) &&
+		    (cli_isspace(p_cmd[len]) || (p_cmd[len] == '\0')))
 		{
-			/* Check: token must be a standalone string
-			   - token at the beginning or separated by a space
-			   - token at the end or separated by a space
-			 */
-			if (p_pos > p_cmd)
-			{
-				/* ignore if not as first argument */
-				i++;
-				continue;
-			}
-
-			if (cli_isspace(p_pos[clios_strlen(p_help_str[i])]) || (p_pos[clios_strlen(p_help_str[i])] == '\0'))
-			{
-				return 1;
-			}
+			return 1;
 		}
 		i++;
 	}
@@ -652,13 +1605,30 @@ CLI_STATIC int cli_fprintf_spec(
 	struct cli_spec_file_io_s *p_file_spec = (struct cli_spec_file_io_s *)p_file_out;
 
 	va_start(ap, format);
+#	if (CLI_SUPPORT_OUT_SINK == 1)
+	if (p_file_spec->p_sink != NULL)
+	{
+		ret = cli_out_sink_vprintf(p_file_spec->p_sink, format, ap);
+	}
+	else
+#	endif
 	if (p_file_spec->p_file != NULL)
 	{
 		ret = clios_vfprintf(p_file_spec->p_file, format, ap);
 	}
-	else if (p_file_spec->p_buffer != NULL)
+	else if ((p_file_spec->p_buffer != NULL) &&
+		(p_file_spec->buffer_len < p_file_spec->buffer_size))
 	{
-		ret = clios_vsnprintf(p_file_spec->p_buffer, p_file_spec->buffer_size, format, ap);
+		/* append behind the previous output */
+		ret = clios_vsnprintf(p_file_spec->p_buffer + p_file_spec->buffer_len,
+			p_file_spec->buffer_size - p_file_spec->buffer_len, format, ap);
+		if (ret > 0)
+		{
+			if ((unsigned int)ret < p_file_spec->buffer_size - p_file_spec->buffer_len)
+				p_file_spec->buffer_len += (unsigned int)ret;
+			else
+				p_file_spec->buffer_len = p_file_spec->buffer_size - 1;
+		}
 	}
 	va_end(ap);
 
@@ -672,8 +1642,17 @@ CLI_STATIC int cli_fprintf_spec(
 {
 	va_list  ap;
 	int  ret = 0;
+#	if (CLI_SUPPORT_OUT_SINK == 1) && (CLI_SUPPORT_FILE_OUT == 1)
+	struct cli_out_sink_s *p_sink = cli_out_sink_get(p_file_out);
+#	endif
 
 	va_start(ap, format);
+#	if (CLI_SUPPORT_OUT_SINK == 1) && (CLI_SUPPORT_FILE_OUT == 1)
+	/* executed via cli_core_cmd_exec__sink, append directly */
+	if (p_sink != IFX_NULL)
+		ret = cli_out_sink_vprintf(p_sink, format, ap);
+	else
+#	endif
 	ret = clios_vfprintf(p_file_out, format, ap);
 
 	va_end(ap);
@@ -699,6 +1678,148 @@ CLI_STATIC int check_help__file(
 }
 #endif
 
+/** size of the local copy of a typed command name (buffer mode) */
+#define CLI_META_NAME_SIZE	64
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+/*
+   print the usage of a command registered with metadata
+*/
+CLI_STATIC int cmd_meta_usage__buffer(
+	const struct cli_cmd_data_s *p_cmd_data,
+	const char *p_key,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret;
+	char name[CLI_META_NAME_SIZE];
+	const struct cli_cmd_meta_s *p_meta = p_cmd_data->p_meta;
+
+	/* the typed key may point into the output buffer */
+	(void)clios_snprintf(name, sizeof(name), "%s", p_key);
+
+	ret = clios_snprintf(p_out, bufsize_max,
+		"Long Form: %s" CLI_CRLF "Short Form: %s" CLI_CRLF "%s%s%s" CLI_CRLF "%s",
+		(p_cmd_data->mask & CLI_INTERN_MASK_LONG) ? name : p_cmd_data->help,
+		(p_cmd_data->mask & CLI_INTERN_MASK_LONG) ? p_cmd_data->help : name,
+		(p_meta->p_args != IFX_NULL) ? "Arguments: " : "",
+		(p_meta->p_args != IFX_NULL) ? p_meta->p_args : "",
+		(p_meta->p_args != IFX_NULL) ? CLI_CRLF : "",
+		p_meta->p_usage);
+	if (ret < 0)
+		return 0;
+	if ((unsigned int)ret >= bufsize_max)
+		ret = (bufsize_max > 0) ? (int)bufsize_max - 1 : 0;
+
+	return ret;
+}
+#endif
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+/*
+   print the usage of a command registered with metadata
+*/
+CLI_STATIC int cmd_meta_usage__file(
+	const struct cli_cmd_data_s *p_cmd_data,
+	const char *p_key,
+	clios_file_t *p_file)
+{
+	const struct cli_cmd_meta_s *p_meta = p_cmd_data->p_meta;
+
+	return cli_fprintf_spec(p_file,
+		"Long Form: %s" CLI_CRLF "Short Form: %s" CLI_CRLF "%s%s%s" CLI_CRLF "%s",
+		(p_cmd_data->mask & CLI_INTERN_MASK_LONG) ? p_key : p_cmd_data->help,
+		(p_cmd_data->mask & CLI_INTERN_MASK_LONG) ? p_cmd_data->help : p_key,
+		(p_meta->p_args != IFX_NULL) ? "Arguments: " : "",
+		(p_meta->p_args != IFX_NULL) ? p_meta->p_args : "",
+		(p_meta->p_args != IFX_NULL) ? CLI_CRLF : "",
+		p_meta->p_usage);
+}
+#endif
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+/*
+   print the usage of a command from the metadata or the help store
+
+\return
+   number of printed bytes
+   IFX_ERROR - no usage available, the handler answers the help request
+*/
+CLI_STATIC int cmd_usage__buffer(
+	struct cli_help_store_cache_s *p_help_store,
+	const struct cli_cmd_data_s *p_cmd_data,
+	const char *p_key,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	struct cli_help_store_ref_s ref;
+	unsigned int len;
+#	endif
+
+	if (p_cmd_data->p_meta != IFX_NULL)
+		return cmd_meta_usage__buffer(p_cmd_data, p_key, bufsize_max, p_out);
+
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	if ((p_help_store != IFX_NULL) && (bufsize_max > 0) &&
+	    (cli_help_store_text_get(p_help_store,
+		(p_cmd_data->mask & CLI_INTERN_MASK_LONG) ? p_key : p_cmd_data->help,
+		&ref) == IFX_SUCCESS))
+	{
+		len = (ref.len < bufsize_max) ? ref.len : bufsize_max - 1;
+		clios_memcpy(p_out, ref.p_text, len);
+		p_out[len] = '\0';
+		cli_help_store_text_put(p_help_store, &ref);
+		return (int)len;
+	}
+#	else
+	(void)p_help_store;
+#	endif
+
+	return IFX_ERROR;
+}
+#endif
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+/*
+   print the usage of a command from the metadata or the help store
+
+\return
+   number of printed bytes
+   IFX_ERROR - no usage available, the handler answers the help request
+*/
+CLI_STATIC int cmd_usage__file(
+	struct cli_help_store_cache_s *p_help_store,
+	const struct cli_cmd_data_s *p_cmd_data,
+	const char *p_key,
+	clios_file_t *p_file)
+{
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	struct cli_help_store_ref_s ref;
+	int ret;
+#	endif
+
+	if (p_cmd_data->p_meta != IFX_NULL)
+		return cmd_meta_usage__file(p_cmd_data, p_key, p_file);
+
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	if ((p_help_store != IFX_NULL) &&
+	    (cli_help_store_text_get(p_help_store,
+		(p_cmd_data->mask & CLI_INTERN_MASK_LONG) ? p_key : p_cmd_data->help,
+		&ref) == IFX_SUCCESS))
+	{
+		ret = cli_fprintf_spec(p_file, "%.*s", (int)ref.len, ref.p_text);
+		cli_help_store_text_put(p_help_store, &ref);
+		return (ret < 0) ? 0 : ret;
+	}
+#	else
+	(void)p_help_store;
+#	endif
+
+	return IFX_ERROR;
+}
+#endif
+
 CLI_STATIC int core_out_mode_check(
 	enum cli_cmd_core_out_mode_e out_mode)
 {
@@ -755,6 +1876,12 @@ CLI_STATIC int core_init(
 
 	p_core_ctx->ctx_size = sizeof(struct cli_core_context_s);
 	p_core_ctx->cli_instance_num = inst_num;
+#	if (CLI_SUPPORT_METRICS == 1)
+	(void)clios_lockinit(&p_core_ctx->lock_metrics, "cli_metrics", inst_num);
+#	endif
+#	if (CLI_SUPPORT_JOURNAL == 1)
+	(void)clios_event_init(&p_core_ctx->event_journal_idle);
+#	endif
 	p_core_ctx->p_user_fct_data = p_user_fct_data;
 
 	p_core_ctx->n_cli_core_clones = 0;
@@ -767,52 +1894,527 @@ CLI_STATIC int core_init(
 	p_core_ctx->group.p_misc_group = CLI_GROUP_MISC_DESCRIPTION;
 	p_core_ctx->group.p_builtin_group = CLI_GROUP_BUILTIN_DESCRIPTION;
 
+#	if (CLI_SUPPORT_TRACE == 1)
+	/* non fatal - the commands are executed without flight recorder */
+	if (CLI_TRACE_DEFAULT_ENTRIES > 0)
+	{
+		if (cli_trace_init(&p_core_ctx->p_trace, CLI_TRACE_DEFAULT_ENTRIES) == IFX_SUCCESS)
+			p_core_ctx->b_trace = IFX_TRUE;
+	}
+#	endif
+
 	*pp_core_ctx = p_core_ctx;
 	return IFX_SUCCESS;
 }
 
 
-CLI_STATIC int cmd_parse_execute(
+#if (CLI_SUPPORT_APROPOS == 1)
+/** Add the commands of the tree to the apropos index (sorted by the long name) */
+CLI_STATIC int apropos_index_walk(
 	struct cli_core_context_s *p_core_ctx,
-	char *p_cmd_arg_buf,
-	const unsigned int buffer_size,
-	clios_file_t *p_file)
+	struct cli_apropos_s *p_apropos,
+	struct cli_cmd_node_s *p_node)
 {
-	struct cli_cmd_data_s cmd_data = {IFX_NULL, 0, {IFX_NULL}};
-	char *p_cmd = IFX_NULL;
-	char *p_arg = IFX_NULL;
-
-	if (p_cmd_arg_buf == IFX_NULL)
-		return IFX_ERROR;
+	const char *p_usage = IFX_NULL;
+	unsigned int usage_len = 0;
+	int ret;
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	struct cli_help_store_ref_s ref;
+	IFX_boolean_t b_ref = IFX_FALSE;
+#	endif
 
-	p_cmd_arg_buf = remove_whitespaces(p_cmd_arg_buf);
-	p_cmd_arg_buf = remove_prefix(p_cmd_arg_buf, "CLI_", 3);
+	if (p_node == IFX_NULL)
+		return IFX_SUCCESS;
 
-	p_core_ctx->cmd_core.curr_cmd = p_cmd_arg_buf;
-	p_cmd = p_cmd_arg_buf;
-	p_arg = p_cmd_arg_buf;
+	if (apropos_index_walk(p_core_ctx, p_apropos, p_node->p_left) != IFX_SUCCESS)
+		return IFX_ERROR;
 
-	/* strip the command word */
-	while (*p_arg) {
-		if (cli_isspace(*p_arg)) {
-			*p_arg = 0;
-			p_arg++;
-			break;
+	if (p_node->cmd_data.mask & CLI_INTERN_MASK_LONG)
+	{
+		if ((p_node->cmd_data.p_meta != IFX_NULL) &&
+		    (p_node->cmd_data.p_meta->p_usage != IFX_NULL))
+		{
+			p_usage = p_node->cmd_data.p_meta->p_usage;
+			usage_len = (unsigned int)clios_strlen(p_usage);
 		}
-		p_arg++;
+#		if (CLI_SUPPORT_HELP_STORE == 1)
+		else if ((p_core_ctx->p_help_store != IFX_NULL) &&
+		         (cli_help_store_text_get(p_core_ctx->p_help_store,
+		            p_node->p_key, &ref) == IFX_SUCCESS))
+		{
+			p_usage = ref.p_text;
+			usage_len = ref.len;
+			b_ref = IFX_TRUE;
+		}
+#		endif
+
+		ret = cli_apropos_cmd_add(p_apropos,
+			(clios_strcmp(p_node->cmd_data.help, CLI_EMPTY_CMD) == 0) ?
+				IFX_NULL : p_node->cmd_data.help,
+			p_node->p_key, p_usage, usage_len, p_node);
+#		if (CLI_SUPPORT_HELP_STORE == 1)
+		if (b_ref == IFX_TRUE)
+			cli_help_store_text_put(p_core_ctx->p_help_store, &ref);
+#		endif
+		if (ret != IFX_SUCCESS)
+			return IFX_ERROR;
 	}
 
-	switch (cmd_core_key_find(&p_core_ctx->cmd_core, p_cmd, &cmd_data))
-	{
-	case e_cli_status_ok:
+	return apropos_index_walk(p_core_ctx, p_apropos, p_node->p_right);
+}
+
+/** Build the apropos index of the registered commands */
+CLI_STATIC int apropos_index_build(
+	struct cli_core_context_s *p_core_ctx)
+{
+	struct cli_apropos_s *p_apropos = IFX_NULL;
+
+	if (p_core_ctx->p_apropos != IFX_NULL)
+		(void)cli_apropos_release(&p_core_ctx->p_apropos);
+
+	if (cli_apropos_init(&p_apropos, p_core_ctx->cmd_core.n_cmds + 1) != IFX_SUCCESS)
+		return IFX_ERROR;
+
+	if ((apropos_index_walk(p_core_ctx, p_apropos, p_core_ctx->cmd_core.p_root) != IFX_SUCCESS) ||
+	    (cli_apropos_build(p_apropos) != IFX_SUCCESS))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: apropos index - build failed" CLI_CRLF));
+		(void)cli_apropos_release(&p_apropos);
+		return IFX_ERROR;
+	}
+
+	p_core_ctx->p_apropos = p_apropos;
+	return IFX_SUCCESS;
+}
+#endif	/* #if (CLI_SUPPORT_APROPOS == 1) */
+
+/** Unknown command error, with the nearest command names if available */
+CLI_STATIC int cmd_unknown_print(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	char *p_out,
+	const unsigned int size)
+{
+#if (CLI_SUPPORT_APROPOS == 1)
+	const char *p_names[CLI_APROPOS_SUGGEST_MAX];
+	unsigned int i, n;
+	int len, ret;
+
+	n = cli_apropos_suggest(p_core_ctx->p_apropos, p_cmd, p_names, CLI_APROPOS_SUGGEST_MAX);
+	if (n > 0)
+	{
+		len = clios_snprintf(p_out, size, "errorcode=-1 (unknown command, did you mean:");
+		for (i = 0; (i < n) && (len > 0) && ((unsigned int)len < size); i++)
+		{
+			ret = clios_snprintf(p_out + len, size - (unsigned int)len, " %s", p_names[i]);
+			len = (ret < 0) ? ret : len + ret;
+		}
+		if ((len > 0) && ((unsigned int)len < size))
+		{
+			ret = clios_snprintf(p_out + len, size - (unsigned int)len, ")" CLI_CRLF);
+			if ((ret > 0) && ((unsigned int)(len + ret) < size))
+				return len + ret;
+		}
+	}
+#else
+	(void)p_core_ctx;
+	(void)p_cmd;
+#endif
+
+	return clios_snprintf(p_out, size, "errorcode=-1 (unknown command)" CLI_CRLF);
+}
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+/** Unknown command error, printout to file */
+CLI_STATIC int cmd_unknown_print__file(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	clios_file_t *p_file)
+{
+	char line[CLI_CORE_PRINT_LINE_SIZE];
+
+	if (cmd_unknown_print(p_core_ctx, p_cmd, line, sizeof(line)) < 0)
+		return IFX_ERROR;
+
+	return cli_fprintf_spec(p_file, "%s", line);
+}
+#endif
+
+#if (CLI_SUPPORT_NAMESPACE == 1)
+/** Add a path command - the path is the long name of the command, the
+    namespace node refers to the long name node */
+CLI_STATIC int cmd_ns_key_add(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int group_mask,
+	char const *p_short_name,
+	char const *p_path,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf,
+	cli_cmd_user_fct_file_t cli_cmd_user_fct_file)
+{
+	struct cli_cmd_core_s *p_cmd_core = &p_core_ctx->cmd_core;
+	struct cli_ns_node_s *p_ns_node = IFX_NULL;
+	struct cli_cmd_node_s *p_node;
+
+	if (p_path == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: p_path pointer is invalid" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	/* count state: the path is not required */
+	if (p_cmd_core->e_state != e_cli_cmd_core_allocate)
+		return cmd_core_key_meta_add(p_cmd_core, group_mask,
+			p_short_name, p_path, p_meta,
+			cli_cmd_user_fct_buf, cli_cmd_user_fct_file);
+
+	if ((p_core_ctx->p_ns == IFX_NULL) && (cli_ns_init(&p_core_ctx->p_ns) != IFX_SUCCESS))
+		return IFX_ERROR;
+
+	if (cli_ns_path_add(p_core_ctx->p_ns, p_path, &p_ns_node) != IFX_SUCCESS)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: invalid path \"%s\"" CLI_CRLF, p_path));
+		return IFX_ERROR;
+	}
+	if (p_ns_node->p_cmd_data != IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: duplicate path %s" CLI_CRLF, p_ns_node->p_path));
+		return IFX_ERROR;
+	}
+
+	if (cmd_core_key_meta_add(p_cmd_core, group_mask,
+		p_short_name, p_ns_node->p_path, p_meta,
+		cli_cmd_user_fct_buf, cli_cmd_user_fct_file) != IFX_SUCCESS)
+		return IFX_ERROR;
+
+	p_node = cmd_core_node_find(p_cmd_core, p_ns_node->p_path);
+	if (p_node == IFX_NULL)
+		return IFX_ERROR;
+	p_ns_node->p_cmd_data = &p_node->cmd_data;
+
+	return IFX_SUCCESS;
+}
+
+/** Namespace dispatch - walk the tokens of a command line which is not a
+    flat command. Returns the command (key = path, arguments = remaining
+    tokens) or the level without command (pp_level). */
+CLI_STATIC enum cli_cmd_status_e cmd_ns_find(
+	struct cli_core_context_s *p_core_ctx,
+	char **pp_cmd,
+	char **pp_arg,
+	struct cli_cmd_data_s *p_cmd_data,
+	struct cli_ns_node_s **pp_level)
+{
+	struct cli_ns_node_s *p_ns_node;
+	const char *p_rest = IFX_NULL;
+
+	*pp_level = IFX_NULL;
+	if (p_core_ctx->p_ns == IFX_NULL)
+		return e_cli_status_key_not_found;
+
+	p_ns_node = cli_ns_resolve(p_core_ctx->p_ns, *pp_cmd, *pp_arg, &p_rest);
+	if (p_ns_node == IFX_NULL)
+		return e_cli_status_key_not_found;
+
+	*pp_cmd = p_ns_node->p_path;
+	*pp_arg = (char *)p_rest;
+	if (p_ns_node->p_cmd_data == IFX_NULL)
+	{
+		*pp_level = p_ns_node;
+		return e_cli_status_key_not_found;
+	}
+
+	clios_memcpy((void *)p_cmd_data, p_ns_node->p_cmd_data, sizeof(struct cli_cmd_data_s));
+	return e_cli_status_ok;
+}
+
+/** Level without command - error (help request: none) and the
+    sub-commands of the level, to file (if set) or to the buffer */
+CLI_STATIC int cmd_ns_level_print(
+	const struct cli_ns_node_s *p_level,
+	const char *p_arg,
+	char *p_out,
+	const unsigned int size,
+	clios_file_t *p_file)
+{
+	char line[CLI_CORE_PRINT_LINE_SIZE];
+	const char *p_err;
+	unsigned int i;
+	int len = 0, ret;
+
+	/* buffer mode: the printout overwrites the arguments */
+	if (cmd_check_help(p_arg))
+		p_err = "errorcode=0";
+	else if ((p_arg != IFX_NULL) && (*p_arg != '\0'))
+		p_err = "errorcode=-1 (unknown sub-command)";
+	else
+		p_err = "errorcode=-1 (incomplete command)";
+
+	for (i = 0; i <= p_level->n_child; i++)
+	{
+		if (i == 0)
+			ret = clios_snprintf(line, sizeof(line), "%s" CLI_CRLF, p_err);
+		else
+			ret = clios_snprintf(line, sizeof(line), "   %s%s" CLI_CRLF,
+				p_level->pp_child[i - 1]->p_token,
+				(p_level->pp_child[i - 1]->n_child > 0) ? " ..." : "");
+		if (ret < 0)
+			break;
+		if ((unsigned int)ret >= sizeof(line))
+			ret = (int)sizeof(line) - 1;
+
+#		if (CLI_SUPPORT_FILE_OUT == 1)
+		if (p_file != IFX_NULL)
+		{
+			(void)cli_fprintf_spec(p_file, "%s", line);
+			len += ret;
+			continue;
+		}
+#		else
+		(void)p_file;
+#		endif
+		if ((p_out == IFX_NULL) || ((unsigned int)(len + ret) >= size))
+			break;
+		clios_memcpy(p_out + len, line, (unsigned int)ret + 1);
+		len += ret;
+	}
+
+	return len;
+}
+#endif	/* #if (CLI_SUPPORT_NAMESPACE == 1) */
+
+#if (CLI_SUPPORT_HOOKS == 1)
+/** Handler call with the pre and post hooks, printout to file (if set) or
+    to the buffer */
+CLI_STATIC int cmd_hooked_exec(
+	struct cli_core_context_s *p_core_ctx,
+	const struct cli_hook_chain_s *p_hooks,
+	const struct cli_cmd_data_s *p_cmd_data,
+	const char *p_cmd,
+	const char *p_arg,
+	const unsigned int buffer_size,
+	char *p_out,
+	clios_file_t *p_file,
+	int *p_overflow)
+{
+	struct cli_cmd_hook_info_s info;
+	struct cli_cmd_meas_s meas;
+	struct cli_exec_ctx_s exec_ctx;
+	void *p_ctx;
+	int ret = IFX_ERROR;
+
+	info.p_key = p_cmd;
+	info.p_arg = p_arg;
+	info.cmd_idx = p_cmd_data->cmd_idx;
+	info.inst = p_core_ctx->cli_instance_num;
+	info.result = IFX_ERROR;
+	info.p_out = IFX_NULL;
+	info.p_exec_ctx = &exec_ctx;
+
+	exec_ctx_enter(p_core_ctx, &exec_ctx, p_cmd);
+	info.session = exec_ctx.session;
+#	if (CLI_SUPPORT_SESSION == 1)
+	if (exec_ctx.p_session != IFX_NULL)
+		info.inst = exec_ctx.p_session->inst_num;
+#	endif
+	p_ctx = exec_ctx_user_data_get(p_core_ctx, &exec_ctx, p_cmd_data->mask);
+	if (cli_hook_chain_pre(p_hooks, &info) != IFX_SUCCESS)
+	{
+		CLI_CMD_STRUCT_STATUS(IFX_ERROR);
+#		if (CLI_SUPPORT_FILE_OUT == 1)
+		if (p_file != IFX_NULL)
+			ret = cli_fprintf_spec(p_file, "errorcode=-1 (command rejected)" CLI_CRLF);
+#		endif
+#		if (CLI_SUPPORT_BUFFER_OUT == 1)
+		if (p_out != IFX_NULL)
+			ret = clios_snprintf(p_out, buffer_size, "errorcode=-1 (command rejected)" CLI_CRLF);
+#		endif
+	}
+	else
+	{
+		CLI_CMD_MEAS_START(p_core_ctx, meas, p_cmd, p_arg);
+#		if (CLI_SUPPORT_FILE_OUT == 1)
+		if (p_file != IFX_NULL)
+			ret = p_cmd_data->user_fct.file_out(p_ctx, p_arg, p_file);
+#		endif
+#		if (CLI_SUPPORT_BUFFER_OUT == 1)
+		if (p_out != IFX_NULL)
+			ret = p_cmd_data->user_fct.buf_out(p_ctx, p_arg, buffer_size, p_out);
+#		endif
+		CLI_CMD_MEAS_STOP(p_core_ctx, meas, p_cmd_data->cmd_idx, ret, p_out);
+		info.result = ret;
+	}
+
+	info.p_out = p_out;
+	cli_hook_chain_post(p_hooks, &info);
+	exec_ctx_leave(&exec_ctx);
+	if (p_overflow != IFX_NULL)
+		*p_overflow = exec_ctx.b_overflow;
+
+	return ret;
+}
+#endif	/* #if (CLI_SUPPORT_HOOKS == 1) */
+
+#if (CLI_SUPPORT_SESSION == 1) && (CLI_SUPPORT_STRUCT_OUT == 1) && \
+    !(defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1))
+/** Output format of the session executing on the given CLI core in the
+    calling thread, text if none */
+CLI_STATIC enum cli_struct_format_e session_format_get(
+	struct cli_core_context_s *p_core_ctx)
+{
+	if ((g_p_cli_session == IFX_NULL) || (g_p_cli_session->p_core_ctx != p_core_ctx))
+		return cli_struct_format_text;
+
+	return clios_atomic_load_relaxed(&g_p_cli_session->format);
+}
+
+/** Execute a command line with the structured output format of the session,
+    the records are written to the file or to the buffer */
+CLI_STATIC int session_struct_exec(
+	struct cli_core_context_s *p_core_ctx,
+	enum cli_struct_format_e format,
+	char *p_cmd_arg_buf,
+	const unsigned int buffer_size,
+	clios_file_t *p_file,
+	int *p_overflow)
+{
+	struct cli_out_sink_s sink;
+	char *p_out = IFX_NULL;
+	unsigned int len = 0;
+	int ret, status;
+
+	if (p_file != IFX_NULL)
+		ret = cli_out_sink_init__file(&sink, (clios_file_io_t *)p_file);
+	else
+		ret = cli_out_sink_init(&sink);
+	if (ret != IFX_SUCCESS)
+		return IFX_ERROR;
+
+	/* the nested execution sees the active structured output */
+	ret = cli_core_cmd_exec__struct(p_core_ctx, p_cmd_arg_buf, format, &sink, &status);
+	if (p_file != IFX_NULL)
+	{
+		if (cli_out_sink_flush(&sink) < 0)
+			ret = IFX_ERROR;
+	}
+	else if ((buffer_size != 0) && (cli_out_sink_detach(&sink, &p_out, &len) == IFX_SUCCESS))
+	{
+		/* the records end behind the last one which fits */
+		if (len >= buffer_size)
+		{
+			len = buffer_size - 1;
+			while ((len > 0) && (p_out[len - 1] != '\n'))
+				len--;
+			if (p_overflow != IFX_NULL)
+				*p_overflow = 1;
+		}
+		clios_memcpy(p_cmd_arg_buf, p_out, len);
+		p_cmd_arg_buf[len] = '\0';
+		cli_out_sink_buf_free(p_out);
+	}
+	cli_out_sink_release(&sink);
+
+	return ret;
+}
+#endif	/* #if (CLI_SUPPORT_SESSION == 1) && (CLI_SUPPORT_STRUCT_OUT == 1) && ... */
+
+CLI_STATIC int cmd_parse_execute(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	const unsigned int buffer_size,
+	clios_file_t *p_file,
+	int *p_overflow)
+{
+	struct cli_cmd_data_s cmd_data = {IFX_NULL, 0, {IFX_NULL}, 0, IFX_NULL};
+	char *p_cmd = IFX_NULL;
+	char *p_arg = IFX_NULL;
+	struct cli_cmd_meas_s meas;
+	struct cli_exec_ctx_s exec_ctx;
+	enum cli_cmd_status_e status;
+#if (CLI_SUPPORT_NAMESPACE == 1)
+	struct cli_ns_node_s *p_level = IFX_NULL;
+#endif
+#if (CLI_SUPPORT_HOOKS == 1)
+	const struct cli_hook_chain_s *p_hooks;
+#endif
+	int ret;
+#if (CLI_SUPPORT_SESSION == 1) && (CLI_SUPPORT_STRUCT_OUT == 1) && \
+    !(defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1))
+	enum cli_struct_format_e format;
+#endif
+
+	if (p_cmd_arg_buf == IFX_NULL)
+		return IFX_ERROR;
+
+#if (CLI_SUPPORT_SESSION == 1) && (CLI_SUPPORT_STRUCT_OUT == 1) && \
+    !(defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1))
+	/* session with structured output, not yet within the structured
+	   execution */
+	format = session_format_get(p_core_ctx);
+	if ((format != cli_struct_format_text) && (cli_struct_out_get() == IFX_NULL))
+		return session_struct_exec(p_core_ctx, format,
+			p_cmd_arg_buf, buffer_size, p_file, p_overflow);
+#endif
+
+	p_cmd_arg_buf = remove_whitespaces(p_cmd_arg_buf);
+	p_cmd_arg_buf = remove_prefix(p_cmd_arg_buf, "CLI_", 3);
+
+	p_cmd = p_cmd_arg_buf;
+	p_arg = p_cmd_arg_buf;
+
+	/* strip the command word */
+	while (*p_arg) {
+		if (cli_isspace(*p_arg)) {
+			*p_arg = 0;
+			p_arg++;
+			break;
+		}
+		p_arg++;
+	}
+
+	CLI_CMD_RECORD(p_core_ctx, p_cmd, p_arg);
+
+	status = cmd_core_key_find(&p_core_ctx->cmd_core, p_cmd, &cmd_data);
+#if (CLI_SUPPORT_NAMESPACE == 1)
+	if (status != e_cli_status_ok)
+		status = cmd_ns_find(p_core_ctx, &p_cmd, &p_arg, &cmd_data, &p_level);
+#endif
+
+	switch (status)
+	{
+	case e_cli_status_ok:
 		switch(p_core_ctx->cmd_core.out_mode)
 		{
 		case cli_cmd_core_out_mode_buffer:
 #			if (CLI_SUPPORT_BUFFER_OUT == 1)
 			if (cmd_data.user_fct.buf_out != IFX_NULL)
-				return cmd_data.user_fct.buf_out(
-					(cmd_data.mask & CLI_INTERN_MASK_BUILTIN) ? p_core_ctx : p_core_ctx->p_user_fct_data,
+			{
+				/* help request answered by the core, no handler round-trip */
+				if (((cmd_data.p_meta != IFX_NULL) || (CLI_CORE_HELP_STORE(p_core_ctx) != IFX_NULL)) &&
+				    cmd_check_help(p_arg))
+				{
+					ret = cmd_usage__buffer(CLI_CORE_HELP_STORE(p_core_ctx),
+						&cmd_data, p_cmd, buffer_size, p_cmd_arg_buf);
+					if (ret >= 0)
+						return ret;
+				}
+#				if (CLI_SUPPORT_HOOKS == 1)
+				p_hooks = clios_atomic_load(&p_core_ctx->p_hooks);
+				if (p_hooks != IFX_NULL)
+					return cmd_hooked_exec(p_core_ctx, p_hooks, &cmd_data,
+						p_cmd, p_arg, buffer_size, p_cmd_arg_buf, IFX_NULL, p_overflow);
+#				endif
+				CLI_CMD_MEAS_START(p_core_ctx, meas, p_cmd, p_arg);
+				exec_ctx_enter(p_core_ctx, &exec_ctx, p_cmd);
+				ret = cmd_data.user_fct.buf_out(
+					exec_ctx_user_data_get(p_core_ctx, &exec_ctx, cmd_data.mask),
 					p_arg, buffer_size, p_cmd_arg_buf);
+				exec_ctx_leave(&exec_ctx);
+				if (p_overflow != IFX_NULL)
+					*p_overflow = exec_ctx.b_overflow;
+				CLI_CMD_MEAS_STOP(p_core_ctx, meas, cmd_data.cmd_idx, ret, p_cmd_arg_buf);
+				return ret;
+			}
 			else
 				return clios_sprintf(p_cmd_arg_buf,
 					"errorcode=-1 (internal error, no function pointer)" CLI_CRLF);
@@ -824,9 +2426,32 @@ CLI_STATIC int cmd_parse_execute(
 		case cli_cmd_core_out_mode_file:
 #			if (CLI_SUPPORT_FILE_OUT == 1)
 			if (cmd_data.user_fct.file_out != IFX_NULL)
-				return cmd_data.user_fct.file_out(
-					(cmd_data.mask & CLI_INTERN_MASK_BUILTIN) ? p_core_ctx : p_core_ctx->p_user_fct_data,
+			{
+				/* help request answered by the core, no handler round-trip */
+				if (((cmd_data.p_meta != IFX_NULL) || (CLI_CORE_HELP_STORE(p_core_ctx) != IFX_NULL)) &&
+				    cmd_check_help(p_arg))
+				{
+					ret = cmd_usage__file(CLI_CORE_HELP_STORE(p_core_ctx), &cmd_data, p_cmd, p_file);
+					if (ret >= 0)
+						return ret;
+				}
+#				if (CLI_SUPPORT_HOOKS == 1)
+				p_hooks = clios_atomic_load(&p_core_ctx->p_hooks);
+				if (p_hooks != IFX_NULL)
+					return cmd_hooked_exec(p_core_ctx, p_hooks, &cmd_data,
+						p_cmd, p_arg, 0, IFX_NULL, p_file, p_overflow);
+#				endif
+				CLI_CMD_MEAS_START(p_core_ctx, meas, p_cmd, p_arg);
+				exec_ctx_enter(p_core_ctx, &exec_ctx, p_cmd);
+				ret = cmd_data.user_fct.file_out(
+					exec_ctx_user_data_get(p_core_ctx, &exec_ctx, cmd_data.mask),
 					p_arg, p_file);
+				exec_ctx_leave(&exec_ctx);
+				if (p_overflow != IFX_NULL)
+					*p_overflow = exec_ctx.b_overflow;
+				CLI_CMD_MEAS_STOP(p_core_ctx, meas, cmd_data.cmd_idx, ret, IFX_NULL);
+				return ret;
+			}
 			else
 				return cli_fprintf_spec(p_file,
 					"errorcode=-1 (internal error, no function pointer)" CLI_CRLF);
@@ -841,11 +2466,22 @@ CLI_STATIC int cmd_parse_execute(
 			return IFX_ERROR;
 		}
 	default:
+#		if (CLI_SUPPORT_NAMESPACE == 1)
+		if ((p_level == IFX_NULL) || !cmd_check_help(p_arg))
+#		endif
+		{
+			CLI_CMD_MEAS_UNKNOWN(p_core_ctx, meas, p_cmd, p_arg);
+			CLI_CMD_STRUCT_STATUS(IFX_ERROR);
+		}
+#		if (CLI_SUPPORT_NAMESPACE == 1)
+		if (p_level != IFX_NULL)
+			return cmd_ns_level_print(p_level, p_arg, p_cmd_arg_buf, buffer_size, p_file);
+#		endif
 		switch(p_core_ctx->cmd_core.out_mode)
 		{
 		case cli_cmd_core_out_mode_buffer:
 #			if (CLI_SUPPORT_BUFFER_OUT == 1)
-			return clios_sprintf(p_cmd_arg_buf, "errorcode=-1 (unknown command)" CLI_CRLF);
+			return cmd_unknown_print(p_core_ctx, p_cmd, p_cmd_arg_buf, buffer_size);
 #			else
 			CLI_USR_ERR(LIB_CLI,
 				("ERR CLI Core: parse & exec - unknown command, buffer printout not supported" CLI_CRLF));
@@ -853,7 +2489,7 @@ CLI_STATIC int cmd_parse_execute(
 #			endif
 		case cli_cmd_core_out_mode_file:
 #			if (CLI_SUPPORT_FILE_OUT == 1)
-			return clios_sprintf(p_cmd_arg_buf, "errorcode=-1 (unknown command)" CLI_CRLF);
+			return cmd_unknown_print__file(p_core_ctx, p_cmd, p_file);
 #			else
 			CLI_USR_ERR(LIB_CLI,
 				("ERR CLI Core: parse & exec - unknown command, file printout not supported" CLI_CRLF));
@@ -872,137 +2508,397 @@ CLI_STATIC int cmd_parse_execute(
 
 #if (CLI_SUPPORT_BUFFER_OUT == 1)
 /*
-   print binary tree
+   print a node of the binary tree (short or long name node)
 */
-CLI_STATIC int cmd_core_tree_print__buffer(
+CLI_STATIC void cmd_core_node_print__buffer(
 	struct cli_cmd_node_s *p_node,
 	unsigned int mask,
 	struct cli_tree_print_buffer_s *p_buffer)
 {
-	int j = 0, ret;
+	int ret;
 	int nFillChar = 0;
 	int nHelpClm = 10;
+	const char *p_short, *p_long;
 
-	if (p_node == IFX_NULL)
-		return IFX_SUCCESS;
-
-	cmd_core_tree_print__buffer(p_node->p_left, mask, p_buffer);
-
-	if ((p_buffer->buf_size + 64) >= p_buffer->buf_size)
-		return IFX_SUCCESS;
-
-	if ((p_node->cmd_data.mask & mask)
-	    && ((p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) == (mask & CLI_INTERN_MASK_LONG))) {
-		if ((mask & CLI_INTERN_MASK_DETAILED) == CLI_INTERN_MASK_DETAILED) {
-			if (p_node->cmd_data.user_fct.buf_out) {
-				ret = p_node->cmd_data.user_fct.buf_out(
-					IFX_NULL, "-h", p_buffer->buf_size, p_buffer->p_out);
-				if (ret < 0)
-					ret = 0;
-				p_buffer->buf_size -= ret;
-				p_buffer->p_out += ret;
-			}
-		} else {
-			ret = clios_sprintf(p_buffer->p_out, "%s", p_node->cmd_data.help);
-			if (ret < 0)
-				ret = 0;
+	if ((mask & CLI_INTERN_MASK_DETAILED) == CLI_INTERN_MASK_DETAILED) {
+		ret = cmd_usage__buffer(p_buffer->p_help_store, &p_node->cmd_data,
+			p_node->p_key, p_buffer->buf_size, p_buffer->p_out);
+		if (ret >= 0) {
 			p_buffer->buf_size -= ret;
 			p_buffer->p_out += ret;
-			nFillChar = nHelpClm - ret;
-			if (nFillChar > 0) {
-				for (j = 0; j < nFillChar; j++) {
-					ret = clios_sprintf(p_buffer->p_out, " ");
-					if (ret < 0)
-						ret = 0;
-					p_buffer->buf_size -= ret;
-					p_buffer->p_out += ret;
-				}
-			}
-			if (clios_strcmp(p_node->p_key, CLI_EMPTY_CMD) == 0) {
-				ret = clios_sprintf(p_buffer->p_out, CLI_EMPTY_CMD_HELP CLI_CRLF);
-			} else {
-				ret = clios_sprintf(p_buffer->p_out, "%s" CLI_CRLF, p_node->p_key);
-			}
+		} else if (p_node->cmd_data.user_fct.buf_out) {
+			ret = p_node->cmd_data.user_fct.buf_out(
+				IFX_NULL, "-h", p_buffer->buf_size, p_buffer->p_out);
 			if (ret < 0)
 				ret = 0;
+			if ((unsigned int)ret >= p_buffer->buf_size) {
+				ret = (int)p_buffer->buf_size - 1;
+				cli_exec_overflow_set(IFX_NULL);
+			}
 			p_buffer->buf_size -= ret;
 			p_buffer->p_out += ret;
 		}
+	} else {
+		if (p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) {
+			p_short = p_node->cmd_data.help;
+			p_long = p_node->p_key;
+		} else {
+			p_short = p_node->p_key;
+			p_long = p_node->cmd_data.help;
+		}
+		/* one printout per line, the help is padded to the key column */
+		nFillChar = nHelpClm - (int)clios_strlen(p_short);
+		if (nFillChar < 0)
+			nFillChar = 0;
+		ret = clios_snprintf(p_buffer->p_out, p_buffer->buf_size,
+			"%s%*s%s" CLI_CRLF, p_short, nFillChar, "",
+			(clios_strcmp(p_long, CLI_EMPTY_CMD) == 0) ?
+				CLI_EMPTY_CMD_HELP : p_long);
+		if (ret < 0)
+			ret = 0;
+		if ((unsigned int)ret >= p_buffer->buf_size) {
+			ret = (int)p_buffer->buf_size - 1;
+			cli_exec_overflow_set(IFX_NULL);
+		}
+		p_buffer->buf_size -= ret;
+		p_buffer->p_out += ret;
 	}
+}
+
+/*
+   print binary tree
+*/
+CLI_STATIC int cmd_core_tree_print__buffer(
+	struct cli_cmd_node_s *p_node,
+	unsigned int mask,
+	struct cli_tree_print_buffer_s *p_buffer)
+{
+	if (p_node == IFX_NULL)
+		return IFX_SUCCESS;
+
+	cmd_core_tree_print__buffer(p_node->p_left, mask, p_buffer);
+
+	/* stop if the buffer is (nearly) full */
+	if (p_buffer->buf_size < 64)
+		return IFX_SUCCESS;
+
+	if ((p_node->cmd_data.mask & mask)
+	    && ((p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) == (mask & CLI_INTERN_MASK_LONG)))
+		cmd_core_node_print__buffer(p_node, mask, p_buffer);
 
 	return cmd_core_tree_print__buffer(p_node->p_right, mask, p_buffer);
 }
+
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+/*
+   print the commands of a group (command list of the tag)
+*/
+CLI_STATIC void group_print__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int tag,
+	unsigned int mask,
+	struct cli_tree_print_buffer_s *p_buffer)
+{
+	const struct cli_group_s *p_group = &p_core_ctx->group;
+	unsigned int i;
+
+	for (i = p_group->p_tag_start[tag]; i < p_group->p_tag_start[tag + 1]; i++)
+	{
+		/* stop if the buffer is (nearly) full */
+		if (p_buffer->buf_size < 64)
+			break;
+		cmd_core_node_print__buffer(p_group->pp_tag_nodes[i], mask, p_buffer);
+	}
+}
+#endif	/* #if (CLI_SUPPORT_GROUP_INDEX == 1) */
 #endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
 
 #if (CLI_SUPPORT_FILE_OUT == 1)
 /*
-   print binary tree
+   print a node of the binary tree
 */
-CLI_STATIC void cmd_core_tree_print__file(
+CLI_STATIC void cmd_core_node_print__file(
+	struct cli_help_store_cache_s *p_help_store,
 	struct cli_cmd_node_s *p_node,
 	unsigned int mask,
 	unsigned int *p_out_size,
 	clios_file_t *p_file)
 {
 	int ret = 0;
-	int j = 0;
-	int ch = 0, fill_char = 0;
+	int fill_char = 0;
 	int help_clm = 18;
+	const char *p_key;
 
-	if (p_node == IFX_NULL)
-		return;
-
-	cmd_core_tree_print__file(p_node->p_left, mask, p_out_size, p_file);
-
-	if (p_node->cmd_data.mask & mask) {
-		if ((mask & CLI_INTERN_MASK_DETAILED) == CLI_INTERN_MASK_DETAILED) {
-			/* don't print twice */
-			if ((p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) == 0)
+	if ((mask & CLI_INTERN_MASK_DETAILED) == CLI_INTERN_MASK_DETAILED) {
+		/* don't print twice */
+		if ((p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) == 0)
+		{
+			ret = cmd_usage__file(p_help_store, &p_node->cmd_data, p_node->p_key, p_file);
+			if (ret >= 0)
 			{
-				if (p_node->cmd_data.user_fct.file_out)
-				{
-					ret = p_node->cmd_data.user_fct.file_out(IFX_NULL, "-h", p_file);
-					if (ret < 0)
-						ret = 0;
-					*p_out_size += (unsigned int)ret;
-				}
+				*p_out_size += (unsigned int)ret;
 			}
-		} else {
+			else if (p_node->cmd_data.user_fct.file_out)
+			{
+				ret = p_node->cmd_data.user_fct.file_out(IFX_NULL, "-h", p_file);
+				if (ret < 0)
+					ret = 0;
+				*p_out_size += (unsigned int)ret;
+			}
+		}
+	} else {
 #ifdef CLI_INTERN_MASK_LONG
-			if (p_node->cmd_data.mask & CLI_INTERN_MASK_LONG)
-				help_clm *= 3;
+		if (p_node->cmd_data.mask & CLI_INTERN_MASK_LONG)
+			help_clm *= 3;
 
-			if ((p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) == (mask & CLI_INTERN_MASK_LONG))
+		if ((p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) == (mask & CLI_INTERN_MASK_LONG))
 #endif
+		{
+			if (clios_strcmp(p_node->p_key, CLI_EMPTY_CMD) == 0)
+				p_key = CLI_EMPTY_CMD_HELP;
+			else
+				p_key = p_node->p_key;
+			/* one printout per line, the key is padded to the help column */
+			fill_char = help_clm - (int)(clios_strlen(p_key) + 4);
+			if (fill_char < 0)
+				fill_char = 0;
+			ret = cli_fprintf_spec(p_file,
+				"   %s,%*s%s" CLI_CRLF, p_key, fill_char, "", p_node->cmd_data.help);
+			if (ret > 0)
+				*p_out_size += (unsigned int)ret;
+		}
+	}
+}
+
+/*
+   print binary tree
+*/
+CLI_STATIC void cmd_core_tree_print__file(
+	struct cli_help_store_cache_s *p_help_store,
+	struct cli_cmd_node_s *p_node,
+	unsigned int mask,
+	unsigned int *p_out_size,
+	clios_file_t *p_file)
+{
+	if (p_node == IFX_NULL)
+		return;
+
+	cmd_core_tree_print__file(p_help_store, p_node->p_left, mask, p_out_size, p_file);
+
+	if (p_node->cmd_data.mask & mask)
+		cmd_core_node_print__file(p_help_store, p_node, mask, p_out_size, p_file);
+
+	cmd_core_tree_print__file(p_help_store, p_node->p_right, mask, p_out_size, p_file);
+}
+
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+/*
+   print the commands of a group (command list of the tag)
+*/
+CLI_STATIC void group_print__file(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int tag,
+	unsigned int mask,
+	unsigned int *p_out_size,
+	clios_file_t *p_file)
+{
+	const struct cli_group_s *p_group = &p_core_ctx->group;
+	unsigned int i;
+
+	for (i = p_group->p_tag_start[tag]; i < p_group->p_tag_start[tag + 1]; i++)
+		cmd_core_node_print__file(CLI_CORE_HELP_STORE(p_core_ctx),
+			p_group->pp_tag_nodes[i], mask, p_out_size, p_file);
+}
+#endif	/* #if (CLI_SUPPORT_GROUP_INDEX == 1) */
+#endif /* #if (CLI_SUPPORT_FILE_OUT == 1) */
+
+#if (CLI_SUPPORT_HELP_CACHE == 1)
+/** Get a cached help listing (the command set is immutable while active,
+   the listing is valid until the shutdown) */
+CLI_STATIC struct cli_help_cache_s *help_cache_get(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int mask)
+{
+	struct cli_help_cache_s *p_entry = IFX_NULL;
+	unsigned int i;
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	for (i = 0; i < CLI_HELP_CACHE_ENTRIES; i++)
+	{
+		if (p_core_ctx->help_cache[i].mask == mask)
+		{
+			p_entry = &p_core_ctx->help_cache[i];
+			break;
+		}
+	}
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	return p_entry;
+}
+
+/** Add a rendered help listing to the cache, the cache takes the listing.
+   Returns IFX_NULL if not cached (cache full), the caller keeps the listing. */
+CLI_STATIC struct cli_help_cache_s *help_cache_put(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int mask,
+	char *p_text,
+	unsigned int len)
+{
+	struct cli_help_cache_s *p_entry = IFX_NULL;
+	unsigned int i;
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->cmd_core.e_state == e_cli_cmd_core_active)
+	{
+		for (i = 0; i < CLI_HELP_CACHE_ENTRIES; i++)
+		{
+			/* rendered in parallel, keep the first one */
+			if (p_core_ctx->help_cache[i].mask == mask)
 			{
-				if (clios_strcmp(p_node->p_key, CLI_EMPTY_CMD) == 0) {
-					ch = cli_fprintf_spec(p_file, "   %s,", CLI_EMPTY_CMD_HELP);
-				} else {
-					ch = cli_fprintf_spec(p_file, "   %s,", p_node->p_key);
-				}
-				if (ch < 0)
-					ch = 0;
-				*p_out_size += (unsigned int)ch;
-				fill_char = help_clm - ch;
-				if (fill_char > 0)
-				{
-					for (j = 0; j < fill_char; j++)
-						(void)cli_fprintf_spec(p_file, " ");
-					*p_out_size += (unsigned int)fill_char;
-				}
-				ret = cli_fprintf_spec(p_file,
-					"%s" CLI_CRLF, p_node->cmd_data.help);
-				if (ret > 0)
-					*p_out_size += (unsigned int)ret;
+				clios_memfree(p_text);
+				p_entry = &p_core_ctx->help_cache[i];
+				break;
 			}
+			if ((p_entry == IFX_NULL) && (p_core_ctx->help_cache[i].mask == 0))
+				p_entry = &p_core_ctx->help_cache[i];
+		}
+		if ((p_entry != IFX_NULL) && (p_entry->mask == 0))
+		{
+			p_entry->p_text = p_text;
+			p_entry->len = len;
+			p_entry->mask = mask;
 		}
 	}
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
-	cmd_core_tree_print__file(p_node->p_right, mask, p_out_size, p_file);
+	return p_entry;
+}
+
+/** Drop the cached help listings (command set changed), called locked */
+CLI_STATIC void help_cache_invalidate(
+	struct cli_core_context_s *p_core_ctx)
+{
+	unsigned int i;
+
+	for (i = 0; i < CLI_HELP_CACHE_ENTRIES; i++)
+	{
+		if (p_core_ctx->help_cache[i].p_text != IFX_NULL)
+			clios_memfree(p_core_ctx->help_cache[i].p_text);
+		p_core_ctx->help_cache[i].p_text = IFX_NULL;
+		p_core_ctx->help_cache[i].len = 0;
+		p_core_ctx->help_cache[i].mask = 0;
+	}
+}
+#endif	/* #if (CLI_SUPPORT_HELP_CACHE == 1) */
+
+/** Parse the sub commands of the help: [detailed] [<group name | number>],
+   returns the tag of the group (-1: all groups) */
+CLI_STATIC int help_sub_cmd_parse(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	unsigned int *p_mask,
+	int *p_tag)
+{
+	*p_tag = -1;
+
+	if ((clios_strncmp(p_cmd, "detailed", 8) == 0) &&
+	    ((p_cmd[8] == '\0') || (p_cmd[8] == ' ')))
+	{
+		*p_mask |= CLI_INTERN_MASK_DETAILED;
+		p_cmd += 8;
+		while (*p_cmd == ' ')
+			p_cmd++;
+	}
+
+	if (*p_cmd == '\0')
+		return IFX_SUCCESS;
+
+	*p_tag = group_tag_find(&p_core_ctx->group, p_cmd);
+
+	return (*p_tag < 0) ? IFX_ERROR : IFX_SUCCESS;
 }
-#endif /* #if (CLI_SUPPORT_FILE_OUT == 1) */
 
 #if (CLI_SUPPORT_BUFFER_OUT == 1)
+#if (CLI_SUPPORT_HELP_CACHE == 1)
+/** Help listing (buffer mode) from the cache, rendered on the first request.
+   Returns IFX_ERROR if not available (no memory). */
+CLI_STATIC int help_cached__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int mask,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	struct cli_help_cache_s *p_entry;
+	struct cli_tree_print_buffer_s buffer;
+	struct cli_exec_ctx_s *p_exec_ctx;
+	char *p_render, *p_text;
+	unsigned int len;
+	int b_overflow = 0;
+
+	if (bufsize_max == 0)
+		return IFX_ERROR;
+
+	p_entry = help_cache_get(p_core_ctx, mask);
+	if (p_entry == IFX_NULL)
+	{
+		p_render = (char *)clios_memalloc(CLI_HELP_CACHE_BUFFER_SIZE);
+		if (p_render == IFX_NULL)
+			return IFX_ERROR;
+		buffer.buf_size = CLI_HELP_CACHE_BUFFER_SIZE;
+		buffer.p_out = p_render;
+		buffer.p_help_store = CLI_CORE_HELP_STORE(p_core_ctx);
+		p_render[0] = '\0';
+		/* a cut render is not cached, it is not a cut of the output */
+		p_exec_ctx = cli_exec_ctx_get();
+		if (p_exec_ctx != IFX_NULL)
+			b_overflow = p_exec_ctx->b_overflow;
+		cmd_core_tree_print__buffer(p_core_ctx->cmd_core.p_root, mask, &buffer);
+		if (p_exec_ctx != IFX_NULL)
+			p_exec_ctx->b_overflow = b_overflow;
+		len = CLI_HELP_CACHE_BUFFER_SIZE - buffer.buf_size;
+
+		/* listing exceeds the render buffer, not cached */
+		if (buffer.buf_size < 64)
+		{
+			clios_memfree(p_render);
+			return IFX_ERROR;
+		}
+
+		/* keep only the used size */
+		p_text = (char *)clios_memalloc(len + 1);
+		if (p_text != IFX_NULL)
+		{
+			clios_memcpy(p_text, p_render, len);
+			p_text[len] = '\0';
+		}
+		clios_memfree(p_render);
+		if (p_text == IFX_NULL)
+			return IFX_ERROR;
+
+		p_entry = help_cache_put(p_core_ctx, mask, p_text, len);
+		if (p_entry == IFX_NULL)
+		{
+			clios_memfree(p_text);
+			return IFX_ERROR;
+		}
+	}
+
+	/* the output ends behind the last line which fits */
+	len = p_entry->len;
+	if (len >= bufsize_max)
+	{
+		len = bufsize_max - 1;
+		while ((len > 0) && (p_entry->p_text[len - 1] != '\n'))
+			len--;
+		cli_exec_overflow_set(IFX_NULL);
+	}
+	clios_memcpy(p_out, p_entry->p_text, len);
+	p_out[len] = '\0';
+
+	return (int)len;
+}
+#endif	/* #if (CLI_SUPPORT_HELP_CACHE == 1) */
+
 /** Build in command - help */
 CLI_STATIC int cli_core_cmd_help__buffer(
 	void *p_ctx,
@@ -1012,7 +2908,8 @@ CLI_STATIC int cli_core_cmd_help__buffer(
 {
 	int ret = 0;
 	struct cli_core_context_s *p_core_ctx = p_ctx;
-	unsigned int mask = CLI_USER_MASK_MISC | CLI_INTERN_MASK_LONG;
+	unsigned int mask = CLI_USER_MASK_MISC | CLI_INTERN_MASK_LONG, group_mask;
+	int tag = -1;
 	struct cli_tree_print_buffer_s buffer;
 
 #ifndef CLI_DEBUG_DISABLE
@@ -1020,6 +2917,8 @@ CLI_STATIC int cli_core_cmd_help__buffer(
 		"Long Form: Help" CLI_CRLF "Short Form: help" CLI_CRLF
 		CLI_CRLF
 		"Input Parameter" CLI_CRLF
+		"- detailed (optional, usage of the commands)" CLI_CRLF
+		"- char group[] (optional, group name or number)" CLI_CRLF
 		CLI_CRLF
 		"Output Parameter" CLI_CRLF
 		"- int errorcode" CLI_CRLF CLI_CRLF;
@@ -1032,56 +2931,79 @@ CLI_STATIC int cli_core_cmd_help__buffer(
 
 	if (clios_strlen(p_cmd))
 	{
-		if (clios_strcmp(p_cmd, "detailed") == 0)
-			mask |= CLI_INTERN_MASK_DETAILED;
-		else
+		if (help_sub_cmd_parse(p_core_ctx, p_cmd, &mask, &tag) != IFX_SUCCESS)
 			return clios_sprintf(p_out,
 				"errorcode=-1 (unknown sub command)" CLI_CRLF);
 	}
 
 	buffer.buf_size = bufsize_max;
 	buffer.p_out = p_out;
+	buffer.p_help_store = CLI_CORE_HELP_STORE(p_core_ctx);
+	p_out[0] = '\0';
+
+	if (tag >= 0)
+	{
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+		if (p_core_ctx->group.pp_tag_nodes != IFX_NULL)
+		{
+			group_print__buffer(p_core_ctx, (unsigned int)tag, mask, &buffer);
+			return (int)(bufsize_max - buffer.buf_size);
+		}
+#endif
+		/* the short name nodes are selected only by the group */
+		group_mask = group_tag_mask(&p_core_ctx->group, (unsigned int)tag);
+		if (group_mask != 0)
+			cmd_core_tree_print__buffer(p_core_ctx->cmd_core.p_root,
+				(mask & CLI_INTERN_MASK_DETAILED) | group_mask, &buffer);
+		return (int)(bufsize_max - buffer.buf_size);
+	}
+
+#if (CLI_SUPPORT_HELP_CACHE == 1)
+	ret = help_cached__buffer(p_core_ctx, mask, bufsize_max, p_out);
+	if (ret >= 0)
+		return ret;
+#endif
 
 	cmd_core_tree_print__buffer(p_core_ctx->cmd_core.p_root, mask, &buffer);
 
-	return (int)buffer.buf_size;
+	return (int)(bufsize_max - buffer.buf_size);
 }
 #endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
 
 #if (CLI_SUPPORT_FILE_OUT == 1)
-CLI_STATIC int cli_core_cmd_help__file(
-	void *p_ctx,
-	const char *p_cmd,
-	clios_file_io_t *p_out_file)
+/** Help listing (file mode) of a group, from the command list of the tag
+   or by a tree walk with the selection mask bit */
+CLI_STATIC void help_group_render__file(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int tag,
+	unsigned int mask,
+	unsigned int *p_out_size,
+	clios_file_t *p_file)
 {
-	int ret = 0, i;
-	struct cli_core_context_s *p_core_ctx = p_ctx;
-	unsigned int out_size = 0, mask = CLI_INTERN_MASK_SHORT;
-	clios_file_t *p_file = (clios_file_t *)p_out_file;
-
-#ifndef CLI_DEBUG_DISABLE
-	static const char USAGE[] =
-		"Long Form: Help" CLI_CRLF "Short Form: help" CLI_CRLF
-		CLI_CRLF
-		"Input Parameter" CLI_CRLF
-		CLI_CRLF
-		"Output Parameter" CLI_CRLF
-		"- int errorcode" CLI_CRLF CLI_CRLF;
-#else
-#undef USAGE
-#define USAGE ""
-#endif
-	if ((ret = check_help__file(p_cmd, USAGE, p_file)) > 0)
-		return ret;
+	unsigned int group_mask;
 
-	if (clios_strlen(p_cmd))
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+	if (p_core_ctx->group.pp_tag_nodes != IFX_NULL)
 	{
-		if (clios_strcmp(p_cmd, "detailed") == 0)
-			mask |= CLI_INTERN_MASK_DETAILED;
-		else
-			return cli_fprintf_spec(p_file,
-				"errorcode=-1 (unknown sub command)" CLI_CRLF);
+		group_print__file(p_core_ctx, tag, mask, p_out_size, p_file);
+		return;
 	}
+#endif
+
+	group_mask = group_tag_mask(&p_core_ctx->group, tag);
+	if (group_mask != 0)
+		cmd_core_tree_print__file(CLI_CORE_HELP_STORE(p_core_ctx),
+			p_core_ctx->cmd_core.p_root, mask | group_mask, p_out_size, p_file);
+}
+
+/** Help listing (file mode), all groups */
+CLI_STATIC int help_render__file(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int mask,
+	clios_file_t *p_file)
+{
+	int i;
+	unsigned int out_size = 0;
 
 	if (p_core_ctx->group.n_reg_groups > 0)
 	{
@@ -1089,7 +3011,7 @@ CLI_STATIC int cli_core_cmd_help__file(
 		{
 			out_size += cli_fprintf_spec(p_file,
 					"== Group: <%s> ===" CLI_CRLF, p_core_ctx->group.pp_group_list[i]);
-			cmd_core_tree_print__file(p_core_ctx->cmd_core.p_root, mask | (0x1 << i), &out_size, p_file);
+			help_group_render__file(p_core_ctx, (unsigned int)i, mask, &out_size, p_file);
 		}
 	}
 
@@ -1106,23 +3028,138 @@ CLI_STATIC int cli_core_cmd_help__file(
 
 			out_size += cli_fprintf_spec(p_file,
 					"== Group: <not registered cmds> ===" CLI_CRLF);
-			cmd_core_tree_print__file(p_core_ctx->cmd_core.p_root, mask | (0x1 << i), &out_size, p_file);
+			help_group_render__file(p_core_ctx,
+				CLI_GROUP_TAG_LEGACY(&p_core_ctx->group, i), mask, &out_size, p_file);
 			reg_mask &= ~(0x1 << i);
 		}
 	}
 
 	out_size += cli_fprintf_spec(p_file,
 			"== Group: <%s> ===" CLI_CRLF, p_core_ctx->group.p_misc_group);
-	cmd_core_tree_print__file(p_core_ctx->cmd_core.p_root, mask | CLI_USER_MASK_MISC, &out_size, p_file);
+	help_group_render__file(p_core_ctx,
+		CLI_GROUP_TAG_MISC(&p_core_ctx->group), mask, &out_size, p_file);
 
 
 	out_size += cli_fprintf_spec(p_file,
 			"== Group: <%s> ===" CLI_CRLF, p_core_ctx->group.p_builtin_group);
-	cmd_core_tree_print__file(p_core_ctx->cmd_core.p_root, mask | CLI_INTERN_MASK_BUILTIN, &out_size, p_file);
-
+	help_group_render__file(p_core_ctx,
+		CLI_GROUP_TAG_BUILTIN(&p_core_ctx->group), mask, &out_size, p_file);
 
 	return (int)out_size;
 }
+
+#if (CLI_SUPPORT_HELP_CACHE == 1) && (CLI_SUPPORT_OUT_SINK == 1)
+/** Help listing (file mode) from the cache, rendered into a sink on the
+   first request and written with one printout.
+   Returns IFX_ERROR if not available (no memory). */
+CLI_STATIC int help_cached__file(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int mask,
+	clios_file_t *p_file)
+{
+	struct cli_help_cache_s *p_entry;
+	struct cli_out_sink_s sink;
+	char *p_text = IFX_NULL;
+	unsigned int len = 0;
+	int ret;
+#	if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
+	struct cli_spec_file_io_s spec_file = {IFX_NULL, IFX_NULL, 0, 0, IFX_NULL};
+#	else
+	clios_file_io_t *p_stream;
+	struct cli_out_sink_s *p_prev;
+#	endif
+
+	p_entry = help_cache_get(p_core_ctx, mask);
+	if (p_entry == IFX_NULL)
+	{
+		(void)cli_out_sink_init(&sink);
+#	if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
+		spec_file.p_sink = &sink;
+		(void)help_render__file(p_core_ctx, mask, (clios_file_t *)&spec_file);
+#	else
+		/* the detailed help of the handlers is also written into the sink */
+		p_stream = cli_out_sink_file_get(&sink);
+		if (p_stream == IFX_NULL)
+		{
+			cli_out_sink_release(&sink);
+			return IFX_ERROR;
+		}
+		p_prev = cli_out_sink_active_set(&sink);
+		(void)help_render__file(p_core_ctx, mask, (clios_file_t *)p_stream);
+		(void)cli_out_sink_active_set(p_prev);
+#	endif
+		if (cli_out_sink_detach(&sink, &p_text, &len) != IFX_SUCCESS)
+			p_text = IFX_NULL;
+		cli_out_sink_release(&sink);
+		if (p_text == IFX_NULL)
+			return IFX_ERROR;
+
+		p_entry = help_cache_put(p_core_ctx, mask, p_text, len);
+		if (p_entry == IFX_NULL)
+		{
+			/* not cached, write once */
+			ret = cli_fprintf_spec(p_file, "%s", p_text);
+			cli_out_sink_buf_free(p_text);
+			return (ret < 0) ? 0 : ret;
+		}
+	}
+
+	ret = cli_fprintf_spec(p_file, "%s", p_entry->p_text);
+
+	return (ret < 0) ? 0 : ret;
+}
+#endif	/* #if (CLI_SUPPORT_HELP_CACHE == 1) && (CLI_SUPPORT_OUT_SINK == 1) */
+
+CLI_STATIC int cli_core_cmd_help__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	struct cli_core_context_s *p_core_ctx = p_ctx;
+	unsigned int mask = CLI_INTERN_MASK_SHORT, out_size = 0;
+	int tag = -1;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+
+#ifndef CLI_DEBUG_DISABLE
+	static const char USAGE[] =
+		"Long Form: Help" CLI_CRLF "Short Form: help" CLI_CRLF
+		CLI_CRLF
+		"Input Parameter" CLI_CRLF
+		"- detailed (optional, usage of the commands)" CLI_CRLF
+		"- char group[] (optional, group name or number)" CLI_CRLF
+		CLI_CRLF
+		"Output Parameter" CLI_CRLF
+		"- int errorcode" CLI_CRLF CLI_CRLF;
+#else
+#undef USAGE
+#define USAGE ""
+#endif
+	if ((ret = check_help__file(p_cmd, USAGE, p_file)) > 0)
+		return ret;
+
+	if (clios_strlen(p_cmd))
+	{
+		if (help_sub_cmd_parse(p_core_ctx, p_cmd, &mask, &tag) != IFX_SUCCESS)
+			return cli_fprintf_spec(p_file,
+				"errorcode=-1 (unknown sub command)" CLI_CRLF);
+	}
+
+	if (tag >= 0)
+	{
+		/* one group, the help listing is not cached */
+		help_group_render__file(p_core_ctx, (unsigned int)tag, mask, &out_size, p_file);
+		return (int)out_size;
+	}
+
+#if (CLI_SUPPORT_HELP_CACHE == 1) && (CLI_SUPPORT_OUT_SINK == 1)
+	ret = help_cached__file(p_core_ctx, mask, p_file);
+	if (ret >= 0)
+		return ret;
+#endif
+
+	return help_render__file(p_core_ctx, mask, p_file);
+}
 #endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
 
 
@@ -1271,1423 +3308,5208 @@ CLI_STATIC int cli_core_cmd_quit__file(
 }
 #endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
 
-int cli_sscanf(const char *buf, char const *fmt, ...)
+#if (CLI_SUPPORT_JOURNAL == 1) || (CLI_SUPPORT_EVENT_LIMIT == 1) || (CLI_SUPPORT_STATS == 1) || \
+    (CLI_SUPPORT_TRACE == 1) || (CLI_SUPPORT_RECORD == 1) || (CLI_SUPPORT_STRUCT_OUT == 1) || \
+    (CLI_SUPPORT_APROPOS == 1)
+/** Built-in printout - collects the printout state of a built-in command
+    which writes several lines either to a file or to the output buffer */
+struct cli_core_print_s
 {
-#ifndef _lint
-	va_list marker;
-#endif
-	char const *p;
-	char const *a;
-	char *r = IFX_NULL;
-	const char *s = buf;
-	int ret = 0, mode = 32, base = 0, array_cnt = 0, i;
-	long string_width = 0;
-	long long int *v64 = IFX_NULL;
-	int *v32 = IFX_NULL;
-	short *v16 = IFX_NULL;
-	char *v8 = IFX_NULL;
-	unsigned long long int *vu64 = IFX_NULL;
-	unsigned int *vu32 = IFX_NULL;
-	unsigned short *vu16 = IFX_NULL;
-	unsigned char *vu8 = IFX_NULL;
-#if (CLI_HAVE_FLOAT == 1)
-	float *f = IFX_NULL;
-#endif
+	/** printout to file (if set) */
+	clios_file_t *p_file;
+	/** else printout to buffer */
+	char *p_out;
+	/** remaining buffer size */
+	unsigned int buf_size;
+	/** number of printed bytes */
+	int out_size;
+};
 
-#ifndef _lint
-	va_start(marker, fmt);
-#endif
+CLI_STATIC int core_printf(
+	struct cli_core_print_s *p_print,
+	const char *format,
+	...)
+{
+	va_list ap;
+	int ret = 0;
 
-	if (s == IFX_NULL) {
-		/*lint -save -e(801) */
-		goto SF_END;
-		/*lint -restore */
+	va_start(ap, format);
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+	if (p_print->p_file != IFX_NULL)
+	{
+		char line[CLI_CORE_PRINT_LINE_SIZE];
+
+		ret = clios_vsnprintf(line, sizeof(line), format, ap);
+		va_end(ap);
+		if (ret < 0)
+			return IFX_ERROR;
+		ret = cli_fprintf_spec(p_print->p_file, "%s", line);
+		if (ret > 0)
+			p_print->out_size += ret;
+		return IFX_SUCCESS;
+	}
+#	endif
+	ret = clios_vsnprintf(p_print->p_out, p_print->buf_size, format, ap);
+	va_end(ap);
+	if ((ret < 0) || ((unsigned int)ret >= p_print->buf_size))
+	{
+		/* buffer full - cut the last line */
+		if (p_print->buf_size)
+			*p_print->p_out = '\0';
+		cli_exec_overflow_set(IFX_NULL);
+		return IFX_ERROR;
 	}
+	p_print->p_out += ret;
+	p_print->buf_size -= (unsigned int)ret;
+	p_print->out_size += ret;
 
-	for (p = fmt; *p; p++) {
-		if (*p != '%')
-			continue;
+	return IFX_SUCCESS;
+}
+#endif	/* #if (CLI_SUPPORT_JOURNAL == 1) || ... || (CLI_SUPPORT_APROPOS == 1) */
 
-		if (s == IFX_NULL) {
-			/*lint -save -e(801) */
-			goto SF_END;
-			/*lint -restore */
-		}
+#if (CLI_SUPPORT_JOURNAL == 1)
+/** room kept for the trailer of a journal replay printout */
+#define CLI_JOURNAL_TRAILER_SIZE \
+	sizeof("errorcode=0 next_seq=18446744073709551615" CLI_CRLF)
 
-		/* skip spaces and tabs */
-		while ((*s == ' ') || (*s == '\t'))
-			s++;
+/** Start a journal access (lock-free), the journal stays mapped until
+   journal_put() */
+CLI_STATIC struct cli_journal_s *journal_get(
+	struct cli_core_context_s *p_core_ctx)
+{
+	(void)clios_atomic_fetch_add(&p_core_ctx->journal_users, 1);
+	/* pairs with the fence of cli_core_journal_close(): either the close
+	   sees the access or the access sees the cleared journal */
+	clios_atomic_fence_full();
+	return clios_atomic_load(&p_core_ctx->p_journal);
+}
 
-		if (*s == 0) {
-			/*lint -save -e(801) */
-			goto SF_END;
-			/*lint -restore */
+/** End a journal access, the last one wakes a waiting close */
+CLI_STATIC void journal_put(
+	struct cli_core_context_s *p_core_ctx)
+{
+	if (clios_atomic_fetch_add(&p_core_ctx->journal_users, -1) != 1)
+		return;
+
+	/* pairs with the fence of cli_core_journal_close(): either the close
+	   sees no access or this access sees the waiting close */
+	clios_atomic_fence_full();
+	if (clios_atomic_load(&p_core_ctx->journal_closers) != 0)
+		(void)clios_event_wakeup(&p_core_ctx->event_journal_idle);
+}
+
+CLI_STATIC int journal_entry_print(
+	void *p_data,
+	unsigned long long seq,
+	unsigned long long time_ms,
+	unsigned int type,
+	const char *p_text)
+{
+	struct cli_core_print_s *p_print = (struct cli_core_print_s *)p_data;
+
+	/* stop reading if the printout failed (buffer full) */
+	return core_printf(p_print,
+		"seq=%llu time=%llu.%03u type=%s %s" CLI_CRLF,
+		seq, time_ms / 1000, (unsigned int)(time_ms % 1000),
+		(type == CLI_JOURNAL_TYPE_DUMP) ? "dump" : "event", p_text);
+}
+
+/** Build in command - journal, common part (status / replay) */
+CLI_STATIC int journal_cmd_exec(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	struct cli_core_print_s *p_print)
+{
+	unsigned long long first_seq = 0, next_seq = 0, from_seq = 0;
+	unsigned int max_entries = 0, reserve;
+	struct cli_journal_s *p_journal = journal_get(p_core_ctx);
+
+	if (p_journal == IFX_NULL)
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (journal not active)" CLI_CRLF);
+	}
+	else if ((p_cmd != IFX_NULL) && (clios_strlen(p_cmd) > 0))
+	{
+		if (cli_sscanf(p_cmd, "%llu %u", &from_seq, &max_entries) < 1)
+		{
+			(void)core_printf(p_print,
+				"errorcode=-1 (invalid sequence number)" CLI_CRLF);
+		}
+		else
+		{
+			/* the entries stop before the trailer, next_seq is the first
+			   entry which did not fit into the buffer */
+			reserve = (p_print->buf_size < CLI_JOURNAL_TRAILER_SIZE) ?
+				p_print->buf_size : (unsigned int)CLI_JOURNAL_TRAILER_SIZE;
+			p_print->buf_size -= reserve;
+			(void)cli_journal_read(p_journal,
+				from_seq, max_entries, journal_entry_print, p_print, &next_seq);
+			p_print->buf_size += reserve;
+			(void)core_printf(p_print,
+				"errorcode=0 next_seq=%llu" CLI_CRLF, next_seq);
 		}
+	}
+	else
+	{
+		(void)cli_journal_seq_get(p_journal, &first_seq, &next_seq);
+		(void)core_printf(p_print,
+			"errorcode=0 first_seq=%llu next_seq=%llu" CLI_CRLF,
+			first_seq, next_seq);
+	}
 
-		if (isdigit(*(p + 1))) {
-			char *ptr;
-			if (*++p == '0') {
-				/*lint -save -e(801) */
-				goto SF_END;
-				/*lint -restore */
-			}
-			string_width = CLI_STRTOL(p, &ptr, 10);
-			p = ptr;
-			a = NULL;
-			array_cnt = 0;
-		} else {
-			switch (*++p) {
-			case 0:
-				/* ret = 0; */
-				/*lint -save -e(801) */
-				goto SF_END;
-				/*lint -restore */
+	journal_put(p_core_ctx);
 
-				/* 8 bit */
-			case 'b':
-				mode = 8;
-				p++;
-				break;
+	return p_print->out_size;
+}
 
-				/* 16 bit */
-			case 'h':
-				mode = 16;
-				p++;
-				break;
+#ifndef CLI_DEBUG_DISABLE
+static const char g_cli_journal_usage[] =
+	"Long Form: journal_replay" CLI_CRLF "Short Form: journal" CLI_CRLF
+	CLI_CRLF
+	"Input Parameter" CLI_CRLF
+	"- unsigned long long from_seq (optional, without: show the journal status)" CLI_CRLF
+	"- unsigned int max_entries (optional, 0: all)" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF
+	"- unsigned long long first_seq (status only)" CLI_CRLF
+	"- unsigned long long next_seq" CLI_CRLF CLI_CRLF;
+#else
+static const char g_cli_journal_usage[] = "";
+#endif
 
-				/* 32 or 64 bit */
-			case 'l':
-				/* The C standard says this should be size of long,
-				 * long is 64 bit on Linux 64 bit systems and 32 bit
-				 * on Windows 64 Bit systems. On 32 bit systems this
-				 * is normally 32 bit long.
-				 */
-				mode = sizeof(long int) * 8;
-				p++;
-				/* 64 bit (for ll) */
-				if (*p == 'l') {
-					mode = 64;
-					p++;
-				}
-				break;
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+CLI_STATIC int cli_core_cmd_journal__buffer(
+	void *p_ctx,
+	const char *p_cmd,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret = 0;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
 
-				/* 32 bit (sizeof(int)) by default */
-			default:
-				mode = 32;
-				break;
-			}
+	if ((ret = cli_check_help__buffer(p_cmd, g_cli_journal_usage, bufsize_max, p_out)) >= 0)
+		return ret;
 
-			switch (*p) {
-			case 'd':
-			case 'i':
-			case 'u':
-				base = 0;
-				break;
+	print.p_out = p_out;
+	print.buf_size = bufsize_max;
 
-			case 'x':
-				base = 16;
-				break;
+	return journal_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
 
-			default:
-				break;
-			}
+#if (CLI_SUPPORT_FILE_OUT == 1)
+CLI_STATIC int cli_core_cmd_journal__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
 
-			a = p + 1;
-			i = 0;
+	if ((ret = check_help__file(p_cmd, g_cli_journal_usage, p_file)) > 0)
+		return ret;
 
-			array_cnt = 1;
+	print.p_file = p_file;
 
-			switch (*a) {
-			case '[':
-				a++;
-				if (*a) {
-					array_cnt = (char)CLI_STRTOL(a, IFX_NULL, 10);
-					if (array_cnt > 256)
-						array_cnt = 0;
-					do {
-						a++;
-					} while (*a && (*a != ']'));
-				}
-				break;
+	return journal_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_JOURNAL == 1) */
 
-			default:
-				break;
-			}
-		}
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+CLI_STATIC int event_limit_rules_print(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_core_print_s *p_print)
+{
+	struct cli_event_limit_rule_info_s info;
+	unsigned int idx = 0;
 
-		switch (*p) {
-		case 0:
-			/* ret = 0; */
-			/*lint -save -e(801) */
-			goto SF_END;
-			/*lint -restore */
+	while (cli_event_limit_rule_get(p_core_ctx->p_event_limit, idx, &info) == IFX_SUCCESS)
+	{
+		if (core_printf(p_print,
+			"key=%s window_ms=%u rate=%u burst=%u passed=%lu coalesced=%lu overflow=%lu" CLI_CRLF,
+			info.key, info.window_ms, info.rate, info.burst,
+			info.n_passed, info.n_coalesced, info.n_overflow) != IFX_SUCCESS)
+			break;
+		idx++;
+	}
 
-#if 1
-			/* string */
-		case 's':
-			{
-#ifndef _lint
-				r = va_arg(marker, char *);
-#endif
-				if (r != IFX_NULL) {
-					const char *q = s;
+	return (int)idx;
+}
 
-					do {
-						if ((*q == ' ') || (*q == '\t'))
-							q++;
-						else
-							break;
-					} while (*q);
-					if (*q) {
-						if (string_width == 0)
-							string_width = strlen(q);
-						do {
-							if ((*q != ' ')
-							    && (*q != '\t')
-							    && (*q != '\n')
-							    && (*q != '\r'))
-								*r++ = *q++;
-							else
-								break;
-							string_width--;
-						} while (string_width > 0 && *q);
-						s = q;
-						*r = 0;
-						ret++;
-					}
-				}
-				break;
-			}
+/** Build in command - event limit, common part (show / set / flush / clear) */
+CLI_STATIC int event_limit_cmd_exec(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	struct cli_core_print_s *p_print)
+{
+	char key[CLI_EVENT_LIMIT_KEY_SIZE];
+	char key_fmt[32];
+	unsigned int window_ms = 0, rate = 0, burst = 0;
+	int ret = 0;
 
-#else
-			/* string */
-		case 's':
-			{
-#ifndef _lint
-				r = va_arg(marker, char *);
-#endif
-				if (r != IFX_NULL) {
-					const char *q = s;
+	/* key width follows the configured key size */
+	(void)clios_snprintf(key_fmt, sizeof(key_fmt), "%%%us %%u %%u %%u",
+		(unsigned int)(CLI_EVENT_LIMIT_KEY_SIZE - 1));
 
-					do {
-						if ((*q == ' ') || (*q == '\t'))
-							q++;
-					} while (*q);
+	if ((p_cmd == IFX_NULL) || (clios_strlen(p_cmd) == 0))
+	{
+		(void)core_printf(p_print, "errorcode=0" CLI_CRLF);
+		if (p_core_ctx->p_event_limit != IFX_NULL)
+			(void)event_limit_rules_print(p_core_ctx, p_print);
+	}
+	else if (clios_strcmp(p_cmd, "flush") == 0)
+	{
+		ret = cli_core_event_limit_flush(p_core_ctx);
+		(void)core_printf(p_print, "errorcode=%d" CLI_CRLF, (ret < 0) ? ret : 0);
+	}
+	else if (clios_strcmp(p_cmd, "clear") == 0)
+	{
+		if (p_core_ctx->p_event_limit != IFX_NULL)
+			ret = cli_event_limit_rule_clear(p_core_ctx->p_event_limit);
+		(void)core_printf(p_print, "errorcode=%d" CLI_CRLF, ret);
+	}
+	else if (cli_sscanf(p_cmd, key_fmt, key, &window_ms, &rate, &burst) < 3)
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (invalid parameter)" CLI_CRLF);
+	}
+	else
+	{
+		ret = cli_core_event_limit_set(p_core_ctx, key, window_ms, rate, burst);
+		(void)core_printf(p_print, "errorcode=%d" CLI_CRLF, ret);
+	}
 
-					if (*q) {
-						strcpy(r, q);
-						ret++;
-					}
-				}
-				break;
-			}
+	return p_print->out_size;
+}
+
+#ifndef CLI_DEBUG_DISABLE
+static const char g_cli_event_limit_usage[] =
+	"Long Form: event_limit" CLI_CRLF "Short Form: evl" CLI_CRLF
+	CLI_CRLF
+	"Input Parameter" CLI_CRLF
+	"- without parameter: show the rules and statistics" CLI_CRLF
+	"- flush: deliver all collapsed events which are due" CLI_CRLF
+	"- clear: remove all rules" CLI_CRLF
+	"- else set a rule (window_ms = 0 and rate = 0 removes the rule):" CLI_CRLF
+	"- char key[32] (event key, \"<prefix>*\" or \"*\")" CLI_CRLF
+	"- unsigned int window_ms (coalescing window, 0: off)" CLI_CRLF
+	"- unsigned int rate (max events per second, 0: unlimited)" CLI_CRLF
+	"- unsigned int burst (optional, token bucket size, 0: same as rate)" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF
+	"- per rule (show only): key window_ms rate burst passed coalesced overflow" CLI_CRLF CLI_CRLF;
+#else
+static const char g_cli_event_limit_usage[] = "";
 #endif
 
-#if (CLI_HAVE_FLOAT == 1)
-		case 'f':
-			{
-				switch (mode) {
-				case 32:
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+CLI_STATIC int cli_core_cmd_event_limit__buffer(
+	void *p_ctx,
+	const char *p_cmd,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret = 0;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = cli_check_help__buffer(p_cmd, g_cli_event_limit_usage, bufsize_max, p_out)) >= 0)
+		return ret;
+
+	print.p_out = p_out;
+	print.buf_size = bufsize_max;
+
+	return event_limit_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+CLI_STATIC int cli_core_cmd_event_limit__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = check_help__file(p_cmd, g_cli_event_limit_usage, p_file)) > 0)
+		return ret;
+
+	print.p_file = p_file;
+
+	return event_limit_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_EVENT_LIMIT == 1) */
+
+#if (CLI_SUPPORT_STATS == 1)
+CLI_STATIC int stats_cmd_print(
+	void *p_data,
+	const char *p_short_name,
+	const char *p_long_name,
+	const struct cli_cmd_stats_s *p_cmd_stats)
+{
+	struct cli_core_print_s *p_print = (struct cli_core_print_s *)p_data;
+
+	if (p_cmd_stats->n_calls == 0)
+		return 0;
+
+	/* stop if the printout failed (buffer full) */
+	return core_printf(p_print,
+		"cmd=%s calls=%llu errors=%llu out_bytes=%llu avg_us=%llu p50_us=%llu p99_us=%llu" CLI_CRLF,
+		p_short_name, p_cmd_stats->n_calls, p_cmd_stats->n_errors,
+		p_cmd_stats->out_bytes, p_cmd_stats->time_sum_us / p_cmd_stats->n_calls,
+		cli_stats_percentile_us(p_cmd_stats, 500),
+		cli_stats_percentile_us(p_cmd_stats, 990));
+}
+
+/** Build in command - stats, common part (show / reset) */
+CLI_STATIC int stats_cmd_exec(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	struct cli_core_print_s *p_print)
+{
+	struct cli_cmd_stats_s cmd_stats;
+	unsigned int bucket;
+
+	if (p_core_ctx->p_stats == IFX_NULL)
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (statistics not active)" CLI_CRLF);
+	}
+	else if ((p_cmd == IFX_NULL) || (clios_strlen(p_cmd) == 0))
+	{
+		(void)cli_core_stats_get(p_core_ctx, IFX_NULL, &cmd_stats);
+		if (core_printf(p_print, "errorcode=0 unknown=%llu" CLI_CRLF,
+			cmd_stats.n_calls) == IFX_SUCCESS)
+			(void)cli_core_stats_walk(p_core_ctx, stats_cmd_print, p_print);
+	}
+	else if (clios_strcmp(p_cmd, "reset") == 0)
+	{
+		(void)core_printf(p_print, "errorcode=%d" CLI_CRLF,
+			cli_core_stats_reset(p_core_ctx));
+	}
+	else if (cli_core_stats_get(p_core_ctx, p_cmd, &cmd_stats) != IFX_SUCCESS)
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (unknown command)" CLI_CRLF);
+	}
+	else
+	{
+		(void)core_printf(p_print, "errorcode=0" CLI_CRLF);
+		if (cmd_stats.n_calls == 0)
+			return p_print->out_size;
+		(void)stats_cmd_print(p_print, p_cmd, IFX_NULL, &cmd_stats);
+		for (bucket = 0; bucket < (CLI_STATS_HIST_BUCKETS - 1); bucket++)
+		{
+			if (core_printf(p_print, "lt_us=%llu count=%u" CLI_CRLF,
+				CLI_STATS_HIST_BOUND_US(bucket), cmd_stats.hist[bucket]) != IFX_SUCCESS)
+				return p_print->out_size;
+		}
+		(void)core_printf(p_print, "lt_us=inf count=%u" CLI_CRLF,
+			cmd_stats.hist[CLI_STATS_HIST_BUCKETS - 1]);
+	}
+
+	return p_print->out_size;
+}
+
+#ifndef CLI_DEBUG_DISABLE
+static const char g_cli_stats_usage[] =
+	"Long Form: statistics" CLI_CRLF "Short Form: stats" CLI_CRLF
+	CLI_CRLF
+	"Input Parameter" CLI_CRLF
+	"- without parameter: show the statistics of all called commands" CLI_CRLF
+	"- reset: reset the statistics" CLI_CRLF
+	"- else: command name, show the statistics and the latency histogram" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF
+	"- unsigned long long unknown (number of unknown commands, show all only)" CLI_CRLF
+	"- per command: cmd calls errors out_bytes avg_us p50_us p99_us" CLI_CRLF
+	"- per histogram bucket: lt_us (upper bound) count" CLI_CRLF CLI_CRLF;
+#else
+static const char g_cli_stats_usage[] = "";
+#endif
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+CLI_STATIC int cli_core_cmd_stats__buffer(
+	void *p_ctx,
+	const char *p_cmd,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret = 0;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = cli_check_help__buffer(p_cmd, g_cli_stats_usage, bufsize_max, p_out)) >= 0)
+		return ret;
+
+	print.p_out = p_out;
+	print.buf_size = bufsize_max;
+
+	return stats_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+CLI_STATIC int cli_core_cmd_stats__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = check_help__file(p_cmd, g_cli_stats_usage, p_file)) > 0)
+		return ret;
+
+	print.p_file = p_file;
+
+	return stats_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_STATS == 1) */
+
+#if (CLI_SUPPORT_TRACE == 1)
+CLI_STATIC int trace_entry_print(
+	void *p_data,
+	const struct cli_trace_entry_s *p_entry)
+{
+	/* stop if the printout failed (buffer full) */
+	return core_printf((struct cli_core_print_s *)p_data,
+		"seq=%llu time=%llu.%03u session=%d inst=%u cmd=%s duration_us=%u"
+		" ret=%d errorcode=%d args=\"%s\"" CLI_CRLF,
+		p_entry->seq, p_entry->time_ms / 1000, (unsigned int)(p_entry->time_ms % 1000),
+		p_entry->session, p_entry->inst, p_entry->key, p_entry->duration_us,
+		p_entry->ret, p_entry->errorcode, p_entry->args);
+}
+
+/** Write the flight recorder to the configured file (on release) */
+CLI_STATIC int trace_file_write(
+	struct cli_core_context_s *p_core_ctx)
+{
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((p_core_ctx->p_trace == IFX_NULL) || (p_core_ctx->p_trace_file == IFX_NULL))
+		return IFX_SUCCESS;
+
+	print.p_file = clios_fopen(p_core_ctx->p_trace_file, "w");
+	if (print.p_file == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: trace - open file %s" CLI_CRLF,
+			p_core_ctx->p_trace_file));
+		return IFX_ERROR;
+	}
+
+	(void)core_printf(&print, "# CLI flight recorder, instance %u" CLI_CRLF,
+		p_core_ctx->cli_instance_num);
+	(void)cli_trace_read(p_core_ctx->p_trace, 0, trace_entry_print, &print);
+	(void)clios_fclose(print.p_file);
+
+	return IFX_SUCCESS;
+#	else
+	(void)p_core_ctx;
+
+	return IFX_SUCCESS;
+#	endif
+}
+
+/** Build in command - trace, common part (show / clear / on / off) */
+CLI_STATIC int trace_cmd_exec(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	struct cli_core_print_s *p_print)
+{
+	unsigned int n_last = 0;
+
+	if (p_core_ctx->p_trace == IFX_NULL)
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (flight recorder not active)" CLI_CRLF);
+	}
+	else if (clios_strcmp(p_cmd, "clear") == 0)
+	{
+		(void)core_printf(p_print, "errorcode=%d" CLI_CRLF,
+			cli_trace_clear(p_core_ctx->p_trace));
+	}
+	else if ((clios_strcmp(p_cmd, "on") == 0) || (clios_strcmp(p_cmd, "off") == 0))
+	{
+		(void)core_printf(p_print, "errorcode=%d" CLI_CRLF,
+			cli_core_trace_enable(p_core_ctx,
+				(p_cmd[1] == 'n') ? IFX_TRUE : IFX_FALSE));
+	}
+	else if ((clios_strlen(p_cmd) != 0) && (cli_sscanf(p_cmd, "%u", &n_last) != 1))
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (invalid parameter)" CLI_CRLF);
+	}
+	else
+	{
+		/* the trace command itself is recorded after this printout */
+		if (core_printf(p_print, "errorcode=0 enabled=%d" CLI_CRLF,
+			(p_core_ctx->b_trace == IFX_TRUE) ? 1 : 0) == IFX_SUCCESS)
+			(void)cli_trace_read(p_core_ctx->p_trace, n_last,
+				trace_entry_print, p_print);
+	}
+
+	return p_print->out_size;
+}
+
+#ifndef CLI_DEBUG_DISABLE
+static const char g_cli_trace_usage[] =
+	"Long Form: trace" CLI_CRLF "Short Form: trc" CLI_CRLF
+	CLI_CRLF
+	"Input Parameter" CLI_CRLF
+	"- without parameter: show all recorded command executions" CLI_CRLF
+	"- <n>: show the last n recorded command executions" CLI_CRLF
+	"- clear: drop all entries" CLI_CRLF
+	"- on / off: enable / disable the recording" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF
+	"- int enabled (show only)" CLI_CRLF
+	"- per entry: seq time session inst cmd duration_us ret errorcode args" CLI_CRLF CLI_CRLF;
+#else
+static const char g_cli_trace_usage[] = "";
+#endif
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+CLI_STATIC int cli_core_cmd_trace__buffer(
+	void *p_ctx,
+	const char *p_cmd,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret = 0;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = cli_check_help__buffer(p_cmd, g_cli_trace_usage, bufsize_max, p_out)) >= 0)
+		return ret;
+
+	print.p_out = p_out;
+	print.buf_size = bufsize_max;
+
+	return trace_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+CLI_STATIC int cli_core_cmd_trace__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = check_help__file(p_cmd, g_cli_trace_usage, p_file)) > 0)
+		return ret;
+
+	print.p_file = p_file;
+
+	return trace_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_TRACE == 1) */
+
+#if (CLI_SUPPORT_METRICS == 1) || (CLI_SUPPORT_RECORD == 1)
+/** Path of a file written by a built-in command - a plain file name within
+   the configured directory (the pipe clients must not write elsewhere).
+
+\return
+   IFX_SUCCESS - path built
+   IFX_ERROR - no directory configured or invalid file name.
+*/
+CLI_STATIC int core_file_path_get(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_name,
+	char *p_path,
+	unsigned int path_size)
+{
+	int ret = IFX_ERROR;
+
+	if ((p_name[0] == '\0') || (p_name[0] == '.') ||
+	    (clios_strstr(p_name, "/") != IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI,
+			("ERR CLI Core: invalid file name \"%s\"" CLI_CRLF, p_name));
+		return IFX_ERROR;
+	}
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->p_file_dir != IFX_NULL)
+	{
+		ret = clios_snprintf(p_path, path_size, "%s/%s", p_core_ctx->p_file_dir, p_name);
+		ret = ((ret < 0) || ((unsigned int)ret >= path_size)) ? IFX_ERROR : IFX_SUCCESS;
+	}
+	else
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: no file directory set" CLI_CRLF));
+	}
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	return ret;
+}
+#endif	/* #if (CLI_SUPPORT_METRICS == 1) || (CLI_SUPPORT_RECORD == 1) */
+
+#if (CLI_SUPPORT_METRICS == 1)
+/** Metrics render state for the statistics walk */
+struct cli_metrics_walk_s
+{
+	/** render context */
+	struct cli_metrics_s *p_metrics;
+	/** family to render (0: calls, 1: errors, 2: output bytes, 3: latency) */
+	int family;
+};
+
+#	if (CLI_SUPPORT_STATS == 1)
+/** Render an execution time [us] in seconds */
+#		define CLI_METRICS_SEC_FMT	"%llu.%06llu"
+#		define CLI_METRICS_SEC_ARG(US)	((US) / 1000000ULL), ((US) % 1000000ULL)
+
+CLI_STATIC int metrics_stats_walk(
+	void *p_data,
+	const char *p_short_name,
+	const char *p_long_name,
+	const struct cli_cmd_stats_s *p_cmd_stats)
+{
+	struct cli_metrics_walk_s *p_walk = (struct cli_metrics_walk_s *)p_data;
+	struct cli_metrics_s *p_metrics = p_walk->p_metrics;
+	unsigned long long count = 0;
+	unsigned int bucket;
+
+	(void)p_long_name;
+
+	if (p_cmd_stats->n_calls == 0)
+		return 0;
+
+	switch (p_walk->family)
+	{
+	case 0:
+		return cli_metrics_printf(p_metrics, "cli_command_calls_total{cmd=\"%s\"} %llu\n",
+			p_short_name, p_cmd_stats->n_calls);
+	case 1:
+		return cli_metrics_printf(p_metrics, "cli_command_errors_total{cmd=\"%s\"} %llu\n",
+			p_short_name, p_cmd_stats->n_errors);
+	case 2:
+		return cli_metrics_printf(p_metrics, "cli_command_output_bytes_total{cmd=\"%s\"} %llu\n",
+			p_short_name, p_cmd_stats->out_bytes);
+	default:
+		break;
+	}
+
+	for (bucket = 0; bucket < (CLI_STATS_HIST_BUCKETS - 1); bucket++)
+	{
+		count += p_cmd_stats->hist[bucket];
+		if (cli_metrics_printf(p_metrics,
+			"cli_command_duration_seconds_bucket{cmd=\"%s\",le=\"" CLI_METRICS_SEC_FMT "\"} %llu\n",
+			p_short_name, CLI_METRICS_SEC_ARG(CLI_STATS_HIST_BOUND_US(bucket)),
+			count) != IFX_SUCCESS)
+			return 1;
+	}
+	count += p_cmd_stats->hist[CLI_STATS_HIST_BUCKETS - 1];
+
+	return cli_metrics_printf(p_metrics,
+		"cli_command_duration_seconds_bucket{cmd=\"%s\",le=\"+Inf\"} %llu\n"
+		"cli_command_duration_seconds_count{cmd=\"%s\"} %llu\n"
+		"cli_command_duration_seconds_sum{cmd=\"%s\"} " CLI_METRICS_SEC_FMT "\n",
+		p_short_name, count, p_short_name, count,
+		p_short_name, CLI_METRICS_SEC_ARG(p_cmd_stats->time_sum_us));
+}
+
+CLI_STATIC void metrics_stats_render(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_metrics_s *p_metrics)
+{
+	static const char * const family[][3] = {
+		{"cli_command_calls", "counter", "Number of command calls"},
+		{"cli_command_errors", "counter", "Number of failed command calls"},
+		{"cli_command_output_bytes", "counter", "Number of command output bytes"},
+		{"cli_command_duration_seconds", "histogram", "Command execution time"}};
+	struct cli_metrics_walk_s walk;
+	struct cli_cmd_stats_s cmd_stats;
+	unsigned int i;
+
+	if (p_core_ctx->p_stats == IFX_NULL)
+		return;
+
+	(void)cli_core_stats_get(p_core_ctx, IFX_NULL, &cmd_stats);
+	(void)cli_metrics_family(p_metrics, "cli_command_unknown", "counter",
+		"Number of unknown commands");
+	(void)cli_metrics_sample(p_metrics, "cli_command_unknown_total", IFX_NULL,
+		cmd_stats.n_calls);
+
+	walk.p_metrics = p_metrics;
+	for (i = 0; i < sizeof(family) / sizeof(family[0]); i++)
+	{
+		walk.family = (int)i;
+		(void)cli_metrics_family(p_metrics, family[i][0], family[i][1], family[i][2]);
+		(void)cli_core_stats_walk(p_core_ctx, metrics_stats_walk, &walk);
+	}
+}
+#	endif	/* #if (CLI_SUPPORT_STATS == 1) */
+
+CLI_STATIC void metrics_core_render(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_metrics_s *p_metrics)
+{
+	struct cli_user_context_s *p_user_ctx;
+	unsigned int n_user_if = 0;
+	char labels[32];
+
+	(void)cli_metrics_family(p_metrics, "cli_build", "info", "CLI library version");
+	(void)clios_snprintf(labels, sizeof(labels), "version=\"%d.%d.%d.%d\"",
+		CLI_VER_REVISION, CLI_VER_FEATURE, CLI_VER_MINOR, CLI_VER_BUILD_STEP);
+	(void)cli_metrics_sample(p_metrics, "cli_build_info", labels, 1);
+
+	(void)cli_metrics_family(p_metrics, "cli_commands", "gauge",
+		"Number of registered commands");
+	(void)cli_metrics_sample(p_metrics, "cli_commands", IFX_NULL,
+		p_core_ctx->cmd_core.n_cmds);
+
+	(void)cli_metrics_family(p_metrics, "cli_core_clones", "gauge",
+		"Number of CLI core clones");
+	(void)cli_metrics_sample(p_metrics, "cli_core_clones", IFX_NULL,
+		p_core_ctx->n_cli_core_clones);
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	for (p_user_ctx = p_core_ctx->p_user_head; p_user_ctx != IFX_NULL;
+	     p_user_ctx = p_user_ctx->p_next)
+		n_user_if++;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+	(void)cli_metrics_family(p_metrics, "cli_user_interfaces", "gauge",
+		"Number of registered user interfaces");
+	(void)cli_metrics_sample(p_metrics, "cli_user_interfaces", IFX_NULL, n_user_if);
+
+	(void)cli_metrics_family(p_metrics, "cli_memory_bytes", "gauge",
+		"Memory allocated by the CLI core");
+	(void)cli_metrics_sample(p_metrics, "cli_memory_bytes", "area=\"context\"",
+		sizeof(struct cli_core_context_s));
+	(void)cli_metrics_sample(p_metrics, "cli_memory_bytes", "area=\"command_tree\"",
+		(p_core_ctx->cmd_core.p_node_array != IFX_NULL) ?
+			(unsigned long long)p_core_ctx->cmd_core.n_nodes * sizeof(struct cli_cmd_node_s) : 0);
+#	if (CLI_SUPPORT_STATS == 1)
+	(void)cli_metrics_sample(p_metrics, "cli_memory_bytes", "area=\"statistics\"",
+		cli_stats_mem_size_get(p_core_ctx->p_stats));
+#	endif
+#	if (CLI_SUPPORT_TRACE == 1)
+	(void)cli_metrics_sample(p_metrics, "cli_memory_bytes", "area=\"trace\"",
+		cli_trace_mem_size_get(p_core_ctx->p_trace));
+#	endif
+	(void)cli_metrics_sample(p_metrics, "cli_memory_bytes", "area=\"metrics\"",
+		p_core_ctx->metrics_buf_size);
+
+#	if (CLI_SUPPORT_STATS == 1)
+	metrics_stats_render(p_core_ctx, p_metrics);
+#	endif
+}
+
+/** Render all metrics, the metrics lock must be taken */
+CLI_STATIC int metrics_render(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_metrics_s *p_metrics)
+{
+	unsigned int i;
+
+	metrics_core_render(p_core_ctx, p_metrics);
+
+	for (i = 0; i < CLI_METRICS_MAX_SOURCES; i++)
+	{
+		if (p_core_ctx->metrics_src[i].source_fct != IFX_NULL)
+			(void)p_core_ctx->metrics_src[i].source_fct(
+				p_core_ctx->metrics_src[i].p_data, p_metrics);
+	}
+	(void)cli_metrics_printf(p_metrics, "# EOF\n");
+
+	return (p_metrics->b_overflow == IFX_TRUE) ? IFX_ERROR : (int)p_metrics->len;
+}
+
+/** Render all metrics into the render buffer of the core (grows on demand),
+    the metrics lock must be taken */
+CLI_STATIC int metrics_buf_render(
+	struct cli_core_context_s *p_core_ctx)
+{
+	struct cli_metrics_s metrics;
+	unsigned int buf_size;
+	int ret;
+
+	do {
+		if (p_core_ctx->p_metrics_buf == IFX_NULL)
+		{
+			buf_size = (p_core_ctx->metrics_buf_size != 0) ?
+				p_core_ctx->metrics_buf_size : CLI_METRICS_BUFFER_SIZE;
+			p_core_ctx->p_metrics_buf = (char *)clios_memalloc(buf_size);
+			if (p_core_ctx->p_metrics_buf == IFX_NULL)
+			{
+				CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: metrics - no memory" CLI_CRLF));
+				p_core_ctx->metrics_buf_size = 0;
+				return IFX_ERROR;
+			}
+			p_core_ctx->metrics_buf_size = buf_size;
+		}
+
+		cli_metrics_init(&metrics, p_core_ctx->p_metrics_buf, p_core_ctx->metrics_buf_size);
+		ret = metrics_render(p_core_ctx, &metrics);
+		if (ret >= 0)
+			return ret;
+
+		/* buffer too small - grow once, the buffer is kept for the next scrape */
+		if (p_core_ctx->metrics_buf_size >= CLI_METRICS_BUFFER_MAX)
+			break;
+		clios_memfree(p_core_ctx->p_metrics_buf);
+		p_core_ctx->p_metrics_buf = IFX_NULL;
+		p_core_ctx->metrics_buf_size *= 2;
+		if (p_core_ctx->metrics_buf_size > CLI_METRICS_BUFFER_MAX)
+			p_core_ctx->metrics_buf_size = CLI_METRICS_BUFFER_MAX;
+	} while (1);
+
+	CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: metrics - buffer too small" CLI_CRLF));
+	return IFX_ERROR;
+}
+
+/** Build in command - write the metrics to a file of the file directory */
+CLI_STATIC int metrics_cmd_file_write(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_name)
+{
+	char path[CLI_CORE_FILE_PATH_SIZE];
+
+	if (core_file_path_get(p_core_ctx, p_name, path, sizeof(path)) != IFX_SUCCESS)
+		return IFX_ERROR;
+
+	return cli_core_metrics_file_write(p_core_ctx, path);
+}
+
+CLI_STATIC int metrics_fd_write(
+	int fd,
+	const char *p_buf,
+	int len)
+{
+	int written = 0, ret;
+
+	while (written < len)
+	{
+		ret = (int)clios_write(fd, p_buf + written, (size_t)(len - written));
+		if (ret <= 0)
+			return IFX_ERROR;
+		written += ret;
+	}
+
+	return written;
+}
+
+#ifndef CLI_DEBUG_DISABLE
+static const char g_cli_metrics_usage[] =
+	"Long Form: metrics" CLI_CRLF "Short Form: met" CLI_CRLF
+	CLI_CRLF
+	"Input Parameter" CLI_CRLF
+	"- without parameter: show the metrics (OpenMetrics text format)" CLI_CRLF
+	"- <name>: write the metrics to the given file of the file directory" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF
+	"- metrics in OpenMetrics text format, terminated by \"# EOF\" (show only)" CLI_CRLF CLI_CRLF;
+#else
+static const char g_cli_metrics_usage[] = "";
+#endif
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+CLI_STATIC int cli_core_cmd_metrics__buffer(
+	void *p_ctx,
+	const char *p_cmd,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret = 0;
+	struct cli_core_context_s *p_core_ctx = (struct cli_core_context_s *)p_ctx;
+
+	if ((ret = cli_check_help__buffer(p_cmd, g_cli_metrics_usage, bufsize_max, p_out)) >= 0)
+		return ret;
+
+	if (clios_strlen(p_cmd) != 0)
+		return clios_snprintf(p_out, bufsize_max, "errorcode=%d" CLI_CRLF,
+			metrics_cmd_file_write(p_core_ctx, p_cmd));
+
+	/* render directly into the output buffer */
+	ret = clios_snprintf(p_out, bufsize_max, "errorcode=0" CLI_CRLF);
+	if ((ret < 0) || ((unsigned int)ret >= bufsize_max) ||
+	    (cli_core_metrics_render(p_core_ctx, p_out + ret, bufsize_max - ret) < 0))
+		return clios_snprintf(p_out, bufsize_max,
+			"errorcode=-1 (buffer too small)" CLI_CRLF);
+
+	return (int)clios_strlen(p_out);
+}
+#endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+CLI_STATIC int cli_core_cmd_metrics__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+	struct cli_core_context_s *p_core_ctx = (struct cli_core_context_s *)p_ctx;
+
+	if ((ret = check_help__file(p_cmd, g_cli_metrics_usage, p_file)) > 0)
+		return ret;
+
+	if (clios_strlen(p_cmd) != 0)
+		return cli_fprintf_spec(p_file, "errorcode=%d" CLI_CRLF,
+			metrics_cmd_file_write(p_core_ctx, p_cmd));
+
+	/* render into the (preallocated) metrics buffer of the core */
+	(void)clios_lockget(&p_core_ctx->lock_metrics);
+	if (metrics_buf_render(p_core_ctx) >= 0)
+		ret = cli_fprintf_spec(p_file, "errorcode=0" CLI_CRLF "%s",
+			p_core_ctx->p_metrics_buf);
+	else
+		ret = cli_fprintf_spec(p_file,
+			"errorcode=-1 (buffer too small)" CLI_CRLF);
+	(void)clios_lockrelease(&p_core_ctx->lock_metrics);
+
+	return ret;
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_METRICS == 1) */
+
+#if (CLI_SUPPORT_RECORD == 1)
+/** Build in command - record, common part (show / start / stop) */
+CLI_STATIC int record_cmd_exec(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	struct cli_core_print_s *p_print)
+{
+	struct cli_record_s *p_record;
+	unsigned long long n_entries = 0, n_lost = 0, n_bytes = 0;
+	char name[CLI_CORE_FILE_PATH_SIZE];
+	char path[CLI_CORE_FILE_PATH_SIZE];
+
+	if (clios_strcmp(p_cmd, "stop") == 0)
+	{
+		(void)core_printf(p_print, "errorcode=%d" CLI_CRLF,
+			cli_core_record_stop(p_core_ctx));
+	}
+	else if (clios_strncmp(p_cmd, "start ", 6) == 0)
+	{
+		name[0] = '\0';
+		if (cli_sscanf(p_cmd + 6, "%255s", name) != 1)
+			(void)core_printf(p_print,
+				"errorcode=-1 (invalid parameter)" CLI_CRLF);
+		else if (core_file_path_get(p_core_ctx, name, path, sizeof(path)) != IFX_SUCCESS)
+			(void)core_printf(p_print,
+				"errorcode=-1 (no file directory or invalid name)" CLI_CRLF);
+		else
+			(void)core_printf(p_print, "errorcode=%d" CLI_CRLF,
+				cli_core_record_start(p_core_ctx, path));
+	}
+	else if (clios_strlen(p_cmd) != 0)
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (invalid parameter)" CLI_CRLF);
+	}
+	else
+	{
+		(void)clios_lockget(&p_core_ctx->lock_ctx);
+		p_record = p_core_ctx->p_record;
+		if (p_record != IFX_NULL)
+			(void)cli_record_counters_get(p_record, &n_entries, &n_lost, &n_bytes);
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+		(void)core_printf(p_print,
+			"errorcode=0 recording=%d entries=%llu lost=%llu bytes=%llu" CLI_CRLF,
+			(p_record != IFX_NULL) ? 1 : 0, n_entries, n_lost, n_bytes);
+	}
+
+	return p_print->out_size;
+}
+
+#ifndef CLI_DEBUG_DISABLE
+static const char g_cli_record_usage[] =
+	"Long Form: record" CLI_CRLF "Short Form: rec" CLI_CRLF
+	CLI_CRLF
+	"Input Parameter" CLI_CRLF
+	"- without parameter: show the recording state" CLI_CRLF
+	"- start <name>: record all command lines to the given file of the file directory" CLI_CRLF
+	"- stop: stop the recording" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF
+	"- int recording (show only)" CLI_CRLF
+	"- entries, lost, bytes (show only)" CLI_CRLF CLI_CRLF;
+#else
+static const char g_cli_record_usage[] = "";
+#endif
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+CLI_STATIC int cli_core_cmd_record__buffer(
+	void *p_ctx,
+	const char *p_cmd,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret = 0;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+	char cmd[CLI_CORE_PRINT_LINE_SIZE];
+
+	if ((ret = cli_check_help__buffer(p_cmd, g_cli_record_usage, bufsize_max, p_out)) >= 0)
+		return ret;
+
+	/* the arguments may be part of the output buffer */
+	(void)clios_strncpy(cmd, p_cmd, sizeof(cmd) - 1);
+	cmd[sizeof(cmd) - 1] = '\0';
+
+	print.p_out = p_out;
+	print.buf_size = bufsize_max;
+
+	return record_cmd_exec((struct cli_core_context_s *)p_ctx, cmd, &print);
+}
+#endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+CLI_STATIC int cli_core_cmd_record__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = check_help__file(p_cmd, g_cli_record_usage, p_file)) > 0)
+		return ret;
+
+	print.p_file = p_file;
+
+	return record_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_RECORD == 1) */
+
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+/** output format names, index: enum cli_struct_format_e */
+static const char *const g_cli_format_names[] = {"text", "tlv", "jsonl"};
+
+/** Build in command - format, common part (show / set the output format
+   of the calling session) */
+CLI_STATIC int format_cmd_exec(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	struct cli_core_print_s *p_print)
+{
+	struct cli_struct_out_s *p_so;
+	unsigned int i;
+
+	(void)p_core_ctx;
+
+	if (clios_strlen(p_cmd) != 0)
+	{
+		for (i = 0; i < sizeof(g_cli_format_names) / sizeof(g_cli_format_names[0]); i++)
+		{
+			if (clios_strcmp(p_cmd, g_cli_format_names[i]) == 0)
+				break;
+		}
+		if (i == sizeof(g_cli_format_names) / sizeof(g_cli_format_names[0]))
+		{
+			(void)core_printf(p_print,
+				"errorcode=-1 (invalid parameter)" CLI_CRLF);
+			return p_print->out_size;
+		}
+		/* applies to the following commands of the session */
+#		if (CLI_SUPPORT_SESSION == 1)
+		if (cli_session_get() != IFX_NULL)
+			(void)cli_session_format_set(cli_session_get(), (enum cli_struct_format_e)i);
+		else
+#		endif
+		cli_struct_session_format_set((enum cli_struct_format_e)i);
+	}
+
+#	if (CLI_SUPPORT_SESSION == 1)
+	if (cli_session_get() != IFX_NULL)
+		i = (unsigned int)cli_session_format_get(cli_session_get());
+	else
+#	endif
+	i = (unsigned int)cli_struct_session_format_get();
+
+	p_so = cli_struct_out_get();
+	if (p_so != IFX_NULL)
+	{
+		(void)cli_struct_rec_start(p_so, "format");
+		cli_struct_str(p_so, "format", g_cli_format_names[i]);
+		(void)cli_struct_rec_end(p_so);
+		cli_struct_status_set(p_so, 0);
+		return 0;
+	}
+
+	(void)core_printf(p_print, "errorcode=0 format=%s" CLI_CRLF,
+		g_cli_format_names[i]);
+
+	return p_print->out_size;
+}
+
+#ifndef CLI_DEBUG_DISABLE
+static const char g_cli_format_usage[] =
+	"Long Form: format" CLI_CRLF "Short Form: fmt" CLI_CRLF
+	CLI_CRLF
+	"Input Parameter" CLI_CRLF
+	"- without parameter: show the output format of the session" CLI_CRLF
+	"- text | tlv | jsonl: set the output format of the session" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF
+	"- format" CLI_CRLF CLI_CRLF;
+#else
+static const char g_cli_format_usage[] = "";
+#endif
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+CLI_STATIC int cli_core_cmd_format__buffer(
+	void *p_ctx,
+	const char *p_cmd,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret = 0;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = cli_check_help__buffer(p_cmd, g_cli_format_usage, bufsize_max, p_out)) >= 0)
+		return ret;
+
+	print.p_out = p_out;
+	print.buf_size = bufsize_max;
+
+	return format_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+CLI_STATIC int cli_core_cmd_format__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = check_help__file(p_cmd, g_cli_format_usage, p_file)) > 0)
+		return ret;
+
+	print.p_file = p_file;
+
+	return format_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_STRUCT_OUT == 1) */
+
+#if (CLI_SUPPORT_APROPOS == 1)
+/** Printout state of the built-in command apropos */
+struct cli_apropos_print_s
+{
+	/** CLI context (usage texts) */
+	struct cli_core_context_s *p_core_ctx;
+	/** printout */
+	struct cli_core_print_s *p_print;
+	/** number of listed commands */
+	unsigned int n_listed;
+};
+
+/** Usage text check of the apropos search */
+CLI_STATIC int apropos_usage_match(
+	void *p_data,
+	void *p_cmd_data,
+	const char *p_word)
+{
+	struct cli_cmd_node_s *p_node = (struct cli_cmd_node_s *)p_cmd_data;
+	int found = 0;
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	struct cli_core_context_s *p_core_ctx = ((struct cli_apropos_print_s *)p_data)->p_core_ctx;
+	struct cli_help_store_ref_s ref;
+#	else
+	(void)p_data;
+#	endif
+
+	if ((p_node->cmd_data.p_meta != IFX_NULL) &&
+	    (p_node->cmd_data.p_meta->p_usage != IFX_NULL))
+		return cli_apropos_text_find(p_node->cmd_data.p_meta->p_usage,
+			(unsigned int)clios_strlen(p_node->cmd_data.p_meta->p_usage), p_word);
+
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	if ((p_core_ctx->p_help_store != IFX_NULL) &&
+	    (cli_help_store_text_get(p_core_ctx->p_help_store, p_node->p_key, &ref) == IFX_SUCCESS))
+	{
+		found = cli_apropos_text_find(ref.p_text, ref.len, p_word);
+		cli_help_store_text_put(p_core_ctx->p_help_store, &ref);
+	}
+#	endif
+
+	return found;
+}
+
+/** Apropos search result, one line per command (as the help listing) */
+CLI_STATIC int apropos_result_print(
+	void *p_data,
+	const char *p_short_name,
+	const char *p_long_name,
+	void *p_cmd_data)
+{
+	struct cli_apropos_print_s *p_apropos_print = (struct cli_apropos_print_s *)p_data;
+	int n_fill;
+
+	(void)p_cmd_data;
+	if (p_short_name == IFX_NULL)
+		p_short_name = CLI_EMPTY_CMD;
+	n_fill = 10 - (int)clios_strlen(p_short_name);
+	if (n_fill < 0)
+		n_fill = 0;
+
+	/* stop if the buffer is full or the max number of lines is reached */
+	if (core_printf(p_apropos_print->p_print, "%s%*s%s" CLI_CRLF,
+		p_short_name, n_fill, "", p_long_name) != IFX_SUCCESS)
+		return 1;
+
+	return (++p_apropos_print->n_listed >= CLI_APROPOS_RESULTS_MAX) ? 1 : 0;
+}
+
+/** Build in command - apropos, common part */
+CLI_STATIC int apropos_cmd_exec(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd,
+	struct cli_core_print_s *p_print)
+{
+	struct cli_apropos_print_s apropos_print;
+	char term[CLI_CORE_PRINT_LINE_SIZE];
+
+	if (p_core_ctx->p_apropos == IFX_NULL)
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (apropos index not available)" CLI_CRLF);
+	}
+	else if ((p_cmd == IFX_NULL) || (clios_strlen(p_cmd) == 0))
+	{
+		(void)core_printf(p_print,
+			"errorcode=-1 (missing search term)" CLI_CRLF);
+	}
+	else
+	{
+		/* buffer mode: the printout overwrites the command line */
+		(void)clios_strncpy(term, p_cmd, sizeof(term) - 1);
+		term[sizeof(term) - 1] = '\0';
+		if (core_printf(p_print, "errorcode=0" CLI_CRLF) != IFX_SUCCESS)
+			return p_print->out_size;
+
+		apropos_print.p_core_ctx = p_core_ctx;
+		apropos_print.p_print = p_print;
+		apropos_print.n_listed = 0;
+		(void)cli_apropos_find(p_core_ctx->p_apropos, term,
+			apropos_usage_match, apropos_result_print, &apropos_print);
+	}
+
+	return p_print->out_size;
+}
+
+#ifndef CLI_DEBUG_DISABLE
+static const char g_cli_apropos_usage[] =
+	"Long Form: apropos" CLI_CRLF "Short Form: apro" CLI_CRLF
+	CLI_CRLF
+	"Input Parameter" CLI_CRLF
+	"- char word[] (one or more search words, case insensitive)" CLI_CRLF
+	CLI_CRLF
+	"Output Parameter" CLI_CRLF
+	"- int errorcode" CLI_CRLF
+	"- per command containing all words (name or usage text):" CLI_CRLF
+	"  short name, long name (limited number of commands)" CLI_CRLF CLI_CRLF;
+#else
+static const char g_cli_apropos_usage[] = "";
+#endif
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+CLI_STATIC int cli_core_cmd_apropos__buffer(
+	void *p_ctx,
+	const char *p_cmd,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+	int ret = 0;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = cli_check_help__buffer(p_cmd, g_cli_apropos_usage, bufsize_max, p_out)) >= 0)
+		return ret;
+
+	print.p_out = p_out;
+	print.buf_size = bufsize_max;
+
+	return apropos_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif /* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+CLI_STATIC int cli_core_cmd_apropos__file(
+	void *p_ctx,
+	const char *p_cmd,
+	clios_file_io_t *p_out_file)
+{
+	int ret = 0;
+	clios_file_t *p_file = (clios_file_t *)p_out_file;
+	struct cli_core_print_s print = {IFX_NULL, IFX_NULL, 0, 0};
+
+	if ((ret = check_help__file(p_cmd, g_cli_apropos_usage, p_file)) > 0)
+		return ret;
+
+	print.p_file = p_file;
+
+	return apropos_cmd_exec((struct cli_core_context_s *)p_ctx, p_cmd, &print);
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_APROPOS == 1) */
+
+int cli_sscanf(const char *buf, char const *fmt, ...)
+{
+#ifndef _lint
+	va_list marker;
+#endif
+	char const *p;
+	char const *a;
+	char *r = IFX_NULL;
+	const char *s = buf;
+	int ret = 0, mode = 32, base = 0, array_cnt = 0, i;
+	long string_width = 0;
+	long long int *v64 = IFX_NULL;
+	int *v32 = IFX_NULL;
+	short *v16 = IFX_NULL;
+	char *v8 = IFX_NULL;
+	unsigned long long int *vu64 = IFX_NULL;
+	unsigned int *vu32 = IFX_NULL;
+	unsigned short *vu16 = IFX_NULL;
+	unsigned char *vu8 = IFX_NULL;
+#if (CLI_HAVE_FLOAT == 1)
+	float *f = IFX_NULL;
+#endif
+
+#ifndef _lint
+	va_start(marker, fmt);
+#endif
+
+	if (s == IFX_NULL) {
+		/*lint -save -e(801) */
+		goto SF_END;
+		/*lint -restore */
+	}
+
+	for (p = fmt; *p; p++) {
+		if (*p != '%')
+			continue;
+
+		if (s == IFX_NULL) {
+			/*lint -save -e(801) */
+			goto SF_END;
+			/*lint -restore */
+		}
+
+		/* skip spaces and tabs */
+		while ((*s == ' ') || (*s == '\t'))
+			s++;
+
+		if (*s == 0) {
+			/*lint -save -e(801) */
+			goto SF_END;
+			/*lint -restore */
+		}
+
+		if (isdigit(*(p + 1))) {
+			char *ptr;
+			if (*++p == '0') {
+				/*lint -save -e(801) */
+				goto SF_END;
+				/*lint -restore */
+			}
+			string_width = CLI_STRTOL(p, &ptr, 10);
+			p = ptr;
+			a = NULL;
+			array_cnt = 0;
+		} else {
+			switch (*++p) {
+			case 0:
+				/* ret = 0; */
+				/*lint -save -e(801) */
+				goto SF_END;
+				/*lint -restore */
+
+				/* 8 bit */
+			case 'b':
+				mode = 8;
+				p++;
+				break;
+
+				/* 16 bit */
+			case 'h':
+				mode = 16;
+				p++;
+				break;
+
+				/* 32 or 64 bit */
+			case 'l':
+				/* The C standard says this should be size of long,
+				 * long is 64 bit on Linux 64 bit systems and 32 bit
+				 * on Windows 64 Bit systems. On 32 bit systems this
+				 * is normally 32 bit long.
+				 */
+				mode = sizeof(long int) * 8;
+				p++;
+				/* 64 bit (for ll) */
+				if (*p == 'l') {
+					mode = 64;
+					p++;
+				}
+				break;
+
+				/* 32 bit (sizeof(int)) by default */
+			default:
+				mode = 32;
+				break;
+			}
+
+			switch (*p) {
+			case 'd':
+			case 'i':
+			case 'u':
+				base = 0;
+				break;
+
+			case 'x':
+				base = 16;
+				break;
+
+			default:
+				break;
+			}
+
+			a = p + 1;
+			i = 0;
+
+			array_cnt = 1;
+
+			switch (*a) {
+			case '[':
+				a++;
+				if (*a) {
+					array_cnt = (char)CLI_STRTOL(a, IFX_NULL, 10);
+					if (array_cnt > 256)
+						array_cnt = 0;
+					do {
+						a++;
+					} while (*a && (*a != ']'));
+				}
+				break;
+
+			default:
+				break;
+			}
+		}
+
+		switch (*p) {
+		case 0:
+			/* ret = 0; */
+			/*lint -save -e(801) */
+			goto SF_END;
+			/*lint -restore */
+
+#if 1
+			/* string */
+		case 's':
+			{
+#ifndef _lint
+				r = va_arg(marker, char *);
+#endif
+				if (r != IFX_NULL) {
+					const char *q = s;
+
+					do {
+						if ((*q == ' ') || (*q == '\t'))
+							q++;
+						else
+							break;
+					} while (*q);
+					if (*q) {
+						if (string_width == 0)
+							string_width = strlen(q);
+						do {
+							if ((*q != ' ')
+							    && (*q != '\t')
+							    && (*q != '\n')
+							    && (*q != '\r'))
+								*r++ = *q++;
+							else
+								break;
+							string_width--;
+						} while (string_width > 0 && *q);
+						s = q;
+						*r = 0;
+						ret++;
+					}
+				}
+				break;
+			}
+
+#else
+			/* string */
+		case 's':
+			{
+#ifndef _lint
+				r = va_arg(marker, char *);
+#endif
+				if (r != IFX_NULL) {
+					const char *q = s;
+
+					do {
+						if ((*q == ' ') || (*q == '\t'))
+							q++;
+					} while (*q);
+
+					if (*q) {
+						strcpy(r, q);
+						ret++;
+					}
+				}
+				break;
+			}
+#endif
+
+#if (CLI_HAVE_FLOAT == 1)
+		case 'f':
+			{
+				switch (mode) {
+				case 32:
+#ifndef _lint
+					f = va_arg(marker, float *);
+#endif
+					if (f != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							f[i] = (float)
+							       strtod(s, &ptr);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+				default:
+					break;
+				}
+				break;
+			}
+#endif	/* #if (CLI_HAVE_FLOAT == 1) */
+
+			/* signed */
+		case 'd':
+		case 'i':
+			{
+				switch (mode) {
+				case 8:
+#ifndef _lint
+					v8 = va_arg(marker, char *);
+#endif
+					if (v8 != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							v8[i] = (char)CLI_STRTOL(s, &ptr, base);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+
+				case 16:
+#ifndef _lint
+					v16 = va_arg(marker, short *);
+#endif
+					if (v16 != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							v16[i] = (short)CLI_STRTOL(s, &ptr, base);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+
+				case 32:
+#ifndef _lint
+					v32 = va_arg(marker, int *);
+#endif
+					if (v32 != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							v32[i] = (int)CLI_STRTOL(s, &ptr, base);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+
+				case 64:
+#ifndef _lint
+					v64 = va_arg(marker, long long int *);
+#endif
+					if (v64 != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							v64[i] = (long long int)CLI_STRTOLL(s, &ptr, base);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+				default:
+					break;
+				}
+				break;
+			}
+
+			/* unsigned */
+		case 'u':
+			/* hexadecimal */
+		case 'x':
+			{
+				switch (mode) {
+				case 8:
 #ifndef _lint
-					f = va_arg(marker, float *);
+					vu8 = va_arg(marker, unsigned char *);
+#endif
+					if (vu8 != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							vu8[i] = (unsigned char)CLI_STRTOUL(s, &ptr, base);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+
+				case 16:
+#ifndef _lint
+					vu16 = va_arg(marker, unsigned short *);
+#endif
+					if (vu16 != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							vu16[i] = (unsigned short)CLI_STRTOUL(s, &ptr, base);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+
+				case 32:
+#ifndef _lint
+					vu32 = va_arg(marker, unsigned int *);
+#endif
+					if (vu32 != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							vu32[i] = (unsigned int)CLI_STRTOUL(s, &ptr, base);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+
+				case 64:
+#ifndef _lint
+					vu64 = va_arg(marker, unsigned long long int *);
+#endif
+					if (vu64 != IFX_NULL) {
+						for (i = 0; i < array_cnt; i++) {
+							char *ptr = IFX_NULL;
+
+							vu64[i] = (unsigned long long int)CLI_STRTOULL(s, &ptr, base);
+							s = ptr;
+						}
+						ret++;
+					}
+					break;
+
+				default:
+					break;
+				}
+				break;
+
+			}
+		default:
+			break;
+		}
+
+		if (array_cnt > 1)
+			p = a;
+	}
+
+SF_END:
+
+#ifndef _lint
+	va_end(marker);
+#endif
+
+	return ret;
+}
+
+int cli_core_group_release(
+	struct cli_core_context_s *p_core_ctx)
+{
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (p_core_ctx->group.pp_group_list != IFX_NULL)
+		clios_memfree((void *)p_core_ctx->group.pp_group_list);
+
+	if (p_core_ctx->group.p_key_entries != IFX_NULL)
+		clios_memfree(p_core_ctx->group.p_key_entries);
+
+#	if (CLI_SUPPORT_GROUP_INDEX == 1)
+	if (p_core_ctx->group.p_trie != IFX_NULL)
+		clios_memfree(p_core_ctx->group.p_trie);
+	group_index_release(&p_core_ctx->group);
+#	endif
+
+	clios_memset(&p_core_ctx->group, 0x00, sizeof(struct cli_group_s));
+
+	return IFX_SUCCESS;
+}
+
+int cli_core_cfg_cmd_shutdown(
+	struct cli_core_context_s *p_core_ctx,
+	enum cli_cmd_core_out_mode_e out_mode)
+{
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (core_out_mode_check(out_mode))
+	{
+		/* invalid outmode */
+		return IFX_ERROR;
+	}
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->n_refs > 0)
+	{
+		/* the command table is in use (clones, sessions) */
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: shutdown - command table in use" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	p_core_ctx->cmd_core.e_state = e_cli_cmd_core_delete;
+#	if (CLI_SUPPORT_HELP_CACHE == 1)
+	help_cache_invalidate(p_core_ctx);
+#	endif
+	p_core_ctx->cmd_core.p_root = IFX_NULL;
+	if (p_core_ctx->cmd_core.p_node_array)	/* not set if this is a clone */
+		clios_memfree(p_core_ctx->cmd_core.p_node_array);
+#	if (CLI_SUPPORT_STATS == 1)
+	(void)cli_stats_release(&p_core_ctx->p_stats);
+#	endif
+#	if (CLI_SUPPORT_GROUP_INDEX == 1)
+	/* the command lists are shared with the clones */
+	if (p_core_ctx->p_cli_core_parent == IFX_NULL)
+		group_index_release(&p_core_ctx->group);
+#	endif
+#	if (CLI_SUPPORT_APROPOS == 1)
+	/* the index is shared with the clones */
+	if (p_core_ctx->p_cli_core_parent == IFX_NULL)
+		(void)cli_apropos_release(&p_core_ctx->p_apropos);
+	else
+		p_core_ctx->p_apropos = IFX_NULL;
+#	endif
+#	if (CLI_SUPPORT_NAMESPACE == 1)
+	/* the namespace (the long names of the path commands) is shared with the clones */
+	if (p_core_ctx->p_cli_core_parent == IFX_NULL)
+		(void)cli_ns_release(&p_core_ctx->p_ns);
+	else
+		p_core_ctx->p_ns = IFX_NULL;
+#	endif
+
+	clios_memset(&p_core_ctx->cmd_core, 0x0, sizeof(struct cli_cmd_core_s));
+	p_core_ctx->cmd_core.out_mode = out_mode;
+	p_core_ctx->cmd_core.e_state = e_cli_cmd_core_count;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	return IFX_SUCCESS;
+}
+
+int cli_core_cfg_mode_cmd_reg(
+	struct cli_core_context_s *p_core_ctx)
+{
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+
+	if (p_core_ctx->cmd_core.e_state != e_cli_cmd_core_count)
+	{
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		/* invalid core mode */
+		return IFX_ERROR;
+	}
+
+	if (p_core_ctx->cmd_core.n_nodes == 0)
+	{
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		/* no registered commands */
+		return IFX_ERROR;
+	}
+
+	p_core_ctx->cmd_core.p_node_array =
+		clios_memalloc(p_core_ctx->cmd_core.n_nodes * sizeof(struct cli_cmd_node_s));
+
+	if (!p_core_ctx->cmd_core.p_node_array)
+	{
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		/* mem alloc */
+		return IFX_ERROR;
+	}
+	clios_memset(
+		p_core_ctx->cmd_core.p_node_array, 0x0,
+		p_core_ctx->cmd_core.n_nodes * sizeof(struct cli_cmd_node_s));
+
+#	if (CLI_SUPPORT_STATS == 1)
+	/* non fatal - the commands are executed without statistics */
+	(void)cli_stats_init(&p_core_ctx->p_stats, p_core_ctx->cmd_core.n_nodes / 2 + 1);
+#	endif
+#	if (CLI_SUPPORT_GROUP_INDEX == 1)
+	/* non fatal - the help listings walk the tree */
+	(void)group_tags_alloc(&p_core_ctx->group, p_core_ctx->cmd_core.n_nodes / 2);
+#	endif
+
+	p_core_ctx->cmd_core.e_state = e_cli_cmd_core_allocate;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	return IFX_SUCCESS;
+}
+
+int cli_core_cfg_mode_active(
+	struct cli_core_context_s *p_core_ctx)
+{
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+
+	if (p_core_ctx->cmd_core.e_state != e_cli_cmd_core_allocate)
+	{
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		/* invalid core mode */
+		return IFX_ERROR;
+	}
+
+	if (!p_core_ctx->cmd_core.p_node_array || !p_core_ctx->cmd_core.p_root)
+	{
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		/* no registered commands */
+		return IFX_ERROR;
+	}
+
+#	if (CLI_SUPPORT_HELP_CACHE == 1)
+	/* the command set is complete, render the listings on the next help */
+	help_cache_invalidate(p_core_ctx);
+#	endif
+#	if (CLI_SUPPORT_GROUP_INDEX == 1)
+	/* non fatal - the help listings walk the tree */
+	(void)group_index_build(&p_core_ctx->group, p_core_ctx->cmd_core.p_root);
+#	endif
+#	if (CLI_SUPPORT_APROPOS == 1)
+	/* non fatal - no apropos search and no suggestions */
+	(void)apropos_index_build(p_core_ctx);
+#	endif
+	p_core_ctx->cmd_core.e_state = e_cli_cmd_core_active;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	return IFX_SUCCESS;
+}
+
+/** Release a CLI core (no references left), a deferred release of the
+    parent is done with its last clone */
+CLI_STATIC void core_release(
+	struct cli_core_context_s *p_core_ctx,
+	enum cli_cmd_core_out_mode_e out_mode)
+{
+	struct cli_core_context_s *p_parent_release = IFX_NULL;
+
+	(void)cli_core_cfg_cmd_shutdown(p_core_ctx, out_mode);
+#	if (CLI_SUPPORT_JOURNAL == 1)
+	(void)cli_core_journal_close(p_core_ctx);
+#	endif
+#	if (CLI_SUPPORT_RECORD == 1)
+	(void)cli_core_record_stop(p_core_ctx);
+#	endif
+#	if (CLI_SUPPORT_EVENT_LIMIT == 1)
+	(void)cli_event_limit_release(&p_core_ctx->p_event_limit);
+#	endif
+#	if (CLI_SUPPORT_TRACE == 1)
+	(void)trace_file_write(p_core_ctx);
+	p_core_ctx->b_trace = IFX_FALSE;
+	(void)cli_trace_release(&p_core_ctx->p_trace);
+	if (p_core_ctx->p_trace_file != IFX_NULL)
+	{
+		clios_memfree(p_core_ctx->p_trace_file);
+		p_core_ctx->p_trace_file = IFX_NULL;
+	}
+#	endif
+#	if (CLI_SUPPORT_METRICS == 1) || (CLI_SUPPORT_RECORD == 1)
+	if (p_core_ctx->p_file_dir != IFX_NULL)
+	{
+		clios_memfree(p_core_ctx->p_file_dir);
+		p_core_ctx->p_file_dir = IFX_NULL;
+	}
+#	endif
+
+#	if (CLI_SUPPORT_HOOKS == 1)
+	(void)cli_hook_chain_release(&p_core_ctx->p_hooks);
+	(void)cli_hook_chain_release(&p_core_ctx->p_hooks_retired);
+#	endif
+
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	/* the decompression cache is shared with the clones */
+	if (p_core_ctx->p_cli_core_parent == IFX_NULL)
+		(void)cli_help_store_cache_release(&p_core_ctx->p_help_store);
+#	endif
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->p_cli_core_parent != IFX_NULL)
+	{
+		(void)clios_lockget(&p_core_ctx->p_cli_core_parent->lock_ctx);
+
+		clios_memset(&p_core_ctx->group, 0x00, sizeof(struct cli_group_s));
+		if (p_core_ctx->p_cli_core_parent->n_cli_core_clones > 0)
+			{p_core_ctx->p_cli_core_parent->n_cli_core_clones--;}
+		if (p_core_ctx->p_cli_core_parent->n_refs > 0)
+			{p_core_ctx->p_cli_core_parent->n_refs--;}
+		if (p_core_ctx->p_cli_core_parent->b_release &&
+		    (p_core_ctx->p_cli_core_parent->n_refs == 0))
+			{p_parent_release = p_core_ctx->p_cli_core_parent;}
+
+		(void)clios_lockrelease(&p_core_ctx->p_cli_core_parent->lock_ctx);
+		p_core_ctx->p_cli_core_parent = IFX_NULL;
+	}
+	else
+	{
+		(void)cli_core_group_release(p_core_ctx);
+	}
+	p_core_ctx->ctx_size = 0;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+#	if (CLI_SUPPORT_METRICS == 1)
+	if (p_core_ctx->p_metrics_buf != IFX_NULL)
+		clios_memfree(p_core_ctx->p_metrics_buf);
+	(void)clios_lockdelete(&p_core_ctx->lock_metrics);
+#	endif
+#	if (CLI_SUPPORT_JOURNAL == 1)
+	(void)clios_event_delete(&p_core_ctx->event_journal_idle);
+#	endif
+
+	(void)clios_lockdelete(&p_core_ctx->lock_ctx);
+	clios_memfree(p_core_ctx);
+
+	/* the last clone of a released parent */
+	if (p_parent_release != IFX_NULL)
+		core_release(p_parent_release, p_parent_release->release_out_mode);
+}
+
+#if (CLI_SUPPORT_SESSION == 1) || (CLI_SUPPORT_ASYNC == 1)
+/** Drop a reference to the command table (session, asynchronous request),
+    a requested release is done with the last reference */
+CLI_STATIC void core_ref_drop(
+	struct cli_core_context_s *p_core_ctx)
+{
+	IFX_boolean_t b_release;
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	p_core_ctx->n_refs--;
+	b_release = (p_core_ctx->b_release && (p_core_ctx->n_refs == 0)) ?
+		IFX_TRUE : IFX_FALSE;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	if (b_release)
+		core_release(p_core_ctx, p_core_ctx->release_out_mode);
+}
+#endif
+
+int cli_core_release(
+	struct cli_core_context_s **pp_core_ctx,
+	enum cli_cmd_core_out_mode_e out_mode)
+{
+	struct cli_core_context_s *p_core_ctx = *pp_core_ctx;
+	IFX_boolean_t b_deferred;
+
+	if (*pp_core_ctx)
+	{
+		p_core_ctx = *pp_core_ctx;
+		*pp_core_ctx = IFX_NULL;
+
+		/* no new references (clone, session) after the release request */
+		(void)clios_lockget(&p_core_ctx->lock_ctx);
+		p_core_ctx->b_release = IFX_TRUE;
+		p_core_ctx->release_out_mode = out_mode;
+		b_deferred = (p_core_ctx->n_refs > 0) ? IFX_TRUE : IFX_FALSE;
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+		/* released with the last clone / session */
+		if (b_deferred)
+			return IFX_SUCCESS;
+
+		core_release(p_core_ctx, out_mode);
+	}
+
+	return IFX_SUCCESS;
+}
+
+/**
+   Setup the CLI core data
+
+\param
+   p_core_ctx  CLI Core context pointer
+\param
+   out_mode  selects the output mode, printout to buffer or file.
+\param
+   p_user_fct_data  user data, used for the cli user function calls
+
+\return
+   IFX_SUCCESS: success
+   IFX_ERROR: error occured
+
+\remarks
+   Depending on the selected output mode the corresponding user functions must have
+   one of the following form:
+   \ref cli_cmd_user_fct_buf_t for printout to a buffer.
+   \ref cli_cmd_user_fct_file_t for printout to a file.
+*/
+int cli_core_init(
+	struct cli_core_context_s **pp_core_ctx,
+	enum cli_cmd_core_out_mode_e out_mode,
+	void *p_user_fct_data)
+{
+	return core_init(pp_core_ctx, out_mode, p_user_fct_data, 0);
+}
+
+int cli_core_user_group_init(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_group_list[],
+	struct cli_group_key_entry_s const *p_key_entries)
+{
+	IFX_int_t grp_cnt = 0, key_cnt = 0;
+	IFX_uint_t mask = 0;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (p_core_ctx->cmd_core.e_state != e_cli_cmd_core_count)
+	{
+		/* wrong state, already in use */
+		return IFX_ERROR;
+	}
+
+	(void)cli_core_group_release(p_core_ctx);
+#	if (CLI_SUPPORT_HELP_CACHE == 1)
+	/* the help listings contain the group names */
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	help_cache_invalidate(p_core_ctx);
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+#	endif
+	p_core_ctx->group.p_misc_group = CLI_GROUP_MISC_DESCRIPTION;
+	p_core_ctx->group.p_builtin_group = CLI_GROUP_BUILTIN_DESCRIPTION;
+
+	grp_cnt = 0;
+	while (p_group_list[grp_cnt] != IFX_NULL)
+	{
+		grp_cnt++;
+#		if (CLI_SUPPORT_GROUP_INDEX == 1)
+		if (grp_cnt > CLI_GROUP_INDEX_MAX_GROUPS)
+			return IFX_ERROR;
+#		else
+		if (grp_cnt >= CLI_MAX_USER_GROUPS) /* max 15 user groups */
+			return IFX_ERROR;
+#		endif
+	}
+	if (grp_cnt == 0)
+		return IFX_SUCCESS;
+
+	key_cnt = 0;
+	if (p_key_entries)
+	{
+		while (p_key_entries[key_cnt].p_search_key)
+		{
+			if ((IFX_int_t)p_key_entries[key_cnt].group_num >= grp_cnt)
+			{
+				return IFX_ERROR;
+			}
+
+			key_cnt++;
+		}
+	}
+	if (key_cnt == 0)
+		return IFX_SUCCESS;
+
+	p_core_ctx->group.pp_group_list = clios_memalloc(grp_cnt * sizeof(char *));
+	p_core_ctx->group.p_key_entries = clios_memalloc(key_cnt * sizeof(struct cli_group_key_entry_s));
+	if ((p_core_ctx->group.pp_group_list == IFX_NULL) ||
+	    (p_core_ctx->group.p_key_entries == IFX_NULL) )
+	{
+		(void)cli_core_group_release(p_core_ctx);
+		return IFX_ERROR;
+	}
+	p_core_ctx->group.n_reg_groups = grp_cnt;
+	p_core_ctx->group.n_key_entries = key_cnt;
+
+	mask = 0;
+	grp_cnt = 0;
+	while (p_group_list[grp_cnt] != IFX_NULL)
+	{
+		p_core_ctx->group.pp_group_list[grp_cnt] = p_group_list[grp_cnt];
+		/* the groups beyond the selection mask are only kept as tag */
+		if (grp_cnt < CLI_MAX_USER_GROUPS)
+			mask |= (0x1 << grp_cnt);
+		grp_cnt++;
+	}
+	p_core_ctx->group.reg_group_mask = mask;
+
+	key_cnt = 0;
+	while (p_key_entries[key_cnt].p_search_key != IFX_NULL)
+	{
+		p_core_ctx->group.p_key_entries[key_cnt].group_num = p_key_entries[key_cnt].group_num;
+		p_core_ctx->group.p_key_entries[key_cnt].p_search_key = p_key_entries[key_cnt].p_search_key;
+		key_cnt++;
+	}
+
+#	if (CLI_SUPPORT_GROUP_INDEX == 1)
+	if (group_trie_build(&p_core_ctx->group) != IFX_SUCCESS)
+	{
+		(void)cli_core_group_release(p_core_ctx);
+		return IFX_ERROR;
+	}
+#	endif
+
+	return IFX_SUCCESS;
+}
+
+int cli_core_cmd_group_add(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_long_name,
+	unsigned int group_num)
+{
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+	struct cli_cmd_data_s cmd_data;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if ((p_long_name == IFX_NULL) ||
+	    (p_core_ctx->cmd_core.e_state != e_cli_cmd_core_allocate) ||
+	    (p_core_ctx->group.p_cmd_tags == IFX_NULL) ||
+	    (group_num >= (unsigned int)p_core_ctx->group.n_reg_groups))
+		return IFX_ERROR;
+
+	if (cmd_core_key_find(&p_core_ctx->cmd_core, p_long_name, &cmd_data) != e_cli_status_ok)
+		return IFX_ERROR;
+
+	group_tag_set(&p_core_ctx->group, cmd_data.cmd_idx, group_num);
+
+	return IFX_SUCCESS;
+#else
+	(void)p_core_ctx;
+	(void)p_long_name;
+	(void)group_num;
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_buildin_register(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int select_mask)
+{
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	switch(p_core_ctx->cmd_core.out_mode)
+	{
+	case cli_cmd_core_out_mode_buffer:
+#		if (CLI_SUPPORT_BUFFER_OUT == 1)
+		if (select_mask & CLI_BUILDIN_REG_HELP) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"help", "Help", cli_core_cmd_help__buffer, IFX_NULL);
+		}
+		if (select_mask & CLI_BUILDIN_REG_QUIT) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"quit", "Quit", cli_core_cmd_quit__buffer, IFX_NULL);
+		}
+		if (select_mask & CLI_BUILDIN_REG_WHAT) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"what", "what_string", cli_core_cmd_what__buffer, IFX_NULL);
+		}
+#		if (CLI_SUPPORT_JOURNAL == 1)
+		if (select_mask & CLI_BUILDIN_REG_JOURNAL) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"journal", "journal_replay", cli_core_cmd_journal__buffer, IFX_NULL);
+		}
+#		endif
+#		if (CLI_SUPPORT_EVENT_LIMIT == 1)
+		if (select_mask & CLI_BUILDIN_REG_EVENT_LIMIT) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"evl", "event_limit", cli_core_cmd_event_limit__buffer, IFX_NULL);
+		}
+#		endif
+#		if (CLI_SUPPORT_STATS == 1)
+		if (select_mask & CLI_BUILDIN_REG_STATS) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"stats", "statistics", cli_core_cmd_stats__buffer, IFX_NULL);
+		}
+#		endif
+#		if (CLI_SUPPORT_TRACE == 1)
+		if (select_mask & CLI_BUILDIN_REG_TRACE) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"trc", "trace", cli_core_cmd_trace__buffer, IFX_NULL);
+		}
+#		endif
+#		if (CLI_SUPPORT_METRICS == 1)
+		if (select_mask & CLI_BUILDIN_REG_METRICS) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"met", "metrics", cli_core_cmd_metrics__buffer, IFX_NULL);
+		}
+#		endif
+#		if (CLI_SUPPORT_RECORD == 1)
+		if (select_mask & CLI_BUILDIN_REG_RECORD) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"rec", "record", cli_core_cmd_record__buffer, IFX_NULL);
+		}
+#		endif
+#		if (CLI_SUPPORT_STRUCT_OUT == 1)
+		if (select_mask & CLI_BUILDIN_REG_FORMAT) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"fmt", "format", cli_core_cmd_format__buffer, IFX_NULL);
+		}
+#		endif
+#		if (CLI_SUPPORT_APROPOS == 1)
+		if (select_mask & CLI_BUILDIN_REG_APROPOS) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"apro", "apropos", cli_core_cmd_apropos__buffer, IFX_NULL);
+		}
+#		endif
+#		else
+		CLI_USR_ERR(LIB_CLI,
+			("ERR CLI Core: register build-in - buffer printout mode not supported" CLI_CRLF));
+		return IFX_ERROR;
+#		endif
+		break;
+
+	case cli_cmd_core_out_mode_file:
+#		if (CLI_SUPPORT_FILE_OUT == 1)
+		if (select_mask & CLI_BUILDIN_REG_HELP) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"help", "Help", IFX_NULL, cli_core_cmd_help__file);
+		}
+		if (select_mask & CLI_BUILDIN_REG_QUIT) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"quit", "Quit", IFX_NULL, cli_core_cmd_quit__file);
+		}
+		if (select_mask & CLI_BUILDIN_REG_WHAT) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"what", "what_string", IFX_NULL, cli_core_cmd_what__file);
+		}
+#		if (CLI_SUPPORT_JOURNAL == 1)
+		if (select_mask & CLI_BUILDIN_REG_JOURNAL) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"journal", "journal_replay", IFX_NULL, cli_core_cmd_journal__file);
+		}
+#		endif
+#		if (CLI_SUPPORT_EVENT_LIMIT == 1)
+		if (select_mask & CLI_BUILDIN_REG_EVENT_LIMIT) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"evl", "event_limit", IFX_NULL, cli_core_cmd_event_limit__file);
+		}
+#		endif
+#		if (CLI_SUPPORT_STATS == 1)
+		if (select_mask & CLI_BUILDIN_REG_STATS) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"stats", "statistics", IFX_NULL, cli_core_cmd_stats__file);
+		}
+#		endif
+#		if (CLI_SUPPORT_TRACE == 1)
+		if (select_mask & CLI_BUILDIN_REG_TRACE) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"trc", "trace", IFX_NULL, cli_core_cmd_trace__file);
+		}
+#		endif
+#		if (CLI_SUPPORT_METRICS == 1)
+		if (select_mask & CLI_BUILDIN_REG_METRICS) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"met", "metrics", IFX_NULL, cli_core_cmd_metrics__file);
+		}
+#		endif
+#		if (CLI_SUPPORT_RECORD == 1)
+		if (select_mask & CLI_BUILDIN_REG_RECORD) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"rec", "record", IFX_NULL, cli_core_cmd_record__file);
+		}
+#		endif
+#		if (CLI_SUPPORT_STRUCT_OUT == 1)
+		if (select_mask & CLI_BUILDIN_REG_FORMAT) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"fmt", "format", IFX_NULL, cli_core_cmd_format__file);
+		}
+#		endif
+#		if (CLI_SUPPORT_APROPOS == 1)
+		if (select_mask & CLI_BUILDIN_REG_APROPOS) {
+			(void)cmd_core_key_add(
+				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
+				"apro", "apropos", IFX_NULL, cli_core_cmd_apropos__file);
+		}
+#		endif
+#		else
+		CLI_USR_ERR(LIB_CLI,
+			("ERR CLI Core: register build-in - file printout mode not supported" CLI_CRLF));
+		return IFX_ERROR;
+#		endif
+		break;
+
+	default:
+		CLI_USR_ERR(LIB_CLI,
+			("ERR CLI Core: register build-in - unknown printout mode" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	return IFX_SUCCESS;
+}
+
+
+int cli_core_key_add__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int group_mask,
+	char const *p_short_name,
+	char const *p_long_name,
+	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf)
+{
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	int ret, group;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	group_mask = user_group_mask_get(p_core_ctx, group_mask, p_long_name, &group);
+	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_buffer)
+	{
+		ret = cmd_core_key_add(
+				&p_core_ctx->cmd_core, group_mask,
+				p_short_name, p_long_name,
+				cli_cmd_user_fct_buf, IFX_NULL);
+#		if (CLI_SUPPORT_GROUP_INDEX == 1)
+		if ((ret == IFX_SUCCESS) && (group >= 0))
+			group_tag_set(&p_core_ctx->group, p_core_ctx->cmd_core.n_cmds, (unsigned int)group);
+#		endif
+		return ret;
+	}
+	else
+		return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_key_add__file(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int group_mask,
+	char const *p_short_name,
+	char const *p_long_name,
+	cli_cmd_user_fct_file_t cli_cmd_user_fct_file)
+{
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	int ret, group;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	group_mask = user_group_mask_get(p_core_ctx, group_mask, p_long_name, &group);
+	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_file)
+	{
+		ret = cmd_core_key_add(
+				&p_core_ctx->cmd_core, (group_mask & (CLI_USER_MASK_ALL | CLI_CMD_MASK_FLAGS)),
+				p_short_name, p_long_name,
+				IFX_NULL, cli_cmd_user_fct_file);
+#		if (CLI_SUPPORT_GROUP_INDEX == 1)
+		if ((ret == IFX_SUCCESS) && (group >= 0))
+			group_tag_set(&p_core_ctx->group, p_core_ctx->cmd_core.n_cmds, (unsigned int)group);
+#		endif
+		return ret;
+	}
+	else
+		return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_key_add_ext__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_short_name,
+	char const *p_long_name,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf)
+{
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	unsigned int group_mask;
+	int ret, group;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if ((p_meta == IFX_NULL) || (p_meta->p_usage == IFX_NULL))
+		return IFX_ERROR;
+
+	group_mask = user_group_mask_get(p_core_ctx, p_meta->group_mask, p_long_name, &group);
+	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_buffer)
+	{
+		ret = cmd_core_key_meta_add(
+				&p_core_ctx->cmd_core, group_mask,
+				p_short_name, p_long_name, p_meta,
+				cli_cmd_user_fct_buf, IFX_NULL);
+#		if (CLI_SUPPORT_GROUP_INDEX == 1)
+		if ((ret == IFX_SUCCESS) && (group >= 0))
+			group_tag_set(&p_core_ctx->group, p_core_ctx->cmd_core.n_cmds, (unsigned int)group);
+#		endif
+		return ret;
+	}
+	else
+		return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_key_add_ext__file(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_short_name,
+	char const *p_long_name,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_file_t cli_cmd_user_fct_file)
+{
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	unsigned int group_mask;
+	int ret, group;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if ((p_meta == IFX_NULL) || (p_meta->p_usage == IFX_NULL))
+		return IFX_ERROR;
+
+	group_mask = user_group_mask_get(p_core_ctx, p_meta->group_mask, p_long_name, &group);
+	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_file)
+	{
+		ret = cmd_core_key_meta_add(
+				&p_core_ctx->cmd_core, (group_mask & (CLI_USER_MASK_ALL | CLI_CMD_MASK_FLAGS)),
+				p_short_name, p_long_name, p_meta,
+				IFX_NULL, cli_cmd_user_fct_file);
+#		if (CLI_SUPPORT_GROUP_INDEX == 1)
+		if ((ret == IFX_SUCCESS) && (group >= 0))
+			group_tag_set(&p_core_ctx->group, p_core_ctx->cmd_core.n_cmds, (unsigned int)group);
+#		endif
+		return ret;
+	}
+	else
+		return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_key_add_path__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_short_name,
+	char const *p_path,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf)
+{
+#if (CLI_SUPPORT_BUFFER_OUT == 1) && (CLI_SUPPORT_NAMESPACE == 1)
+	unsigned int group_mask;
+	int ret, group;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	group_mask = user_group_mask_get(p_core_ctx,
+		(p_meta != IFX_NULL) ? p_meta->group_mask : 0, p_path, &group);
+	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_buffer)
+	{
+		ret = cmd_ns_key_add(
+				p_core_ctx, group_mask,
+				p_short_name, p_path, p_meta,
+				cli_cmd_user_fct_buf, IFX_NULL);
+#		if (CLI_SUPPORT_GROUP_INDEX == 1)
+		if ((ret == IFX_SUCCESS) && (group >= 0))
+			group_tag_set(&p_core_ctx->group, p_core_ctx->cmd_core.n_cmds, (unsigned int)group);
+#		endif
+		return ret;
+	}
+	else
+		return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_key_add_path__file(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_short_name,
+	char const *p_path,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_file_t cli_cmd_user_fct_file)
+{
+#if (CLI_SUPPORT_FILE_OUT == 1) && (CLI_SUPPORT_NAMESPACE == 1)
+	unsigned int group_mask;
+	int ret, group;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	group_mask = user_group_mask_get(p_core_ctx,
+		(p_meta != IFX_NULL) ? p_meta->group_mask : 0, p_path, &group);
+	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_file)
+	{
+		ret = cmd_ns_key_add(
+				p_core_ctx, (group_mask & (CLI_USER_MASK_ALL | CLI_CMD_MASK_FLAGS)),
+				p_short_name, p_path, p_meta,
+				IFX_NULL, cli_cmd_user_fct_file);
+#		if (CLI_SUPPORT_GROUP_INDEX == 1)
+		if ((ret == IFX_SUCCESS) && (group >= 0))
+			group_tag_set(&p_core_ctx->group, p_core_ctx->cmd_core.n_cmds, (unsigned int)group);
+#		endif
+		return ret;
+	}
+	else
+		return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_cmd_exec__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	const unsigned int buffer_size)
+{
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_buffer)
+		return cmd_parse_execute(
+		p_core_ctx, p_cmd_arg_buf, buffer_size, IFX_NULL, IFX_NULL);
+	else
+		return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+/** Cursor of a continued buffer mode execution */
+struct cli_exec_cursor_s
+{
+	/** return value of the execution (CLI_EXEC_TRUNCATED: output cut) */
+	int ret;
+	/** length of the output */
+	unsigned int len;
+	/** read position of the next chunk */
+	unsigned int pos;
+	/** output (same allocation) */
+	char *p_buf;
+};
+
+/** Copy the next chunk into the user buffer, cut behind the last line end */
+CLI_STATIC void exec_cursor_chunk_get(
+	struct cli_exec_cursor_s *p_cursor,
+	char *p_out,
+	unsigned int out_size)
+{
+	unsigned int n = p_cursor->len - p_cursor->pos, i;
+
+	if (n > out_size - 1)
+	{
+		n = out_size - 1;
+		for (i = n; i > 0; i--)
+		{
+			if (p_cursor->p_buf[p_cursor->pos + i - 1] == '\n')
+			{
+				n = i;
+				break;
+			}
+		}
+	}
+	clios_memcpy(p_out, p_cursor->p_buf + p_cursor->pos, n);
+	p_out[n] = '\0';
+	p_cursor->pos += n;
+}
+#endif	/* #if (CLI_SUPPORT_BUFFER_OUT == 1) */
+
+int cli_core_cmd_exec_cont__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	const unsigned int buffer_size,
+	struct cli_exec_cursor_s **pp_cursor)
+{
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	struct cli_exec_cursor_s *p_cursor;
+	unsigned int size;
+	int ret, b_overflow = 0;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if ((p_cmd_arg_buf == IFX_NULL) || (buffer_size < 2) || (pp_cursor == IFX_NULL))
+		return IFX_ERROR;
+
+	p_cursor = *pp_cursor;
+	if (p_cursor == IFX_NULL)
+	{
+		if (p_core_ctx->cmd_core.out_mode != cli_cmd_core_out_mode_buffer)
+			return IFX_ERROR;
+
+		size = p_core_ctx->exec_cursor_size;
+		if (size == 0)
+			size = CLI_EXEC_CURSOR_BUFFER_SIZE;
+
+		p_cursor = (struct cli_exec_cursor_s *)clios_memalloc(sizeof(*p_cursor) + size);
+		if (p_cursor == IFX_NULL)
+		{
+			CLI_USR_ERR(LIB_CLI,
+				("ERR CLI Core: exec cursor - no memory (%u bytes)" CLI_CRLF, size));
+			return IFX_ERROR;
+		}
+		p_cursor->p_buf = (char *)(p_cursor + 1);
+		p_cursor->pos = 0;
+
+		/* execute once into the cursor buffer */
+		(void)clios_strncpy(p_cursor->p_buf, p_cmd_arg_buf, size - 1);
+		p_cursor->p_buf[size - 1] = '\0';
+		p_cursor->ret = cmd_parse_execute(p_core_ctx, p_cursor->p_buf, size, IFX_NULL, &b_overflow);
+		p_cursor->p_buf[size - 1] = '\0';
+		p_cursor->len = (unsigned int)clios_strlen(p_cursor->p_buf);
+		if ((p_cursor->ret >= 0) && b_overflow)
+		{
+			/* a write was refused, the output was cut */
+			CLI_USR_DBG(LIB_CLI, CLI_PRN_HIGH,
+				("WRN CLI Core: exec cursor - output cut at %u bytes" CLI_CRLF,
+				p_cursor->len));
+			p_cursor->ret = CLI_EXEC_TRUNCATED;
+		}
+	}
+
+	exec_cursor_chunk_get(p_cursor, p_cmd_arg_buf, buffer_size);
+	ret = p_cursor->ret;
+
+	if (p_cursor->pos < p_cursor->len)
+	{
+		*pp_cursor = p_cursor;
+	}
+	else
+	{
+		clios_memfree(p_cursor);
+		*pp_cursor = IFX_NULL;
+	}
+
+	return ret;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_exec_cursor_size_set(
+	struct cli_core_context_s *p_core_ctx,
+	const unsigned int size)
+{
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if ((size != 0) && (size < CLI_EXEC_CURSOR_SIZE_MIN))
+		return IFX_ERROR;
+
+	p_core_ctx->exec_cursor_size = size;
+
+	return IFX_SUCCESS;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+void cli_core_exec_cursor_release(
+	struct cli_exec_cursor_s **pp_cursor)
+{
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	if ((pp_cursor != IFX_NULL) && (*pp_cursor != IFX_NULL))
+	{
+		clios_memfree(*pp_cursor);
+		*pp_cursor = IFX_NULL;
+	}
+#endif
+}
+
+int cli_core_cmd_exec__file(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	clios_file_io_t *p_file_io)
+{
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	clios_file_t *p_file = (clios_file_t *)p_file_io;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_file)
+		return cmd_parse_execute(
+			p_core_ctx, p_cmd_arg_buf, 0, p_file, IFX_NULL);
+	else
+		return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_core_cmd_arg_exec__file(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd,
+	char *p_arg,
+	clios_file_io_t *p_file_io)
+{
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	struct cli_cmd_data_s cmd_data = {IFX_NULL, 0, {IFX_NULL}, 0, IFX_NULL};
+	char dummy_arg[10] = "";
+	struct cli_cmd_meas_s meas;
+	struct cli_exec_ctx_s exec_ctx;
+	enum cli_cmd_status_e status;
+#	if (CLI_SUPPORT_NAMESPACE == 1)
+	struct cli_ns_node_s *p_level = IFX_NULL;
+#	endif
+#	if (CLI_SUPPORT_HOOKS == 1)
+	const struct cli_hook_chain_s *p_hooks;
+#	endif
+	int ret;
+	/* time_t start_time = 0, stop_time = 0;
+	bool start_time_measured = false; */
+	clios_file_t *p_file = (clios_file_t *)p_file_io;
+
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (p_cmd == IFX_NULL || clios_strlen(p_cmd) == 0) {
+		return cli_core_cmd_arg_exec__file(p_core_ctx, "help", IFX_NULL, p_file_io);
+		/* return IFX_ERROR; */
+	}
+
+	p_cmd = remove_whitespaces(p_cmd);
+	if (p_arg != IFX_NULL) {
+		p_arg = remove_whitespaces(p_arg);
+	} else {
+		p_arg = dummy_arg;
+	}
+
+	CLI_CMD_RECORD(p_core_ctx, p_cmd, p_arg);
+
+	status = cmd_core_key_find(&p_core_ctx->cmd_core, p_cmd, &cmd_data);
+#if (CLI_SUPPORT_NAMESPACE == 1)
+	if (status != e_cli_status_ok)
+		status = cmd_ns_find(p_core_ctx, &p_cmd, &p_arg, &cmd_data, &p_level);
+#endif
+
+	switch (status)
+	{
+	case e_cli_status_ok:
+		switch(p_core_ctx->cmd_core.out_mode)
+		{
+		case cli_cmd_core_out_mode_buffer:
+#			if (CLI_SUPPORT_BUFFER_OUT == 1) && 0
+			if (cmd_data.user_fct.buf_out != IFX_NULL)
+				return cmd_data.user_fct.buf_out(p_user_data, p_arg, cmd_buffer_size, p_cmd_buf);
+			else
+				return clios_sprintf(p_cmd_buf,
+					"errorcode=-1 (internal error, no function pointer) CLI_CRLF");
+#			else
+			CLI_USR_ERR(LIB_CLI,
+				("ERR CLI Core: exec - buffer printout not supported" CLI_CRLF));
+			return IFX_ERROR;
+#			endif
+		case cli_cmd_core_out_mode_file:
+#			if (CLI_SUPPORT_FILE_OUT == 1)
+			if (cmd_data.user_fct.file_out != IFX_NULL)
+			{
+				/* help request answered by the core, no handler round-trip */
+				if (((cmd_data.p_meta != IFX_NULL) || (CLI_CORE_HELP_STORE(p_core_ctx) != IFX_NULL)) &&
+				    cmd_check_help(p_arg))
+				{
+					ret = cmd_usage__file(CLI_CORE_HELP_STORE(p_core_ctx), &cmd_data, p_cmd, p_file);
+					if (ret >= 0)
+						return ret;
+				}
+#				if (CLI_SUPPORT_HOOKS == 1)
+				p_hooks = clios_atomic_load(&p_core_ctx->p_hooks);
+				if (p_hooks != IFX_NULL)
+					return cmd_hooked_exec(p_core_ctx, p_hooks, &cmd_data,
+						p_cmd, p_arg, 0, IFX_NULL, p_file, IFX_NULL);
+#				endif
+				CLI_CMD_MEAS_START(p_core_ctx, meas, p_cmd, p_arg);
+				exec_ctx_enter(p_core_ctx, &exec_ctx, p_cmd);
+				ret = cmd_data.user_fct.file_out(
+					exec_ctx_user_data_get(p_core_ctx, &exec_ctx, cmd_data.mask),
+					p_arg, p_file);
+				exec_ctx_leave(&exec_ctx);
+				CLI_CMD_MEAS_STOP(p_core_ctx, meas, cmd_data.cmd_idx, ret, IFX_NULL);
+				return ret;
+			}
+			else
+				return cli_fprintf_spec(p_file,
+					"errorcode=-1 (internal error, no function pointer)" CLI_CRLF);
+#			else
+			CLI_USR_ERR(LIB_CLI,
+				("ERR CLI Core: exec - file printout not supported" CLI_CRLF));
+			return IFX_ERROR;
+#			endif
+		default:
+			CLI_USR_ERR(LIB_CLI,
+				("ERR CLI Core: exec - printout mode unknown" CLI_CRLF));
+			return IFX_ERROR;
+		}
+	default:
+#		if (CLI_SUPPORT_NAMESPACE == 1)
+		if ((p_level == IFX_NULL) || !cmd_check_help(p_arg))
+#		endif
+		{
+			CLI_CMD_MEAS_UNKNOWN(p_core_ctx, meas, p_cmd, p_arg);
+			CLI_CMD_STRUCT_STATUS(IFX_ERROR);
+		}
+#		if (CLI_SUPPORT_NAMESPACE == 1)
+		if (p_level != IFX_NULL)
+			return cmd_ns_level_print(p_level, p_arg, IFX_NULL, 0, p_file);
+#		endif
+		switch(p_core_ctx->cmd_core.out_mode)
+		{
+		case cli_cmd_core_out_mode_buffer:
+#			if (CLI_SUPPORT_BUFFER_OUT == 1) && 0
+			return clios_sprintf(p_cmd_buf, "errorcode=-1 (unknown command)" CLI_CRLF);
+#			else
+			CLI_USR_ERR(LIB_CLI,
+				("ERR CLI Core: exec - unknown command, printout mode not supported" CLI_CRLF));
+			return IFX_ERROR;
+#			endif
+		case cli_cmd_core_out_mode_file:
+#			if (CLI_SUPPORT_FILE_OUT == 1)
+				return cmd_unknown_print__file(p_core_ctx, p_cmd, p_file);
+#			else
+			CLI_USR_ERR(LIB_CLI,
+				("ERR CLI Core: exec - unknown command, printout mode not supported" CLI_CRLF));
+			return IFX_ERROR;
+#			endif
+		default:
+			CLI_USR_ERR(LIB_CLI,
+				("ERR CLI Core: exec - unknown command, unknown printout mode" CLI_CRLF));
+			return IFX_ERROR;
+		}
+	}
+
+	return IFX_SUCCESS;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_check_help__buffer(
+	const char *p_cmd,
+	const char *p_usage,
+	const unsigned int bufsize_max,
+	char *p_out)
+{
+#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	if (cmd_check_help(p_cmd))
+	{
+		if (clios_strlen(p_usage) < bufsize_max)
+			return clios_sprintf(p_out, "%s", p_usage);
+		else
+			return IFX_SUCCESS;
+	}
+	return IFX_ERROR;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+int cli_check_help__file(
+	const char *p_cmd,
+	const char *p_usage,
+	clios_file_io_t *p_file_io)
+{
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	clios_file_t *p_file = (clios_file_t *)p_file_io;
+
+	return check_help__file(p_cmd, p_usage, p_file);
+#else
+	return IFX_ERROR;
+#endif
+}
+
+/** Setup a CLI interface, therefore the follwoing steps are necessary:
+   - Create the CLI core (cli_core_init)
+   - Count all commands (memory usage), counting mode:
+     --> register built-in commands
+     --> register user commands
+   - Switch to registration mode (allocates memory)
+   - Register all commands (setup binary tree), registration mode:
+     --> register built-in commands
+     --> register user commands
+   - Activate CLI Core
+*/
+int cli_core_setup__file(
+	struct cli_core_context_s **pp_core_ctx,
+	unsigned int builtin_selmask,
+	void *p_user_fct_data,
+	const cli_cmd_register__file cmd_reg_list[])
+{
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	int retval = 0, i = 0;
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+
+	if (!pp_core_ctx)
+	{
+		/* missing args */
+		return IFX_ERROR;
+	}
+
+	if ((cmd_reg_list[0] == IFX_NULL) && (builtin_selmask == 0))
+	{
+		/* no commands */
+		return IFX_ERROR;
+	}
+
+	/* create CLI core */
+	if ((retval = core_init(
+			&p_core_ctx, cli_cmd_core_out_mode_file,
+			p_user_fct_data, 0)) != IFX_SUCCESS)
+		return retval;
+
+	/* count built-in commands (help, quit) */
+	if (builtin_selmask != 0) {
+		if ((retval = cli_core_buildin_register(
+				p_core_ctx, builtin_selmask)) != IFX_SUCCESS)
+			goto CLI_CORE_SETUP__FILE_ERR;
+	}
+	/* count user commands */
+	i = 0;
+	while (cmd_reg_list[i])  {
+		if ((retval = cmd_reg_list[i](p_core_ctx)) != IFX_SUCCESS)
+			break;
+		i++;
+	}
+	if (retval != IFX_SUCCESS)
+		goto CLI_CORE_SETUP__FILE_ERR;
+
+	/* switch to registration mode */
+	if ((retval = cli_core_cfg_mode_cmd_reg(p_core_ctx)) != IFX_SUCCESS)
+		goto CLI_CORE_SETUP__FILE_ERR;
+
+	/* register built-in commands (help, quit) */
+	if (builtin_selmask != 0) {
+		if ((retval = cli_core_buildin_register(
+				p_core_ctx, builtin_selmask)) != IFX_SUCCESS)
+			goto CLI_CORE_SETUP__FILE_ERR;
+	}
+	/* count user commands */
+	i = 0;
+	while (cmd_reg_list[i]) {
+		if ((retval = cmd_reg_list[i](p_core_ctx)) != IFX_SUCCESS)
+			break;
+		i++;
+	}
+	if (retval != IFX_SUCCESS)
+		goto CLI_CORE_SETUP__FILE_ERR;
+
+	/* Activate CLI core */
+	if ((retval = cli_core_cfg_mode_active(p_core_ctx)) != IFX_SUCCESS)
+		goto CLI_CORE_SETUP__FILE_ERR;
+
+	*pp_core_ctx = p_core_ctx;
+	return retval;
+
+CLI_CORE_SETUP__FILE_ERR:
+	(void)cli_core_release(&p_core_ctx, cli_cmd_core_out_mode_file);
+	return retval;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+
+/** Setup a CLI interface, based on the given already existing CLI Core:
+   - Create the CLI core (cli_core_init)
+   - takeover the parent settings
+*/
+int cli_core_clone(
+	struct cli_core_context_s *p_core_ctx_parent,
+	struct cli_core_context_s **pp_core_ctx,
+	unsigned int instance_num,
+	void *p_user_fct_data)
+{
+	int retval = 0;
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+
+	if ((pp_core_ctx == IFX_NULL) || (p_core_ctx_parent == IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: clone - missing args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	if ((p_core_ctx_parent->ctx_size != sizeof(struct cli_core_context_s)) ||
+	    (p_core_ctx_parent->cmd_core.e_state != e_cli_cmd_core_active))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: clone - invalid parent state" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	/* create CLI core (for clone) */
+	if ((retval = core_init(
+			&p_core_ctx, p_core_ctx_parent->cmd_core.out_mode,
+			p_user_fct_data, instance_num)) != IFX_SUCCESS)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: clone - core init" CLI_CRLF));
+		return retval;
+	}
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	(void)clios_lockget(&p_core_ctx_parent->lock_ctx);
+
+	if (p_core_ctx_parent->b_release)
+	{
+		(void)clios_lockrelease(&p_core_ctx_parent->lock_ctx);
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		core_release(p_core_ctx, p_core_ctx_parent->cmd_core.out_mode);
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: clone - parent released" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	/* take over cmd core settings from the parent */
+	p_core_ctx->cmd_core.e_state  = p_core_ctx_parent->cmd_core.e_state;
+	p_core_ctx->cmd_core.out_mode = p_core_ctx_parent->cmd_core.out_mode;
+	p_core_ctx->cmd_core.n_nodes  = p_core_ctx_parent->cmd_core.n_nodes;
+	p_core_ctx->cmd_core.n_used_nodes = p_core_ctx_parent->cmd_core.n_used_nodes;
+	p_core_ctx->cmd_core.n_cmds   = p_core_ctx_parent->cmd_core.n_cmds;
+	/* p_core_ctx->cmd_core.p_node_array = p_core_ctx_parent->cmd_core.p_node_array; */
+	p_core_ctx->cmd_core.p_root   = p_core_ctx_parent->cmd_core.p_root;
+#	if (CLI_SUPPORT_HELP_STORE == 1)
+	p_core_ctx->p_help_store      = p_core_ctx_parent->p_help_store;
+#	endif
+#	if (CLI_SUPPORT_APROPOS == 1)
+	p_core_ctx->p_apropos         = p_core_ctx_parent->p_apropos;
+#	endif
+#	if (CLI_SUPPORT_NAMESPACE == 1)
+	p_core_ctx->p_ns              = p_core_ctx_parent->p_ns;
+#	endif
+#	if (CLI_SUPPORT_STATS == 1)
+	/* own statistics for each clone */
+	(void)cli_stats_init(&p_core_ctx->p_stats, p_core_ctx->cmd_core.n_nodes / 2 + 1);
+#	endif
+
+	/* take over cmd core settings from the parent */
+	p_core_ctx->group.n_reg_groups   = p_core_ctx_parent->group.n_reg_groups;
+	p_core_ctx->group.n_key_entries  = p_core_ctx_parent->group.n_key_entries;
+	p_core_ctx->group.pp_group_list  = p_core_ctx_parent->group.pp_group_list;
+	p_core_ctx->group.p_key_entries  = p_core_ctx_parent->group.p_key_entries;
+	p_core_ctx->group.reg_group_mask = p_core_ctx_parent->group.reg_group_mask;
+	p_core_ctx->group.not_reg_group_mask = p_core_ctx_parent->group.not_reg_group_mask;
+	p_core_ctx->group.p_misc_group   = p_core_ctx_parent->group.p_misc_group;
+	p_core_ctx->group.p_builtin_group = p_core_ctx_parent->group.p_builtin_group;
+#	if (CLI_SUPPORT_GROUP_INDEX == 1)
+	p_core_ctx->group.p_trie         = p_core_ctx_parent->group.p_trie;
+	p_core_ctx->group.n_trie_nodes   = p_core_ctx_parent->group.n_trie_nodes;
+	p_core_ctx->group.tag_words      = p_core_ctx_parent->group.tag_words;
+	p_core_ctx->group.n_cmd_tags     = p_core_ctx_parent->group.n_cmd_tags;
+	p_core_ctx->group.p_cmd_tags     = p_core_ctx_parent->group.p_cmd_tags;
+	p_core_ctx->group.p_tag_start    = p_core_ctx_parent->group.p_tag_start;
+	p_core_ctx->group.pp_tag_nodes   = p_core_ctx_parent->group.pp_tag_nodes;
+#	endif
+
+	/* setup parent */
+	p_core_ctx->p_cli_core_parent = p_core_ctx_parent;
+	p_core_ctx_parent->n_cli_core_clones++;
+	p_core_ctx_parent->n_refs++;
+
+	(void)clios_lockrelease(&p_core_ctx_parent->lock_ctx);
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	*pp_core_ctx = p_core_ctx;
+	return retval;
+}
+
+
+
+/** Setup a CLI interface, therefore the follwoing steps are necessary:
+   - Create the CLI core (cli_core_init)
+   - Count all commands (memory usage), counting mode:
+     --> register built-in commands
+     --> register user commands
+   - Switch to registration mode (allocates memory)
+   - Register all commands (setup binary tree), registration mode:
+     --> register built-in commands
+     --> register user commands
+   - Activate CLI Core
+*/
+int cli_core_group_setup__file(
+	struct cli_core_context_s **pp_core_ctx,
+	unsigned int builtin_selmask,
+	void *p_user_fct_data,
+	const cli_cmd_register__file cmd_reg_list[],
+	char const *p_group_list[],
+	struct cli_group_key_entry_s const *p_key_entries)
+{
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	int retval = 0, i = 0;
+	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+
+	if (!pp_core_ctx)
+	{
+		/* missing args */
+		return IFX_ERROR;
+	}
+
+	if ((cmd_reg_list[0] == IFX_NULL) && (builtin_selmask == 0))
+	{
+		/* no commands */
+		return IFX_ERROR;
+	}
+
+	/* create CLI core */
+	if ((retval = core_init(
+			&p_core_ctx, cli_cmd_core_out_mode_file,
+			p_user_fct_data, 0)) != IFX_SUCCESS)
+		return retval;
+
+	if ((retval = cli_core_user_group_init(p_core_ctx, p_group_list, p_key_entries)) != IFX_SUCCESS)
+		return retval;
+
+	/* count built-in commands (help, quit) */
+	if (builtin_selmask != 0) {
+		if ((retval = cli_core_buildin_register(
+				p_core_ctx, builtin_selmask)) != IFX_SUCCESS)
+			goto CLI_CORE_SETUP__FILE_ERR;
+	}
+	/* count user commands */
+	i = 0;
+	while (cmd_reg_list[i])  {
+		if ((retval = cmd_reg_list[i](p_core_ctx)) != IFX_SUCCESS)
+			break;
+		i++;
+	}
+	if (retval != IFX_SUCCESS)
+		goto CLI_CORE_SETUP__FILE_ERR;
+
+	/* switch to registration mode */
+	if ((retval = cli_core_cfg_mode_cmd_reg(p_core_ctx)) != IFX_SUCCESS)
+		goto CLI_CORE_SETUP__FILE_ERR;
+
+	/* register built-in commands (help, quit) */
+	if (builtin_selmask != 0) {
+		if ((retval = cli_core_buildin_register(
+				p_core_ctx, builtin_selmask)) != IFX_SUCCESS)
+			goto CLI_CORE_SETUP__FILE_ERR;
+	}
+	/* count user commands */
+	i = 0;
+	while (cmd_reg_list[i]) {
+		if ((retval = cmd_reg_list[i](p_core_ctx)) != IFX_SUCCESS)
+			break;
+		i++;
+	}
+	if (retval != IFX_SUCCESS)
+		goto CLI_CORE_SETUP__FILE_ERR;
+
+	/* Activate CLI core */
+	if ((retval = cli_core_cfg_mode_active(p_core_ctx)) != IFX_SUCCESS)
+		goto CLI_CORE_SETUP__FILE_ERR;
+
+	*pp_core_ctx = p_core_ctx;
+	return retval;
+
+CLI_CORE_SETUP__FILE_ERR:
+	(void)cli_core_release(&p_core_ctx, cli_cmd_core_out_mode_file);
+	return retval;
+#else
+	return IFX_ERROR;
+#endif
+}
+
+
+int cli_user_if_register(
+	struct cli_core_context_s *p_core_ctx,
+	void *p_cb_data,
+	cli_exit_callback exit_cb_fct,
+	cli_event_callback event_cb_fct,
+	cli_dump_callback dump_cb_fct,
+	struct cli_user_context_s **pp_user_ctx)
+{
+	IFX_int32_t tout = 0;
+	struct cli_user_context_s *p_user_ctx = IFX_NULL;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+	if (*pp_user_ctx != IFX_NULL)
+	{
+		/* expect NULL pointer */
+		return IFX_ERROR;
+	}
+
+	if ((clios_lockget_timout(
+		&p_core_ctx->lock_ctx, (IFX_uint32_t)-1, &tout) == IFX_SUCCESS)
+	    && (tout == 0))
+	{
+		p_user_ctx = (struct cli_user_context_s *)
+			clios_memalloc(sizeof(struct cli_user_context_s));
+		if (!p_user_ctx)
+		{
+			(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+			/* error mem alloc */
+			return IFX_ERROR;
+		}
+		clios_memset(p_user_ctx, 0x0, sizeof(struct cli_user_context_s));
+		p_user_ctx->p_user_data = p_cb_data;
+		p_user_ctx->exit_cb_fct = exit_cb_fct;
+		p_user_ctx->event_cb_fct = event_cb_fct;
+		p_user_ctx->dump_cb_fct = dump_cb_fct;
+
+		if (p_core_ctx->p_user_head == IFX_NULL) {
+			p_core_ctx->p_user_head = p_user_ctx;
+		} else {
+			struct cli_user_context_s *p_user_list = p_core_ctx->p_user_head;
+			while (p_user_list->p_next != IFX_NULL) {
+				p_user_list = p_user_list->p_next;
+			}
+			p_user_list->p_next = p_user_ctx;
+		}
+
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+	}
+
+	*pp_user_ctx = p_user_ctx;
+
+	return IFX_SUCCESS;
+}
+
+int cli_user_if_unregister(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_user_context_s **pp_user_ctx)
+{
+	IFX_int32_t tout = 0;
+	struct cli_user_context_s *p_user_ctx = IFX_NULL, *p_user_list = IFX_NULL;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+	if (*pp_user_ctx == IFX_NULL)
+	{
+		return IFX_SUCCESS;
+	}
+
+	if ((clios_lockget_timout(
+		&p_core_ctx->lock_ctx, (IFX_uint32_t)-1, &tout) == IFX_SUCCESS)
+	    && (tout == 0))
+	{
+		if (p_core_ctx->p_user_head == *pp_user_ctx)
+		{
+			p_user_ctx = *pp_user_ctx;
+			*pp_user_ctx = IFX_NULL;
+			p_core_ctx->p_user_head = p_user_ctx->p_next;
+		}
+		else
+		{
+			p_user_list = p_core_ctx->p_user_head;
+			while (p_user_list)
+			{
+				if (p_user_list->p_next == *pp_user_ctx)
+				{
+					p_user_ctx = *pp_user_ctx;
+					*pp_user_ctx = IFX_NULL;
+					p_user_list->p_next = p_user_ctx->p_next;
+					break;
+				}
+				p_user_list = p_user_list->p_next;
+			}
+		}
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+		if (p_user_ctx)
+		{
+			clios_memfree(p_user_ctx);
+			return IFX_SUCCESS;
+		}
+
+	}
+
+	return IFX_ERROR;
+}
+
+static int cli_dummy_if_exit(void *p_ctx)
+{
+	struct cli_dummy_interface_s *p_dummy_console = (struct cli_dummy_interface_s *) p_ctx;
+
+	p_dummy_console->b_run = IFX_FALSE;
+
+	return IFX_SUCCESS;
+}
+
+int cli_dummy_if_start(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int sleep_ms)
+{
+	int retval = IFX_SUCCESS;
+	struct cli_dummy_interface_s dummy_if;
+	struct cli_user_context_s *p_user_ctx = IFX_NULL;
+
+	/* ToDo: check if quit cmd is registered */
+
+	dummy_if.b_run = IFX_TRUE;
+	retval = cli_user_if_register(
+		p_core_ctx, (void *)&dummy_if,
+		cli_dummy_if_exit, IFX_NULL, IFX_NULL,
+		&p_user_ctx);
+
+	if (retval != IFX_SUCCESS) {
+		return IFX_ERROR;
+	}
+
+	while (dummy_if.b_run == IFX_TRUE)
+	{
+		clios_sleep_msec(sleep_ms);
+	}
+
+	retval = cli_user_if_unregister(
+		p_core_ctx, &p_user_ctx);
+
+	return retval;
+}
+
+const char *cli_cmd_name_get(struct cli_core_context_s *p_core_ctx)
+{
+#if (CLI_SUPPORT_THREAD_LOCAL == 1)
+	struct cli_exec_ctx_s *p_exec_ctx = g_p_cli_exec_ctx;
+
+	if ((!p_core_ctx) || (p_exec_ctx == IFX_NULL))
+		return IFX_NULL;
+
+	return p_exec_ctx->p_cmd;
+#else
+	if (!p_core_ctx)
+		return IFX_NULL;
+
+	return p_core_ctx->cmd_core.curr_cmd;
 #endif
-					if (f != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
+}
+
+struct cli_exec_ctx_s *cli_exec_ctx_get(void)
+{
+#if (CLI_SUPPORT_THREAD_LOCAL == 1)
+	return g_p_cli_exec_ctx;
+#else
+	return IFX_NULL;
+#endif
+}
+
+void cli_exec_cancel(
+	struct cli_exec_ctx_s *p_exec_ctx)
+{
+	if (p_exec_ctx != IFX_NULL)
+		clios_atomic_store(&p_exec_ctx->b_cancel, 1);
+}
+
+int cli_exec_cancelled(
+	const struct cli_exec_ctx_s *p_exec_ctx)
+{
+#if (CLI_SUPPORT_THREAD_LOCAL == 1)
+	if (p_exec_ctx == IFX_NULL)
+		p_exec_ctx = g_p_cli_exec_ctx;
+#endif
+	if (p_exec_ctx == IFX_NULL)
+		return 0;
+
+	return clios_atomic_load(&p_exec_ctx->b_cancel);
+}
+
+void cli_exec_overflow_set(
+	struct cli_exec_ctx_s *p_exec_ctx)
+{
+#if (CLI_SUPPORT_THREAD_LOCAL == 1)
+	if (p_exec_ctx == IFX_NULL)
+		p_exec_ctx = g_p_cli_exec_ctx;
+#endif
+	if (p_exec_ctx != IFX_NULL)
+		p_exec_ctx->b_overflow = 1;
+}
+
+
+int cli_core_inst_num_get(struct cli_core_context_s *p_core_ctx)
+{
+	if (p_core_ctx != IFX_NULL)
+		{return (int)p_core_ctx->cli_instance_num;}
+
+	return IFX_ERROR;
+}
+
+int cli_core_num_of_clones_get(struct cli_core_context_s *p_core_ctx)
+{
+	if (p_core_ctx != IFX_NULL)
+		{return (int)p_core_ctx->n_cli_core_clones;}
+
+	return IFX_ERROR;
+}
+
+int cli_core_file_dir_set(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_dir)
+{
+#if (CLI_SUPPORT_METRICS == 1) || (CLI_SUPPORT_RECORD == 1)
+	char *p_file_dir = IFX_NULL;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (p_dir != IFX_NULL)
+	{
+		p_file_dir = (char *)clios_memalloc(clios_strlen(p_dir) + 1);
+		if (p_file_dir == IFX_NULL)
+		{
+			CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: file dir set - no memory" CLI_CRLF));
+			return IFX_ERROR;
+		}
+		clios_strcpy(p_file_dir, p_dir);
+	}
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->p_file_dir != IFX_NULL)
+		clios_memfree(p_core_ctx->p_file_dir);
+	p_core_ctx->p_file_dir = p_file_dir;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	return IFX_SUCCESS;
+#else
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+	(void)p_dir;
+
+	return IFX_ERROR;
+#endif
+}
+
+/** Copy the next line of command lines and split the key (same key as the
+   execution, see cmd_parse_execute), long lines are cut.
+
+\return
+   command key, empty for an empty line
+*/
+CLI_STATIC char *cmd_line_key_next(
+	const char **pp_cmd_lines,
+	char *p_line,
+	unsigned int line_size,
+	char **pp_arg)
+{
+	const char *p_cmd_lines = *pp_cmd_lines;
+	char *p_cmd, *p_arg;
+	unsigned int len, n;
+
+	for (len = 0; (p_cmd_lines[len] != '\0') &&
+	     (p_cmd_lines[len] != '\r') && (p_cmd_lines[len] != '\n'); len++)
+		;
+	n = (len < line_size) ? len : line_size - 1;
+	clios_memcpy(p_line, p_cmd_lines, n);
+	p_line[n] = '\0';
+	p_cmd_lines += len;
+	while ((*p_cmd_lines == '\r') || (*p_cmd_lines == '\n'))
+		p_cmd_lines++;
+	*pp_cmd_lines = p_cmd_lines;
+
+	p_cmd = remove_whitespaces(p_line);
+	p_cmd = remove_prefix(p_cmd, "CLI_", 3);
+	for (p_arg = p_cmd; *p_arg; p_arg++)
+	{
+		if (cli_isspace(*p_arg))
+		{
+			*p_arg++ = 0;
+			break;
+		}
+	}
+	*pp_arg = p_arg;
+
+	return p_cmd;
+}
+
+int cli_core_cmd_concurrent_get(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd_lines)
+{
+	char line[CLI_CMD_CONCURRENT_LINE_LEN];
+	struct cli_cmd_data_s cmd_data;
+	enum cli_cmd_status_e status;
+	char *p_cmd, *p_arg;
+#if (CLI_SUPPORT_NAMESPACE == 1)
+	struct cli_ns_node_s *p_level = IFX_NULL;
+#endif
+
+	if ((p_core_ctx == IFX_NULL) || (p_cmd_lines == IFX_NULL))
+		return IFX_FALSE;
+
+	while (*p_cmd_lines != '\0')
+	{
+		p_cmd = cmd_line_key_next(&p_cmd_lines, line, sizeof(line), &p_arg);
+		if (*p_cmd == '\0')
+			continue;
+
+		status = cmd_core_key_find(&p_core_ctx->cmd_core, p_cmd, &cmd_data);
+#if (CLI_SUPPORT_NAMESPACE == 1)
+		if (status != e_cli_status_ok)
+			status = cmd_ns_find(p_core_ctx, &p_cmd, &p_arg, &cmd_data, &p_level);
+#endif
+		if ((status == e_cli_status_ok) &&
+		    ((cmd_data.mask & (CLI_CMD_MASK_CONCURRENT | CLI_INTERN_MASK_BUILTIN)) == 0))
+			return IFX_FALSE;
+	}
+
+	return IFX_TRUE;
+}
+
+int cli_core_cmd_interactive_get(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd_lines)
+{
+	char line[CLI_CMD_CONCURRENT_LINE_LEN];
+	char *p_cmd, *p_arg;
+	unsigned int n_lines = 0;
+#if (CLI_SUPPORT_NAMESPACE == 1)
+	struct cli_cmd_data_s cmd_data;
+	struct cli_ns_node_s *p_level = IFX_NULL;
+#endif
+
+	if ((p_core_ctx == IFX_NULL) || (p_cmd_lines == IFX_NULL))
+		return IFX_FALSE;
+
+	while (*p_cmd_lines != '\0')
+	{
+		p_cmd = cmd_line_key_next(&p_cmd_lines, line, sizeof(line), &p_arg);
+		if (*p_cmd == '\0')
+			continue;
+		n_lines++;
+
+		if ((clios_strcmp(p_cmd, "help") == 0) || (clios_strcmp(p_cmd, "Help") == 0))
+			continue;
+#if (CLI_SUPPORT_NAMESPACE == 1)
+		/* help token after the path of a namespace command */
+		if (cmd_core_key_find(&p_core_ctx->cmd_core, p_cmd, &cmd_data) != e_cli_status_ok)
+			(void)cmd_ns_find(p_core_ctx, &p_cmd, &p_arg, &cmd_data, &p_level);
+#endif
+		if (cmd_check_help(p_arg) != 1)
+			return IFX_FALSE;
+	}
+
+	return (n_lines > 0) ? IFX_TRUE : IFX_FALSE;
+}
+
+#if (CLI_SUPPORT_SESSION == 1)
+/** Wait until the running event callbacks of a session are done, except for
+   the callback of the calling thread (unsubscribe / close from within the
+   callback). Called and returns with lock_ctx held.
+*/
+CLI_STATIC void session_event_calls_wait(
+	struct cli_session_s *p_session)
+{
+	unsigned int n_own = (g_p_cli_session_event == p_session) ? 1 : 0;
+
+	if (p_session->n_event_calls <= n_own)
+		return;
+
+	p_session->n_event_waiters++;
+	while (p_session->n_event_calls > n_own)
+	{
+		(void)clios_lockrelease(&p_session->p_core_ctx->lock_ctx);
+		(void)clios_event_wait(&p_session->event_calls_done, CLI_CORE_WAIT_TIMEOUT, IFX_NULL);
+		(void)clios_lockget(&p_session->p_core_ctx->lock_ctx);
+	}
+	/* one wakeup per signal, pass it on to the next waiter */
+	if (--p_session->n_event_waiters > 0)
+		(void)clios_event_wakeup(&p_session->event_calls_done);
+}
+
+/** Drop a session reference, the last one unlinks the session.
+   Called with lock_ctx held.
+
+\return
+   IFX_TRUE - session unlinked, to be freed by the caller (outside the lock)
+   IFX_FALSE - still referenced.
+*/
+CLI_STATIC IFX_boolean_t session_ref_put(
+	struct cli_session_s *p_session)
+{
+	struct cli_core_context_s *p_core_ctx = p_session->p_core_ctx;
+
+	if (--p_session->n_refs > 0)
+		return IFX_FALSE;
+
+	if (p_session->p_prev != IFX_NULL)
+		p_session->p_prev->p_next = p_session->p_next;
+	else
+		p_core_ctx->p_session_head = p_session->p_next;
+	if (p_session->p_next != IFX_NULL)
+		p_session->p_next->p_prev = p_session->p_prev;
+
+	return IFX_TRUE;
+}
+
+/** Free an unlinked session, a deferred release of the CLI core is done
+   with the last session.
+*/
+CLI_STATIC void session_free(
+	struct cli_session_s *p_session)
+{
+	struct cli_core_context_s *p_core_ctx = p_session->p_core_ctx;
+
+	(void)clios_event_delete(&p_session->event_calls_done);
+	clios_memfree(p_session);
+	core_ref_drop(p_core_ctx);
+}
+
+int cli_session_open(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int inst_num,
+	void *p_user_fct_data,
+	struct cli_session_s **pp_session)
+{
+	struct cli_session_s *p_session;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (pp_session == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Session: open - missing args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_session = (struct cli_session_s *)clios_memalloc(sizeof(struct cli_session_s));
+	if (p_session == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Session: open - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_session, 0x00, sizeof(struct cli_session_s));
+	p_session->p_core_ctx = p_core_ctx;
+	p_session->p_user_fct_data = p_user_fct_data;
+	p_session->inst_num = inst_num;
+	p_session->n_refs = 1;
+	if (clios_event_init(&p_session->event_calls_done) != IFX_SUCCESS)
+	{
+		clios_memfree(p_session);
+		return IFX_ERROR;
+	}
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if ((p_core_ctx->cmd_core.e_state != e_cli_cmd_core_active) || p_core_ctx->b_release)
+	{
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		(void)clios_event_delete(&p_session->event_calls_done);
+		clios_memfree(p_session);
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Session: open - invalid core state" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	p_session->p_next = p_core_ctx->p_session_head;
+	if (p_session->p_next != IFX_NULL)
+		p_session->p_next->p_prev = p_session;
+	p_core_ctx->p_session_head = p_session;
+	p_core_ctx->n_sessions++;
+	p_core_ctx->n_refs++;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	*pp_session = p_session;
+	return IFX_SUCCESS;
+}
+
+int cli_session_close(
+	struct cli_session_s **pp_session)
+{
+	struct cli_session_s *p_session;
+	struct cli_core_context_s *p_core_ctx;
+	IFX_boolean_t b_free;
+
+	if ((pp_session == IFX_NULL) || (*pp_session == IFX_NULL))
+		return IFX_ERROR;
+
+	p_session = *pp_session;
+	*pp_session = IFX_NULL;
+	p_core_ctx = p_session->p_core_ctx;
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	p_session->b_closed = IFX_TRUE;
+	p_session->event_fct = IFX_NULL;
+	session_event_calls_wait(p_session);
+	p_core_ctx->n_sessions--;
+	/* a running event delivery frees the session with its reference */
+	b_free = session_ref_put(p_session);
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	if (b_free == IFX_TRUE)
+		session_free(p_session);
+
+	return IFX_SUCCESS;
+}
+
+int cli_session_subscribe(
+	struct cli_session_s *p_session,
+	cli_session_event_fct_t event_fct,
+	void *p_data)
+{
+	if (p_session == IFX_NULL)
+		return IFX_ERROR;
+
+	(void)clios_lockget(&p_session->p_core_ctx->lock_ctx);
+	p_session->event_fct = event_fct;
+	p_session->p_event_data = (event_fct != IFX_NULL) ? p_data : IFX_NULL;
+	/* after an unsubscribe the callback is not running any more */
+	if (event_fct == IFX_NULL)
+		session_event_calls_wait(p_session);
+	(void)clios_lockrelease(&p_session->p_core_ctx->lock_ctx);
+
+	return IFX_SUCCESS;
+}
+
+int cli_session_cmd_exec__buffer(
+	struct cli_session_s *p_session,
+	char *p_cmd_arg_buf,
+	const unsigned int buffer_size)
+{
+	struct cli_session_s *p_outer = g_p_cli_session;
+	int ret;
+
+	if (p_session == IFX_NULL)
+		return IFX_ERROR;
+
+	g_p_cli_session = p_session;
+	ret = cli_core_cmd_exec__buffer(p_session->p_core_ctx, p_cmd_arg_buf, buffer_size);
+	g_p_cli_session = p_outer;
+
+	return ret;
+}
+
+int cli_session_cmd_exec__file(
+	struct cli_session_s *p_session,
+	char *p_cmd_arg_buf,
+	clios_file_io_t *p_file_io)
+{
+	struct cli_session_s *p_outer = g_p_cli_session;
+	int ret;
+
+	if (p_session == IFX_NULL)
+		return IFX_ERROR;
+
+	g_p_cli_session = p_session;
+	ret = cli_core_cmd_exec__file(p_session->p_core_ctx, p_cmd_arg_buf, p_file_io);
+	g_p_cli_session = p_outer;
+
+	return ret;
+}
+
+struct cli_session_s *cli_session_get(void)
+{
+	return (g_p_cli_exec_ctx != IFX_NULL) ? g_p_cli_exec_ctx->p_session : IFX_NULL;
+}
 
-							f[i] = (float)
-							       strtod(s, &ptr);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
-				default:
-					break;
-				}
-				break;
-			}
-#endif	/* #if (CLI_HAVE_FLOAT == 1) */
+unsigned int cli_session_inst_num_get(
+	const struct cli_session_s *p_session)
+{
+	return (p_session != IFX_NULL) ? p_session->inst_num : 0;
+}
 
-			/* signed */
-		case 'd':
-		case 'i':
-			{
-				switch (mode) {
-				case 8:
-#ifndef _lint
-					v8 = va_arg(marker, char *);
-#endif
-					if (v8 != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
+void *cli_session_user_data_get(
+	const struct cli_session_s *p_session)
+{
+	return (p_session != IFX_NULL) ? p_session->p_user_fct_data : IFX_NULL;
+}
 
-							v8[i] = (char)CLI_STRTOL(s, &ptr, base);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
+unsigned int cli_core_num_of_sessions_get(
+	struct cli_core_context_s *p_core_ctx)
+{
+	return (p_core_ctx != IFX_NULL) ? p_core_ctx->n_sessions : 0;
+}
 
-				case 16:
-#ifndef _lint
-					v16 = va_arg(marker, short *);
-#endif
-					if (v16 != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+int cli_session_format_set(
+	struct cli_session_s *p_session,
+	enum cli_struct_format_e format)
+{
+	if ((p_session == IFX_NULL) || ((unsigned int)format > cli_struct_format_jsonl))
+		return IFX_ERROR;
 
-							v16[i] = (short)CLI_STRTOL(s, &ptr, base);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
+	clios_atomic_store_relaxed(&p_session->format, format);
 
-				case 32:
-#ifndef _lint
-					v32 = va_arg(marker, int *);
-#endif
-					if (v32 != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
+	return IFX_SUCCESS;
+}
 
-							v32[i] = (int)CLI_STRTOL(s, &ptr, base);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
+enum cli_struct_format_e cli_session_format_get(
+	const struct cli_session_s *p_session)
+{
+	return (p_session != IFX_NULL) ?
+		clios_atomic_load_relaxed(&p_session->format) : cli_struct_format_text;
+}
+#endif	/* #if (CLI_SUPPORT_STRUCT_OUT == 1) */
+#endif	/* #if (CLI_SUPPORT_SESSION == 1) */
+
+#if (CLI_SUPPORT_ASYNC == 1)
+/** Drop a reference to an asynchronous request, the last one completes
+    the request (output of a deferred handler, completion callback) */
+CLI_STATIC void async_req_unref(
+	struct cli_async_req_s *p_req)
+{
+	struct cli_core_context_s *p_core_ctx = p_req->p_core_ctx;
+	char *p_out = IFX_NULL;
+	unsigned int len = 0;
 
-				case 64:
-#ifndef _lint
-					v64 = va_arg(marker, long long int *);
-#endif
-					if (v64 != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
+	if (clios_atomic_fetch_add(&p_req->n_refs, -1) != 1)
+		return;
 
-							v64[i] = (long long int)CLI_STRTOLL(s, &ptr, base);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
-				default:
-					break;
-				}
-				break;
-			}
+	if (p_req->b_deferred)
+	{
+		if ((cli_out_sink_detach(&p_req->defer_sink, &p_out, &len) == IFX_SUCCESS) &&
+		    (len > 0))
+			(void)cli_out_sink_write(p_req->p_sink, p_out, len);
+		cli_out_sink_buf_free(p_out);
+	}
+	cli_out_sink_release(&p_req->defer_sink);
 
-			/* unsigned */
-		case 'u':
-			/* hexadecimal */
-		case 'x':
-			{
-				switch (mode) {
-				case 8:
-#ifndef _lint
-					vu8 = va_arg(marker, unsigned char *);
+	if (p_req->done_fct != IFX_NULL)
+		p_req->done_fct(p_req->p_user, p_req->status, p_req->p_sink);
+	clios_memfree(p_req);
+
+	/* the last request of a released CLI core */
+	core_ref_drop(p_core_ctx);
+}
+
+/** Job function of an asynchronous request (pool worker) */
+CLI_STATIC int async_job(
+	void *p_data)
+{
+	struct cli_async_req_s *p_req = (struct cli_async_req_s *)p_data;
+	struct cli_async_req_s *p_outer = g_p_cli_async_req;
+#	if (CLI_SUPPORT_TRACE == 1)
+	int session = cli_trace_session_get();
+#	endif
+	int ret;
+
+#	if (CLI_SUPPORT_TRACE == 1)
+	cli_trace_session_set(p_req->session);
+#	endif
+	g_p_cli_async_req = p_req;
+	ret = cli_core_cmd_exec__sink(p_req->p_core_ctx, p_req->line, p_req->p_sink);
+	g_p_cli_async_req = p_outer;
+#	if (CLI_SUPPORT_TRACE == 1)
+	cli_trace_session_set(session);
+#	endif
+
+	return ret;
+}
+
+/** Completion of the job of an asynchronous request (also for a job
+    which was not executed, released pool) */
+CLI_STATIC void async_job_done(
+	void *p_data,
+	int ret)
+{
+	struct cli_async_req_s *p_req = (struct cli_async_req_s *)p_data;
+
+	/* a deferred handler reports the status with cli_cmd_complete */
+	if (!p_req->b_deferred)
+		p_req->status = ret;
+	async_req_unref(p_req);
+}
+
+int cli_core_async_pool_set(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_pool_s *p_pool)
+{
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	clios_atomic_store(&p_core_ctx->p_async_pool, p_pool);
+
+	return IFX_SUCCESS;
+}
+
+int cli_core_cmd_exec_async(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd_line,
+	struct cli_out_sink_s *p_sink,
+	cli_cmd_done_fct_t done_fct,
+	void *p_user)
+{
+	struct cli_async_req_s *p_req;
+	struct cli_pool_s *p_pool;
+	unsigned int len;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if ((p_cmd_line == IFX_NULL) || (p_sink == IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Async: exec - missing args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_pool = clios_atomic_load(&p_core_ctx->p_async_pool);
+	if (p_pool == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Async: exec - no executor pool" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	len = (unsigned int)clios_strlen(p_cmd_line);
+	p_req = (struct cli_async_req_s *)clios_memalloc(sizeof(struct cli_async_req_s) + 2 * len + 1);
+	if (p_req == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Async: exec - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_req, 0x00, sizeof(struct cli_async_req_s));
+	clios_memcpy(p_req->line, p_cmd_line, len + 1);
+	p_req->line_size = len + 1;
+	p_req->p_key = p_req->line + p_req->line_size;
+	p_req->p_core_ctx = p_core_ctx;
+	p_req->p_sink = p_sink;
+	p_req->done_fct = done_fct;
+	p_req->p_user = p_user;
+	p_req->session = cmd_session_get();
+	p_req->n_refs = 1;
+	p_req->status = IFX_ERROR;
+	(void)cli_out_sink_init(&p_req->defer_sink);
+
+	p_req->job.job_fct = async_job;
+	p_req->job.done_fct = async_job_done;
+	p_req->job.p_data = p_req;
+	p_req->job.b_concurrent = cli_core_cmd_concurrent_get(p_core_ctx, p_req->line);
+	/* help requests by the interactive lane, else the session of the caller */
+	if (cli_core_cmd_interactive_get(p_core_ctx, p_req->line) == IFX_TRUE)
+		p_req->job.session = CLI_POOL_SESSION_INTERACTIVE;
+	else
+		p_req->job.session = (p_req->session >= 0) ?
+			(unsigned int)p_req->session : CLI_ASYNC_SESSION;
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if ((p_core_ctx->cmd_core.e_state != e_cli_cmd_core_active) || p_core_ctx->b_release)
+	{
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		cli_out_sink_release(&p_req->defer_sink);
+		clios_memfree(p_req);
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Async: exec - invalid core state" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	p_core_ctx->n_refs++;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	if (cli_pool_submit(p_pool, &p_req->job) != IFX_SUCCESS)
+	{
+		cli_out_sink_release(&p_req->defer_sink);
+		clios_memfree(p_req);
+		core_ref_drop(p_core_ctx);
+		return IFX_ERROR;
+	}
+
+	return IFX_SUCCESS;
+}
+
+struct cli_exec_ctx_s *cli_cmd_defer(void)
+{
+	struct cli_async_req_s *p_req = g_p_cli_async_req;
+	struct cli_exec_ctx_s *p_exec_ctx = g_p_cli_exec_ctx;
+
+	/* only the handler called by the request (not nested), once */
+	if ((p_req == IFX_NULL) || (p_exec_ctx == IFX_NULL) ||
+	    (p_exec_ctx->p_outer != IFX_NULL) || p_req->b_deferred)
+		return IFX_NULL;
+
+	p_req->exec_ctx = *p_exec_ctx;
+	p_req->exec_ctx.p_sink = &p_req->defer_sink;
+	if (p_exec_ctx->p_cmd != IFX_NULL)
+	{
+		/* the key is not longer than the command line */
+		(void)clios_strncpy(p_req->p_key, p_exec_ctx->p_cmd, p_req->line_size - 1);
+		p_req->p_key[p_req->line_size - 1] = '\0';
+		p_req->exec_ctx.p_cmd = p_req->p_key;
+	}
+	p_req->b_deferred = IFX_TRUE;
+	(void)clios_atomic_fetch_add(&p_req->n_refs, 1);
+
+	return &p_req->exec_ctx;
+}
+
+int cli_cmd_complete(
+	struct cli_exec_ctx_s *p_exec_ctx,
+	int status)
+{
+	struct cli_async_req_s *p_req;
+
+	if (p_exec_ctx == IFX_NULL)
+		return IFX_ERROR;
+
+	p_req = (struct cli_async_req_s *)p_exec_ctx;
+	if (!p_req->b_deferred)
+		return IFX_ERROR;
+
+	p_req->status = status;
+	async_req_unref(p_req);
+
+	return IFX_SUCCESS;
+}
+#endif	/* #if (CLI_SUPPORT_ASYNC == 1) */
+
+void cli_traverse(struct cli_core_context_s *p_core_ctx,
+		  int (*handler)(const char *s, void *user_data),
+		  void *user_data)
+{
+#if (CLI_SUPPORT_AUTO_COMPLETION == 1)
+	struct cli_cmd_node_s *curr = p_core_ctx->cmd_core.p_root;
+
+	cli_traverse_node(curr, handler, user_data);
+#	if (CLI_SUPPORT_NAMESPACE == 1)
+	/* path commands: the first level only */
+	(void)cli_traverse_level(p_core_ctx, IFX_NULL, handler, user_data);
+#	endif
+#else
+	return;
 #endif
-					if (vu8 != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
+}
 
-							vu8[i] = (unsigned char)CLI_STRTOUL(s, &ptr, base);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
+int cli_traverse_level(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_path,
+	int (*handler)(const char *s, void *user_data),
+	void *user_data)
+{
+#if (CLI_SUPPORT_NAMESPACE == 1)
+	const struct cli_ns_node_s *p_level;
+	unsigned int i, len;
 
-				case 16:
-#ifndef _lint
-					vu16 = va_arg(marker, unsigned short *);
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if ((p_core_ctx->p_ns == IFX_NULL) || (handler == IFX_NULL))
+		return IFX_ERROR;
+
+	p_level = &p_core_ctx->p_ns->root;
+	while ((p_path != IFX_NULL) && (p_level != IFX_NULL))
+	{
+		while (cli_isspace(*p_path))
+			p_path++;
+		for (len = 0; (p_path[len] != '\0') && !cli_isspace(p_path[len]); len++)
+			;
+		if (len == 0)
+			break;
+		p_level = cli_ns_child_find(p_level, p_path, len);
+		p_path += len;
+	}
+	if (p_level == IFX_NULL)
+		return IFX_ERROR;
+
+	for (i = 0; i < p_level->n_child; i++)
+		if (handler(p_level->pp_child[i]->p_token, user_data))
+			break;
+
+	return IFX_SUCCESS;
+#else
+	(void)p_core_ctx;
+	(void)p_path;
+	(void)handler;
+	(void)user_data;
+	return IFX_ERROR;
 #endif
-					if (vu16 != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
+}
 
-							vu16[i] = (unsigned short)CLI_STRTOUL(s, &ptr, base);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
+int cli_traverse_group(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int group_num,
+	int (*handler)(const char *s, void *user_data),
+	void *user_data)
+{
+#if (CLI_SUPPORT_GROUP_INDEX == 1)
+	const struct cli_group_s *p_group;
+	struct cli_cmd_node_s *p_node;
+	unsigned int i;
 
-				case 32:
-#ifndef _lint
-					vu32 = va_arg(marker, unsigned int *);
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	p_group = &p_core_ctx->group;
+	if ((p_core_ctx->cmd_core.e_state != e_cli_cmd_core_active) ||
+	    (p_group->pp_tag_nodes == IFX_NULL) || (handler == IFX_NULL) ||
+	    (group_num >= (unsigned int)p_group->n_reg_groups))
+		return IFX_ERROR;
+
+	for (i = p_group->p_tag_start[group_num]; i < p_group->p_tag_start[group_num + 1]; i++)
+	{
+		p_node = p_group->pp_tag_nodes[i];
+		if (clios_strcmp(p_node->p_key, CLI_EMPTY_CMD) != 0)
+			if (handler(p_node->p_key, user_data))
+				break;
+		if (handler(p_node->cmd_data.help, user_data))
+			break;
+	}
+
+	return IFX_SUCCESS;
+#else
+	(void)p_core_ctx;
+	(void)group_num;
+	(void)handler;
+	(void)user_data;
+	return IFX_ERROR;
 #endif
-					if (vu32 != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
+}
 
-							vu32[i] = (unsigned int)CLI_STRTOUL(s, &ptr, base);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
+/** Deliver an event to all registered user interfaces */
+CLI_STATIC int user_if_event_deliver(
+	void *p_data,
+	char *p_event)
+{
+	struct cli_core_context_s *p_core_ctx = (struct cli_core_context_s *)p_data;
+	struct cli_user_context_s *p_user_ctx = IFX_NULL, *p_user_ctx_next = IFX_NULL;
+#if (CLI_SUPPORT_SESSION == 1)
+	struct cli_session_s *p_session, *p_next, *p_free = IFX_NULL, *p_outer;
+	cli_session_event_fct_t event_fct;
+	void *p_event_data;
+#endif
 
-				case 64:
-#ifndef _lint
-					vu64 = va_arg(marker, unsigned long long int *);
+#if (CLI_SUPPORT_JOURNAL == 1)
+	(void)cli_journal_append(journal_get(p_core_ctx), CLI_JOURNAL_TYPE_EVENT, p_event);
+	journal_put(p_core_ctx);
 #endif
-					if (vu64 != IFX_NULL) {
-						for (i = 0; i < array_cnt; i++) {
-							char *ptr = IFX_NULL;
 
-							vu64[i] = (unsigned long long int)CLI_STRTOULL(s, &ptr, base);
-							s = ptr;
-						}
-						ret++;
-					}
-					break;
+	p_user_ctx = p_core_ctx->p_user_head;
 
-				default:
-					break;
-				}
-				break;
+	while (p_user_ctx)
+	{
+		p_user_ctx_next = p_user_ctx->p_next;
 
-			}
-		default:
-			break;
-		}
+		if (p_user_ctx->event_cb_fct != IFX_NULL)
+			p_user_ctx->event_cb_fct(p_user_ctx->p_user_data, p_event);
 
-		if (array_cnt > 1)
-			p = a;
+		p_user_ctx = p_user_ctx_next;
 	}
 
-SF_END:
+#if (CLI_SUPPORT_SESSION == 1)
+	/* the callbacks are called without lock_ctx, they may subscribe, open or
+	   close sessions. The reference keeps the session (and its list link)
+	   valid, a session closed meanwhile is freed after the loop. */
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	p_session = p_core_ctx->p_session_head;
+	while (p_session != IFX_NULL)
+	{
+		if ((p_session->b_closed == IFX_TRUE) || (p_session->event_fct == IFX_NULL))
+		{
+			p_session = p_session->p_next;
+			continue;
+		}
+		event_fct = p_session->event_fct;
+		p_event_data = p_session->p_event_data;
+		p_session->n_refs++;
+		p_session->n_event_calls++;
+		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
-#ifndef _lint
-	va_end(marker);
+		p_outer = g_p_cli_session_event;
+		g_p_cli_session_event = p_session;
+		(void)event_fct(p_event_data, p_event);
+		g_p_cli_session_event = p_outer;
+
+		(void)clios_lockget(&p_core_ctx->lock_ctx);
+		p_session->n_event_calls--;
+		if (p_session->n_event_waiters > 0)
+			(void)clios_event_wakeup(&p_session->event_calls_done);
+		p_next = p_session->p_next;
+		if (session_ref_put(p_session) == IFX_TRUE)
+		{
+			/* p_prev is not used after the unlink */
+			p_session->p_prev = p_free;
+			p_free = p_session;
+		}
+		p_session = p_next;
+	}
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	while (p_free != IFX_NULL)
+	{
+		p_session = p_free;
+		p_free = p_session->p_prev;
+		session_free(p_session);
+	}
 #endif
 
-	return ret;
+	return IFX_SUCCESS;
 }
 
-int cli_core_group_release(
-	struct cli_core_context_s *p_core_ctx)
+int cli_user_if_event(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_event
+)
 {
-	CLI_CORE_CTX_CHECK(p_core_ctx);
-
-	if (p_core_ctx->group.pp_group_list != IFX_NULL)
-		clios_memfree((void *)p_core_ctx->group.pp_group_list);
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+	struct cli_event_limit_s *p_event_limit;
+#endif
 
-	if (p_core_ctx->group.p_key_entries != IFX_NULL)
-		clios_memfree(p_core_ctx->group.p_key_entries);
+	if (p_core_ctx == IFX_NULL)
+		return IFX_ERROR;
 
-	clios_memset(&p_core_ctx->group, 0x00, sizeof(struct cli_group_s));
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+	p_event_limit = clios_atomic_load(&p_core_ctx->p_event_limit);
+	if (p_event_limit != IFX_NULL)
+		return cli_event_limit_process(
+			p_event_limit, p_event, user_if_event_deliver, p_core_ctx);
+#endif
 
-	return IFX_SUCCESS;
+	return user_if_event_deliver(p_core_ctx, p_event);
 }
 
-int cli_core_cfg_cmd_shutdown(
+int cli_user_if_dump(
 	struct cli_core_context_s *p_core_ctx,
-	enum cli_cmd_core_out_mode_e out_mode)
+	char *p_dump
+)
 {
-	CLI_CORE_CTX_CHECK(p_core_ctx);
+	struct cli_user_context_s *p_user_ctx = IFX_NULL, *p_user_ctx_next = IFX_NULL;
 
-	if (core_out_mode_check(out_mode))
-	{
-		/* invalid outmode */
+	if (p_core_ctx == IFX_NULL)
 		return IFX_ERROR;
-	}
 
-	(void)clios_lockget(&p_core_ctx->lock_ctx);
-	p_core_ctx->cmd_core.e_state = e_cli_cmd_core_delete;
-	p_core_ctx->cmd_core.p_root = IFX_NULL;
-	if (p_core_ctx->cmd_core.p_node_array)	/* not set if this is a clone */
-		clios_memfree(p_core_ctx->cmd_core.p_node_array);
+#if (CLI_SUPPORT_JOURNAL == 1)
+	(void)cli_journal_append(journal_get(p_core_ctx), CLI_JOURNAL_TYPE_DUMP, p_dump);
+	journal_put(p_core_ctx);
+#endif
 
-	clios_memset(&p_core_ctx->cmd_core, 0x0, sizeof(struct cli_cmd_core_s));
-	p_core_ctx->cmd_core.out_mode = out_mode;
-	p_core_ctx->cmd_core.e_state = e_cli_cmd_core_count;
-	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+	p_user_ctx = p_core_ctx->p_user_head;
+
+	while (p_user_ctx)
+	{
+		p_user_ctx_next = p_user_ctx->p_next;
+
+		if (p_user_ctx->dump_cb_fct != IFX_NULL)
+			p_user_ctx->dump_cb_fct(p_user_ctx->p_user_data, p_dump);
+
+		p_user_ctx = p_user_ctx_next;
+	}
 
 	return IFX_SUCCESS;
 }
 
-int cli_core_cfg_mode_cmd_reg(
-	struct cli_core_context_s *p_core_ctx)
+#if (CLI_SUPPORT_JOURNAL == 1)
+int cli_core_journal_open(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_path,
+	unsigned int n_slots,
+	unsigned int slot_size)
 {
+	struct cli_journal_s *p_journal = IFX_NULL;
+	IFX_boolean_t b_open;
+
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
+	if (cli_journal_open(p_path, n_slots, slot_size, &p_journal) != IFX_SUCCESS)
+		return IFX_ERROR;
+
 	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	b_open = (p_core_ctx->p_journal != IFX_NULL) ? IFX_TRUE : IFX_FALSE;
+	if (b_open == IFX_FALSE)
+		clios_atomic_store(&p_core_ctx->p_journal, p_journal);
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
-	if (p_core_ctx->cmd_core.e_state != e_cli_cmd_core_count)
+	if (b_open == IFX_TRUE)
 	{
-		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
-		/* invalid core mode */
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: journal already open" CLI_CRLF));
+		(void)cli_journal_close(&p_journal);
 		return IFX_ERROR;
 	}
 
-	if (p_core_ctx->cmd_core.n_nodes == 0)
-	{
-		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
-		/* no registered commands */
-		return IFX_ERROR;
-	}
+	return IFX_SUCCESS;
+}
 
-	p_core_ctx->cmd_core.p_node_array =
-		clios_memalloc(p_core_ctx->cmd_core.n_nodes * sizeof(struct cli_cmd_node_s));
+int cli_core_journal_close(
+	struct cli_core_context_s *p_core_ctx)
+{
+	struct cli_journal_s *p_journal;
 
-	if (!p_core_ctx->cmd_core.p_node_array)
-	{
-		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
-		/* mem alloc */
-		return IFX_ERROR;
-	}
-	clios_memset(
-		p_core_ctx->cmd_core.p_node_array, 0x0,
-		p_core_ctx->cmd_core.n_nodes * sizeof(struct cli_cmd_node_s));
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	p_core_ctx->cmd_core.e_state = e_cli_cmd_core_allocate;
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	p_journal = p_core_ctx->p_journal;
+	clios_atomic_store(&p_core_ctx->p_journal, (struct cli_journal_s *)IFX_NULL);
 	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
-	return IFX_SUCCESS;
+	if (p_journal == IFX_NULL)
+		return IFX_SUCCESS;
+
+	/* wait for the running accesses (event, dump, replay), a new access
+	   sees the cleared journal, the last access wakes the close */
+	(void)clios_atomic_fetch_add(&p_core_ctx->journal_closers, 1);
+	clios_atomic_fence_full();
+	while (clios_atomic_load(&p_core_ctx->journal_users) != 0)
+		(void)clios_event_wait(&p_core_ctx->event_journal_idle, CLI_CORE_WAIT_TIMEOUT, IFX_NULL);
+	/* one wakeup per signal, pass it on to the next waiting close */
+	if (clios_atomic_fetch_add(&p_core_ctx->journal_closers, -1) != 1)
+		(void)clios_event_wakeup(&p_core_ctx->event_journal_idle);
+
+	return cli_journal_close(&p_journal);
 }
 
-int cli_core_cfg_mode_active(
-	struct cli_core_context_s *p_core_ctx)
+int cli_core_journal_seq_get(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned long long *p_first_seq,
+	unsigned long long *p_next_seq)
 {
+	int ret;
+
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	ret = cli_journal_seq_get(journal_get(p_core_ctx), p_first_seq, p_next_seq);
+	journal_put(p_core_ctx);
 
-	if (p_core_ctx->cmd_core.e_state != e_cli_cmd_core_allocate)
-	{
-		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
-		/* invalid core mode */
-		return IFX_ERROR;
-	}
+	return ret;
+}
 
-	if (!p_core_ctx->cmd_core.p_node_array || !p_core_ctx->cmd_core.p_root)
+CLI_STATIC int journal_entry_replay(
+	void *p_data,
+	unsigned long long seq,
+	unsigned long long time_ms,
+	unsigned int type,
+	const char *p_text)
+{
+	struct cli_user_context_s *p_user_ctx = (struct cli_user_context_s *)p_data;
+
+	switch (type)
 	{
-		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
-		/* no registered commands */
-		return IFX_ERROR;
+	case CLI_JOURNAL_TYPE_EVENT:
+		if (p_user_ctx->event_cb_fct != IFX_NULL)
+			(void)p_user_ctx->event_cb_fct(p_user_ctx->p_user_data, (char *)p_text);
+		break;
+	case CLI_JOURNAL_TYPE_DUMP:
+		if (p_user_ctx->dump_cb_fct != IFX_NULL)
+			(void)p_user_ctx->dump_cb_fct(p_user_ctx->p_user_data, (char *)p_text);
+		break;
+	default:
+		break;
 	}
 
-	p_core_ctx->cmd_core.e_state = e_cli_cmd_core_active;
-	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
-
-	return IFX_SUCCESS;
+	return 0;
 }
 
-int cli_core_release(
-	struct cli_core_context_s **pp_core_ctx,
-	enum cli_cmd_core_out_mode_e out_mode)
+int cli_user_if_replay(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_user_context_s *p_user_ctx,
+	unsigned long long from_seq,
+	unsigned long long *p_next_seq)
 {
-	struct cli_core_context_s *p_core_ctx = *pp_core_ctx;
+	struct cli_journal_s *p_journal;
+	int ret;
 
-	if (*pp_core_ctx)
-	{
-		p_core_ctx = *pp_core_ctx;
-		*pp_core_ctx = IFX_NULL;
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-		(void)cli_core_cfg_cmd_shutdown(p_core_ctx, out_mode);
+	if (p_user_ctx == IFX_NULL)
+		return IFX_ERROR;
 
-		(void)clios_lockget(&p_core_ctx->lock_ctx);
-		if (p_core_ctx->p_cli_core_parent != IFX_NULL)
-		{
-			(void)clios_lockget(&p_core_ctx->p_cli_core_parent->lock_ctx);
+	p_journal = journal_get(p_core_ctx);
+	ret = (p_journal != IFX_NULL) ?
+		cli_journal_read(p_journal, from_seq, 0,
+			journal_entry_replay, p_user_ctx, p_next_seq) : IFX_ERROR;
+	journal_put(p_core_ctx);
 
-			clios_memset(&p_core_ctx->group, 0x00, sizeof(struct cli_group_s));
-			if (p_core_ctx->p_cli_core_parent->n_cli_core_clones > 0)
-				{p_core_ctx->p_cli_core_parent->n_cli_core_clones--;}
+	return ret;
+}
+#endif	/* #if (CLI_SUPPORT_JOURNAL == 1) */
 
-			(void)clios_lockrelease(&p_core_ctx->p_cli_core_parent->lock_ctx);
-			p_core_ctx->p_cli_core_parent = IFX_NULL;
-		}
-		else
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+int cli_core_event_limit_set(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_key,
+	unsigned int window_ms,
+	unsigned int rate,
+	unsigned int burst)
+{
+	struct cli_event_limit_s *p_event_limit = IFX_NULL;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->p_event_limit == IFX_NULL)
+	{
+		if (cli_event_limit_init(&p_event_limit) != IFX_SUCCESS)
 		{
-			(void)cli_core_group_release(p_core_ctx);
+			(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+			return IFX_ERROR;
 		}
-		p_core_ctx->ctx_size = 0;
-		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
-
-		(void)clios_lockdelete(&p_core_ctx->lock_ctx);
-		clios_memfree(p_core_ctx);
+		clios_atomic_store(&p_core_ctx->p_event_limit, p_event_limit);
 	}
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
-	return IFX_SUCCESS;
+	return cli_event_limit_rule_set(p_core_ctx->p_event_limit,
+		p_key, window_ms, rate, burst);
 }
 
-/**
-   Setup the CLI core data
+int cli_core_event_limit_flush(
+	struct cli_core_context_s *p_core_ctx)
+{
+	struct cli_event_limit_s *p_event_limit;
 
-\param
-   p_core_ctx  CLI Core context pointer
-\param
-   out_mode  selects the output mode, printout to buffer or file.
-\param
-   p_user_fct_data  user data, used for the cli user function calls
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-\return
-   IFX_SUCCESS: success
-   IFX_ERROR: error occured
+	p_event_limit = clios_atomic_load(&p_core_ctx->p_event_limit);
+	if (p_event_limit == IFX_NULL)
+		return 0;
 
-\remarks
-   Depending on the selected output mode the corresponding user functions must have
-   one of the following form:
-   \ref cli_cmd_user_fct_buf_t for printout to a buffer.
-   \ref cli_cmd_user_fct_file_t for printout to a file.
-*/
-int cli_core_init(
-	struct cli_core_context_s **pp_core_ctx,
-	enum cli_cmd_core_out_mode_e out_mode,
-	void *p_user_fct_data)
-{
-	return core_init(pp_core_ctx, out_mode, p_user_fct_data, 0);
+	return cli_event_limit_flush(p_event_limit, user_if_event_deliver, p_core_ctx);
 }
 
-int cli_core_user_group_init(
+int cli_core_event_limit_due_get(
 	struct cli_core_context_s *p_core_ctx,
-	char const *p_group_list[],
-	struct cli_group_key_entry_s const *p_key_entries)
+	unsigned int *p_wait_ms)
 {
-	IFX_int_t grp_cnt = 0, key_cnt = 0;
-	IFX_uint_t mask = 0;
+	struct cli_event_limit_s *p_event_limit;
 
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	if (p_core_ctx->cmd_core.e_state != e_cli_cmd_core_count)
-	{
-		/* wrong state, already in use */
-		return IFX_ERROR;
-	}
-
-	(void)cli_core_group_release(p_core_ctx);
-	p_core_ctx->group.p_misc_group = CLI_GROUP_MISC_DESCRIPTION;
-	p_core_ctx->group.p_builtin_group = CLI_GROUP_BUILTIN_DESCRIPTION;
+	p_event_limit = clios_atomic_load(&p_core_ctx->p_event_limit);
+	if (p_event_limit == IFX_NULL)
+		return 0;
 
-	grp_cnt = 0;
-	while (p_group_list[grp_cnt] != IFX_NULL)
-	{
-		grp_cnt++;
-		if (grp_cnt >= CLI_MAX_USER_GROUPS) /* max 15 user groups */
-			return IFX_ERROR;
-	}
-	if (grp_cnt == 0)
-		return IFX_SUCCESS;
+	return cli_event_limit_due_get(p_event_limit, p_wait_ms);
+}
+#endif	/* #if (CLI_SUPPORT_EVENT_LIMIT == 1) */
 
-	key_cnt = 0;
-	if (p_key_entries)
-	{
-		while (p_key_entries[key_cnt].p_search_key)
-		{
-			if (p_key_entries[key_cnt].group_num >= (unsigned char)grp_cnt)
-			{
-				return IFX_ERROR;
-			}
+#if (CLI_SUPPORT_STATS == 1)
+/** Walk the command tree (in order) and deliver the statistics
 
-			key_cnt++;
-		}
-	}
-	if (key_cnt == 0)
-		return IFX_SUCCESS;
+\return
+   0 - continue
+   else - stop
+*/
+CLI_STATIC int stats_node_walk(
+	struct cli_stats_s *p_stats,
+	struct cli_cmd_node_s *p_node,
+	cli_stats_walk_fct_t walk_fct,
+	void *p_data,
+	int *p_count)
+{
+	struct cli_cmd_stats_s cmd_stats;
 
-	p_core_ctx->group.pp_group_list = clios_memalloc(grp_cnt * sizeof(char *));
-	p_core_ctx->group.p_key_entries = clios_memalloc(key_cnt * sizeof(struct cli_group_key_entry_s));
-	if ((p_core_ctx->group.pp_group_list == IFX_NULL) ||
-	    (p_core_ctx->group.p_key_entries == IFX_NULL) )
-	{
-		(void)cli_core_group_release(p_core_ctx);
-		return IFX_ERROR;
-	}
-	p_core_ctx->group.n_reg_groups = grp_cnt;
-	p_core_ctx->group.n_key_entries = key_cnt;
+	if (p_node == IFX_NULL)
+		return 0;
 
-	mask = 0;
-	grp_cnt = 0;
-	while (p_group_list[grp_cnt] != IFX_NULL)
-	{
-		p_core_ctx->group.pp_group_list[grp_cnt] = p_group_list[grp_cnt];
-		mask |= (0x1 << grp_cnt);
-		grp_cnt++;
-	}
-	p_core_ctx->group.reg_group_mask = mask;
+	if (stats_node_walk(p_stats, p_node->p_left, walk_fct, p_data, p_count) != 0)
+		return 1;
 
-	key_cnt = 0;
-	while (p_key_entries[key_cnt].p_search_key != IFX_NULL)
+	if (!(p_node->cmd_data.mask & CLI_INTERN_MASK_LONG) &&
+	    !comp_eq(p_node->p_key, CLI_EMPTY_CMD) &&
+	    (cli_stats_read(p_stats, p_node->cmd_data.cmd_idx, &cmd_stats) == IFX_SUCCESS))
 	{
-		p_core_ctx->group.p_key_entries[key_cnt].group_num = p_key_entries[key_cnt].group_num;
-		p_core_ctx->group.p_key_entries[key_cnt].p_search_key = p_key_entries[key_cnt].p_search_key;
-		key_cnt++;
+		(*p_count)++;
+		if (walk_fct(p_data, p_node->p_key, p_node->cmd_data.help, &cmd_stats) != 0)
+			return 1;
 	}
 
-	return IFX_SUCCESS;
+	return stats_node_walk(p_stats, p_node->p_right, walk_fct, p_data, p_count);
 }
 
-int cli_core_buildin_register(
+int cli_core_stats_get(
 	struct cli_core_context_s *p_core_ctx,
-	unsigned int select_mask)
+	const char *p_name,
+	struct cli_cmd_stats_s *p_cmd_stats)
 {
+	struct cli_cmd_data_s cmd_data = {IFX_NULL, 0, {IFX_NULL}, 0, IFX_NULL};
+
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	switch(p_core_ctx->cmd_core.out_mode)
+	if (p_name != IFX_NULL)
 	{
-	case cli_cmd_core_out_mode_buffer:
-#		if (CLI_SUPPORT_BUFFER_OUT == 1)
-		if (select_mask & CLI_BUILDIN_REG_HELP) {
-			(void)cmd_core_key_add(
-				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
-				"help", "Help", cli_core_cmd_help__buffer, IFX_NULL);
-		}
-		if (select_mask & CLI_BUILDIN_REG_QUIT) {
-			(void)cmd_core_key_add(
-				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
-				"quit", "Quit", cli_core_cmd_quit__buffer, IFX_NULL);
-		}
-		if (select_mask & CLI_BUILDIN_REG_WHAT) {
-			(void)cmd_core_key_add(
-				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
-				"what", "what_string", cli_core_cmd_what__buffer, IFX_NULL);
-		}
-#		else
-		CLI_USR_ERR(LIB_CLI,
-			("ERR CLI Core: register build-in - buffer printout mode not supported" CLI_CRLF));
-		return IFX_ERROR;
-#		endif
-		break;
-
-	case cli_cmd_core_out_mode_file:
-#		if (CLI_SUPPORT_FILE_OUT == 1)
-		if (select_mask & CLI_BUILDIN_REG_HELP) {
-			(void)cmd_core_key_add(
-				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
-				"help", "Help", IFX_NULL, cli_core_cmd_help__file);
-		}
-		if (select_mask & CLI_BUILDIN_REG_QUIT) {
-			(void)cmd_core_key_add(
-				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
-				"quit", "Quit", IFX_NULL, cli_core_cmd_quit__file);
-		}
-		if (select_mask & CLI_BUILDIN_REG_WHAT) {
-			(void)cmd_core_key_add(
-				&p_core_ctx->cmd_core, CLI_INTERN_MASK_BUILTIN,
-				"what", "what_string", IFX_NULL, cli_core_cmd_what__file);
-		}
-#		else
-		CLI_USR_ERR(LIB_CLI,
-			("ERR CLI Core: register build-in - file printout mode not supported" CLI_CRLF));
-		return IFX_ERROR;
-#		endif
-		break;
-
-	default:
-		CLI_USR_ERR(LIB_CLI,
-			("ERR CLI Core: register build-in - unknown printout mode" CLI_CRLF));
-		return IFX_ERROR;
+		if (cmd_core_key_find(&p_core_ctx->cmd_core, p_name, &cmd_data) != e_cli_status_ok)
+			return IFX_ERROR;
 	}
 
-	return IFX_SUCCESS;
+	return cli_stats_read(p_core_ctx->p_stats, cmd_data.cmd_idx, p_cmd_stats);
 }
 
-
-int cli_core_key_add__buffer(
+int cli_core_stats_walk(
 	struct cli_core_context_s *p_core_ctx,
-	unsigned int group_mask,
-	char const *p_short_name,
-	char const *p_long_name,
-	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf)
+	cli_stats_walk_fct_t walk_fct,
+	void *p_data)
 {
-#if (CLI_SUPPORT_BUFFER_OUT == 1)
+	int count = 0;
+
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	group_mask = user_group_mask_get(p_core_ctx, group_mask, p_long_name);
-	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_buffer)
-		return cmd_core_key_add(
-			&p_core_ctx->cmd_core, group_mask,
-			p_short_name, p_long_name,
-			cli_cmd_user_fct_buf, IFX_NULL);
-	else
+	if ((p_core_ctx->p_stats == IFX_NULL) || (walk_fct == IFX_NULL))
 		return IFX_ERROR;
-#else
-	return IFX_ERROR;
-#endif
+
+	(void)stats_node_walk(p_core_ctx->p_stats, p_core_ctx->cmd_core.p_root,
+		walk_fct, p_data, &count);
+
+	return count;
 }
 
-int cli_core_key_add__file(
-	struct cli_core_context_s *p_core_ctx,
-	unsigned int group_mask,
-	char const *p_short_name,
-	char const *p_long_name,
-	cli_cmd_user_fct_file_t cli_cmd_user_fct_file)
+int cli_core_stats_reset(
+	struct cli_core_context_s *p_core_ctx)
 {
-#if (CLI_SUPPORT_FILE_OUT == 1)
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	group_mask = user_group_mask_get(p_core_ctx, group_mask, p_long_name);
-	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_file)
-		return cmd_core_key_add(
-			&p_core_ctx->cmd_core, (group_mask & CLI_USER_MASK_ALL),
-			p_short_name, p_long_name,
-			IFX_NULL, cli_cmd_user_fct_file);
-	else
-		return IFX_ERROR;
-#else
-	return IFX_ERROR;
-#endif
+	return cli_stats_reset(p_core_ctx->p_stats);
 }
+#endif	/* #if (CLI_SUPPORT_STATS == 1) */
 
-int cli_core_cmd_exec__buffer(
+#if (CLI_SUPPORT_TRACE == 1)
+int cli_core_trace_enable(
 	struct cli_core_context_s *p_core_ctx,
-	char *p_cmd_arg_buf,
-	const unsigned int buffer_size)
+	IFX_boolean_t b_enable)
 {
-#if (CLI_SUPPORT_BUFFER_OUT == 1)
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_buffer)
-		return cmd_parse_execute(
-		p_core_ctx, p_cmd_arg_buf, buffer_size, IFX_NULL);
-	else
+	if (p_core_ctx->p_trace == IFX_NULL)
 		return IFX_ERROR;
-#else
-	return IFX_ERROR;
-#endif
+
+	p_core_ctx->b_trace = (b_enable == IFX_TRUE) ? IFX_TRUE : IFX_FALSE;
+
+	return IFX_SUCCESS;
 }
 
-int cli_core_cmd_exec__file(
+int cli_core_trace_read(
 	struct cli_core_context_s *p_core_ctx,
-	char *p_cmd_arg_buf,
-	clios_file_io_t *p_file_io)
+	unsigned int n_last,
+	cli_trace_read_fct_t read_fct,
+	void *p_data)
 {
-#if (CLI_SUPPORT_FILE_OUT == 1)
-	clios_file_t *p_file = (clios_file_t *)p_file_io;
-
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	if (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_file)
-		return cmd_parse_execute(
-			p_core_ctx, p_cmd_arg_buf, 0, p_file);
-	else
-		return IFX_ERROR;
-#else
-	return IFX_ERROR;
-#endif
+	return cli_trace_read(p_core_ctx->p_trace, n_last, read_fct, p_data);
 }
 
-int cli_core_cmd_arg_exec__file(
+int cli_core_trace_file_set(
 	struct cli_core_context_s *p_core_ctx,
-	char *p_cmd,
-	char *p_arg,
-	clios_file_io_t *p_file_io)
+	const char *p_path)
 {
-#if (CLI_SUPPORT_FILE_OUT == 1)
-	struct cli_cmd_data_s cmd_data = {IFX_NULL, 0, {IFX_NULL}};
-	char dummy_arg[10] = "";
-	/* time_t start_time = 0, stop_time = 0;
-	bool start_time_measured = false; */
-	clios_file_t *p_file = (clios_file_t *)p_file_io;
-
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+	char *p_trace_file = IFX_NULL;
 
 	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	if (p_cmd == IFX_NULL || clios_strlen(p_cmd) == 0) {
-		return cli_core_cmd_arg_exec__file(p_core_ctx, "help", IFX_NULL, p_file_io);
-		/* return IFX_ERROR; */
-	}
-
-	p_cmd = remove_whitespaces(p_cmd);
-	p_core_ctx->cmd_core.curr_cmd = p_cmd;
-	if (p_arg != IFX_NULL) {
-		p_arg = remove_whitespaces(p_arg);
-	} else {
-		p_arg = dummy_arg;
-	}
-
-	switch (cmd_core_key_find(&p_core_ctx->cmd_core, p_cmd, &cmd_data))
+	if (p_path != IFX_NULL)
 	{
-	case e_cli_status_ok:
-		switch(p_core_ctx->cmd_core.out_mode)
-		{
-		case cli_cmd_core_out_mode_buffer:
-#			if (CLI_SUPPORT_BUFFER_OUT == 1) && 0
-			if (cmd_data.user_fct.buf_out != IFX_NULL)
-				return cmd_data.user_fct.buf_out(p_user_data, p_arg, cmd_buffer_size, p_cmd_buf);
-			else
-				return clios_sprintf(p_cmd_buf,
-					"errorcode=-1 (internal error, no function pointer) CLI_CRLF");
-#			else
-			CLI_USR_ERR(LIB_CLI,
-				("ERR CLI Core: exec - buffer printout not supported" CLI_CRLF));
-			return IFX_ERROR;
-#			endif
-		case cli_cmd_core_out_mode_file:
-#			if (CLI_SUPPORT_FILE_OUT == 1)
-			if (cmd_data.user_fct.file_out != IFX_NULL)
-				return cmd_data.user_fct.file_out(
-					(cmd_data.mask & CLI_INTERN_MASK_BUILTIN) ? p_core_ctx : p_core_ctx->p_user_fct_data,
-					p_arg, p_file);
-			else
-				return cli_fprintf_spec(p_file,
-					"errorcode=-1 (internal error, no function pointer)" CLI_CRLF);
-#			else
-			CLI_USR_ERR(LIB_CLI,
-				("ERR CLI Core: exec - file printout not supported" CLI_CRLF));
-			return IFX_ERROR;
-#			endif
-		default:
-			CLI_USR_ERR(LIB_CLI,
-				("ERR CLI Core: exec - printout mode unknown" CLI_CRLF));
-			return IFX_ERROR;
-		}
-	default:
-		switch(p_core_ctx->cmd_core.out_mode)
+		p_trace_file = (char *)clios_memalloc(clios_strlen(p_path) + 1);
+		if (p_trace_file == IFX_NULL)
 		{
-		case cli_cmd_core_out_mode_buffer:
-#			if (CLI_SUPPORT_BUFFER_OUT == 1) && 0
-			return clios_sprintf(p_cmd_buf, "errorcode=-1 (unknown command)" CLI_CRLF);
-#			else
-			CLI_USR_ERR(LIB_CLI,
-				("ERR CLI Core: exec - unknown command, printout mode not supported" CLI_CRLF));
-			return IFX_ERROR;
-#			endif
-		case cli_cmd_core_out_mode_file:
-#			if (CLI_SUPPORT_FILE_OUT == 1)
-				return cli_fprintf_spec(p_file, "errorcode=-1 (unknown command)" CLI_CRLF);
-#			else
-			CLI_USR_ERR(LIB_CLI,
-				("ERR CLI Core: exec - unknown command, printout mode not supported" CLI_CRLF));
-			return IFX_ERROR;
-#			endif
-		default:
-			CLI_USR_ERR(LIB_CLI,
-				("ERR CLI Core: exec - unknown command, unknown printout mode" CLI_CRLF));
+			CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: trace file set - no memory" CLI_CRLF));
 			return IFX_ERROR;
 		}
+		clios_strcpy(p_trace_file, p_path);
 	}
 
-	return IFX_SUCCESS;
-#else
-	return IFX_ERROR;
-#endif
-}
-
-int cli_check_help__buffer(
-	const char *p_cmd,
-	const char *p_usage,
-	const unsigned int bufsize_max,
-	char *p_out)
-{
-#if (CLI_SUPPORT_BUFFER_OUT == 1)
-	if (cmd_check_help(p_cmd))
-	{
-		if (clios_strlen(p_usage) < bufsize_max)
-			return clios_sprintf(p_out, "%s", p_usage);
-		else
-			return IFX_SUCCESS;
-	}
-	return IFX_ERROR;
-#else
-	return IFX_ERROR;
-#endif
-}
-
-int cli_check_help__file(
-	const char *p_cmd,
-	const char *p_usage,
-	clios_file_io_t *p_file_io)
-{
-#if (CLI_SUPPORT_FILE_OUT == 1)
-	clios_file_t *p_file = (clios_file_t *)p_file_io;
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->p_trace_file != IFX_NULL)
+		clios_memfree(p_core_ctx->p_trace_file);
+	p_core_ctx->p_trace_file = p_trace_file;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
-	return check_help__file(p_cmd, p_usage, p_file);
-#else
+	return IFX_SUCCESS;
+#	else
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+	(void)p_path;
+
+	CLI_USR_ERR(LIB_CLI,
+		("ERR CLI Core: trace file set - file printout not supported" CLI_CRLF));
 	return IFX_ERROR;
-#endif
+#	endif
 }
+#endif	/* #if (CLI_SUPPORT_TRACE == 1) */
 
-/** Setup a CLI interface, therefore the follwoing steps are necessary:
-   - Create the CLI core (cli_core_init)
-   - Count all commands (memory usage), counting mode:
-     --> register built-in commands
-     --> register user commands
-   - Switch to registration mode (allocates memory)
-   - Register all commands (setup binary tree), registration mode:
-     --> register built-in commands
-     --> register user commands
-   - Activate CLI Core
-*/
-int cli_core_setup__file(
-	struct cli_core_context_s **pp_core_ctx,
-	unsigned int builtin_selmask,
-	void *p_user_fct_data,
-	const cli_cmd_register__file cmd_reg_list[])
+#if (CLI_SUPPORT_METRICS == 1)
+int cli_core_metrics_source_add(
+	struct cli_core_context_s *p_core_ctx,
+	cli_metrics_source_fct_t source_fct,
+	void *p_data)
 {
-#if (CLI_SUPPORT_FILE_OUT == 1)
-	int retval = 0, i = 0;
-	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	unsigned int i;
+	int ret = IFX_ERROR;
 
-	if (!pp_core_ctx)
-	{
-		/* missing args */
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (source_fct == IFX_NULL)
 		return IFX_ERROR;
-	}
 
-	if ((cmd_reg_list[0] == IFX_NULL) && (builtin_selmask == 0))
+	(void)clios_lockget(&p_core_ctx->lock_metrics);
+	for (i = 0; i < CLI_METRICS_MAX_SOURCES; i++)
 	{
-		/* no commands */
-		return IFX_ERROR;
+		if (p_core_ctx->metrics_src[i].source_fct == IFX_NULL)
+		{
+			p_core_ctx->metrics_src[i].source_fct = source_fct;
+			p_core_ctx->metrics_src[i].p_data = p_data;
+			ret = IFX_SUCCESS;
+			break;
+		}
 	}
+	(void)clios_lockrelease(&p_core_ctx->lock_metrics);
 
-	/* create CLI core */
-	if ((retval = core_init(
-			&p_core_ctx, cli_cmd_core_out_mode_file,
-			p_user_fct_data, 0)) != IFX_SUCCESS)
-		return retval;
+	if (ret != IFX_SUCCESS)
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: metrics - no free source entry" CLI_CRLF));
 
-	/* count built-in commands (help, quit) */
-	if (builtin_selmask != 0) {
-		if ((retval = cli_core_buildin_register(
-				p_core_ctx, builtin_selmask)) != IFX_SUCCESS)
-			goto CLI_CORE_SETUP__FILE_ERR;
-	}
-	/* count user commands */
-	i = 0;
-	while (cmd_reg_list[i])  {
-		if ((retval = cmd_reg_list[i](p_core_ctx)) != IFX_SUCCESS)
-			break;
-		i++;
-	}
-	if (retval != IFX_SUCCESS)
-		goto CLI_CORE_SETUP__FILE_ERR;
+	return ret;
+}
 
-	/* switch to registration mode */
-	if ((retval = cli_core_cfg_mode_cmd_reg(p_core_ctx)) != IFX_SUCCESS)
-		goto CLI_CORE_SETUP__FILE_ERR;
+int cli_core_metrics_source_remove(
+	struct cli_core_context_s *p_core_ctx,
+	cli_metrics_source_fct_t source_fct,
+	void *p_data)
+{
+	unsigned int i;
+	int ret = IFX_ERROR;
 
-	/* register built-in commands (help, quit) */
-	if (builtin_selmask != 0) {
-		if ((retval = cli_core_buildin_register(
-				p_core_ctx, builtin_selmask)) != IFX_SUCCESS)
-			goto CLI_CORE_SETUP__FILE_ERR;
-	}
-	/* count user commands */
-	i = 0;
-	while (cmd_reg_list[i]) {
-		if ((retval = cmd_reg_list[i](p_core_ctx)) != IFX_SUCCESS)
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	(void)clios_lockget(&p_core_ctx->lock_metrics);
+	for (i = 0; i < CLI_METRICS_MAX_SOURCES; i++)
+	{
+		if ((p_core_ctx->metrics_src[i].source_fct == source_fct) &&
+		    (p_core_ctx->metrics_src[i].p_data == p_data))
+		{
+			p_core_ctx->metrics_src[i].source_fct = IFX_NULL;
+			p_core_ctx->metrics_src[i].p_data = IFX_NULL;
+			ret = IFX_SUCCESS;
 			break;
-		i++;
+		}
 	}
-	if (retval != IFX_SUCCESS)
-		goto CLI_CORE_SETUP__FILE_ERR;
+	(void)clios_lockrelease(&p_core_ctx->lock_metrics);
 
-	/* Activate CLI core */
-	if ((retval = cli_core_cfg_mode_active(p_core_ctx)) != IFX_SUCCESS)
-		goto CLI_CORE_SETUP__FILE_ERR;
+	return ret;
+}
 
-	*pp_core_ctx = p_core_ctx;
-	return retval;
+int cli_core_metrics_render(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_buf,
+	unsigned int buf_size)
+{
+	struct cli_metrics_s metrics;
+	int ret;
 
-CLI_CORE_SETUP__FILE_ERR:
-	(void)cli_core_release(&p_core_ctx, cli_cmd_core_out_mode_file);
-	return retval;
-#else
-	return IFX_ERROR;
-#endif
-}
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
+	if ((p_buf == IFX_NULL) || (buf_size == 0))
+		return IFX_ERROR;
 
-/** Setup a CLI interface, based on the given already existing CLI Core:
-   - Create the CLI core (cli_core_init)
-   - takeover the parent settings
-*/
-int cli_core_clone(
-	struct cli_core_context_s *p_core_ctx_parent,
-	struct cli_core_context_s **pp_core_ctx,
-	unsigned int instance_num,
-	void *p_user_fct_data)
+	cli_metrics_init(&metrics, p_buf, buf_size);
+
+	(void)clios_lockget(&p_core_ctx->lock_metrics);
+	ret = metrics_render(p_core_ctx, &metrics);
+	(void)clios_lockrelease(&p_core_ctx->lock_metrics);
+
+	return ret;
+}
+
+int cli_core_metrics_file_write(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_path)
 {
-	int retval = 0;
-	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	char tmp_path[256];
+	int fd, ret;
 
-	if ((pp_core_ctx == IFX_NULL) || (p_core_ctx_parent == IFX_NULL))
-	{
-		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: clone - missing args" CLI_CRLF));
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if (p_path == IFX_NULL)
 		return IFX_ERROR;
-	}
 
-	if ((p_core_ctx_parent->ctx_size != sizeof(struct cli_core_context_s)) ||
-	    (p_core_ctx_parent->cmd_core.e_state != e_cli_cmd_core_active))
+	ret = clios_snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", p_path);
+	if ((ret < 0) || ((unsigned int)ret >= sizeof(tmp_path)))
 	{
-		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: clone - invalid parent state" CLI_CRLF));
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: metrics - path too long" CLI_CRLF));
 		return IFX_ERROR;
 	}
 
-	/* create CLI core (for clone) */
-	if ((retval = core_init(
-			&p_core_ctx, p_core_ctx_parent->cmd_core.out_mode,
-			p_user_fct_data, instance_num)) != IFX_SUCCESS)
+	(void)clios_lockget(&p_core_ctx->lock_metrics);
+	ret = metrics_buf_render(p_core_ctx);
+	if (ret >= 0)
 	{
-		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: clone - core init" CLI_CRLF));
-		return retval;
+		fd = clios_open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0)
+		{
+			ret = IFX_ERROR;
+		}
+		else
+		{
+			ret = metrics_fd_write(fd, p_core_ctx->p_metrics_buf, ret);
+			(void)clios_close(fd);
+			if ((ret < 0) || (clios_rename(tmp_path, p_path) != 0))
+				ret = IFX_ERROR;
+		}
+		if (ret < 0)
+			CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: metrics - write file %s" CLI_CRLF,
+				p_path));
 	}
+	(void)clios_lockrelease(&p_core_ctx->lock_metrics);
 
-	(void)clios_lockget(&p_core_ctx->lock_ctx);
-	(void)clios_lockget(&p_core_ctx_parent->lock_ctx);
+	return (ret < 0) ? IFX_ERROR : IFX_SUCCESS;
+}
 
-	/* take over cmd core settings from the parent */
-	p_core_ctx->cmd_core.e_state  = p_core_ctx_parent->cmd_core.e_state;
-	p_core_ctx->cmd_core.out_mode = p_core_ctx_parent->cmd_core.out_mode;
-	p_core_ctx->cmd_core.n_nodes  = p_core_ctx_parent->cmd_core.n_nodes;
-	p_core_ctx->cmd_core.n_used_nodes = p_core_ctx_parent->cmd_core.n_used_nodes;
-	/* p_core_ctx->cmd_core.p_node_array = p_core_ctx_parent->cmd_core.p_node_array; */
-	p_core_ctx->cmd_core.p_root   = p_core_ctx_parent->cmd_core.p_root;
+int cli_core_metrics_fd_write(
+	struct cli_core_context_s *p_core_ctx,
+	int fd)
+{
+	int ret;
 
-	/* take over cmd core settings from the parent */
-	p_core_ctx->group.n_reg_groups   = p_core_ctx_parent->group.n_reg_groups;
-	p_core_ctx->group.n_key_entries  = p_core_ctx_parent->group.n_key_entries;
-	p_core_ctx->group.pp_group_list  = p_core_ctx_parent->group.pp_group_list;
-	p_core_ctx->group.p_key_entries  = p_core_ctx_parent->group.p_key_entries;
-	p_core_ctx->group.reg_group_mask = p_core_ctx_parent->group.reg_group_mask;
-	p_core_ctx->group.not_reg_group_mask = p_core_ctx_parent->group.not_reg_group_mask;
-	p_core_ctx->group.p_misc_group   = p_core_ctx_parent->group.p_misc_group;
-	p_core_ctx->group.p_builtin_group = p_core_ctx_parent->group.p_builtin_group;
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	/* setup parent */
-	p_core_ctx->p_cli_core_parent = p_core_ctx_parent;
-	p_core_ctx_parent->n_cli_core_clones++;
+	if (fd < 0)
+		return IFX_ERROR;
 
-	(void)clios_lockrelease(&p_core_ctx_parent->lock_ctx);
-	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+	(void)clios_lockget(&p_core_ctx->lock_metrics);
+	ret = metrics_buf_render(p_core_ctx);
+	if (ret >= 0)
+		ret = metrics_fd_write(fd, p_core_ctx->p_metrics_buf, ret);
+	(void)clios_lockrelease(&p_core_ctx->lock_metrics);
 
-	*pp_core_ctx = p_core_ctx;
-	return retval;
+	return ret;
 }
+#endif	/* #if (CLI_SUPPORT_METRICS == 1) */
 
-
-
-/** Setup a CLI interface, therefore the follwoing steps are necessary:
-   - Create the CLI core (cli_core_init)
-   - Count all commands (memory usage), counting mode:
-     --> register built-in commands
-     --> register user commands
-   - Switch to registration mode (allocates memory)
-   - Register all commands (setup binary tree), registration mode:
-     --> register built-in commands
-     --> register user commands
-   - Activate CLI Core
-*/
-int cli_core_group_setup__file(
-	struct cli_core_context_s **pp_core_ctx,
-	unsigned int builtin_selmask,
-	void *p_user_fct_data,
-	const cli_cmd_register__file cmd_reg_list[],
-	char const *p_group_list[],
-	struct cli_group_key_entry_s const *p_key_entries)
+#if (CLI_SUPPORT_HOOKS == 1)
+/** Replace the hook chain, the current chain is kept until release */
+CLI_STATIC void hook_chain_set(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_hook_chain_s *p_new)
 {
-#if (CLI_SUPPORT_FILE_OUT == 1)
-	int retval = 0, i = 0;
-	struct cli_core_context_s *p_core_ctx = IFX_NULL;
+	struct cli_hook_chain_s *p_old = p_core_ctx->p_hooks;
 
-	if (!pp_core_ctx)
+	clios_atomic_store(&p_core_ctx->p_hooks, p_new);
+	if (p_old != IFX_NULL)
 	{
-		/* missing args */
-		return IFX_ERROR;
+		p_old->p_next = p_core_ctx->p_hooks_retired;
+		p_core_ctx->p_hooks_retired = p_old;
 	}
+}
 
-	if ((cmd_reg_list[0] == IFX_NULL) && (builtin_selmask == 0))
-	{
-		/* no commands */
-		return IFX_ERROR;
-	}
+int cli_core_hook_add(
+	struct cli_core_context_s *p_core_ctx,
+	cli_cmd_hook_pre_t pre_fct,
+	cli_cmd_hook_post_t post_fct,
+	void *p_data)
+{
+	struct cli_hook_chain_s *p_new = IFX_NULL;
+	struct cli_hook_s hook;
+	int ret;
 
-	/* create CLI core */
-	if ((retval = core_init(
-			&p_core_ctx, cli_cmd_core_out_mode_file,
-			p_user_fct_data, 0)) != IFX_SUCCESS)
-		return retval;
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	if ((retval = cli_core_user_group_init(p_core_ctx, p_group_list, p_key_entries)) != IFX_SUCCESS)
-		return retval;
+	hook.pre_fct = pre_fct;
+	hook.post_fct = post_fct;
+	hook.p_data = p_data;
 
-	/* count built-in commands (help, quit) */
-	if (builtin_selmask != 0) {
-		if ((retval = cli_core_buildin_register(
-				p_core_ctx, builtin_selmask)) != IFX_SUCCESS)
-			goto CLI_CORE_SETUP__FILE_ERR;
-	}
-	/* count user commands */
-	i = 0;
-	while (cmd_reg_list[i])  {
-		if ((retval = cmd_reg_list[i](p_core_ctx)) != IFX_SUCCESS)
-			break;
-		i++;
-	}
-	if (retval != IFX_SUCCESS)
-		goto CLI_CORE_SETUP__FILE_ERR;
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	ret = cli_hook_chain_add(p_core_ctx->p_hooks, &hook, &p_new);
+	if (ret == IFX_SUCCESS)
+		hook_chain_set(p_core_ctx, p_new);
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
-	/* switch to registration mode */
-	if ((retval = cli_core_cfg_mode_cmd_reg(p_core_ctx)) != IFX_SUCCESS)
-		goto CLI_CORE_SETUP__FILE_ERR;
+	return ret;
+}
 
-	/* register built-in commands (help, quit) */
-	if (builtin_selmask != 0) {
-		if ((retval = cli_core_buildin_register(
-				p_core_ctx, builtin_selmask)) != IFX_SUCCESS)
-			goto CLI_CORE_SETUP__FILE_ERR;
-	}
-	/* count user commands */
-	i = 0;
-	while (cmd_reg_list[i]) {
-		if ((retval = cmd_reg_list[i](p_core_ctx)) != IFX_SUCCESS)
-			break;
-		i++;
-	}
-	if (retval != IFX_SUCCESS)
-		goto CLI_CORE_SETUP__FILE_ERR;
+int cli_core_hook_remove(
+	struct cli_core_context_s *p_core_ctx,
+	cli_cmd_hook_pre_t pre_fct,
+	cli_cmd_hook_post_t post_fct,
+	void *p_data)
+{
+	struct cli_hook_chain_s *p_new = IFX_NULL;
+	struct cli_hook_s hook;
+	int ret;
+
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	/* Activate CLI core */
-	if ((retval = cli_core_cfg_mode_active(p_core_ctx)) != IFX_SUCCESS)
-		goto CLI_CORE_SETUP__FILE_ERR;
+	hook.pre_fct = pre_fct;
+	hook.post_fct = post_fct;
+	hook.p_data = p_data;
 
-	*pp_core_ctx = p_core_ctx;
-	return retval;
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	ret = cli_hook_chain_remove(p_core_ctx->p_hooks, &hook, &p_new);
+	if (ret == IFX_SUCCESS)
+		hook_chain_set(p_core_ctx, p_new);
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
-CLI_CORE_SETUP__FILE_ERR:
-	(void)cli_core_release(&p_core_ctx, cli_cmd_core_out_mode_file);
-	return retval;
-#else
-	return IFX_ERROR;
-#endif
+	return ret;
 }
+#endif	/* #if (CLI_SUPPORT_HOOKS == 1) */
 
-
-int cli_user_if_register(
+#if (CLI_SUPPORT_RECORD == 1)
+int cli_core_record_start(
 	struct cli_core_context_s *p_core_ctx,
-	void *p_cb_data,
-	cli_exit_callback exit_cb_fct,
-	cli_event_callback event_cb_fct,
-	cli_dump_callback dump_cb_fct,
-	struct cli_user_context_s **pp_user_ctx)
+	const char *p_path)
 {
-	IFX_int32_t tout = 0;
-	struct cli_user_context_s *p_user_ctx = IFX_NULL;
+	struct cli_record_s *p_record = IFX_NULL;
 
 	CLI_CORE_CTX_CHECK(p_core_ctx);
-	if (*pp_user_ctx != IFX_NULL)
+
+	if (p_core_ctx->p_record != IFX_NULL)
 	{
-		/* expect NULL pointer */
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: recording already active" CLI_CRLF));
 		return IFX_ERROR;
 	}
 
-	if ((clios_lockget_timout(
-		&p_core_ctx->lock_ctx, (IFX_uint32_t)-1, &tout) == IFX_SUCCESS)
-	    && (tout == 0))
-	{
-		p_user_ctx = (struct cli_user_context_s *)
-			clios_memalloc(sizeof(struct cli_user_context_s));
-		if (!p_user_ctx)
-		{
-			(void)clios_lockrelease(&p_core_ctx->lock_ctx);
-			/* error mem alloc */
-			return IFX_ERROR;
-		}
-		clios_memset(p_user_ctx, 0x0, sizeof(struct cli_user_context_s));
-		p_user_ctx->p_user_data = p_cb_data;
-		p_user_ctx->exit_cb_fct = exit_cb_fct;
-		p_user_ctx->event_cb_fct = event_cb_fct;
-		p_user_ctx->dump_cb_fct = dump_cb_fct;
-
-		if (p_core_ctx->p_user_head == IFX_NULL) {
-			p_core_ctx->p_user_head = p_user_ctx;
-		} else {
-			struct cli_user_context_s *p_user_list = p_core_ctx->p_user_head;
-			while (p_user_list->p_next != IFX_NULL) {
-				p_user_list = p_user_list->p_next;
-			}
-			p_user_list->p_next = p_user_ctx;
-		}
+	if (cli_record_open(p_path, &p_record) != IFX_SUCCESS)
+		return IFX_ERROR;
 
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->p_record != IFX_NULL)
+	{
 		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+		(void)cli_record_close(&p_record);
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: recording already active" CLI_CRLF));
+		return IFX_ERROR;
 	}
-
-	*pp_user_ctx = p_user_ctx;
+	clios_atomic_store(&p_core_ctx->p_record, p_record);
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
 	return IFX_SUCCESS;
 }
 
-int cli_user_if_unregister(
-	struct cli_core_context_s *p_core_ctx,
-	struct cli_user_context_s **pp_user_ctx)
+int cli_core_record_stop(
+	struct cli_core_context_s *p_core_ctx)
 {
-	IFX_int32_t tout = 0;
-	struct cli_user_context_s *p_user_ctx = IFX_NULL, *p_user_list = IFX_NULL;
+	struct cli_record_s *p_record;
 
 	CLI_CORE_CTX_CHECK(p_core_ctx);
-	if (*pp_user_ctx == IFX_NULL)
-	{
+
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	p_record = p_core_ctx->p_record;
+	clios_atomic_store(&p_core_ctx->p_record, (struct cli_record_s *)IFX_NULL);
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+
+	if (p_record == IFX_NULL)
 		return IFX_SUCCESS;
-	}
 
-	if ((clios_lockget_timout(
-		&p_core_ctx->lock_ctx, (IFX_uint32_t)-1, &tout) == IFX_SUCCESS)
-	    && (tout == 0))
-	{
-		if (p_core_ctx->p_user_head == *pp_user_ctx)
-		{
-			p_user_ctx = *pp_user_ctx;
-			*pp_user_ctx = IFX_NULL;
-			p_core_ctx->p_user_head = p_user_ctx->p_next;
-		}
-		else
-		{
-			p_user_list = p_core_ctx->p_user_head;
-			while (p_user_list)
-			{
-				if (p_user_list->p_next == *pp_user_ctx)
-				{
-					p_user_ctx = *pp_user_ctx;
-					*pp_user_ctx = IFX_NULL;
-					p_user_list->p_next = p_user_ctx->p_next;
-					break;
-				}
-				p_user_list = p_user_list->p_next;
-			}
-		}
-		(void)clios_lockrelease(&p_core_ctx->lock_ctx);
+	return cli_record_close(&p_record);
+}
 
-		if (p_user_ctx)
-		{
-			clios_memfree(p_user_ctx);
-			return IFX_SUCCESS;
-		}
+/** Replay state, passed to the record read callback */
+struct cli_record_replay_s
+{
+	/** CLI context pointer */
+	struct cli_core_context_s *p_core_ctx;
+	/** pacing in percent, 0: as fast as possible */
+	unsigned int speed;
+	/** replay start [ms] */
+	clios_time_t start_ms;
+	/** command output (file mode) */
+	clios_file_io_t *p_out;
+	/** command line buffer */
+	char *p_buf;
+	/** number of executed entries */
+	int n_exec;
+};
 
+/** Record read callback - execute a recorded command line */
+CLI_STATIC int record_replay_entry(
+	void *p_data,
+	const struct cli_record_entry_s *p_entry)
+{
+	struct cli_record_replay_s *p_replay = (struct cli_record_replay_s *)p_data;
+	unsigned long long due_ms;
+	unsigned int key_len;
+	clios_time_t now_ms;
+
+	if ((clios_strcmp(p_entry->p_key, "quit") == 0) ||
+	    (clios_strcmp(p_entry->p_key, "Quit") == 0))
+		return 0;
+
+	if (p_replay->speed != 0)
+	{
+		due_ms = p_entry->offset_us / 10ULL / p_replay->speed;
+		now_ms = clios_elapsed_time_msec_get(p_replay->start_ms);
+		if (due_ms > (unsigned long long)now_ms)
+			clios_sleep_msec((clios_time_t)(due_ms - now_ms));
 	}
 
-	return IFX_ERROR;
-}
+#	if (CLI_SUPPORT_TRACE == 1)
+	cli_trace_session_set(p_entry->session);
+#	endif
 
-static int cli_dummy_if_exit(void *p_ctx)
-{
-	struct cli_dummy_interface_s *p_dummy_console = (struct cli_dummy_interface_s *) p_ctx;
+	/* "<key> <args>", the buffer is also used for the output (buffer mode) */
+	key_len = (unsigned int)clios_strlen(p_entry->p_key);
+	(void)clios_memcpy(p_replay->p_buf, p_entry->p_key, key_len + 1);
+	(void)clios_strncpy(p_replay->p_buf + key_len + 1, p_entry->p_args,
+		CLI_RECORD_BUFFER_SIZE - key_len - 2);
+	p_replay->p_buf[CLI_RECORD_BUFFER_SIZE - 1] = '\0';
 
-	p_dummy_console->b_run = IFX_FALSE;
+	switch (p_replay->p_core_ctx->cmd_core.out_mode)
+	{
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+	case cli_cmd_core_out_mode_file:
+		(void)cli_core_cmd_arg_exec__file(p_replay->p_core_ctx,
+			p_replay->p_buf, p_replay->p_buf + key_len + 1, p_replay->p_out);
+		break;
+#	endif
+#	if (CLI_SUPPORT_BUFFER_OUT == 1)
+	case cli_cmd_core_out_mode_buffer:
+		p_replay->p_buf[key_len] = ' ';
+		(void)cli_core_cmd_exec__buffer(p_replay->p_core_ctx,
+			p_replay->p_buf, CLI_RECORD_BUFFER_SIZE);
+		break;
+#	endif
+	default:
+		return -1;
+	}
 
-	return IFX_SUCCESS;
+	p_replay->n_exec++;
+
+	return 0;
 }
 
-int cli_dummy_if_start(
+int cli_core_record_replay(
 	struct cli_core_context_s *p_core_ctx,
-	unsigned int sleep_ms)
+	const char *p_path,
+	unsigned int speed,
+	clios_file_io_t *p_out)
 {
-	int retval = IFX_SUCCESS;
-	struct cli_dummy_interface_s dummy_if;
-	struct cli_user_context_s *p_user_ctx = IFX_NULL;
+	struct cli_record_replay_s replay;
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+	clios_file_t *p_null = IFX_NULL;
+#	endif
+	int ret;
+#	if (CLI_SUPPORT_TRACE == 1)
+	int session = cli_trace_session_get();
+#	endif
 
-	/* ToDo: check if quit cmd is registered */
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	dummy_if.b_run = IFX_TRUE;
-	retval = cli_user_if_register(
-		p_core_ctx, (void *)&dummy_if,
-		cli_dummy_if_exit, IFX_NULL, IFX_NULL,
-		&p_user_ctx);
+	clios_memset(&replay, 0, sizeof(replay));
+	replay.p_core_ctx = p_core_ctx;
+	replay.speed = speed;
+	replay.p_out = p_out;
 
-	if (retval != IFX_SUCCESS) {
+	replay.p_buf = (char *)clios_memalloc(CLI_RECORD_BUFFER_SIZE);
+	if (replay.p_buf == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: replay - no memory" CLI_CRLF));
 		return IFX_ERROR;
 	}
 
-	while (dummy_if.b_run == IFX_TRUE)
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+	if ((p_out == IFX_NULL) &&
+	    (p_core_ctx->cmd_core.out_mode == cli_cmd_core_out_mode_file))
 	{
-		clios_sleep_msec(sleep_ms);
+		p_null = clios_fopen("/dev/null", "w");
+		if (p_null == IFX_NULL)
+		{
+			CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: replay - open /dev/null" CLI_CRLF));
+			clios_memfree(replay.p_buf);
+			return IFX_ERROR;
+		}
+		replay.p_out = (clios_file_io_t *)p_null;
 	}
+#	endif
 
-	retval = cli_user_if_unregister(
-		p_core_ctx, &p_user_ctx);
+	replay.start_ms = clios_elapsed_time_msec_get(0);
+	ret = cli_record_read(p_path, record_replay_entry, &replay);
 
-	return retval;
+#	if (CLI_SUPPORT_TRACE == 1)
+	cli_trace_session_set(session);
+#	endif
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+	if (p_null != IFX_NULL)
+		(void)clios_fclose(p_null);
+#	endif
+	clios_memfree(replay.p_buf);
+
+	return (ret < 0) ? IFX_ERROR : replay.n_exec;
 }
+#endif	/* #if (CLI_SUPPORT_RECORD == 1) */
 
-const char *cli_cmd_name_get(struct cli_core_context_s *p_core_ctx)
+#if (CLI_SUPPORT_OUT_SINK == 1)
+int cli_core_cmd_exec__sink(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	struct cli_out_sink_s *p_sink)
 {
-	if (!p_core_ctx)
-		return IFX_NULL;
+	int ret = IFX_ERROR, b_overflow = 0;
+	unsigned long long n_dropped;
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+#		if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
+	struct cli_spec_file_io_s spec_file = {IFX_NULL, IFX_NULL, 0, 0, IFX_NULL};
+#		else
+	clios_file_io_t *p_stream;
+	struct cli_out_sink_s *p_prev;
+#		endif
+#	endif
+#	if (CLI_SUPPORT_BUFFER_OUT == 1)
+	struct cli_out_sink_s *p_active;
+	char *p_buf;
+	unsigned int len;
+#	endif
 
-	return p_core_ctx->cmd_core.curr_cmd;
-}
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
+	if ((p_cmd_arg_buf == IFX_NULL) || (p_sink == IFX_NULL))
+		return IFX_ERROR;
+	n_dropped = p_sink->n_dropped;
 
-int cli_core_inst_num_get(struct cli_core_context_s *p_core_ctx)
-{
-	if (p_core_ctx != IFX_NULL)
-		{return (int)p_core_ctx->cli_instance_num;}
+	switch (p_core_ctx->cmd_core.out_mode)
+	{
+#	if (CLI_SUPPORT_FILE_OUT == 1)
+	case cli_cmd_core_out_mode_file:
+#		if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
+		spec_file.p_sink = p_sink;
+		ret = cmd_parse_execute(p_core_ctx, p_cmd_arg_buf, 0, (clios_file_t *)&spec_file, &b_overflow);
+#		else
+		/* the handlers get the stream of the sink, the core and the
+		   handlers using cli_out_sink_get() append directly */
+		p_stream = cli_out_sink_file_get(p_sink);
+		if (p_stream == IFX_NULL)
+			return IFX_ERROR;
+		p_prev = cli_out_sink_active_set(p_sink);
+		ret = cmd_parse_execute(p_core_ctx, p_cmd_arg_buf, 0, (clios_file_t *)p_stream, &b_overflow);
+		(void)cli_out_sink_active_set(p_prev);
+#		endif
+		break;
+#	endif
+#	if (CLI_SUPPORT_BUFFER_OUT == 1)
+	case cli_cmd_core_out_mode_buffer:
+		/* the command line buffer is also the output buffer */
+		p_buf = (char *)clios_memalloc(CLI_OUT_SINK_EXEC_BUFFER_SIZE);
+		if (p_buf == IFX_NULL)
+			return IFX_ERROR;
+		(void)clios_strncpy(p_buf, p_cmd_arg_buf, CLI_OUT_SINK_EXEC_BUFFER_SIZE - 1);
+		p_buf[CLI_OUT_SINK_EXEC_BUFFER_SIZE - 1] = '\0';
+		/* handlers using the sink of the execution context append directly */
+		p_active = cli_out_sink_active_set(p_sink);
+		ret = cmd_parse_execute(p_core_ctx, p_buf, CLI_OUT_SINK_EXEC_BUFFER_SIZE, IFX_NULL, &b_overflow);
+		(void)cli_out_sink_active_set(p_active);
+		p_buf[CLI_OUT_SINK_EXEC_BUFFER_SIZE - 1] = '\0';
+		len = (unsigned int)clios_strlen(p_buf);
+		if ((len > 0) && (cli_out_sink_write(p_sink, p_buf, len) < 0))
+			ret = IFX_ERROR;
+		clios_memfree(p_buf);
+		break;
+#	endif
+	default:
+		break;
+	}
 
-	return IFX_ERROR;
+	/* a write was refused (handler, built-in command or sink), the output
+	   was cut */
+	if ((ret >= 0) && (b_overflow || (p_sink->n_dropped != n_dropped)))
+	{
+		CLI_USR_DBG(LIB_CLI, CLI_PRN_HIGH,
+			("WRN CLI Core: exec sink - output cut at %u bytes" CLI_CRLF,
+			p_sink->len));
+		ret = CLI_EXEC_TRUNCATED;
+	}
+
+	return ret;
 }
 
-int cli_core_num_of_clones_get(struct cli_core_context_s *p_core_ctx)
+int cli_core_cmd_exec__alloc(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	char **pp_out,
+	unsigned int *p_out_len)
 {
-	if (p_core_ctx != IFX_NULL)
-		{return (int)p_core_ctx->n_cli_core_clones;}
+	struct cli_out_sink_s sink;
+	int ret;
 
-	return IFX_ERROR;
-}
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-void cli_traverse(struct cli_core_context_s *p_core_ctx,
-		  int (*handler)(const char *s, void *user_data),
-		  void *user_data)
-{
-#if (CLI_SUPPORT_AUTO_COMPLETION == 1)
-	struct cli_cmd_node_s *curr = p_core_ctx->cmd_core.p_root;
+	if (pp_out == IFX_NULL)
+		return IFX_ERROR;
+	*pp_out = IFX_NULL;
 
-	cli_traverse_node(curr, handler, user_data);
-#else
-	return;
-#endif
+	(void)cli_out_sink_init(&sink);
+
+	ret = cli_core_cmd_exec__sink(p_core_ctx, p_cmd_arg_buf, &sink);
+	if (cli_out_sink_detach(&sink, pp_out, p_out_len) != IFX_SUCCESS)
+		ret = IFX_ERROR;
+
+	cli_out_sink_release(&sink);
+
+	return ret;
 }
+#endif	/* #if (CLI_SUPPORT_OUT_SINK == 1) */
 
-int cli_user_if_event(
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+int cli_core_cmd_exec__struct(
 	struct cli_core_context_s *p_core_ctx,
-	char *p_event
-)
+	char *p_cmd_arg_buf,
+	enum cli_struct_format_e format,
+	struct cli_out_sink_s *p_sink,
+	int *p_status)
 {
-	struct cli_user_context_s *p_user_ctx = IFX_NULL, *p_user_ctx_next = IFX_NULL;
+	struct cli_struct_out_s *p_so, *p_prev;
+	struct cli_out_sink_s text;
+	int ret;
 
-	if (p_core_ctx == IFX_NULL)
+	CLI_CORE_CTX_CHECK(p_core_ctx);
+
+	if ((p_sink == IFX_NULL) || (p_status == IFX_NULL))
 		return IFX_ERROR;
+	*p_status = IFX_ERROR;
 
-	p_user_ctx = p_core_ctx->p_user_head;
+	/* the record buffer is too large for the stack of the pipe threads */
+	p_so = (struct cli_struct_out_s *)clios_memalloc(sizeof(*p_so));
+	if (p_so == IFX_NULL)
+		return IFX_ERROR;
+	(void)cli_struct_out_init(p_so, format, p_sink);
+	(void)cli_out_sink_init(&text);
 
-	while (p_user_ctx)
-	{
-		p_user_ctx_next = p_user_ctx->p_next;
+	/* the handlers see the structured output (except for the text format),
+	   the text output is collected */
+	p_prev = cli_struct_out_active_set(p_so);
+	ret = cli_core_cmd_exec__sink(p_core_ctx, p_cmd_arg_buf, &text);
+	(void)cli_struct_out_active_set(p_prev);
 
-		if (p_user_ctx->event_cb_fct != IFX_NULL)
-			p_user_ctx->event_cb_fct(p_user_ctx->p_user_data, p_event);
+	if (cli_struct_out_finish(p_so, &text, ret, p_status) != IFX_SUCCESS)
+		ret = IFX_ERROR;
 
-		p_user_ctx = p_user_ctx_next;
-	}
+	cli_out_sink_release(&text);
+	clios_memfree(p_so);
 
-	return IFX_SUCCESS;
+	return ret;
 }
+#endif	/* #if (CLI_SUPPORT_STRUCT_OUT == 1) */
 
-int cli_user_if_dump(
+#if (CLI_SUPPORT_HELP_STORE == 1)
+int cli_core_help_store_set(
 	struct cli_core_context_s *p_core_ctx,
-	char *p_dump
-)
+	const struct cli_help_store_s *p_store)
 {
-	struct cli_user_context_s *p_user_ctx = IFX_NULL, *p_user_ctx_next = IFX_NULL;
+	struct cli_help_store_cache_s *p_cache = IFX_NULL;
 
-	if (p_core_ctx == IFX_NULL)
-		return IFX_ERROR;
+	CLI_CORE_CTX_CHECK(p_core_ctx);
 
-	p_user_ctx = p_core_ctx->p_user_head;
+	if (p_store == IFX_NULL)
+		return IFX_ERROR;
 
-	while (p_user_ctx)
+	/* the commands look up the store without lock */
+	if ((p_core_ctx->cmd_core.e_state == e_cli_cmd_core_active) ||
+	    (p_core_ctx->p_cli_core_parent != IFX_NULL))
 	{
-		p_user_ctx_next = p_user_ctx->p_next;
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Core: help store - CLI already active" CLI_CRLF));
+		return IFX_ERROR;
+	}
 
-		if (p_user_ctx->dump_cb_fct != IFX_NULL)
-			p_user_ctx->dump_cb_fct(p_user_ctx->p_user_data, p_dump);
+	if (cli_help_store_cache_init(&p_cache, p_store) != IFX_SUCCESS)
+		return IFX_ERROR;
 
-		p_user_ctx = p_user_ctx_next;
-	}
+	(void)clios_lockget(&p_core_ctx->lock_ctx);
+	if (p_core_ctx->p_help_store != IFX_NULL)
+		(void)cli_help_store_cache_release(&p_core_ctx->p_help_store);
+	p_core_ctx->p_help_store = p_cache;
+	(void)clios_lockrelease(&p_core_ctx->lock_ctx);
 
 	return IFX_SUCCESS;
 }
+#endif	/* #if (CLI_SUPPORT_HELP_STORE == 1) */
@@ -93,6 +93,12 @@
    group. Therefore the user has to provide the requried group setup:
    - List of all group description (description)
    - List of all search keys + group assignment
+
+   With the group index (CLI_SUPPORT_GROUP_INDEX) up to 256 groups are
+   supported, the search keys are matched with a prefix trie and each command
+   keeps a tag per group (\ref cli_core_cmd_group_add for more groups).
+   On activation the commands of each group are listed, "help <group>" and
+   \ref cli_traverse_group visit only the commands of the group.
 */
 
 /** @} */
@@ -113,6 +119,65 @@ extern "C" {
 /** this version supports multiple instance support (see cli_core_clone) */
 #define CLI_HAVE_MULTIPLE_INSTANCE_SUPPORT	1
 
+/** this version supports the persistent event journal (see cli_core_journal_open) */
+#define CLI_HAVE_EVENT_JOURNAL_SUPPORT	CLI_SUPPORT_JOURNAL
+
+/** this version supports event coalescing / rate limiting (see cli_core_event_limit_set) */
+#define CLI_HAVE_EVENT_LIMIT_SUPPORT	CLI_SUPPORT_EVENT_LIMIT
+
+/** this version supports per command statistics (see cli_core_stats_get) */
+#define CLI_HAVE_STATS_SUPPORT	CLI_SUPPORT_STATS
+
+/** this version supports the flight recorder (see cli_core_trace_read) */
+#define CLI_HAVE_TRACE_SUPPORT	CLI_SUPPORT_TRACE
+
+/** this version supports the OpenMetrics exporter (see cli_core_metrics_render) */
+#define CLI_HAVE_METRICS_SUPPORT	CLI_SUPPORT_METRICS
+
+/** this version supports the command recording (see cli_core_record_start) */
+#define CLI_HAVE_RECORD_SUPPORT	CLI_SUPPORT_RECORD
+
+/** this version supports the buffered output sink (see cli_core_cmd_exec__sink) */
+#define CLI_HAVE_OUT_SINK_SUPPORT	CLI_SUPPORT_OUT_SINK
+
+/** this version supports the typed output builder (see cli_out_builder_init__buffer) */
+#define CLI_HAVE_OUT_BUILDER_SUPPORT	CLI_SUPPORT_OUT_BUILDER
+
+/** this version supports the structured output (see cli_core_cmd_exec__struct) */
+#define CLI_HAVE_STRUCT_OUT_SUPPORT	CLI_SUPPORT_STRUCT_OUT
+
+/** this version supports the compressed help store (see cli_core_help_store_set) */
+#define CLI_HAVE_HELP_STORE_SUPPORT	CLI_SUPPORT_HELP_STORE
+
+/** this version supports the group index (see cli_core_cmd_group_add) */
+#define CLI_HAVE_GROUP_INDEX_SUPPORT	CLI_SUPPORT_GROUP_INDEX
+
+/** this version supports the apropos index (see \ref LIB_CLI_APROPOS) */
+#define CLI_HAVE_APROPOS_SUPPORT	CLI_SUPPORT_APROPOS
+
+/** this version supports hierarchical commands (see cli_core_key_add_path__file) */
+#define CLI_HAVE_NAMESPACE_SUPPORT	CLI_SUPPORT_NAMESPACE
+
+/** this version supports command execution hooks (see cli_core_hook_add) */
+#define CLI_HAVE_HOOKS_SUPPORT	CLI_SUPPORT_HOOKS
+
+/** this version supports the per call execution context (see cli_exec_ctx_get) */
+#define CLI_HAVE_EXEC_CTX_SUPPORT	CLI_SUPPORT_THREAD_LOCAL
+
+/** this version supports sessions on a shared command table (see cli_session_open) */
+#define CLI_HAVE_SESSION_SUPPORT	CLI_SUPPORT_SESSION
+
+/** this version supports the executor pool (see cli_pool_init) */
+#define CLI_HAVE_POOL_SUPPORT	CLI_SUPPORT_POOL
+
+/** this version supports the asynchronous command execution
+   (see cli_core_cmd_exec_async) */
+#define CLI_HAVE_ASYNC_SUPPORT	CLI_SUPPORT_ASYNC
+
+
+/** return value of a buffer mode execution: the command was executed, but
+   the output exceeded the output buffer and was cut */
+#define CLI_EXEC_TRUNCATED	(-1000)
 
 /** empty command name */
 #define CLI_EMPTY_CMD		" "
@@ -122,16 +187,67 @@ extern "C" {
 /** User selection mask all - allows to group commands from user side */
 #define CLI_USER_MASK_ALL	0x0000FFFF
 
+/** Registration flag (given with the selection mask): the command only
+   reads, the executor pool runs it concurrently with other such commands
+   (see \ref cli_core_cmd_concurrent_get). Commands without the flag are
+   executed exclusively by the pool, the built-in commands concurrently. */
+#define CLI_CMD_MASK_CONCURRENT	0x00100000
+
 /** Register build-in command "Help" */
 #define CLI_BUILDIN_REG_HELP	0x00000001
 /** Register build-in command "Quit" */
 #define CLI_BUILDIN_REG_QUIT	0x00000002
 /** Register build-in command "What" */
 #define CLI_BUILDIN_REG_WHAT	0x00000004
+/** Register build-in command "Journal" (see \ref LIB_CLI_JOURNAL) */
+#define CLI_BUILDIN_REG_JOURNAL	0x00000008
+/** Register build-in command "Event Limit" (see \ref LIB_CLI_EVENT_LIMIT) */
+#define CLI_BUILDIN_REG_EVENT_LIMIT	0x00000010
+/** Register build-in command "Statistics" (see \ref LIB_CLI_STATS) */
+#define CLI_BUILDIN_REG_STATS	0x00000020
+/** Register build-in command "Trace" (see \ref LIB_CLI_TRACE) */
+#define CLI_BUILDIN_REG_TRACE	0x00000040
+/** Register build-in command "Metrics" (see \ref LIB_CLI_METRICS) */
+#define CLI_BUILDIN_REG_METRICS	0x00000080
+/** Register build-in command "Record" (see \ref LIB_CLI_RECORD) */
+#define CLI_BUILDIN_REG_RECORD	0x00000100
+/** Register build-in command "Format" (see \ref LIB_CLI_STRUCT_OUT) */
+#define CLI_BUILDIN_REG_FORMAT	0x00000200
+/** Register build-in command "Apropos" (see \ref LIB_CLI_APROPOS) */
+#define CLI_BUILDIN_REG_APROPOS	0x00000400
 
 /** Forward declaration, file IO */
 typedef void clios_file_io_t;
 
+/** Forward declaration, output sink */
+struct cli_out_sink_s;
+
+/** Forward declaration, session on a shared command table */
+struct cli_session_s;
+
+/** Execution context of a command handler call, set up by the CLI core for
+   each call in the calling thread (see \ref cli_exec_ctx_get). Concurrent
+   executions on one CLI core have their own context. */
+struct cli_exec_ctx_s
+{
+	/** CLI core of the execution */
+	struct cli_core_context_s *p_core_ctx;
+	/** command name (key as entered, path of a path command) */
+	const char *p_cmd;
+	/** session of the calling thread (pipe number), -1: none */
+	int session;
+	/** output sink (see cli_core_cmd_exec__sink), IFX_NULL: none */
+	struct cli_out_sink_s *p_sink;
+	/** cancel request (see \ref cli_exec_cancel) */
+	int b_cancel;
+	/** outer context of the thread (nested execution), IFX_NULL: none */
+	struct cli_exec_ctx_s *p_outer;
+	/** session of the execution (see cli_session_open), IFX_NULL: none */
+	struct cli_session_s *p_session;
+	/** output refused, the output is cut (see \ref cli_exec_overflow_set) */
+	int b_overflow;
+};
+
 #if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
 /** Special IO file type */
 struct cli_spec_file_io_s
@@ -142,6 +258,10 @@ struct cli_spec_file_io_s
    char *p_buffer;
    /** memory buffer size*/
    unsigned int buffer_size;
+   /** memory buffer append cursor */
+   unsigned int buffer_len;
+   /** output sink (see \ref LIB_CLI_OUT_SINK), used if set */
+   struct cli_out_sink_s *p_sink;
 };
 #endif
 
@@ -195,6 +315,21 @@ struct cli_group_key_entry_s
 	unsigned char group_num;
 };
 
+/** Usage metadata of a CLI command (see \ref cli_core_key_add_ext__buffer).
+   The core answers the help request ("-h", "--help", "/h", "-?") of the
+   command and prints the detailed help without calling the handler.
+   The data is not copied and must be valid while the context exists. */
+struct cli_cmd_meta_s
+{
+	/** description of the input / output parameters, the core prints the
+	    names and the argument summary in front */
+	char const *p_usage;
+	/** argument summary (optional), i.e. "<index> [<value>]" */
+	char const *p_args;
+	/** user given group assignment */
+	unsigned int group_mask;
+};
+
 /** Buffer printout, user CLI function type
    For the buffer printout a user CLI function must have this form.
 
@@ -291,7 +426,7 @@ extern int cli_sscanf(const char *buf, char const *fmt, ...);
 
 \return
    IFX_SUCCESS - operation done
-   IFX_ERROR - failed.
+   IFX_ERROR - failed (the command table is in use by clones or sessions).
 
 \ingroup LIB_CLI_CORE
 */
@@ -341,6 +476,12 @@ extern int cli_core_cfg_mode_active(
    IFX_SUCCESS - operation done
    IFX_ERROR - failed.
 
+\remarks
+   The command table is shared with the clones and the sessions
+   (see \ref cli_session_open). While they exist, the release is deferred
+   and done with the release of the last clone / session, the clones and
+   sessions can be released in any order.
+
 \ingroup LIB_CLI_CORE
 */
 extern int cli_core_release(
@@ -390,6 +531,28 @@ extern int cli_core_user_group_init(
 	char const *p_group_list[],
 	struct cli_group_key_entry_s const *p_key_entries);
 
+/** Add a registered command to a further group (group index only),
+   possible after the registration and before the CLI is activated
+   (\ref cli_core_cfg_mode_active).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_long_name  long name of the command.
+\param
+   group_num  group number (see \ref cli_core_user_group_init).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (unknown command or group, wrong state).
+
+\ingroup LIB_CLI_CORE_GROUP
+*/
+extern int cli_core_cmd_group_add(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_long_name,
+	unsigned int group_num);
+
 
 /** Register the built-in CLI commands.
    Therefore the commands are selected via a mask.
@@ -508,6 +671,118 @@ extern int cli_core_key_add__file(
 	char const *p_long_name,
 	cli_cmd_user_fct_file_t cli_cmd_user_fct_file);
 
+/** Command Registration - add a CLI command with usage metadata.
+   The handler is not called for the help request of the command.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_short_name  points to the short CLI Command name.
+\param
+   p_long_name  points to the long CLI Command name.
+\param
+   p_meta  usage and group of the command (not copied).
+\param
+   cli_cmd_user_fct_buf  points to the CLI function to execute (buffer printout)
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+
+\ingroup LIB_CLI_CORE_BUF_OUT
+*/
+extern int cli_core_key_add_ext__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_short_name,
+	char const *p_long_name,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf);
+
+/** Command Registration - add a CLI command with usage metadata.
+   The handler is not called for the help request of the command.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_short_name  points to the short CLI Command name.
+\param
+   p_long_name  points to the long CLI Command name.
+\param
+   p_meta  usage and group of the command (not copied).
+\param
+   cli_cmd_user_fct_file  points to the CLI function to execute (file printout)
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+
+\ingroup LIB_CLI_CORE_FILE_OUT
+*/
+extern int cli_core_key_add_ext__file(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_short_name,
+	char const *p_long_name,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_file_t cli_cmd_user_fct_file);
+
+/** Command Registration - add a CLI command with a path of tokens
+   (hierarchical namespace, see \ref LIB_CLI_NS), i.e. "gpe table entry get".
+   The path with single spaces is the long name of the command.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_short_name  points to the short CLI Command name, CLI_EMPTY_CMD: none.
+\param
+   p_path  points to the path, tokens separated by white spaces (copied).
+\param
+   p_meta  usage and group of the command (not copied),
+           IFX_NULL: the handler answers the help request.
+\param
+   cli_cmd_user_fct_buf  points to the CLI function to execute (buffer printout)
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+
+\ingroup LIB_CLI_CORE_BUF_OUT
+*/
+extern int cli_core_key_add_path__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_short_name,
+	char const *p_path,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_buf_t cli_cmd_user_fct_buf);
+
+/** Command Registration - add a CLI command with a path of tokens
+   (hierarchical namespace, see \ref LIB_CLI_NS), i.e. "gpe table entry get".
+   The path with single spaces is the long name of the command.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_short_name  points to the short CLI Command name, CLI_EMPTY_CMD: none.
+\param
+   p_path  points to the path, tokens separated by white spaces (copied).
+\param
+   p_meta  usage and group of the command (not copied),
+           IFX_NULL: the handler answers the help request.
+\param
+   cli_cmd_user_fct_file  points to the CLI function to execute (file printout)
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+
+\ingroup LIB_CLI_CORE_FILE_OUT
+*/
+extern int cli_core_key_add_path__file(
+	struct cli_core_context_s *p_core_ctx,
+	char const *p_short_name,
+	char const *p_path,
+	const struct cli_cmd_meta_s *p_meta,
+	cli_cmd_user_fct_file_t cli_cmd_user_fct_file);
+
 /** Command Execution - executes a CLI command.
 
 \param
@@ -529,6 +804,88 @@ extern int cli_core_cmd_exec__buffer(
 	char *p_cmd_arg_buf,
 	const unsigned int buffer_size);
 
+/** Forward declaration, cursor of a continued buffer mode execution */
+struct cli_exec_cursor_s;
+
+/** Command Execution - executes a CLI command, the output is returned in
+   chunks of the user buffer size.
+
+   The first call (*pp_cursor == IFX_NULL) executes the command and returns
+   the first chunk. If more output is pending, a cursor is returned and the
+   following calls with this cursor return the next chunks (the command is
+   not executed again). The cursor is released with the last chunk.
+
+\code
+   struct cli_exec_cursor_s *p_cursor = IFX_NULL;
+
+   strcpy(buf, "help");
+   do {
+      ret = cli_core_cmd_exec_cont__buffer(p_core_ctx, buf, sizeof(buf), &p_cursor);
+      ... deliver buf ...
+   } while (p_cursor != IFX_NULL);
+\endcode
+
+\remarks
+   The output is not streamed: the command is executed once into a buffer of
+   \ref CLI_EXEC_CURSOR_BUFFER_SIZE bytes (see
+   \ref cli_core_exec_cursor_size_set), which bounds the complete output, and
+   the chunks are taken from this buffer.
+   If a write was refused (built-in commands, \ref cli_exec_overflow_set),
+   the output was cut and all chunks return CLI_EXEC_TRUNCATED. A chunk ends
+   with a complete line if the chunk contains a line end.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_cmd_arg_buf  points to the user buffer which contains the command (+ args)
+      on the first call and which is used to return the output chunk.
+\param
+   buffer_size  size of the user buffer (at least 2 bytes).
+\param
+   pp_cursor  cursor, IFX_NULL on the first call, returns IFX_NULL if no more
+      output is pending.
+
+\return
+   return value of the command execution
+   CLI_EXEC_TRUNCATED - executed, the output was cut.
+   IFX_ERROR - failed (the cursor is released).
+
+\ingroup LIB_CLI_CORE_BUF_OUT
+*/
+extern int cli_core_cmd_exec_cont__buffer(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	const unsigned int buffer_size,
+	struct cli_exec_cursor_s **pp_cursor);
+
+/** Set the output buffer size of the continued executions of a CLI core,
+   e.g. for the complete help listing of a large command tree.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   size  output buffer size [bytes] (at least 256), 0: CLI_EXEC_CURSOR_BUFFER_SIZE.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+
+\ingroup LIB_CLI_CORE_BUF_OUT
+*/
+extern int cli_core_exec_cursor_size_set(
+	struct cli_core_context_s *p_core_ctx,
+	const unsigned int size);
+
+/** Release the cursor of a continued execution (abort before the last chunk).
+
+\param
+   pp_cursor  cursor, set to IFX_NULL.
+
+\ingroup LIB_CLI_CORE_BUF_OUT
+*/
+extern void cli_core_exec_cursor_release(
+	struct cli_exec_cursor_s **pp_cursor);
+
 /** Command Execution - executes a CLI command.
 
 \param
@@ -601,6 +958,8 @@ extern int cli_core_setup__file(
 
 \remarks
    Take over the command search tree and group config from the parent CLI core - no mem alloc.
+   The clone holds a reference to the parent, the release of the parent is
+   deferred until all clones are released.
 
 \param
    p_core_ctx_parent  points to the parent (reference) CLI Core.
@@ -741,6 +1100,10 @@ extern int cli_dummy_if_start(
    CLI command handler itself, so it may be used by the command handler
    to get the name of the command that's being executed in case when the same
    handler has been registered for different commands.
+   The name is taken from the execution context of the calling thread
+   (see \ref cli_exec_ctx_get), concurrent executions on one CLI core get
+   their own name. Without thread local storage (kernel) the name of the
+   last started execution of the CLI core is returned.
 
 \param
    p_core_ctx  CLI context pointer.
@@ -755,6 +1118,63 @@ extern int cli_dummy_if_start(
 */
 extern const char *cli_cmd_name_get(struct cli_core_context_s *p_core_ctx);
 
+/** Get the execution context of the command handler running in the calling
+   thread.
+
+\remarks
+   The context is valid until the handler returns.
+   Without thread local storage (kernel, CLI_SUPPORT_THREAD_LOCAL == 0) the
+   per call context is not available to the handler.
+
+\return
+   execution context
+   IFX_NULL - not called within a command handler or no thread local storage.
+
+\ingroup LIB_CLI_CORE
+*/
+extern struct cli_exec_ctx_s *cli_exec_ctx_get(void);
+
+/** Request the cancellation of a running command, e.g. from a watchdog
+   thread. The handler checks the request with \ref cli_exec_cancelled.
+
+\param
+   p_exec_ctx  execution context of the command.
+
+\ingroup LIB_CLI_CORE
+*/
+extern void cli_exec_cancel(
+	struct cli_exec_ctx_s *p_exec_ctx);
+
+/** Check for a cancel request (within a command handler).
+
+\param
+   p_exec_ctx  execution context, IFX_NULL: context of the calling thread.
+
+\return
+   1 - cancellation requested
+   0 - else
+
+\ingroup LIB_CLI_CORE
+*/
+extern int cli_exec_cancelled(
+	const struct cli_exec_ctx_s *p_exec_ctx);
+
+/** Report a refused write (within a command handler), e.g. a buffer mode
+   handler which stops with the first line that does not fit. The caller
+   gets CLI_EXEC_TRUNCATED (see \ref cli_core_cmd_exec_cont__buffer).
+
+\remarks
+   The built-in commands and the output sink report their refused writes.
+   Without thread local storage (kernel) only an explicit context is marked.
+
+\param
+   p_exec_ctx  execution context, IFX_NULL: context of the calling thread.
+
+\ingroup LIB_CLI_CORE
+*/
+extern void cli_exec_overflow_set(
+	struct cli_exec_ctx_s *p_exec_ctx);
+
 
 /** Returns the instance number of the given CLI Core.
 
@@ -783,6 +1203,63 @@ extern int cli_core_inst_num_get(struct cli_core_context_s *p_core_ctx);
 */
 extern int cli_core_num_of_clones_get(struct cli_core_context_s *p_core_ctx);
 
+/** Set the directory for the files written by the built-in commands
+   ("metrics <name>", "record start <name>"). The commands accept a plain file name within this
+   directory only, without a directory they do not write files. The C API
+   functions (e.g. cli_core_metrics_file_write) take any path.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_dir  directory, IFX_NULL: no file output of the built-in commands.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+
+\ingroup LIB_CLI_CORE
+*/
+extern int cli_core_file_dir_set(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_dir);
+
+/** Check if command lines may run concurrently (executor pool scheduling).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_cmd_lines  command lines (separated by line ends).
+
+\return
+   IFX_TRUE - all commands are registered with \ref CLI_CMD_MASK_CONCURRENT
+              or are built-in commands (unknown commands are not checked)
+   IFX_FALSE - at least one command is executed exclusively.
+
+\ingroup LIB_CLI_CORE
+*/
+extern int cli_core_cmd_concurrent_get(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd_lines);
+
+/** Check if command lines are help requests (executor pool, interactive
+   lane).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_cmd_lines  command lines (separated by line ends).
+
+\return
+   IFX_TRUE - all commands are help requests ("help" or a help token
+              as first argument, for example "-h")
+   IFX_FALSE - at least one other command, no command.
+
+\ingroup LIB_CLI_CORE
+*/
+extern int cli_core_cmd_interactive_get(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_cmd_lines);
+
 
 /** Iterate over all registered CLI commands
 
@@ -800,6 +1277,53 @@ extern void cli_traverse(struct cli_core_context_s *p_core_ctx,
 		int (*handler)(const char *s, void *user_data),
 		void *user_data);
 
+/** Iterate over the CLI commands of a group (short and long names),
+   e.g. for a group filtered completion (group index only).
+
+\param
+   p_core_ctx  CLI context pointer
+\param
+   group_num  group number (see \ref cli_core_user_group_init)
+\param
+   handler  Handler which is called for each name, stops on a non zero return
+\param
+   user_data  Data passed to handler
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (unknown group, no group index).
+
+\ingroup LIB_CLI_CORE_GROUP
+*/
+extern int cli_traverse_group(struct cli_core_context_s *p_core_ctx,
+		unsigned int group_num,
+		int (*handler)(const char *s, void *user_data),
+		void *user_data);
+
+/** Iterate over the sub-commands of a level of the hierarchical namespace
+   (tokens), e.g. for the completion of the next token.
+
+\param
+   p_core_ctx  CLI context pointer
+\param
+   p_path  path of the level, tokens separated by white spaces,
+           IFX_NULL or "": first level
+\param
+   handler  Handler which is called for each token, stops on a non zero return
+\param
+   user_data  Data passed to handler
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - unknown level or not supported.
+
+\ingroup LIB_CLI_CORE
+*/
+extern int cli_traverse_level(struct cli_core_context_s *p_core_ctx,
+		const char *p_path,
+		int (*handler)(const char *s, void *user_data),
+		void *user_data);
+
 
 /** Issues the event callback for all registered user interfaces.
 
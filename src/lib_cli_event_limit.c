@@ -0,0 +1,815 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_event_limit.c
+   Command Line Interface - event coalescing and rate limiting
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+#include "lib_cli_event_limit.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** token bucket resolution, 1 token = 1000 milli tokens */
+#define CLI_EVENT_LIMIT_TOKEN	1000
+
+/** time a is equal or later than time b (wrap around safe) */
+#define CLI_EVENT_LIMIT_TIME_AFTER_EQ(a, b)	((int)((a) - (b)) >= 0)
+
+/** Event limiter state of a single event key */
+struct cli_event_limit_key_s
+{
+	/** event key, empty if the entry is unused */
+	char key[CLI_EVENT_LIMIT_KEY_SIZE];
+	/** hash of the event key */
+	unsigned int hash;
+	/** index of the assigned rule */
+	unsigned int rule_idx;
+	/** end of the current coalescing window */
+	clios_time_t window_end;
+	/** last token bucket refill */
+	clios_time_t last_refill;
+	/** available tokens [milli tokens] */
+	unsigned int tokens;
+	/** number of events represented by the pending text */
+	unsigned int n_pending;
+	/** latest (pending) event text */
+	char text[CLI_EVENT_LIMIT_TEXT_SIZE];
+};
+
+/** Event limiter rule */
+struct cli_event_limit_rule_s
+{
+	/** rule key (without the trailing '*') */
+	char key[CLI_EVENT_LIMIT_KEY_SIZE];
+	/** rule key matches all keys with this prefix */
+	IFX_boolean_t b_prefix;
+	/** length of the rule key */
+	unsigned int key_len;
+	/** coalescing window [ms] */
+	unsigned int window_ms;
+	/** max number of events per second */
+	unsigned int rate;
+	/** token bucket size */
+	unsigned int burst;
+	/** number of delivered events */
+	unsigned long n_passed;
+	/** number of collapsed events */
+	unsigned long n_coalesced;
+	/** number of events limited via the overflow state (key table full) */
+	unsigned long n_overflow;
+	/** shared state of all keys of this rule which found no free entry */
+	struct cli_event_limit_key_s overflow;
+};
+
+/** Event limiter context */
+struct cli_event_limit_s
+{
+	/** protects the rules and the key table */
+	IFXOS_lock_t lock;
+	/** number of rules */
+	unsigned int n_rules;
+	/** rule table */
+	struct cli_event_limit_rule_s rules[CLI_EVENT_LIMIT_MAX_RULES];
+	/** number of used key entries */
+	unsigned int n_keys;
+	/** number of key entries with a pending event */
+	unsigned int n_pending_keys;
+	/** earliest due time of all pending events */
+	clios_time_t next_due;
+	/** key table (hash, linear probing) */
+	struct cli_event_limit_key_s keys[CLI_EVENT_LIMIT_MAX_KEYS];
+};
+
+/** Extract the event key (first word of the event text)
+
+\return
+   length of the key
+*/
+CLI_STATIC unsigned int event_key_get(
+	const char *p_event,
+	char *p_key,
+	unsigned int *p_hash)
+{
+	unsigned int len = 0, hash = 2166136261U;
+
+	while ((len < (CLI_EVENT_LIMIT_KEY_SIZE - 1)) &&
+	       (p_event[len] != '\0') && (p_event[len] != ' ') &&
+	       (p_event[len] != '\t') && (p_event[len] != '\r') &&
+	       (p_event[len] != '\n'))
+	{
+		p_key[len] = p_event[len];
+		hash = (hash ^ (unsigned char)p_event[len]) * 16777619U;
+		len++;
+	}
+	p_key[len] = '\0';
+	*p_hash = hash;
+
+	return len;
+}
+
+/** Find the best matching rule: exact match, else the longest prefix.
+
+\return
+   rule index
+   -1 - no matching rule
+*/
+CLI_STATIC int event_rule_match(
+	struct cli_event_limit_s *p_limit,
+	const char *p_key)
+{
+	unsigned int i;
+	int best = -1;
+
+	for (i = 0; i < p_limit->n_rules; i++)
+	{
+		struct cli_event_limit_rule_s *p_rule = &p_limit->rules[i];
+
+		if (p_rule->b_prefix == IFX_FALSE)
+		{
+			if (clios_strcmp(p_key, p_rule->key) == 0)
+				return (int)i;
+		}
+		else if (clios_strncmp(p_key, p_rule->key, p_rule->key_len) == 0)
+		{
+			if ((best < 0) || (p_rule->key_len > p_limit->rules[best].key_len))
+				best = (int)i;
+		}
+	}
+
+	return best;
+}
+
+/** Check if a key entry is idle - nothing pending and the state is the same
+   as of a fresh entry (window expired, token bucket full).
+*/
+CLI_STATIC IFX_boolean_t event_key_idle(
+	struct cli_event_limit_s *p_limit,
+	struct cli_event_limit_key_s *p_entry,
+	clios_time_t now)
+{
+	struct cli_event_limit_rule_s *p_rule = &p_limit->rules[p_entry->rule_idx];
+	unsigned long long tokens;
+
+	if (p_entry->n_pending != 0)
+		return IFX_FALSE;
+
+	if ((p_rule->window_ms != 0) &&
+	    !CLI_EVENT_LIMIT_TIME_AFTER_EQ(now, p_entry->window_end))
+		return IFX_FALSE;
+
+	if (p_rule->rate != 0)
+	{
+		tokens = (unsigned long long)p_entry->tokens +
+			(unsigned long long)(clios_time_t)(now - p_entry->last_refill) * p_rule->rate;
+		if (tokens < (unsigned long long)p_rule->burst * CLI_EVENT_LIMIT_TOKEN)
+			return IFX_FALSE;
+	}
+
+	return IFX_TRUE;
+}
+
+/** Remove a key entry, following entries of the probe sequence are moved
+   back (no tombstones required for linear probing).
+*/
+CLI_STATIC void event_key_remove(
+	struct cli_event_limit_s *p_limit,
+	unsigned int idx)
+{
+	unsigned int next = idx, home;
+
+	for (;;)
+	{
+		p_limit->keys[idx].key[0] = '\0';
+		for (;;)
+		{
+			next = (next + 1) % CLI_EVENT_LIMIT_MAX_KEYS;
+			if (p_limit->keys[next].key[0] == '\0')
+			{
+				p_limit->n_keys--;
+				return;
+			}
+			home = p_limit->keys[next].hash % CLI_EVENT_LIMIT_MAX_KEYS;
+			/* move the entry unless its home slot is within (idx, next] */
+			if ((idx < next) ? ((home <= idx) || (home > next)) :
+			                   ((home <= idx) && (home > next)))
+				break;
+		}
+		p_limit->keys[idx] = p_limit->keys[next];
+		idx = next;
+	}
+}
+
+/** Remove all idle key entries.
+
+\return
+   number of removed entries
+*/
+CLI_STATIC unsigned int event_keys_evict(
+	struct cli_event_limit_s *p_limit,
+	clios_time_t now)
+{
+	unsigned int i, n_removed = 0;
+
+	for (i = 0; i < CLI_EVENT_LIMIT_MAX_KEYS; i++)
+	{
+		/* a moved back entry lands on i, check it again */
+		while ((p_limit->keys[i].key[0] != '\0') &&
+		       (event_key_idle(p_limit, &p_limit->keys[i], now) == IFX_TRUE))
+		{
+			event_key_remove(p_limit, i);
+			n_removed++;
+		}
+	}
+
+	return n_removed;
+}
+
+/** Initialize the state of a new key entry */
+CLI_STATIC void event_key_init(
+	struct cli_event_limit_s *p_limit,
+	struct cli_event_limit_key_s *p_entry,
+	const char *p_key,
+	unsigned int hash,
+	unsigned int rule_idx,
+	clios_time_t now)
+{
+	clios_strcpy(p_entry->key, p_key);
+	p_entry->hash = hash;
+	p_entry->rule_idx = rule_idx;
+	p_entry->window_end = now;
+	p_entry->last_refill = now;
+	p_entry->tokens = p_limit->rules[rule_idx].burst * CLI_EVENT_LIMIT_TOKEN;
+	p_entry->n_pending = 0;
+}
+
+/** Find or create the state entry of an event key.
+   If the key table is full, the idle entries are evicted. If all entries
+   are still in use, the key shares the overflow state of its rule.
+
+\return
+   key entry
+   IFX_NULL - no rule for this key.
+*/
+CLI_STATIC struct cli_event_limit_key_s *event_key_lookup(
+	struct cli_event_limit_s *p_limit,
+	const char *p_key,
+	unsigned int hash,
+	clios_time_t now)
+{
+	struct cli_event_limit_key_s *p_entry = IFX_NULL;
+	struct cli_event_limit_rule_s *p_rule;
+	unsigned int i, idx = hash % CLI_EVENT_LIMIT_MAX_KEYS;
+	int rule_idx;
+
+	/* empty key marks an unused entry */
+	if (p_key[0] == '\0')
+		return IFX_NULL;
+
+	for (i = 0; i < CLI_EVENT_LIMIT_MAX_KEYS; i++)
+	{
+		p_entry = &p_limit->keys[idx];
+		if (p_entry->key[0] == '\0')
+			break;
+		if (clios_strcmp(p_entry->key, p_key) == 0)
+			return p_entry;
+		idx = (idx + 1) % CLI_EVENT_LIMIT_MAX_KEYS;
+	}
+
+	rule_idx = event_rule_match(p_limit, p_key);
+	if (rule_idx < 0)
+		return IFX_NULL;
+	p_rule = &p_limit->rules[rule_idx];
+
+	if ((i == CLI_EVENT_LIMIT_MAX_KEYS) && (event_keys_evict(p_limit, now) > 0))
+	{
+		/* the key is not in the table, take the first free entry */
+		idx = hash % CLI_EVENT_LIMIT_MAX_KEYS;
+		while (p_limit->keys[idx].key[0] != '\0')
+			idx = (idx + 1) % CLI_EVENT_LIMIT_MAX_KEYS;
+		p_entry = &p_limit->keys[idx];
+		i = 0;
+	}
+
+	if (i == CLI_EVENT_LIMIT_MAX_KEYS)
+	{
+		/* all entries in use, limit the key together with the other
+		   overflowed keys of the same rule */
+		p_entry = &p_rule->overflow;
+		if (p_entry->key[0] == '\0')
+			event_key_init(p_limit, p_entry, "*", 0, (unsigned int)rule_idx, now);
+		p_rule->n_overflow++;
+		return p_entry;
+	}
+
+	event_key_init(p_limit, p_entry, p_key, hash, (unsigned int)rule_idx, now);
+	p_limit->n_keys++;
+
+	return p_entry;
+}
+
+/** Refill the token bucket and take a token.
+
+\return
+   IFX_TRUE - token available (and taken)
+   IFX_FALSE - rate exceeded
+*/
+CLI_STATIC IFX_boolean_t event_token_take(
+	struct cli_event_limit_rule_s *p_rule,
+	struct cli_event_limit_key_s *p_entry,
+	clios_time_t now)
+{
+	unsigned long long tokens;
+
+	if (p_rule->rate == 0)
+		return IFX_TRUE;
+
+	tokens = (unsigned long long)p_entry->tokens +
+		(unsigned long long)(clios_time_t)(now - p_entry->last_refill) * p_rule->rate;
+	if (tokens > (unsigned long long)p_rule->burst * CLI_EVENT_LIMIT_TOKEN)
+		tokens = (unsigned long long)p_rule->burst * CLI_EVENT_LIMIT_TOKEN;
+	p_entry->tokens = (unsigned int)tokens;
+	p_entry->last_refill = now;
+
+	if (p_entry->tokens < CLI_EVENT_LIMIT_TOKEN)
+		return IFX_FALSE;
+
+	p_entry->tokens -= CLI_EVENT_LIMIT_TOKEN;
+	return IFX_TRUE;
+}
+
+/** Check if an event of the given key can be delivered now.
+   If so, a token is taken and the next coalescing window is started.
+*/
+CLI_STATIC IFX_boolean_t event_deliver_check(
+	struct cli_event_limit_rule_s *p_rule,
+	struct cli_event_limit_key_s *p_entry,
+	clios_time_t now)
+{
+	if ((p_rule->window_ms != 0) &&
+	    !CLI_EVENT_LIMIT_TIME_AFTER_EQ(now, p_entry->window_end))
+		return IFX_FALSE;
+
+	if (event_token_take(p_rule, p_entry, now) == IFX_FALSE)
+		return IFX_FALSE;
+
+	p_entry->window_end = now + p_rule->window_ms;
+	p_rule->n_passed++;
+
+	return IFX_TRUE;
+}
+
+/** Time when the pending event of the given key can be delivered */
+CLI_STATIC clios_time_t event_due_get(
+	struct cli_event_limit_rule_s *p_rule,
+	struct cli_event_limit_key_s *p_entry,
+	clios_time_t now)
+{
+	clios_time_t due = now, due_token;
+
+	if ((p_rule->window_ms != 0) &&
+	    !CLI_EVENT_LIMIT_TIME_AFTER_EQ(now, p_entry->window_end))
+		due = p_entry->window_end;
+
+	if ((p_rule->rate != 0) && (p_entry->tokens < CLI_EVENT_LIMIT_TOKEN))
+	{
+		due_token = p_entry->last_refill +
+			(CLI_EVENT_LIMIT_TOKEN - p_entry->tokens + p_rule->rate - 1) / p_rule->rate;
+		if (CLI_EVENT_LIMIT_TIME_AFTER_EQ(due_token, due))
+			due = due_token;
+	}
+
+	return due;
+}
+
+/** Copy out the pending event of the given key (if it is due).
+
+\return
+   IFX_TRUE - pending event copied to p_out
+   IFX_FALSE - nothing to deliver
+*/
+CLI_STATIC IFX_boolean_t event_pending_take(
+	struct cli_event_limit_s *p_limit,
+	struct cli_event_limit_key_s *p_entry,
+	clios_time_t now,
+	char *p_out,
+	unsigned int out_size)
+{
+	struct cli_event_limit_rule_s *p_rule = &p_limit->rules[p_entry->rule_idx];
+
+	if (p_entry->n_pending == 0)
+		return IFX_FALSE;
+
+	if (event_deliver_check(p_rule, p_entry, now) == IFX_FALSE)
+		return IFX_FALSE;
+
+	if (p_entry->n_pending > 1)
+		(void)clios_snprintf(p_out, out_size, "%s coalesced=%u",
+			p_entry->text, p_entry->n_pending);
+	else
+		(void)clios_snprintf(p_out, out_size, "%s", p_entry->text);
+
+	p_entry->n_pending = 0;
+	p_limit->n_pending_keys--;
+
+	return IFX_TRUE;
+}
+
+/** Reset the state of all keys (rules changed) */
+CLI_STATIC void event_keys_reset(
+	struct cli_event_limit_s *p_limit)
+{
+	unsigned int i;
+
+	clios_memset(p_limit->keys, 0x00, sizeof(p_limit->keys));
+	for (i = 0; i < p_limit->n_rules; i++)
+		clios_memset(&p_limit->rules[i].overflow, 0x00,
+			sizeof(struct cli_event_limit_key_s));
+	p_limit->n_keys = 0;
+	p_limit->n_pending_keys = 0;
+}
+
+/** Key entry by index - the key table followed by the overflow states of the rules.
+
+\return
+   key entry
+   IFX_NULL - index out of range.
+*/
+CLI_STATIC struct cli_event_limit_key_s *event_entry_get(
+	struct cli_event_limit_s *p_limit,
+	unsigned int idx)
+{
+	if (idx < CLI_EVENT_LIMIT_MAX_KEYS)
+		return &p_limit->keys[idx];
+
+	idx -= CLI_EVENT_LIMIT_MAX_KEYS;
+	return (idx < p_limit->n_rules) ? &p_limit->rules[idx].overflow : IFX_NULL;
+}
+
+int cli_event_limit_init(
+	struct cli_event_limit_s **pp_limit)
+{
+	struct cli_event_limit_s *p_limit;
+
+	if ((pp_limit == IFX_NULL) || (*pp_limit != IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Event Limit: init - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_limit = (struct cli_event_limit_s *)clios_memalloc(sizeof(struct cli_event_limit_s));
+	if (p_limit == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Event Limit: init - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_limit, 0x00, sizeof(struct cli_event_limit_s));
+
+	if (clios_lockinit(&p_limit->lock, "cli_evl", 0) != IFX_SUCCESS)
+	{
+		clios_memfree(p_limit);
+		return IFX_ERROR;
+	}
+
+	*pp_limit = p_limit;
+	return IFX_SUCCESS;
+}
+
+int cli_event_limit_release(
+	struct cli_event_limit_s **pp_limit)
+{
+	struct cli_event_limit_s *p_limit;
+
+	if ((pp_limit == IFX_NULL) || (*pp_limit == IFX_NULL))
+		return IFX_ERROR;
+
+	p_limit = *pp_limit;
+	*pp_limit = IFX_NULL;
+
+	(void)clios_lockdelete(&p_limit->lock);
+	clios_memfree(p_limit);
+
+	return IFX_SUCCESS;
+}
+
+int cli_event_limit_rule_set(
+	struct cli_event_limit_s *p_limit,
+	const char *p_key,
+	unsigned int window_ms,
+	unsigned int rate,
+	unsigned int burst)
+{
+	struct cli_event_limit_rule_s *p_rule;
+	unsigned int i, key_len;
+	IFX_boolean_t b_prefix = IFX_FALSE;
+
+	if ((p_limit == IFX_NULL) || (p_key == IFX_NULL))
+		return IFX_ERROR;
+
+	key_len = (unsigned int)clios_strlen(p_key);
+	if ((key_len > 0) && (p_key[key_len - 1] == '*'))
+	{
+		b_prefix = IFX_TRUE;
+		key_len--;
+	}
+	if ((key_len >= CLI_EVENT_LIMIT_KEY_SIZE) ||
+	    ((key_len == 0) && (b_prefix == IFX_FALSE)))
+	{
+		CLI_USR_ERR(LIB_CLI,
+			("ERR CLI Event Limit: invalid key \"%s\"" CLI_CRLF, p_key));
+		return IFX_ERROR;
+	}
+
+	if ((rate != 0) && (burst == 0))
+		burst = rate;
+
+	(void)clios_lockget(&p_limit->lock);
+
+	for (i = 0; i < p_limit->n_rules; i++)
+	{
+		p_rule = &p_limit->rules[i];
+		if ((p_rule->b_prefix == b_prefix) && (p_rule->key_len == key_len) &&
+		    (clios_strncmp(p_rule->key, p_key, key_len) == 0))
+			break;
+	}
+
+	if ((window_ms == 0) && (rate == 0))
+	{
+		/* remove the rule */
+		if (i < p_limit->n_rules)
+		{
+			for (; (i + 1) < p_limit->n_rules; i++)
+				p_limit->rules[i] = p_limit->rules[i + 1];
+			p_limit->n_rules--;
+		}
+	}
+	else
+	{
+		if (i == p_limit->n_rules)
+		{
+			if (p_limit->n_rules >= CLI_EVENT_LIMIT_MAX_RULES)
+			{
+				(void)clios_lockrelease(&p_limit->lock);
+				CLI_USR_ERR(LIB_CLI,
+					("ERR CLI Event Limit: rule table full (max %u)" CLI_CRLF,
+					CLI_EVENT_LIMIT_MAX_RULES));
+				return IFX_ERROR;
+			}
+			p_rule = &p_limit->rules[p_limit->n_rules++];
+			clios_memset(p_rule, 0x00, sizeof(struct cli_event_limit_rule_s));
+			clios_memcpy(p_rule->key, p_key, key_len);
+			p_rule->key[key_len] = '\0';
+			p_rule->key_len = key_len;
+			p_rule->b_prefix = b_prefix;
+		}
+		p_rule = &p_limit->rules[i];
+		p_rule->window_ms = window_ms;
+		p_rule->rate = rate;
+		p_rule->burst = burst;
+	}
+
+	event_keys_reset(p_limit);
+
+	(void)clios_lockrelease(&p_limit->lock);
+
+	return IFX_SUCCESS;
+}
+
+int cli_event_limit_rule_clear(
+	struct cli_event_limit_s *p_limit)
+{
+	if (p_limit == IFX_NULL)
+		return IFX_ERROR;
+
+	(void)clios_lockget(&p_limit->lock);
+	p_limit->n_rules = 0;
+	event_keys_reset(p_limit);
+	(void)clios_lockrelease(&p_limit->lock);
+
+	return IFX_SUCCESS;
+}
+
+int cli_event_limit_rule_get(
+	struct cli_event_limit_s *p_limit,
+	unsigned int idx,
+	struct cli_event_limit_rule_info_s *p_info)
+{
+	struct cli_event_limit_rule_s *p_rule;
+
+	if ((p_limit == IFX_NULL) || (p_info == IFX_NULL))
+		return IFX_ERROR;
+
+	(void)clios_lockget(&p_limit->lock);
+	if (idx >= p_limit->n_rules)
+	{
+		(void)clios_lockrelease(&p_limit->lock);
+		return IFX_ERROR;
+	}
+
+	p_rule = &p_limit->rules[idx];
+	(void)clios_snprintf(p_info->key, sizeof(p_info->key), "%s%s",
+		p_rule->key, (p_rule->b_prefix == IFX_TRUE) ? "*" : "");
+	p_info->window_ms = p_rule->window_ms;
+	p_info->rate = p_rule->rate;
+	p_info->burst = p_rule->burst;
+	p_info->n_passed = p_rule->n_passed;
+	p_info->n_coalesced = p_rule->n_coalesced;
+	p_info->n_overflow = p_rule->n_overflow;
+	(void)clios_lockrelease(&p_limit->lock);
+
+	return IFX_SUCCESS;
+}
+
+int cli_event_limit_process(
+	struct cli_event_limit_s *p_limit,
+	char *p_event,
+	cli_event_limit_fct_t deliver_fct,
+	void *p_data)
+{
+	struct cli_event_limit_key_s *p_entry;
+	struct cli_event_limit_rule_s *p_rule;
+	char key[CLI_EVENT_LIMIT_KEY_SIZE];
+	char out[CLI_EVENT_LIMIT_TEXT_SIZE + 32];
+	char *p_deliver = IFX_NULL;
+	unsigned int hash;
+	clios_time_t now, due;
+	IFX_boolean_t b_flush = IFX_FALSE;
+
+	if ((p_limit == IFX_NULL) || (p_event == IFX_NULL) || (deliver_fct == IFX_NULL))
+		return IFX_ERROR;
+
+	(void)event_key_get(p_event, key, &hash);
+	now = clios_elapsed_time_msec_get(0);
+
+	(void)clios_lockget(&p_limit->lock);
+
+	if (p_limit->n_rules == 0)
+	{
+		(void)clios_lockrelease(&p_limit->lock);
+		return deliver_fct(p_data, p_event);
+	}
+
+	p_entry = event_key_lookup(p_limit, key, hash, now);
+	if (p_entry != IFX_NULL)
+	{
+		p_rule = &p_limit->rules[p_entry->rule_idx];
+
+		if ((p_entry->n_pending == 0) &&
+		    (event_deliver_check(p_rule, p_entry, now) == IFX_TRUE))
+		{
+			/* nothing collapsed, pass the event as it is */
+			p_deliver = p_event;
+		}
+		else
+		{
+			/* keep the latest event */
+			if (p_entry->n_pending == 0)
+				p_limit->n_pending_keys++;
+			else
+				p_rule->n_coalesced++;
+			(void)clios_snprintf(p_entry->text, sizeof(p_entry->text), "%s", p_event);
+			p_entry->n_pending++;
+
+			if (event_pending_take(p_limit, p_entry, now, out, sizeof(out)) == IFX_TRUE)
+			{
+				p_deliver = out;
+			}
+			else
+			{
+				due = event_due_get(p_rule, p_entry, now);
+				if ((p_limit->n_pending_keys == 1) ||
+				    CLI_EVENT_LIMIT_TIME_AFTER_EQ(p_limit->next_due, due))
+					p_limit->next_due = due;
+			}
+		}
+
+		/* other keys waiting for delivery */
+		if ((p_limit->n_pending_keys > 0) &&
+		    CLI_EVENT_LIMIT_TIME_AFTER_EQ(now, p_limit->next_due))
+			b_flush = IFX_TRUE;
+	}
+	else
+	{
+		p_deliver = p_event;
+	}
+
+	(void)clios_lockrelease(&p_limit->lock);
+
+	if (p_deliver != IFX_NULL)
+		(void)deliver_fct(p_data, p_deliver);
+
+	if (b_flush == IFX_TRUE)
+		(void)cli_event_limit_flush(p_limit, deliver_fct, p_data);
+
+	return IFX_SUCCESS;
+}
+
+int cli_event_limit_flush(
+	struct cli_event_limit_s *p_limit,
+	cli_event_limit_fct_t deliver_fct,
+	void *p_data)
+{
+	struct cli_event_limit_key_s *p_entry;
+	char out[CLI_EVENT_LIMIT_TEXT_SIZE + 32];
+	unsigned int i = 0;
+	int n_delivered = 0;
+	clios_time_t now, due;
+	IFX_boolean_t b_first;
+
+	if ((p_limit == IFX_NULL) || (deliver_fct == IFX_NULL))
+		return IFX_ERROR;
+
+	now = clios_elapsed_time_msec_get(0);
+
+	/* fast path, nothing due */
+	(void)clios_lockget(&p_limit->lock);
+	if ((p_limit->n_pending_keys == 0) ||
+	    !CLI_EVENT_LIMIT_TIME_AFTER_EQ(now, p_limit->next_due))
+	{
+		(void)clios_lockrelease(&p_limit->lock);
+		return 0;
+	}
+	(void)clios_lockrelease(&p_limit->lock);
+
+	/* deliver outside of the lock, the callbacks may issue further events */
+	for (;;)
+	{
+		(void)clios_lockget(&p_limit->lock);
+		if (p_limit->n_pending_keys == 0)
+			break;
+		for (; (p_entry = event_entry_get(p_limit, i)) != IFX_NULL; i++)
+		{
+			if (event_pending_take(p_limit, p_entry, now, out, sizeof(out)) == IFX_TRUE)
+				break;
+		}
+		if (p_entry == IFX_NULL)
+			break;
+		(void)clios_lockrelease(&p_limit->lock);
+
+		(void)deliver_fct(p_data, out);
+		n_delivered++;
+		i++;
+	}
+
+	/* update the due time of the remaining events */
+	b_first = IFX_TRUE;
+	for (i = 0; (p_limit->n_pending_keys > 0) &&
+	            ((p_entry = event_entry_get(p_limit, i)) != IFX_NULL); i++)
+	{
+		if (p_entry->n_pending == 0)
+			continue;
+		due = event_due_get(&p_limit->rules[p_entry->rule_idx], p_entry, now);
+		if ((b_first == IFX_TRUE) ||
+		    CLI_EVENT_LIMIT_TIME_AFTER_EQ(p_limit->next_due, due))
+			p_limit->next_due = due;
+		b_first = IFX_FALSE;
+	}
+
+	(void)clios_lockrelease(&p_limit->lock);
+
+	return n_delivered;
+}
+
+int cli_event_limit_due_get(
+	struct cli_event_limit_s *p_limit,
+	unsigned int *p_wait_ms)
+{
+	clios_time_t now;
+	int ret = 0;
+
+	if ((p_limit == IFX_NULL) || (p_wait_ms == IFX_NULL))
+		return IFX_ERROR;
+
+	now = clios_elapsed_time_msec_get(0);
+
+	(void)clios_lockget(&p_limit->lock);
+	if (p_limit->n_pending_keys > 0)
+	{
+		*p_wait_ms = CLI_EVENT_LIMIT_TIME_AFTER_EQ(now, p_limit->next_due) ?
+			0 : (unsigned int)(clios_time_t)(p_limit->next_due - now);
+		ret = 1;
+	}
+	(void)clios_lockrelease(&p_limit->lock);
+
+	return ret;
+}
+
+#endif	/* #if (CLI_SUPPORT_EVENT_LIMIT == 1) */
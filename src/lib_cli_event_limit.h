@@ -0,0 +1,293 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_EVENT_LIMIT_H
+#define _LIB_CLI_EVENT_LIMIT_H
+
+/**
+   \file lib_cli_event_limit.h
+   Command Line Interface - event coalescing and rate limiting
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_EVENT_LIMIT CLI Event Limiter
+
+   The event limiter sits in front of the event callbacks of all registered
+   user interfaces (\ref cli_user_if_event). A flood of the same event is
+   collapsed into the latest value plus a count before it is copied into any
+   event FIFO or written to a pipe.
+
+   The event key is the first word of the event text. For each key a rule
+   can be configured:
+   - window_ms: coalescing window. The first event is delivered immediately,
+     all further events within the window are collapsed. At the end of the
+     window the latest event is delivered once, extended by
+     " coalesced=<count>".
+   - rate / burst: token bucket. At most "rate" events per second are
+     delivered (with bursts up to "burst" events), the rest is collapsed
+     in the same way.
+
+   A rule key ending with '*' matches all event keys with this prefix,
+   the rule key "*" matches all events. Events without a matching rule
+   are passed without any additional copy.
+
+\remarks
+   Collapsed events are delivered with the next event of the same key or
+   by \ref cli_core_event_limit_flush. The pipe interface calls the flush
+   on its own; other user interfaces should call it periodically, e.g. when
+   \ref cli_core_event_limit_due_get reports a due event.
+   If the key table is full, idle keys are evicted. If all keys are still
+   active, new keys share the state of their rule ("overflow" statistic).
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Forward declaration, event limiter context */
+struct cli_event_limit_s;
+
+/** Event limiter deliver callback, called for each event to pass.
+
+\param
+   p_data  user data, given with the process / flush call.
+\param
+   p_event  points to the event text.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+typedef int (*cli_event_limit_fct_t)(
+	void *p_data,
+	char *p_event);
+
+/** Event limiter rule info, see \ref cli_event_limit_rule_get. */
+struct cli_event_limit_rule_info_s
+{
+	/** rule key */
+	char key[CLI_EVENT_LIMIT_KEY_SIZE];
+	/** coalescing window [ms] */
+	unsigned int window_ms;
+	/** max number of events per second (0: unlimited) */
+	unsigned int rate;
+	/** token bucket size */
+	unsigned int burst;
+	/** number of delivered events */
+	unsigned long n_passed;
+	/** number of collapsed events */
+	unsigned long n_coalesced;
+	/** number of events limited via the shared rule state (key table full) */
+	unsigned long n_overflow;
+};
+
+/** Create an event limiter (without any rule).
+
+\param
+   pp_limit  returns the event limiter context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_event_limit_init(
+	struct cli_event_limit_s **pp_limit);
+
+/** Release an event limiter, pending events are dropped.
+
+\param
+   pp_limit  contains the event limiter context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_event_limit_release(
+	struct cli_event_limit_s **pp_limit);
+
+/** Add, change or remove a rule.
+
+\param
+   p_limit  event limiter context.
+\param
+   p_key  event key, "<prefix>*" or "*".
+\param
+   window_ms  coalescing window [ms] (0: no coalescing).
+\param
+   rate  max number of events per second (0: unlimited).
+\param
+   burst  token bucket size (0: same as rate).
+
+\remarks
+   window_ms = 0 and rate = 0 removes the rule. A change of the rules resets
+   the state of all keys, pending events are dropped.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (rule table full, invalid key).
+*/
+extern int cli_event_limit_rule_set(
+	struct cli_event_limit_s *p_limit,
+	const char *p_key,
+	unsigned int window_ms,
+	unsigned int rate,
+	unsigned int burst);
+
+/** Remove all rules.
+
+\param
+   p_limit  event limiter context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_event_limit_rule_clear(
+	struct cli_event_limit_s *p_limit);
+
+/** Get a rule and its statistics.
+
+\param
+   p_limit  event limiter context.
+\param
+   idx  rule index (0 .. number of rules - 1).
+\param
+   p_info  returns the rule info.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - no rule with the given index.
+*/
+extern int cli_event_limit_rule_get(
+	struct cli_event_limit_s *p_limit,
+	unsigned int idx,
+	struct cli_event_limit_rule_info_s *p_info);
+
+/** Process an event - deliver, collapse or both.
+
+\param
+   p_limit  event limiter context.
+\param
+   p_event  points to the event text.
+\param
+   deliver_fct  called for each event to pass.
+\param
+   p_data  user data for the callback.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_event_limit_process(
+	struct cli_event_limit_s *p_limit,
+	char *p_event,
+	cli_event_limit_fct_t deliver_fct,
+	void *p_data);
+
+/** Deliver all collapsed events which are due.
+
+\param
+   p_limit  event limiter context.
+\param
+   deliver_fct  called for each event to pass.
+\param
+   p_data  user data for the callback.
+
+\return
+   number of delivered events
+   IFX_ERROR - failed.
+*/
+extern int cli_event_limit_flush(
+	struct cli_event_limit_s *p_limit,
+	cli_event_limit_fct_t deliver_fct,
+	void *p_data);
+
+/** Get the time until the next collapsed event is due.
+
+\param
+   p_limit  event limiter context.
+\param
+   p_wait_ms  returns the time until the next event is due [ms], 0 if due.
+
+\return
+   1 - collapsed events pending, p_wait_ms is valid
+   0 - no collapsed events
+   IFX_ERROR - failed.
+*/
+extern int cli_event_limit_due_get(
+	struct cli_event_limit_s *p_limit,
+	unsigned int *p_wait_ms);
+
+/** Add, change or remove an event limit rule of the given CLI core.
+   See \ref cli_event_limit_rule_set.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_key  event key, "<prefix>*" or "*".
+\param
+   window_ms  coalescing window [ms] (0: no coalescing).
+\param
+   rate  max number of events per second (0: unlimited).
+\param
+   burst  token bucket size (0: same as rate).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_core_event_limit_set(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_key,
+	unsigned int window_ms,
+	unsigned int rate,
+	unsigned int burst);
+
+/** Deliver all collapsed events of the given CLI core which are due.
+
+\param
+   p_core_ctx  CLI context pointer.
+
+\return
+   number of delivered events
+   IFX_ERROR - failed.
+*/
+extern int cli_core_event_limit_flush(
+	struct cli_core_context_s *p_core_ctx);
+
+/** Get the time until the next collapsed event of the given CLI core is due.
+   See \ref cli_event_limit_due_get.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_wait_ms  returns the time until the next event is due [ms], 0 if due.
+
+\return
+   1 - collapsed events pending, p_wait_ms is valid
+   0 - no collapsed events
+   IFX_ERROR - failed.
+*/
+extern int cli_core_event_limit_due_get(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int *p_wait_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_EVENT_LIMIT_H */
@@ -0,0 +1,328 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_help_store.c
+   Command Line Interface - compressed help text store
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_HELP_STORE == 1)
+#include "lib_cli_help_store.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** FNV-1a offset basis */
+#define CLI_HELP_STORE_HASH_INIT	2166136261U
+/** FNV-1a prime */
+#define CLI_HELP_STORE_HASH_PRIME	16777619U
+
+/** Decompressed block in the cache */
+struct cli_help_store_slot_s
+{
+	/** block number, -1: empty */
+	int block;
+	/** number of references to the block */
+	unsigned int n_users;
+	/** last use (LRU) */
+	unsigned int stamp;
+	/** decompressed block */
+	char *p_buf;
+};
+
+/** Decompression cache of a store */
+struct cli_help_store_cache_s
+{
+	/** help store */
+	const struct cli_help_store_s *p_store;
+	/** protects the slots */
+	IFXOS_lock_t lock;
+	/** use counter (LRU) */
+	unsigned int stamp;
+	/** cached blocks */
+	struct cli_help_store_slot_s slot[CLI_HELP_STORE_LRU_ENTRIES];
+};
+
+unsigned int cli_help_store_hash(
+	const char *p_key)
+{
+	unsigned int hash = CLI_HELP_STORE_HASH_INIT;
+
+	while (*p_key)
+	{
+		hash ^= (unsigned char)*p_key++;
+		hash *= CLI_HELP_STORE_HASH_PRIME;
+	}
+
+	return hash;
+}
+
+int cli_help_store_decode(
+	const struct cli_help_store_s *p_store,
+	unsigned int block,
+	char *p_out)
+{
+	const unsigned char *p_in, *p_end;
+	unsigned int len, pos = 0, dist, n, ctrl = 0, bits = 0;
+
+	if ((p_store == IFX_NULL) || (block >= p_store->n_blocks) || (p_out == IFX_NULL))
+		return IFX_ERROR;
+
+	len = p_store->p_blocks[block].len;
+	p_in = p_store->p_data + p_store->p_blocks[block].offset;
+	p_end = (block + 1 < p_store->n_blocks) ?
+		p_store->p_data + p_store->p_blocks[block + 1].offset :
+		p_store->p_data + p_store->data_size;
+
+	while (pos < len)
+	{
+		if (bits == 0)
+		{
+			if (p_in >= p_end)
+				return IFX_ERROR;
+			ctrl = *p_in++;
+			bits = 8;
+		}
+
+		if (ctrl & 0x1)
+		{
+			/* literal */
+			if (p_in >= p_end)
+				return IFX_ERROR;
+			p_out[pos++] = (char)*p_in++;
+		}
+		else
+		{
+			/* match, may start within the dictionary */
+			if (p_in + 1 >= p_end)
+				return IFX_ERROR;
+			dist = (unsigned int)p_in[0] | (((unsigned int)p_in[1] & 0xF0) << 4);
+			n = ((unsigned int)p_in[1] & 0x0F) + CLI_HELP_STORE_MATCH_MIN;
+			p_in += 2;
+			if ((dist == 0) || (dist > pos + p_store->dict_len) || (pos + n > len))
+				return IFX_ERROR;
+			while (n--)
+			{
+				p_out[pos] = (dist > pos) ?
+					(char)p_store->p_dict[p_store->dict_len - (dist - pos)] :
+					p_out[pos - dist];
+				pos++;
+			}
+		}
+		ctrl >>= 1;
+		bits--;
+	}
+
+	return IFX_SUCCESS;
+}
+
+int cli_help_store_cache_init(
+	struct cli_help_store_cache_s **pp_cache,
+	const struct cli_help_store_s *p_store)
+{
+	struct cli_help_store_cache_s *p_cache;
+	int i;
+
+	if ((pp_cache == IFX_NULL) || (*pp_cache != IFX_NULL) || (p_store == IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Help Store: init - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_cache = (struct cli_help_store_cache_s *)clios_memalloc(sizeof(struct cli_help_store_cache_s));
+	if (p_cache == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Help Store: init - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_cache, 0x00, sizeof(struct cli_help_store_cache_s));
+	p_cache->p_store = p_store;
+	for (i = 0; i < CLI_HELP_STORE_LRU_ENTRIES; i++)
+		p_cache->slot[i].block = -1;
+
+	if (clios_lockinit(&p_cache->lock, "cli_hst", 0) != IFX_SUCCESS)
+	{
+		clios_memfree(p_cache);
+		return IFX_ERROR;
+	}
+
+	*pp_cache = p_cache;
+	return IFX_SUCCESS;
+}
+
+int cli_help_store_cache_release(
+	struct cli_help_store_cache_s **pp_cache)
+{
+	struct cli_help_store_cache_s *p_cache;
+	int i;
+
+	if ((pp_cache == IFX_NULL) || (*pp_cache == IFX_NULL))
+		return IFX_ERROR;
+
+	p_cache = *pp_cache;
+	*pp_cache = IFX_NULL;
+
+	for (i = 0; i < CLI_HELP_STORE_LRU_ENTRIES; i++)
+	{
+		if (p_cache->slot[i].p_buf != IFX_NULL)
+			clios_memfree(p_cache->slot[i].p_buf);
+	}
+	(void)clios_lockdelete(&p_cache->lock);
+	clios_memfree(p_cache);
+
+	return IFX_SUCCESS;
+}
+
+/** Binary search of the index */
+CLI_STATIC const struct cli_help_store_entry_s *help_store_entry_find(
+	const struct cli_help_store_s *p_store,
+	unsigned int hash)
+{
+	unsigned int lo = 0, hi = p_store->n_entries, mid;
+
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (p_store->p_entries[mid].hash == hash)
+			return &p_store->p_entries[mid];
+		if (p_store->p_entries[mid].hash < hash)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return IFX_NULL;
+}
+
+/** Get the cache slot of a block, decompress it into the least recently
+   used free slot if not cached (called with the lock held) */
+CLI_STATIC int help_store_slot_get(
+	struct cli_help_store_cache_s *p_cache,
+	unsigned int block)
+{
+	struct cli_help_store_slot_s *p_slot;
+	int i, victim = -1;
+
+	for (i = 0; i < CLI_HELP_STORE_LRU_ENTRIES; i++)
+	{
+		p_slot = &p_cache->slot[i];
+		if (p_slot->block == (int)block)
+			return i;
+		if ((p_slot->n_users == 0) &&
+		    ((victim < 0) || (p_slot->block < 0) ||
+		     ((p_cache->slot[victim].block >= 0) &&
+		      ((int)(p_slot->stamp - p_cache->slot[victim].stamp) < 0))))
+			victim = i;
+	}
+
+	if (victim < 0)
+		return IFX_ERROR;
+
+	p_slot = &p_cache->slot[victim];
+	if (p_slot->p_buf == IFX_NULL)
+	{
+		p_slot->p_buf = (char *)clios_memalloc(p_cache->p_store->block_len_max);
+		if (p_slot->p_buf == IFX_NULL)
+			return IFX_ERROR;
+	}
+	p_slot->block = -1;
+	if (cli_help_store_decode(p_cache->p_store, block, p_slot->p_buf) != IFX_SUCCESS)
+		return IFX_ERROR;
+	p_slot->block = (int)block;
+
+	return victim;
+}
+
+int cli_help_store_text_get(
+	struct cli_help_store_cache_s *p_cache,
+	const char *p_key,
+	struct cli_help_store_ref_s *p_ref)
+{
+	const struct cli_help_store_s *p_store;
+	const struct cli_help_store_entry_s *p_entry;
+	int slot;
+
+	if ((p_cache == IFX_NULL) || (p_key == IFX_NULL) || (p_ref == IFX_NULL))
+		return IFX_ERROR;
+
+	p_store = p_cache->p_store;
+	p_entry = help_store_entry_find(p_store, cli_help_store_hash(p_key));
+	if ((p_entry == IFX_NULL) || (p_entry->block >= p_store->n_blocks) ||
+	    ((unsigned int)p_entry->offset + p_entry->len > p_store->p_blocks[p_entry->block].len))
+		return IFX_ERROR;
+
+	p_ref->len = p_entry->len;
+	p_ref->p_alloc = IFX_NULL;
+
+	(void)clios_lockget(&p_cache->lock);
+	slot = help_store_slot_get(p_cache, p_entry->block);
+	if (slot >= 0)
+	{
+		p_cache->slot[slot].n_users++;
+		p_cache->slot[slot].stamp = ++p_cache->stamp;
+	}
+	(void)clios_lockrelease(&p_cache->lock);
+
+	if (slot >= 0)
+	{
+		p_ref->slot = slot;
+		p_ref->p_text = p_cache->slot[slot].p_buf + p_entry->offset;
+		return IFX_SUCCESS;
+	}
+
+	/* all slots in use, decompress into a private buffer */
+	p_ref->slot = -1;
+	p_ref->p_alloc = (char *)clios_memalloc(p_store->p_blocks[p_entry->block].len);
+	if (p_ref->p_alloc == IFX_NULL)
+		return IFX_ERROR;
+	if (cli_help_store_decode(p_store, p_entry->block, p_ref->p_alloc) != IFX_SUCCESS)
+	{
+		clios_memfree(p_ref->p_alloc);
+		p_ref->p_alloc = IFX_NULL;
+		return IFX_ERROR;
+	}
+	p_ref->p_text = p_ref->p_alloc + p_entry->offset;
+
+	return IFX_SUCCESS;
+}
+
+void cli_help_store_text_put(
+	struct cli_help_store_cache_s *p_cache,
+	struct cli_help_store_ref_s *p_ref)
+{
+	if ((p_cache == IFX_NULL) || (p_ref == IFX_NULL))
+		return;
+
+	if (p_ref->p_alloc != IFX_NULL)
+	{
+		clios_memfree(p_ref->p_alloc);
+		p_ref->p_alloc = IFX_NULL;
+	}
+	else if ((p_ref->slot >= 0) && (p_ref->slot < CLI_HELP_STORE_LRU_ENTRIES))
+	{
+		(void)clios_lockget(&p_cache->lock);
+		if (p_cache->slot[p_ref->slot].n_users > 0)
+			p_cache->slot[p_ref->slot].n_users--;
+		(void)clios_lockrelease(&p_cache->lock);
+	}
+	p_ref->slot = -1;
+	p_ref->p_text = IFX_NULL;
+}
+
+#endif	/* #if (CLI_SUPPORT_HELP_STORE == 1) */
@@ -0,0 +1,242 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_HELP_STORE_H
+#define _LIB_CLI_HELP_STORE_H
+
+/**
+   \file lib_cli_help_store.h
+   Command Line Interface - compressed help text store
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_HELP_STORE CLI Help Store
+
+   The usage texts of the commands are kept compressed in a read-only blob
+   generated at build time with the cli_help_pack tool. The command handlers
+   are built with CLI_DEBUG_DISABLE (empty usage), the CLI core answers the
+   help request ("-h", ...) and prints the detailed help from the store.
+
+   Format of the store:
+   - the texts are concatenated into blocks (default 3 kByte), each block is
+     compressed on its own (LZSS)
+   - a shared dictionary (the most frequent lines of all texts) precedes
+     each block, the matches may refer into it
+   - the index is sorted by the hash of the long command name
+     (see \ref cli_help_store_hash) and gives block, offset and length
+     of the text
+
+   LZSS stream: a control byte gives the type of the following 8 items
+   (LSB first), 1: literal byte, 0: match of 2 bytes: distance (12 bit,
+   low byte first, then the high nibble in the upper half of the second
+   byte) and length - 3 (lower half of the second byte).
+
+   The blocks are decompressed on demand into a small LRU cache
+   (\ref CLI_HELP_STORE_LRU_ENTRIES blocks).
+
+   Example (build):
+   \code
+   cli_help_pack -s my_help_store my_usage.txt my_help_store.c
+   \endcode
+   Example (setup, before the CLI is activated):
+   \code
+   extern const struct cli_help_store_s my_help_store;
+
+   (void)cli_core_help_store_set(p_core_ctx, &my_help_store);
+   \endcode
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** max match distance of the LZSS stream */
+#define CLI_HELP_STORE_DIST_MAX	4095
+/** min match length of the LZSS stream */
+#define CLI_HELP_STORE_MATCH_MIN	3
+/** max match length of the LZSS stream */
+#define CLI_HELP_STORE_MATCH_MAX	18
+
+/** Compressed block of the store */
+struct cli_help_store_block_s
+{
+	/** offset of the compressed block within the data */
+	unsigned int offset;
+	/** decompressed length of the block */
+	unsigned int len;
+};
+
+/** Index entry of the store */
+struct cli_help_store_entry_s
+{
+	/** hash of the long command name (see \ref cli_help_store_hash) */
+	unsigned int hash;
+	/** block of the text */
+	unsigned short block;
+	/** offset of the text within the decompressed block */
+	unsigned short offset;
+	/** length of the text */
+	unsigned short len;
+};
+
+/** Compressed help text store (generated by cli_help_pack) */
+struct cli_help_store_s
+{
+	/** shared dictionary */
+	const unsigned char *p_dict;
+	/** length of the dictionary */
+	unsigned int dict_len;
+	/** compressed blocks */
+	const unsigned char *p_data;
+	/** size of the compressed blocks */
+	unsigned int data_size;
+	/** block table */
+	const struct cli_help_store_block_s *p_blocks;
+	/** number of blocks */
+	unsigned int n_blocks;
+	/** index, sorted by hash */
+	const struct cli_help_store_entry_s *p_entries;
+	/** number of index entries */
+	unsigned int n_entries;
+	/** max decompressed length of a block */
+	unsigned int block_len_max;
+};
+
+/** Forward declaration, decompression cache of a store */
+struct cli_help_store_cache_s;
+
+/** Text reference, valid until \ref cli_help_store_text_put */
+struct cli_help_store_ref_s
+{
+	/** text (not zero terminated) */
+	const char *p_text;
+	/** length of the text */
+	unsigned int len;
+	/** cache slot of the block, internal */
+	int slot;
+	/** decompression buffer (all slots in use), internal */
+	char *p_alloc;
+};
+
+/** Hash of a command name for the index (FNV-1a, 32 bit).
+
+\param
+   p_key  long command name.
+
+\return
+   hash value
+*/
+extern unsigned int cli_help_store_hash(
+	const char *p_key);
+
+/** Decompress a block of the store.
+
+\param
+   p_store  help store.
+\param
+   block  block number.
+\param
+   p_out  output buffer (block length, see \ref cli_help_store_s).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (invalid block, corrupted data).
+*/
+extern int cli_help_store_decode(
+	const struct cli_help_store_s *p_store,
+	unsigned int block,
+	char *p_out);
+
+/** Create the decompression cache of a store.
+
+\param
+   pp_cache  returns the cache.
+\param
+   p_store  help store (not copied).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_help_store_cache_init(
+	struct cli_help_store_cache_s **pp_cache,
+	const struct cli_help_store_s *p_store);
+
+/** Release the decompression cache of a store.
+
+\param
+   pp_cache  cache to release.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_help_store_cache_release(
+	struct cli_help_store_cache_s **pp_cache);
+
+/** Get the usage text of a command, the block is locked in the cache until
+   \ref cli_help_store_text_put.
+
+\param
+   p_cache  decompression cache.
+\param
+   p_key  long command name.
+\param
+   p_ref  returns the text reference.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - not found or failed.
+*/
+extern int cli_help_store_text_get(
+	struct cli_help_store_cache_s *p_cache,
+	const char *p_key,
+	struct cli_help_store_ref_s *p_ref);
+
+/** Release a text reference.
+
+\param
+   p_cache  decompression cache.
+\param
+   p_ref  text reference of \ref cli_help_store_text_get.
+*/
+extern void cli_help_store_text_put(
+	struct cli_help_store_cache_s *p_cache,
+	struct cli_help_store_ref_s *p_ref);
+
+/** Set the help store of a CLI context, possible before the CLI is
+   activated (\ref cli_core_cfg_mode_active). The usage texts of the store
+   are used for all commands registered without metadata.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_store  help store (not copied, must be valid while the context exists).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_core_help_store_set(
+	struct cli_core_context_s *p_core_ctx,
+	const struct cli_help_store_s *p_store);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_HELP_STORE_H */
@@ -0,0 +1,177 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_hooks.c
+   Command Line Interface - command execution hooks
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_HOOKS == 1)
+#include "lib_cli_hooks.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** Compare two hooks */
+#define CLI_HOOK_EQ(a, b) \
+	(((a)->pre_fct == (b)->pre_fct) && ((a)->post_fct == (b)->post_fct) && \
+	 ((a)->p_data == (b)->p_data))
+
+/** Create a chain from a list of hooks, compile the call lists */
+CLI_STATIC int hook_chain_create(
+	const struct cli_hook_s *p_hooks,
+	unsigned int n_hooks,
+	struct cli_hook_chain_s **pp_new)
+{
+	struct cli_hook_chain_s *p_new;
+	unsigned int i;
+
+	p_new = (struct cli_hook_chain_s *)clios_memalloc(sizeof(struct cli_hook_chain_s));
+	if (p_new == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Hooks: no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_new, 0x00, sizeof(struct cli_hook_chain_s));
+
+	for (i = 0; i < n_hooks; i++)
+	{
+		p_new->hook[i] = p_hooks[i];
+		if (p_hooks[i].pre_fct != IFX_NULL)
+			p_new->pre[p_new->n_pre++] = p_hooks[i];
+	}
+	p_new->n_hooks = n_hooks;
+
+	for (i = n_hooks; i > 0; i--)
+	{
+		if (p_hooks[i - 1].post_fct != IFX_NULL)
+			p_new->post[p_new->n_post++] = p_hooks[i - 1];
+	}
+
+	*pp_new = p_new;
+	return IFX_SUCCESS;
+}
+
+int cli_hook_chain_add(
+	const struct cli_hook_chain_s *p_chain,
+	const struct cli_hook_s *p_hook,
+	struct cli_hook_chain_s **pp_new)
+{
+	struct cli_hook_s hooks[CLI_HOOKS_MAX];
+	unsigned int n = 0;
+
+	if ((p_hook == IFX_NULL) || (pp_new == IFX_NULL) ||
+	    ((p_hook->pre_fct == IFX_NULL) && (p_hook->post_fct == IFX_NULL)))
+		return IFX_ERROR;
+
+	if (p_chain != IFX_NULL)
+	{
+		if (p_chain->n_hooks >= CLI_HOOKS_MAX)
+		{
+			CLI_USR_ERR(LIB_CLI, ("ERR CLI Hooks: max number of hooks installed" CLI_CRLF));
+			return IFX_ERROR;
+		}
+		n = p_chain->n_hooks;
+		clios_memcpy(hooks, p_chain->hook, n * sizeof(struct cli_hook_s));
+	}
+	hooks[n++] = *p_hook;
+
+	return hook_chain_create(hooks, n, pp_new);
+}
+
+int cli_hook_chain_remove(
+	const struct cli_hook_chain_s *p_chain,
+	const struct cli_hook_s *p_hook,
+	struct cli_hook_chain_s **pp_new)
+{
+	struct cli_hook_s hooks[CLI_HOOKS_MAX];
+	unsigned int i, n = 0;
+	int found = 0;
+
+	if ((p_chain == IFX_NULL) || (p_hook == IFX_NULL) || (pp_new == IFX_NULL))
+		return IFX_ERROR;
+
+	for (i = 0; i < p_chain->n_hooks; i++)
+	{
+		/* remove the first match only, a hook can be installed twice */
+		if (!found && CLI_HOOK_EQ(&p_chain->hook[i], p_hook))
+		{
+			found = 1;
+			continue;
+		}
+		hooks[n++] = p_chain->hook[i];
+	}
+	if (!found)
+		return IFX_ERROR;
+
+	if (n == 0)
+	{
+		*pp_new = IFX_NULL;
+		return IFX_SUCCESS;
+	}
+
+	return hook_chain_create(hooks, n, pp_new);
+}
+
+int cli_hook_chain_release(
+	struct cli_hook_chain_s **pp_chain)
+{
+	struct cli_hook_chain_s *p_chain, *p_next;
+
+	if (pp_chain == IFX_NULL)
+		return IFX_ERROR;
+
+	p_chain = *pp_chain;
+	*pp_chain = IFX_NULL;
+	while (p_chain != IFX_NULL)
+	{
+		p_next = p_chain->p_next;
+		clios_memfree(p_chain);
+		p_chain = p_next;
+	}
+
+	return IFX_SUCCESS;
+}
+
+int cli_hook_chain_pre(
+	const struct cli_hook_chain_s *p_chain,
+	const struct cli_cmd_hook_info_s *p_info)
+{
+	unsigned int i;
+
+	for (i = 0; i < p_chain->n_pre; i++)
+	{
+		if (p_chain->pre[i].pre_fct(p_chain->pre[i].p_data, p_info) != IFX_SUCCESS)
+			return IFX_ERROR;
+	}
+
+	return IFX_SUCCESS;
+}
+
+void cli_hook_chain_post(
+	const struct cli_hook_chain_s *p_chain,
+	const struct cli_cmd_hook_info_s *p_info)
+{
+	unsigned int i;
+
+	for (i = 0; i < p_chain->n_post; i++)
+		p_chain->post[i].post_fct(p_chain->post[i].p_data, p_info);
+}
+
+#endif	/* #if (CLI_SUPPORT_HOOKS == 1) */
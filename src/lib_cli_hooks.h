@@ -0,0 +1,258 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_HOOKS_H
+#define _LIB_CLI_HOOKS_H
+
+/**
+   \file lib_cli_hooks.h
+   Command Line Interface - command execution hooks
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_HOOKS CLI Command Execution Hooks
+
+   Pre and post execution hooks around each command handler call of a CLI
+   core (user and built-in commands), e.g. for auditing, access control,
+   metrics or output capture.
+
+   - pre hooks are called in the order of installation, a pre hook may
+     reject the command (access control), the handler and the following pre
+     hooks are not called and the core answers
+     "errorcode=-1 (command rejected)".
+   - post hooks are called in the reverse order, also for rejected commands,
+     with the result of the handler and the buffer mode printout.
+
+   The installed hooks are compiled into a chain of the pre and the post
+   callbacks which is replaced on each change (\ref cli_core_hook_add,
+   \ref cli_core_hook_remove). Without hooks the command dispatch only
+   checks the chain pointer.
+
+\remarks
+   - The hooks are installed per CLI core, a clone has its own hooks.
+   - Replaced chains are kept until the release of the CLI core (a
+     concurrent command execution may still use them), hooks are intended
+     to be changed rarely.
+   - Help requests answered by the core (usage metadata) and unknown
+     commands do not call the hooks.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Command execution, passed to the hooks */
+struct cli_cmd_hook_info_s
+{
+	/** command key (as entered, path of a path command) */
+	const char *p_key;
+	/** command arguments */
+	const char *p_arg;
+	/** command number (statistics) */
+	unsigned int cmd_idx;
+	/** CLI core instance */
+	unsigned int inst;
+	/** session of the calling thread (pipe number), -1: none */
+	int session;
+	/** return value of the handler (post hook), IFX_ERROR: rejected */
+	int result;
+	/** printout of the handler (post hook, buffer mode), IFX_NULL: file mode */
+	const char *p_out;
+	/** execution context of the call, e.g. for a cancel request */
+	struct cli_exec_ctx_s *p_exec_ctx;
+};
+
+/** Pre execution hook.
+
+\param
+   p_data  user data, given with \ref cli_core_hook_add.
+\param
+   p_info  command execution.
+
+\return
+   IFX_SUCCESS - execute the command
+   else - reject the command
+
+\remarks
+   Buffer mode: key and arguments refer to the command line buffer which
+   is overwritten by the printout, they are not valid in the post hook.
+*/
+typedef int (*cli_cmd_hook_pre_t)(
+	void *p_data,
+	const struct cli_cmd_hook_info_s *p_info);
+
+/** Post execution hook.
+
+\param
+   p_data  user data, given with \ref cli_core_hook_add.
+\param
+   p_info  command execution, including the result.
+*/
+typedef void (*cli_cmd_hook_post_t)(
+	void *p_data,
+	const struct cli_cmd_hook_info_s *p_info);
+
+/** Hook chain entry */
+struct cli_hook_s
+{
+	/** pre execution hook, IFX_NULL: none */
+	cli_cmd_hook_pre_t pre_fct;
+	/** post execution hook, IFX_NULL: none */
+	cli_cmd_hook_post_t post_fct;
+	/** user data */
+	void *p_data;
+};
+
+/** Hook chain, not changed after creation */
+struct cli_hook_chain_s
+{
+	/** number of installed hooks */
+	unsigned int n_hooks;
+	/** installed hooks (order of installation) */
+	struct cli_hook_s hook[CLI_HOOKS_MAX];
+	/** number of pre hooks */
+	unsigned int n_pre;
+	/** pre hooks, call order */
+	struct cli_hook_s pre[CLI_HOOKS_MAX];
+	/** number of post hooks */
+	unsigned int n_post;
+	/** post hooks, call order (reverse order of installation) */
+	struct cli_hook_s post[CLI_HOOKS_MAX];
+	/** next replaced chain (kept until release) */
+	struct cli_hook_chain_s *p_next;
+};
+
+/** Create a chain with an additional hook.
+
+\param
+   p_chain  current chain, IFX_NULL: none.
+\param
+   p_hook  hook to add (at least one callback).
+\param
+   pp_new  returns the new chain.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (chain full, no memory).
+*/
+extern int cli_hook_chain_add(
+	const struct cli_hook_chain_s *p_chain,
+	const struct cli_hook_s *p_hook,
+	struct cli_hook_chain_s **pp_new);
+
+/** Create a chain without a hook.
+
+\param
+   p_chain  current chain.
+\param
+   p_hook  hook to remove (callbacks and user data as installed).
+\param
+   pp_new  returns the new chain, IFX_NULL: no hooks left.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (not installed, no memory).
+*/
+extern int cli_hook_chain_remove(
+	const struct cli_hook_chain_s *p_chain,
+	const struct cli_hook_s *p_hook,
+	struct cli_hook_chain_s **pp_new);
+
+/** Release a list of chains (linked by p_next).
+
+\param
+   pp_chain  first chain of the list.
+
+\return
+   IFX_SUCCESS - operation done
+*/
+extern int cli_hook_chain_release(
+	struct cli_hook_chain_s **pp_chain);
+
+/** Call the pre hooks.
+
+\param
+   p_chain  hook chain.
+\param
+   p_info  command execution.
+
+\return
+   IFX_SUCCESS - execute the command
+   IFX_ERROR - rejected.
+*/
+extern int cli_hook_chain_pre(
+	const struct cli_hook_chain_s *p_chain,
+	const struct cli_cmd_hook_info_s *p_info);
+
+/** Call the post hooks.
+
+\param
+   p_chain  hook chain.
+\param
+   p_info  command execution, including the result.
+*/
+extern void cli_hook_chain_post(
+	const struct cli_hook_chain_s *p_chain,
+	const struct cli_cmd_hook_info_s *p_info);
+
+/** Install a hook at the end of the chain of a CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   pre_fct  pre execution hook, IFX_NULL: none.
+\param
+   post_fct  post execution hook, IFX_NULL: none.
+\param
+   p_data  user data for the hooks.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (no callback, \ref CLI_HOOKS_MAX hooks installed).
+*/
+extern int cli_core_hook_add(
+	struct cli_core_context_s *p_core_ctx,
+	cli_cmd_hook_pre_t pre_fct,
+	cli_cmd_hook_post_t post_fct,
+	void *p_data);
+
+/** Remove a hook (callbacks and user data as installed).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   pre_fct  pre execution hook.
+\param
+   post_fct  post execution hook.
+\param
+   p_data  user data for the hooks.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (not installed).
+*/
+extern int cli_core_hook_remove(
+	struct cli_core_context_s *p_core_ctx,
+	cli_cmd_hook_pre_t pre_fct,
+	cli_cmd_hook_post_t post_fct,
+	void *p_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_HOOKS_H */
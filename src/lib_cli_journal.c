@@ -0,0 +1,368 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_journal.c
+   Command Line Interface - persistent event / dump journal
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_JOURNAL == 1)
+#include "lib_cli_journal.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** journal file magic "CLIJ" */
+#define CLI_JOURNAL_MAGIC	0x434C494A
+/** journal file layout version */
+#define CLI_JOURNAL_VERSION	1
+
+/** min slot size, slot header + some text */
+#define CLI_JOURNAL_MIN_SLOT_SIZE	64
+
+/** slot marker - a writer fills the slot */
+#define CLI_JOURNAL_SLOT_BUSY	(~0ULL)
+
+/** Journal file header (start of the mapped file) */
+struct cli_journal_hdr_s
+{
+	/** file magic */
+	unsigned int magic;
+	/** layout version */
+	unsigned int version;
+	/** number of slots */
+	unsigned int n_slots;
+	/** size of a slot */
+	unsigned int slot_size;
+	/** next sequence number to write (atomic) */
+	unsigned long long next_seq;
+	/** reserved, keep the slots 8 byte aligned */
+	unsigned long long reserved[2];
+};
+
+/** Journal slot header, followed by the zero terminated text.
+
+\remarks
+   The seq field works as a sequence lock:
+   - 0: slot is invalid
+   - \ref CLI_JOURNAL_SLOT_BUSY: slot is under construction
+   - <seq + 1>: slot contains the entry with the given sequence number
+*/
+struct cli_journal_slot_s
+{
+	/** sequence number + 1 of the entry, 0 if invalid */
+	unsigned long long seq;
+	/** time stamp [ms since epoch] */
+	unsigned long long time_ms;
+	/** entry type */
+	unsigned int type;
+	/** text length */
+	unsigned int len;
+};
+
+/** Journal context */
+struct cli_journal_s
+{
+	/** file descriptor */
+	int fd;
+	/** size of the mapping */
+	size_t map_size;
+	/** points to the file header (start of the mapping) */
+	struct cli_journal_hdr_s *p_hdr;
+	/** points to the first slot */
+	unsigned char *p_slots;
+	/** number of slots */
+	unsigned int n_slots;
+	/** size of a slot */
+	unsigned int slot_size;
+};
+
+CLI_STATIC unsigned long long journal_time_ms_get(void)
+{
+	struct timespec ts;
+
+	if (clock_gettime(CLOCK_REALTIME, &ts) != 0)
+		return 0;
+
+	return (unsigned long long)ts.tv_sec * 1000ULL +
+		(unsigned long long)(ts.tv_nsec / 1000000);
+}
+
+CLI_STATIC struct cli_journal_slot_s *journal_slot_get(
+	struct cli_journal_s *p_journal,
+	unsigned long long seq)
+{
+	return (struct cli_journal_slot_s *)(p_journal->p_slots +
+		(size_t)(seq % p_journal->n_slots) * p_journal->slot_size);
+}
+
+int cli_journal_open(
+	const char *p_path,
+	unsigned int n_slots,
+	unsigned int slot_size,
+	struct cli_journal_s **pp_journal)
+{
+	struct cli_journal_s *p_journal;
+	struct cli_journal_hdr_s *p_hdr;
+	struct cli_journal_slot_s *p_slot;
+	struct stat st;
+	size_t map_size;
+	unsigned int i;
+	void *p_map;
+	int fd;
+
+	if ((p_path == IFX_NULL) || (pp_journal == IFX_NULL) || (*pp_journal != IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Journal: open - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	if (n_slots == 0)
+		n_slots = CLI_JOURNAL_DEFAULT_SLOTS;
+	if (slot_size == 0)
+		slot_size = CLI_JOURNAL_DEFAULT_SLOT_SIZE;
+	if (slot_size < CLI_JOURNAL_MIN_SLOT_SIZE)
+		slot_size = CLI_JOURNAL_MIN_SLOT_SIZE;
+	/* keep the slot headers 8 byte aligned */
+	slot_size = (slot_size + 7) & ~7U;
+
+	map_size = sizeof(struct cli_journal_hdr_s) + (size_t)n_slots * slot_size;
+
+	fd = clios_open(p_path, O_RDWR | O_CREAT, 0644);
+	if (fd < 0)
+	{
+		CLI_USR_ERR(LIB_CLI,
+			("ERR CLI Journal: open - cannot open %s" CLI_CRLF, p_path));
+		return IFX_ERROR;
+	}
+
+	if ((fstat(fd, &st) != 0) ||
+	    (((size_t)st.st_size != map_size) && (clios_ftruncate(fd, (off_t)map_size) != 0)))
+	{
+		CLI_USR_ERR(LIB_CLI,
+			("ERR CLI Journal: open - cannot resize %s" CLI_CRLF, p_path));
+		(void)clios_close(fd);
+		return IFX_ERROR;
+	}
+
+	p_map = clios_mmap(IFX_NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (p_map == MAP_FAILED)
+	{
+		CLI_USR_ERR(LIB_CLI,
+			("ERR CLI Journal: open - cannot map %s" CLI_CRLF, p_path));
+		(void)clios_close(fd);
+		return IFX_ERROR;
+	}
+
+	p_journal = (struct cli_journal_s *)clios_memalloc(sizeof(struct cli_journal_s));
+	if (p_journal == IFX_NULL)
+	{
+		(void)clios_munmap(p_map, map_size);
+		(void)clios_close(fd);
+		return IFX_ERROR;
+	}
+	clios_memset(p_journal, 0x00, sizeof(struct cli_journal_s));
+
+	p_hdr = (struct cli_journal_hdr_s *)p_map;
+	if ((p_hdr->magic != CLI_JOURNAL_MAGIC) ||
+	    (p_hdr->version != CLI_JOURNAL_VERSION) ||
+	    (p_hdr->n_slots != n_slots) ||
+	    (p_hdr->slot_size != slot_size))
+	{
+		/* new file or other geometry - start from scratch */
+		clios_memset(p_map, 0x00, map_size);
+		p_hdr->n_slots = n_slots;
+		p_hdr->slot_size = slot_size;
+		p_hdr->version = CLI_JOURNAL_VERSION;
+		p_hdr->next_seq = 0;
+		clios_atomic_store(&p_hdr->magic, CLI_JOURNAL_MAGIC);
+	}
+	else
+	{
+		/* drop the entries of an interrupted writer */
+		for (i = 0; i < n_slots; i++)
+		{
+			p_slot = (struct cli_journal_slot_s *)((unsigned char *)p_map +
+				sizeof(struct cli_journal_hdr_s) + (size_t)i * slot_size);
+			if (p_slot->seq == CLI_JOURNAL_SLOT_BUSY)
+				p_slot->seq = 0;
+		}
+	}
+
+	p_journal->fd = fd;
+	p_journal->map_size = map_size;
+	p_journal->p_hdr = p_hdr;
+	p_journal->p_slots = (unsigned char *)p_map + sizeof(struct cli_journal_hdr_s);
+	p_journal->n_slots = n_slots;
+	p_journal->slot_size = slot_size;
+
+	*pp_journal = p_journal;
+	return IFX_SUCCESS;
+}
+
+int cli_journal_close(
+	struct cli_journal_s **pp_journal)
+{
+	struct cli_journal_s *p_journal;
+
+	if ((pp_journal == IFX_NULL) || (*pp_journal == IFX_NULL))
+		return IFX_ERROR;
+
+	p_journal = *pp_journal;
+	*pp_journal = IFX_NULL;
+
+	(void)clios_msync(p_journal->p_hdr, p_journal->map_size, MS_ASYNC);
+	(void)clios_munmap(p_journal->p_hdr, p_journal->map_size);
+	(void)clios_close(p_journal->fd);
+	clios_memfree(p_journal);
+
+	return IFX_SUCCESS;
+}
+
+int cli_journal_append(
+	struct cli_journal_s *p_journal,
+	unsigned int type,
+	const char *p_text)
+{
+	struct cli_journal_slot_s *p_slot;
+	unsigned long long seq, slot_seq;
+	unsigned int len, max_len;
+
+	if ((p_journal == IFX_NULL) || (p_text == IFX_NULL))
+		return IFX_ERROR;
+
+	max_len = p_journal->slot_size - sizeof(struct cli_journal_slot_s) - 1;
+	len = (unsigned int)clios_strlen(p_text);
+	if (len > max_len)
+		len = max_len;
+
+	/* reserve the slot - this is the only shared write access */
+	seq = clios_atomic_fetch_add(&p_journal->p_hdr->next_seq, 1ULL);
+	p_slot = journal_slot_get(p_journal, seq);
+
+	/* claim the slot - after a wrap a writer one lap behind may still fill
+	   it, the writers of a slot are serialized */
+	slot_seq = clios_atomic_load(&p_slot->seq);
+	for (;;)
+	{
+		if (slot_seq == CLI_JOURNAL_SLOT_BUSY)
+		{
+			slot_seq = clios_atomic_load(&p_slot->seq);
+			continue;
+		}
+		/* already overwritten by a writer one lap ahead */
+		if (slot_seq > seq + 1)
+			return IFX_SUCCESS;
+		if (clios_atomic_cas(&p_slot->seq, &slot_seq, CLI_JOURNAL_SLOT_BUSY))
+			break;
+	}
+
+	/* fill and commit the slot */
+	clios_atomic_fence_release();
+	p_slot->time_ms = journal_time_ms_get();
+	p_slot->type = type;
+	p_slot->len = len;
+	clios_memcpy((char *)(p_slot + 1), p_text, len);
+	((char *)(p_slot + 1))[len] = '\0';
+	clios_atomic_store(&p_slot->seq, seq + 1);
+
+	return IFX_SUCCESS;
+}
+
+int cli_journal_seq_get(
+	struct cli_journal_s *p_journal,
+	unsigned long long *p_first_seq,
+	unsigned long long *p_next_seq)
+{
+	unsigned long long next_seq;
+
+	if (p_journal == IFX_NULL)
+		return IFX_ERROR;
+
+	next_seq = clios_atomic_load(&p_journal->p_hdr->next_seq);
+	if (p_first_seq)
+		*p_first_seq = (next_seq > p_journal->n_slots) ? (next_seq - p_journal->n_slots) : 0;
+	if (p_next_seq)
+		*p_next_seq = next_seq;
+
+	return IFX_SUCCESS;
+}
+
+int cli_journal_read(
+	struct cli_journal_s *p_journal,
+	unsigned long long from_seq,
+	unsigned int max_entries,
+	cli_journal_read_fct_t read_fct,
+	void *p_data,
+	unsigned long long *p_next_seq)
+{
+	struct cli_journal_slot_s *p_slot, slot;
+	unsigned long long seq, first_seq, next_seq;
+	unsigned int max_len;
+	int n_entries = 0;
+	char *p_text;
+
+	if ((p_journal == IFX_NULL) || (read_fct == IFX_NULL))
+		return IFX_ERROR;
+
+	p_text = (char *)clios_memalloc(p_journal->slot_size);
+	if (p_text == IFX_NULL)
+		return IFX_ERROR;
+	max_len = p_journal->slot_size - sizeof(struct cli_journal_slot_s) - 1;
+
+	(void)cli_journal_seq_get(p_journal, &first_seq, &next_seq);
+	seq = (from_seq < first_seq) ? first_seq : from_seq;
+
+	for (; seq < next_seq; seq++)
+	{
+		if ((max_entries != 0) && ((unsigned int)n_entries >= max_entries))
+			break;
+
+		p_slot = journal_slot_get(p_journal, seq);
+
+		/* copy the slot, drop it if not committed or overwritten meanwhile */
+		slot.seq = clios_atomic_load(&p_slot->seq);
+		if (slot.seq != seq + 1)
+			continue;
+		slot.time_ms = p_slot->time_ms;
+		slot.type = p_slot->type;
+		slot.len = p_slot->len;
+		if (slot.len > max_len)
+			continue;
+		clios_memcpy(p_text, (char *)(p_slot + 1), slot.len);
+		p_text[slot.len] = '\0';
+		clios_atomic_fence_acquire();
+		if (clios_atomic_load_relaxed(&p_slot->seq) != slot.seq)
+			continue;
+
+		/* a refused entry is not delivered, the next read starts with it */
+		if (read_fct(p_data, seq, slot.time_ms, slot.type, p_text) != 0)
+			break;
+		n_entries++;
+	}
+
+	clios_memfree(p_text);
+
+	if (p_next_seq)
+		*p_next_seq = seq;
+
+	return n_entries;
+}
+
+#endif	/* #if (CLI_SUPPORT_JOURNAL == 1) */
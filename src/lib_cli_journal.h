@@ -0,0 +1,265 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_JOURNAL_H
+#define _LIB_CLI_JOURNAL_H
+
+/**
+   \file lib_cli_journal.h
+   Command Line Interface - persistent event / dump journal
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_JOURNAL CLI Event Journal
+
+   The journal keeps the last events and message dumps issued via
+   \ref cli_user_if_event and \ref cli_user_if_dump within a memory mapped
+   ring file. Each entry gets a unique, increasing sequence number.
+
+   A user interface which (re-)connects later can request all entries starting
+   from a given sequence number (\ref cli_user_if_replay or the built-in
+   command "journal"), so no alarm is lost while the client was not running.
+
+   The journal file survives a restart of the process, the sequence numbering
+   continues with the next start.
+
+\remarks
+   - Adding an entry is lock-free (one atomic increment + copy into the slot),
+     only writers which meet on the same slot after a wrap of the ring wait
+     for each other.
+   - Each entry is stored within a fixed size slot, longer text is truncated.
+   - If more than "number of slots" entries have been written since the
+     requested sequence number, the oldest entries are lost.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** journal entry type - event */
+#define CLI_JOURNAL_TYPE_EVENT	1
+/** journal entry type - message dump */
+#define CLI_JOURNAL_TYPE_DUMP	2
+
+/** Forward declaration, journal context */
+struct cli_journal_s;
+
+/** Journal read callback, called for each journal entry.
+
+\param
+   p_data  user data, given with the read call.
+\param
+   seq  sequence number of the entry.
+\param
+   time_ms  time stamp of the entry [ms since epoch].
+\param
+   type  entry type (\ref CLI_JOURNAL_TYPE_EVENT, \ref CLI_JOURNAL_TYPE_DUMP).
+\param
+   p_text  points to the entry text.
+
+\return
+   0 - continue
+   else - stop reading
+*/
+typedef int (*cli_journal_read_fct_t)(
+	void *p_data,
+	unsigned long long seq,
+	unsigned long long time_ms,
+	unsigned int type,
+	const char *p_text);
+
+/** Open (or create) a journal file and map it.
+
+\remarks
+   An existing journal file with the same geometry is taken over and the
+   sequence numbering continues, else the journal is re-initialized.
+
+\param
+   p_path  path of the journal file.
+\param
+   n_slots  number of journal entries (0: use the default).
+\param
+   slot_size  size of an entry (0: use the default).
+\param
+   pp_journal  returns the journal context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_journal_open(
+	const char *p_path,
+	unsigned int n_slots,
+	unsigned int slot_size,
+	struct cli_journal_s **pp_journal);
+
+/** Unmap and close a journal file.
+
+\param
+   pp_journal  contains the journal context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_journal_close(
+	struct cli_journal_s **pp_journal);
+
+/** Append an entry to the journal (lock-free).
+
+\param
+   p_journal  journal context.
+\param
+   type  entry type.
+\param
+   p_text  entry text (will be truncated to the slot size).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_journal_append(
+	struct cli_journal_s *p_journal,
+	unsigned int type,
+	const char *p_text);
+
+/** Read all entries starting with the given sequence number.
+
+\param
+   p_journal  journal context.
+\param
+   from_seq  first sequence number to deliver.
+\param
+   max_entries  max number of entries to deliver (0: all).
+\param
+   read_fct  callback, called for each entry.
+\param
+   p_data  user data for the callback.
+\param
+   p_next_seq  returns the sequence number following the last delivered
+               entry (can be used for the next read). If the callback
+               stopped the read, this is the entry which it refused.
+
+\return
+   number of delivered entries (without the refused entry)
+   IFX_ERROR - failed.
+*/
+extern int cli_journal_read(
+	struct cli_journal_s *p_journal,
+	unsigned long long from_seq,
+	unsigned int max_entries,
+	cli_journal_read_fct_t read_fct,
+	void *p_data,
+	unsigned long long *p_next_seq);
+
+/** Get the available sequence number range of the journal.
+
+\param
+   p_journal  journal context.
+\param
+   p_first_seq  returns the oldest available sequence number.
+\param
+   p_next_seq  returns the next sequence number to be written.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_journal_seq_get(
+	struct cli_journal_s *p_journal,
+	unsigned long long *p_first_seq,
+	unsigned long long *p_next_seq);
+
+/** Attach a journal file to the given CLI core.
+   From now on all events and dumps of this core are written to the journal.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_path  path of the journal file.
+\param
+   n_slots  number of journal entries (0: use the default).
+\param
+   slot_size  size of an entry (0: use the default).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_core_journal_open(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_path,
+	unsigned int n_slots,
+	unsigned int slot_size);
+
+/** Detach and close the journal of the given CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_core_journal_close(
+	struct cli_core_context_s *p_core_ctx);
+
+/** Get the available sequence number range of the CLI core journal.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_first_seq  returns the oldest available sequence number.
+\param
+   p_next_seq  returns the next sequence number to be written.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (no journal attached).
+*/
+extern int cli_core_journal_seq_get(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned long long *p_first_seq,
+	unsigned long long *p_next_seq);
+
+/** Deliver the journal entries starting with the given sequence number
+   to a registered user interface (via its event and dump callbacks).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_user_ctx  user interface context (see \ref cli_user_if_register).
+\param
+   from_seq  first sequence number to deliver.
+\param
+   p_next_seq  returns the sequence number following the last delivered entry.
+
+\return
+   number of delivered entries
+   IFX_ERROR - failed (no journal attached).
+*/
+extern int cli_user_if_replay(
+	struct cli_core_context_s *p_core_ctx,
+	struct cli_user_context_s *p_user_ctx,
+	unsigned long long from_seq,
+	unsigned long long *p_next_seq);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_JOURNAL_H */
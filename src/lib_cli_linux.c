@@ -271,6 +271,9 @@ EXPORT_SYMBOL(cli_core_buildin_register);
 EXPORT_SYMBOL(cli_check_help__buffer);
 EXPORT_SYMBOL(cli_core_key_add__buffer);
 EXPORT_SYMBOL(cli_core_cmd_exec__buffer);
+EXPORT_SYMBOL(cli_core_cmd_exec_cont__buffer);
+EXPORT_SYMBOL(cli_core_exec_cursor_size_set);
+EXPORT_SYMBOL(cli_core_exec_cursor_release);
 EXPORT_SYMBOL(cli_user_if_register);
 EXPORT_SYMBOL(cli_user_if_unregister);
 
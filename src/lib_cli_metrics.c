@@ -0,0 +1,99 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_metrics.c
+   Command Line Interface - OpenMetrics (Prometheus) text exporter
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_METRICS == 1)
+#include "lib_cli_metrics.h"
+
+#include <stdarg.h>
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+void cli_metrics_init(
+	struct cli_metrics_s *p_metrics,
+	char *p_buf,
+	unsigned int buf_size)
+{
+	p_metrics->p_buf = p_buf;
+	p_metrics->buf_size = buf_size;
+	p_metrics->len = 0;
+	p_metrics->b_overflow = IFX_FALSE;
+
+	if ((p_buf != IFX_NULL) && (buf_size > 0))
+		p_buf[0] = '\0';
+}
+
+int cli_metrics_printf(
+	struct cli_metrics_s *p_metrics,
+	const char *format,
+	...)
+{
+	va_list ap;
+	int ret;
+	unsigned int remain;
+
+	if ((p_metrics->b_overflow == IFX_TRUE) || (p_metrics->p_buf == IFX_NULL))
+		return IFX_ERROR;
+
+	remain = p_metrics->buf_size - p_metrics->len;
+
+	va_start(ap, format);
+	ret = clios_vsnprintf(p_metrics->p_buf + p_metrics->len, remain, format, ap);
+	va_end(ap);
+
+	if ((ret < 0) || ((unsigned int)ret >= remain))
+	{
+		/* keep the last complete line */
+		p_metrics->p_buf[p_metrics->len] = '\0';
+		p_metrics->b_overflow = IFX_TRUE;
+		return IFX_ERROR;
+	}
+	p_metrics->len += (unsigned int)ret;
+
+	return IFX_SUCCESS;
+}
+
+int cli_metrics_family(
+	struct cli_metrics_s *p_metrics,
+	const char *p_name,
+	const char *p_type,
+	const char *p_help)
+{
+	return cli_metrics_printf(p_metrics, "# TYPE %s %s\n# HELP %s %s\n",
+		p_name, p_type, p_name, p_help);
+}
+
+int cli_metrics_sample(
+	struct cli_metrics_s *p_metrics,
+	const char *p_name,
+	const char *p_labels,
+	unsigned long long value)
+{
+	if (p_labels != IFX_NULL)
+		return cli_metrics_printf(p_metrics, "%s{%s} %llu\n", p_name, p_labels, value);
+
+	return cli_metrics_printf(p_metrics, "%s %llu\n", p_name, value);
+}
+
+#endif	/* #if (CLI_SUPPORT_METRICS == 1) */
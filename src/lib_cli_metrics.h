@@ -0,0 +1,244 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_METRICS_H
+#define _LIB_CLI_METRICS_H
+
+/**
+   \file lib_cli_metrics.h
+   Command Line Interface - OpenMetrics (Prometheus) text exporter
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_METRICS CLI Metrics Exporter
+
+   The runtime metrics of a CLI core are rendered in the OpenMetrics text
+   format, so a local node agent can scrape them without parsing the
+   "help" output:
+   - per command calls, errors, output bytes and latency histogram
+     (see \ref LIB_CLI_STATS)
+   - number of commands, clones, user interfaces and memory usage
+   - metrics of registered sources, for example the pipe interface
+     (event / dump FIFO fill level and drops, pipe sessions)
+
+   The metrics are available via the built-in command "metrics", the file
+   writer \ref cli_core_metrics_file_write (for a "textfile" collector) and
+   the socket / fd writer \ref cli_core_metrics_fd_write. The built-in
+   command writes files only within the directory set by
+   \ref cli_core_file_dir_set (the pipes are open to all local users).
+
+\remarks
+   The text is rendered into a buffer which is allocated once per CLI core
+   (or into the given buffer), there is no heap allocation per scrape.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Metrics render context - appends to a preallocated buffer */
+struct cli_metrics_s
+{
+	/** render buffer */
+	char *p_buf;
+	/** size of the render buffer */
+	unsigned int buf_size;
+	/** number of rendered bytes (without the terminating zero) */
+	unsigned int len;
+	/** set if the buffer was too small */
+	IFX_boolean_t b_overflow;
+};
+
+/** Metrics source callback, renders additional metric families.
+
+\param
+   p_data  user data, given with \ref cli_core_metrics_source_add.
+\param
+   p_metrics  render context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+typedef int (*cli_metrics_source_fct_t)(
+	void *p_data,
+	struct cli_metrics_s *p_metrics);
+
+/** Setup a render context.
+
+\param
+   p_metrics  render context.
+\param
+   p_buf  render buffer.
+\param
+   buf_size  size of the render buffer.
+*/
+extern void cli_metrics_init(
+	struct cli_metrics_s *p_metrics,
+	char *p_buf,
+	unsigned int buf_size);
+
+/** Append formatted text.
+
+\param
+   p_metrics  render context.
+\param
+   format  printf like format.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - buffer too small (the overflow flag is set).
+*/
+extern int cli_metrics_printf(
+	struct cli_metrics_s *p_metrics,
+	const char *format,
+	...);
+
+/** Append the metadata of a metric family ("# TYPE", "# HELP").
+
+\param
+   p_metrics  render context.
+\param
+   p_name  family name (without "_total" for counters).
+\param
+   p_type  "counter", "gauge", "histogram", "info", ...
+\param
+   p_help  help text.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - buffer too small.
+*/
+extern int cli_metrics_family(
+	struct cli_metrics_s *p_metrics,
+	const char *p_name,
+	const char *p_type,
+	const char *p_help);
+
+/** Append a sample with an integer value.
+
+\param
+   p_metrics  render context.
+\param
+   p_name  sample name (including the suffix like "_total").
+\param
+   p_labels  label set without braces (for example "cmd=\"help\""),
+             IFX_NULL: no labels.
+\param
+   value  sample value.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - buffer too small.
+*/
+extern int cli_metrics_sample(
+	struct cli_metrics_s *p_metrics,
+	const char *p_name,
+	const char *p_labels,
+	unsigned long long value);
+
+/** Register an additional metrics source for the given CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   source_fct  render callback.
+\param
+   p_data  user data for the callback.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (no free entry, see \ref CLI_METRICS_MAX_SOURCES).
+*/
+extern int cli_core_metrics_source_add(
+	struct cli_core_context_s *p_core_ctx,
+	cli_metrics_source_fct_t source_fct,
+	void *p_data);
+
+/** Remove a metrics source.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   source_fct  render callback.
+\param
+   p_data  user data for the callback.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - source not found.
+*/
+extern int cli_core_metrics_source_remove(
+	struct cli_core_context_s *p_core_ctx,
+	cli_metrics_source_fct_t source_fct,
+	void *p_data);
+
+/** Render the metrics of the given CLI core into the given buffer.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_buf  render buffer.
+\param
+   buf_size  size of the render buffer.
+
+\return
+   number of rendered bytes
+   IFX_ERROR - failed (buffer too small).
+*/
+extern int cli_core_metrics_render(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_buf,
+	unsigned int buf_size);
+
+/** Write the metrics of the given CLI core to a file.
+   The file is replaced atomically (written to "<path>.tmp" and renamed).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_path  file path.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_core_metrics_file_write(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_path);
+
+/** Write the metrics of the given CLI core to a file descriptor
+   (for example an accepted socket connection).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   fd  file descriptor, not closed.
+
+\return
+   number of written bytes
+   IFX_ERROR - failed.
+*/
+extern int cli_core_metrics_fd_write(
+	struct cli_core_context_s *p_core_ctx,
+	int fd);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_METRICS_H */
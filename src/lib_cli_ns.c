@@ -0,0 +1,304 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_ns.c
+   Command Line Interface - hierarchical command namespaces
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_NAMESPACE == 1)
+#include "lib_cli_ns.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** initial size of a child table */
+#define CLI_NS_CHILD_INIT	4
+
+/** token separator */
+#define CLI_NS_IS_SPACE(c)	(((c) == ' ') || ((c) == '\t'))
+
+/** Compare the token of a node with a token (lexicographic order) */
+CLI_STATIC int ns_token_cmp(
+	const struct cli_ns_node_s *p_node,
+	const char *p_token,
+	unsigned int len)
+{
+	unsigned int n = (p_node->token_len < len) ? p_node->token_len : len;
+	int ret = clios_memcmp(p_node->p_token, p_token, n);
+
+	if (ret != 0)
+		return ret;
+	if (p_node->token_len == len)
+		return 0;
+
+	return (p_node->token_len < len) ? -1 : 1;
+}
+
+/** Binary search within the child table, returns the insert position if
+    not found */
+CLI_STATIC unsigned int ns_child_pos(
+	const struct cli_ns_node_s *p_node,
+	const char *p_token,
+	unsigned int len,
+	int *p_found)
+{
+	unsigned int lo = 0, hi = p_node->n_child, mid;
+	int ret;
+
+	*p_found = 0;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		ret = ns_token_cmp(p_node->pp_child[mid], p_token, len);
+		if (ret == 0)
+		{
+			*p_found = 1;
+			return mid;
+		}
+		if (ret < 0)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+/** Create a child of a level (path = parent path + token) */
+CLI_STATIC struct cli_ns_node_s *ns_child_add(
+	struct cli_ns_s *p_ns,
+	struct cli_ns_node_s *p_parent,
+	unsigned int pos,
+	const char *p_token,
+	unsigned int len)
+{
+	struct cli_ns_node_s *p_node, **pp_new;
+	unsigned int parent_len, size;
+
+	if (p_parent->n_child >= p_parent->child_size)
+	{
+		size = p_parent->child_size ? 2 * p_parent->child_size : CLI_NS_CHILD_INIT;
+		pp_new = (struct cli_ns_node_s **)clios_memalloc(size * sizeof(struct cli_ns_node_s *));
+		if (pp_new == IFX_NULL)
+			return IFX_NULL;
+		if (p_parent->pp_child != IFX_NULL)
+		{
+			clios_memcpy(pp_new, p_parent->pp_child,
+				p_parent->n_child * sizeof(struct cli_ns_node_s *));
+			clios_memfree(p_parent->pp_child);
+		}
+		p_parent->pp_child = pp_new;
+		p_parent->child_size = size;
+	}
+
+	parent_len = (p_parent->p_path != IFX_NULL) ?
+		(unsigned int)clios_strlen(p_parent->p_path) : 0;
+
+	p_node = (struct cli_ns_node_s *)clios_memalloc(sizeof(struct cli_ns_node_s));
+	if (p_node == IFX_NULL)
+		return IFX_NULL;
+	clios_memset(p_node, 0x00, sizeof(struct cli_ns_node_s));
+
+	p_node->p_path = (char *)clios_memalloc(parent_len + len + 2);
+	if (p_node->p_path == IFX_NULL)
+	{
+		clios_memfree(p_node);
+		return IFX_NULL;
+	}
+	if (parent_len)
+	{
+		clios_memcpy(p_node->p_path, p_parent->p_path, parent_len);
+		p_node->p_path[parent_len++] = ' ';
+	}
+	clios_memcpy(p_node->p_path + parent_len, p_token, len);
+	p_node->p_path[parent_len + len] = '\0';
+	p_node->p_token = p_node->p_path + parent_len;
+	p_node->token_len = len;
+
+	clios_memmove(&p_parent->pp_child[pos + 1], &p_parent->pp_child[pos],
+		(p_parent->n_child - pos) * sizeof(struct cli_ns_node_s *));
+	p_parent->pp_child[pos] = p_node;
+	p_parent->n_child++;
+	p_ns->n_nodes++;
+
+	return p_node;
+}
+
+/** Release the children of a level */
+CLI_STATIC void ns_node_release(
+	struct cli_ns_node_s *p_node)
+{
+	unsigned int i;
+
+	for (i = 0; i < p_node->n_child; i++)
+	{
+		ns_node_release(p_node->pp_child[i]);
+		clios_memfree(p_node->pp_child[i]);
+	}
+	if (p_node->pp_child != IFX_NULL)
+		clios_memfree(p_node->pp_child);
+	if (p_node->p_path != IFX_NULL)
+		clios_memfree(p_node->p_path);
+}
+
+int cli_ns_init(
+	struct cli_ns_s **pp_ns)
+{
+	struct cli_ns_s *p_ns;
+
+	if ((pp_ns == IFX_NULL) || (*pp_ns != IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Namespace: init - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_ns = (struct cli_ns_s *)clios_memalloc(sizeof(struct cli_ns_s));
+	if (p_ns == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Namespace: init - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_ns, 0x00, sizeof(struct cli_ns_s));
+
+	*pp_ns = p_ns;
+	return IFX_SUCCESS;
+}
+
+int cli_ns_release(
+	struct cli_ns_s **pp_ns)
+{
+	struct cli_ns_s *p_ns;
+
+	if ((pp_ns == IFX_NULL) || (*pp_ns == IFX_NULL))
+		return IFX_ERROR;
+
+	p_ns = *pp_ns;
+	*pp_ns = IFX_NULL;
+
+	ns_node_release(&p_ns->root);
+	clios_memfree(p_ns);
+
+	return IFX_SUCCESS;
+}
+
+int cli_ns_path_add(
+	struct cli_ns_s *p_ns,
+	const char *p_path,
+	struct cli_ns_node_s **pp_node)
+{
+	struct cli_ns_node_s *p_node, *p_child;
+	unsigned int len, pos;
+	int found;
+
+	if ((p_ns == IFX_NULL) || (p_path == IFX_NULL) || (pp_node == IFX_NULL))
+		return IFX_ERROR;
+
+	p_node = &p_ns->root;
+	for (;;)
+	{
+		while (CLI_NS_IS_SPACE(*p_path))
+			p_path++;
+		for (len = 0; (p_path[len] != '\0') && !CLI_NS_IS_SPACE(p_path[len]); len++)
+			;
+		if (len == 0)
+			break;
+
+		pos = ns_child_pos(p_node, p_path, len, &found);
+		if (found)
+		{
+			p_child = p_node->pp_child[pos];
+		}
+		else
+		{
+			p_child = ns_child_add(p_ns, p_node, pos, p_path, len);
+			if (p_child == IFX_NULL)
+			{
+				CLI_USR_ERR(LIB_CLI, ("ERR CLI Namespace: path add - no memory" CLI_CRLF));
+				return IFX_ERROR;
+			}
+		}
+		p_node = p_child;
+		p_path += len;
+	}
+
+	if (p_node == &p_ns->root)
+		return IFX_ERROR;
+
+	*pp_node = p_node;
+	return IFX_SUCCESS;
+}
+
+struct cli_ns_node_s *cli_ns_child_find(
+	const struct cli_ns_node_s *p_node,
+	const char *p_token,
+	unsigned int len)
+{
+	unsigned int pos;
+	int found;
+
+	if ((p_node == IFX_NULL) || (p_token == IFX_NULL) || (len == 0))
+		return IFX_NULL;
+
+	pos = ns_child_pos(p_node, p_token, len, &found);
+
+	return found ? p_node->pp_child[pos] : IFX_NULL;
+}
+
+struct cli_ns_node_s *cli_ns_resolve(
+	const struct cli_ns_s *p_ns,
+	const char *p_first,
+	const char *p_rest,
+	const char **pp_rest)
+{
+	struct cli_ns_node_s *p_node, *p_child;
+	unsigned int len;
+
+	if ((p_ns == IFX_NULL) || (p_first == IFX_NULL))
+		return IFX_NULL;
+
+	p_node = cli_ns_child_find(&p_ns->root, p_first, (unsigned int)clios_strlen(p_first));
+	if (p_node == IFX_NULL)
+		return IFX_NULL;
+
+	while ((p_rest != IFX_NULL) && (p_node->n_child > 0))
+	{
+		while (CLI_NS_IS_SPACE(*p_rest))
+			p_rest++;
+		for (len = 0; (p_rest[len] != '\0') && !CLI_NS_IS_SPACE(p_rest[len]); len++)
+			;
+		p_child = cli_ns_child_find(p_node, p_rest, len);
+		if (p_child == IFX_NULL)
+			break;
+		p_node = p_child;
+		p_rest += len;
+	}
+
+	if (p_rest != IFX_NULL)
+	{
+		while (CLI_NS_IS_SPACE(*p_rest))
+			p_rest++;
+	}
+	if (pp_rest != IFX_NULL)
+		*pp_rest = p_rest;
+
+	return p_node;
+}
+
+#endif	/* #if (CLI_SUPPORT_NAMESPACE == 1) */
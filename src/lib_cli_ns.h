@@ -0,0 +1,173 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_NS_H
+#define _LIB_CLI_NS_H
+
+/**
+   \file lib_cli_ns.h
+   Command Line Interface - hierarchical command namespaces
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_NS CLI Command Namespaces
+
+   Commands can be registered with a path of tokens instead of a flat name
+   (see \ref cli_core_key_add_path__file), e.g. "gpe table entry get".
+   Each level of the namespace tree keeps a sorted table of its child
+   tokens, the dispatch walks the command line token by token (binary
+   search per level). The remaining tokens are the arguments of the
+   command.
+
+   The path (tokens separated by a single space) is the long name of the
+   command, i.e. for the help listing, the statistics and the apropos
+   search. A command line which ends at a level without command lists
+   the sub-commands of the level:
+   \code
+   gpe table
+   errorcode=-1 (incomplete command)
+      entry ...
+      range ...
+   \endcode
+
+   Subsystems register their subtrees independently, a level is created
+   with the first command below it. The completion works per level
+   (see \ref cli_traverse_level).
+
+\remarks
+   The walk takes the longest path: an argument of a command with
+   sub-commands is taken as sub-command if the names are equal.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Namespace tree node, a level and / or a command */
+struct cli_ns_node_s
+{
+	/** path of the node, tokens separated by a single space */
+	char *p_path;
+	/** token of the node (within the path) */
+	const char *p_token;
+	/** length of the token */
+	unsigned int token_len;
+	/** command of the node, IFX_NULL: level only */
+	void *p_cmd_data;
+	/** child table, sorted by the token */
+	struct cli_ns_node_s **pp_child;
+	/** number of children */
+	unsigned int n_child;
+	/** size of the child table */
+	unsigned int child_size;
+};
+
+/** Namespace tree */
+struct cli_ns_s
+{
+	/** root level (no token) */
+	struct cli_ns_node_s root;
+	/** number of nodes (without the root) */
+	unsigned int n_nodes;
+};
+
+/** Create an (empty) namespace tree.
+
+\param
+   pp_ns  returns the tree.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_ns_init(
+	struct cli_ns_s **pp_ns);
+
+/** Release a namespace tree.
+
+\param
+   pp_ns  tree to release.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_ns_release(
+	struct cli_ns_s **pp_ns);
+
+/** Add a path, the missing levels are created.
+
+\param
+   p_ns  namespace tree.
+\param
+   p_path  path, tokens separated by white spaces.
+\param
+   pp_node  returns the node of the path (the command is set by the caller).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (empty path, no memory).
+*/
+extern int cli_ns_path_add(
+	struct cli_ns_s *p_ns,
+	const char *p_path,
+	struct cli_ns_node_s **pp_node);
+
+/** Find a child of a level.
+
+\param
+   p_node  level.
+\param
+   p_token  token (not zero terminated).
+\param
+   len  length of the token.
+
+\return
+   child node
+   IFX_NULL - not found.
+*/
+extern struct cli_ns_node_s *cli_ns_child_find(
+	const struct cli_ns_node_s *p_node,
+	const char *p_token,
+	unsigned int len);
+
+/** Walk a command line token by token.
+
+\param
+   p_ns  namespace tree.
+\param
+   p_first  first token (zero terminated).
+\param
+   p_rest  remaining tokens, IFX_NULL: none.
+\param
+   pp_rest  returns the tokens after the found node (arguments).
+
+\return
+   deepest node of the command line
+   IFX_NULL - the first token is not a root token.
+*/
+extern struct cli_ns_node_s *cli_ns_resolve(
+	const struct cli_ns_s *p_ns,
+	const char *p_first,
+	const char *p_rest,
+	const char **pp_rest);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_NS_H */
@@ -59,6 +59,7 @@ extern "C"
 
 #define clios_strlen	strlen
 #define clios_strcpy	strcpy
+#define clios_strncpy	strncpy
 #define clios_strstr	strstr
 #define clios_strcmp	strcmp
 #define clios_strncmp	strncmp
@@ -71,6 +72,7 @@ extern "C"
 #define clios_memset	memset
 #define clios_memcpy	memcpy
 #define clios_memcmp	memcmp
+#define clios_memmove	memmove
 
 #define clios_printf	printf
 #define clios_sprintf	sprintf
@@ -82,6 +84,86 @@ extern "C"
 #endif
 #define clios_ioctl	ioctl
 
+#if (CLI_SUPPORT_JOURNAL == 1) || (CLI_SUPPORT_METRICS == 1) || (CLI_SUPPORT_RECORD == 1)
+#	include <sys/types.h>
+#	include <sys/stat.h>
+#	include <fcntl.h>
+#	include <unistd.h>
+
+#	define clios_open	open
+#	define clios_close	close
+#endif
+
+#if (CLI_SUPPORT_METRICS == 1) || (CLI_SUPPORT_RECORD == 1)
+#	include <errno.h>
+
+#	define clios_write	write
+#endif
+
+#if (CLI_SUPPORT_METRICS == 1)
+#	include <stdio.h>
+
+#	define clios_rename	rename
+#endif
+
+#if (CLI_SUPPORT_RECORD == 1)
+#	define clios_read	read
+#endif
+
+#if (CLI_SUPPORT_OUT_SINK == 1)
+#	include <errno.h>
+#	include <stdio.h>
+#	include <sys/uio.h>
+#	include <sys/socket.h>
+
+#	define clios_writev	writev
+#	define clios_sendmsg	sendmsg
+#	define clios_fopencookie	fopencookie
+#	define clios_setvbuf	setvbuf
+#endif
+
+#if ((CLI_SUPPORT_OUT_SINK == 1) || (CLI_SUPPORT_OUT_BUILDER == 1)) && \
+    !(defined(LINUX) && defined(__KERNEL__))
+#	include <stdio.h>
+
+#	define clios_fwrite	fwrite
+#endif
+
+#if (CLI_SUPPORT_JOURNAL == 1)
+#	include <sys/mman.h>
+#	include <time.h>
+
+#	define clios_ftruncate	ftruncate
+#	define clios_mmap	mmap
+#	define clios_munmap	munmap
+#	define clios_msync	msync
+#endif
+
+#if defined(LINUX) && !defined(__KERNEL__)
+#	include <time.h>
+
+#	define clios_clock_gettime	clock_gettime
+#endif
+
+#if (CLI_SUPPORT_THREAD_LOCAL == 1)
+/** thread local storage (GCC), not available in the kernel */
+#	define clios_thread_local	__thread
+#endif
+
+/* Function map - atomic operations (GCC builtins), used for the lock-free
+   fast paths (journal append, ...) */
+#define clios_atomic_load(p_val)	__atomic_load_n((p_val), __ATOMIC_ACQUIRE)
+#define clios_atomic_load_relaxed(p_val)	__atomic_load_n((p_val), __ATOMIC_RELAXED)
+#define clios_atomic_store(p_val, val)	__atomic_store_n((p_val), (val), __ATOMIC_RELEASE)
+#define clios_atomic_store_relaxed(p_val, val)	__atomic_store_n((p_val), (val), __ATOMIC_RELAXED)
+#define clios_atomic_fetch_add(p_val, val)	__atomic_fetch_add((p_val), (val), __ATOMIC_ACQ_REL)
+#define clios_atomic_add_relaxed(p_val, val)	(void)__atomic_fetch_add((p_val), (val), __ATOMIC_RELAXED)
+#define clios_atomic_fence_release()	__atomic_thread_fence(__ATOMIC_RELEASE)
+#define clios_atomic_fence_acquire()	__atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define clios_atomic_cas(p_val, p_expected, val) \
+	__atomic_compare_exchange_n((p_val), (p_expected), (val), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#define clios_atomic_fence_full()	__atomic_thread_fence(__ATOMIC_SEQ_CST)
+
 /* ==========================================================================
    includes - IFXOS mapped functions
    ========================================================================== */
@@ -101,6 +183,8 @@ extern "C"
 #	include "ifxos_thread.h"
 #	include "ifxos_pipe.h"
 #	include "ifx_fifo.h"
+#elif (CLI_SUPPORT_POOL == 1)
+#	include "ifxos_thread.h"
 #endif
 
 #if (CLI_SUPPORT_AUTO_COMPLETION == 1)
@@ -140,6 +224,10 @@ extern "C"
 #	define clios_file_t	IFXOS_File_t
 #endif
 
+#if (CLI_SUPPORT_FILE_OUT == 1)
+#	define clios_fopen	IFXOS_FOpen
+#	define clios_fclose	IFXOS_FClose
+#endif
 #define clios_feof	IFXOS_FEof
 #define clios_fread	IFXOS_FRead
 #define clios_fflush	IFXOS_FFlush
@@ -155,6 +243,8 @@ extern "C"
 
 /* Function map - Time and Wait Functions and Defines. */
 #define clios_sleep_msec	IFXOS_MSecSleep
+#define clios_time_t		IFX_time_t
+#define clios_elapsed_time_msec_get	IFXOS_ElapsedTimeMSecGet
 
 
 /* Function map - Lock handling. */
@@ -0,0 +1,419 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_out_builder.c
+   Command Line Interface - typed output builder
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_OUT_BUILDER == 1)
+#include "lib_cli_out_builder.h"
+#if (CLI_SUPPORT_OUT_SINK == 1)
+#	include "lib_cli_out_sink.h"
+#endif
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** decimal digit pairs "00" .. "99" */
+static const char g_cli_out_dec_pairs[201] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+/** hex digits */
+static const char g_cli_out_hex_digits[16] = {
+	'0', '1', '2', '3', '4', '5', '6', '7',
+	'8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+/** Write the output to the sink or the file of the handler */
+CLI_STATIC int builder_write(
+	struct cli_out_builder_s *p_b,
+	unsigned int len)
+{
+#	if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
+	struct cli_spec_file_io_s *p_spec = (struct cli_spec_file_io_s *)p_b->p_file;
+	unsigned int n;
+#	endif
+
+#	if (CLI_SUPPORT_OUT_SINK == 1)
+	if (p_b->p_sink != IFX_NULL)
+		return (cli_out_sink_write(p_b->p_sink, p_b->p_buf, len) < 0) ? IFX_ERROR : IFX_SUCCESS;
+#	endif
+
+#	if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
+	if (p_spec->p_file != IFX_NULL)
+		return (clios_fwrite(p_b->p_buf, 1, len, (clios_file_t *)p_spec->p_file) == len) ?
+			IFX_SUCCESS : IFX_ERROR;
+
+	if ((p_spec->p_buffer == IFX_NULL) || (p_spec->buffer_len >= p_spec->buffer_size))
+		return IFX_ERROR;
+	n = p_spec->buffer_size - 1 - p_spec->buffer_len;
+	if (n > len)
+		n = len;
+	clios_memcpy(p_spec->p_buffer + p_spec->buffer_len, p_b->p_buf, n);
+	p_spec->buffer_len += n;
+	p_spec->p_buffer[p_spec->buffer_len] = '\0';
+
+	return (n == len) ? IFX_SUCCESS : IFX_ERROR;
+#	else
+	return (clios_fwrite(p_b->p_buf, 1, len, (clios_file_t *)p_b->p_file) == len) ?
+		IFX_SUCCESS : IFX_ERROR;
+#	endif
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+
+/** Write the first n bytes of the embedded buffer (file mode) */
+CLI_STATIC void builder_flush(
+	struct cli_out_builder_s *p_b,
+	unsigned int n)
+{
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	if (n == 0)
+		return;
+
+	if (builder_write(p_b, n) == IFX_SUCCESS)
+		p_b->n_written += n;
+	else
+		p_b->b_truncated = 1;
+
+	clios_memmove(p_b->p_buf, p_b->p_buf + n, p_b->len - n);
+	p_b->len -= n;
+	p_b->cell_start = (p_b->cell_start > n) ? p_b->cell_start - n : 0;
+#else
+	(void)p_b;
+	(void)n;
+#endif
+}
+
+/** Make room for n bytes (and the zero termination)
+
+\return
+   1 - space available
+   0 - buffer full (buffer mode) or n exceeds the embedded buffer
+*/
+CLI_STATIC int builder_reserve(
+	struct cli_out_builder_s *p_b,
+	unsigned int n)
+{
+	if (p_b->size - p_b->len > n)
+		return 1;
+
+	if (p_b->p_file != IFX_NULL)
+	{
+		/* keep the current cell for the alignment */
+		builder_flush(p_b, (p_b->n_cols != 0) ? p_b->cell_start : p_b->len);
+		if (p_b->size - p_b->len > n)
+			return 1;
+		builder_flush(p_b, p_b->len);
+		if (p_b->size - p_b->len > n)
+			return 1;
+	}
+	p_b->b_truncated = 1;
+
+	return 0;
+}
+
+int cli_out_builder_init__buffer(
+	struct cli_out_builder_s *p_b,
+	char *p_out,
+	unsigned int bufsize_max)
+{
+	if ((p_b == IFX_NULL) || (p_out == IFX_NULL) || (bufsize_max == 0))
+		return IFX_ERROR;
+
+	clios_memset(p_b, 0x00, sizeof(*p_b) - sizeof(p_b->stage));
+	p_b->p_buf = p_out;
+	p_b->size = bufsize_max;
+	p_out[0] = '\0';
+
+	return IFX_SUCCESS;
+}
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+int cli_out_builder_init__file(
+	struct cli_out_builder_s *p_b,
+	clios_file_io_t *p_file)
+{
+	if ((p_b == IFX_NULL) || (p_file == IFX_NULL))
+		return IFX_ERROR;
+
+	clios_memset(p_b, 0x00, sizeof(*p_b) - sizeof(p_b->stage));
+	p_b->p_buf = p_b->stage;
+	p_b->size = sizeof(p_b->stage);
+	p_b->p_file = p_file;
+#	if (CLI_SUPPORT_OUT_SINK == 1)
+#		if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
+	p_b->p_sink = ((struct cli_spec_file_io_s *)p_file)->p_sink;
+#		else
+	p_b->p_sink = cli_out_sink_get(p_file);
+#		endif
+#	endif
+
+	return IFX_SUCCESS;
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+
+int cli_out_builder_finish(
+	struct cli_out_builder_s *p_b)
+{
+	if (p_b->p_file != IFX_NULL)
+	{
+		builder_flush(p_b, p_b->len);
+		return (int)p_b->n_written;
+	}
+
+	p_b->p_buf[p_b->len] = '\0';
+
+	return (int)p_b->len;
+}
+
+void cli_out_strn(
+	struct cli_out_builder_s *p_b,
+	const char *p_str,
+	unsigned int len)
+{
+	unsigned int n;
+
+	while (len > 0)
+	{
+		n = p_b->size - p_b->len - 1;
+		if (n == 0)
+		{
+			if (!builder_reserve(p_b, 1))
+				return;
+			continue;
+		}
+		if (n > len)
+			n = len;
+		clios_memcpy(p_b->p_buf + p_b->len, p_str, n);
+		p_b->len += n;
+		p_str += n;
+		len -= n;
+	}
+}
+
+void cli_out_str(
+	struct cli_out_builder_s *p_b,
+	const char *p_str)
+{
+	cli_out_strn(p_b, p_str, (unsigned int)clios_strlen(p_str));
+}
+
+void cli_out_char(
+	struct cli_out_builder_s *p_b,
+	char c)
+{
+	if (!builder_reserve(p_b, 1))
+		return;
+
+	p_b->p_buf[p_b->len++] = c;
+}
+
+/** Convert to decimal, two digits per step, from the end of the buffer
+
+\return
+   start of the digits
+*/
+CLI_STATIC char *builder_dec_convert(
+	unsigned long long val,
+	char *p_end)
+{
+	char *p = p_end;
+	unsigned int val32, idx;
+
+	/* 64 bit divisions only for the upper digits */
+	while (val > 0xFFFFFFFFULL)
+	{
+		idx = (unsigned int)(val % 100) * 2;
+		val /= 100;
+		p -= 2;
+		p[0] = g_cli_out_dec_pairs[idx];
+		p[1] = g_cli_out_dec_pairs[idx + 1];
+	}
+
+	val32 = (unsigned int)val;
+	while (val32 >= 100)
+	{
+		idx = (val32 % 100) * 2;
+		val32 /= 100;
+		p -= 2;
+		p[0] = g_cli_out_dec_pairs[idx];
+		p[1] = g_cli_out_dec_pairs[idx + 1];
+	}
+	if (val32 >= 10)
+	{
+		p -= 2;
+		p[0] = g_cli_out_dec_pairs[val32 * 2];
+		p[1] = g_cli_out_dec_pairs[val32 * 2 + 1];
+	}
+	else
+	{
+		*--p = (char)('0' + val32);
+	}
+
+	return p;
+}
+
+/** Append the number with sign and padding */
+CLI_STATIC void builder_dec_append(
+	struct cli_out_builder_s *p_b,
+	unsigned long long val,
+	int b_neg,
+	unsigned int width)
+{
+	char tmp[24];
+	char *p;
+	unsigned int n, pad;
+
+	p = builder_dec_convert(val, tmp + sizeof(tmp));
+	if (b_neg)
+		*--p = '-';
+	n = (unsigned int)(tmp + sizeof(tmp) - p);
+	pad = (width > n) ? width - n : 0;
+
+	if (!builder_reserve(p_b, pad + n))
+		return;
+
+	clios_memset(p_b->p_buf + p_b->len, ' ', pad);
+	clios_memcpy(p_b->p_buf + p_b->len + pad, p, n);
+	p_b->len += pad + n;
+}
+
+void cli_out_dec(
+	struct cli_out_builder_s *p_b,
+	unsigned long long val,
+	unsigned int width)
+{
+	builder_dec_append(p_b, val, 0, width);
+}
+
+void cli_out_dec_s(
+	struct cli_out_builder_s *p_b,
+	long long val,
+	unsigned int width)
+{
+	if (val < 0)
+		builder_dec_append(p_b, 0ULL - (unsigned long long)val, 1, width);
+	else
+		builder_dec_append(p_b, (unsigned long long)val, 0, width);
+}
+
+void cli_out_hex(
+	struct cli_out_builder_s *p_b,
+	unsigned long long val,
+	unsigned int digits)
+{
+	char *p;
+	unsigned int i;
+
+	if (digits == 0)
+		digits = 1;
+	else if (digits > 16)
+		digits = 16;
+
+	if (!builder_reserve(p_b, digits))
+		return;
+
+	p = p_b->p_buf + p_b->len;
+	for (i = digits; i > 0; i--)
+	{
+		p[i - 1] = g_cli_out_hex_digits[val & 0xF];
+		val >>= 4;
+	}
+	p_b->len += digits;
+}
+
+void cli_out_table_set(
+	struct cli_out_builder_s *p_b,
+	const struct cli_out_column_s *p_cols,
+	unsigned int n_cols)
+{
+	p_b->p_cols = p_cols;
+	p_b->n_cols = (p_cols != IFX_NULL) ? n_cols : 0;
+	p_b->col = 0;
+	p_b->cell_start = p_b->len;
+}
+
+void cli_out_row_start(
+	struct cli_out_builder_s *p_b)
+{
+	p_b->col = 0;
+	p_b->cell_start = p_b->len;
+}
+
+/** Pad the current cell to the column width */
+CLI_STATIC void builder_cell_pad(
+	struct cli_out_builder_s *p_b,
+	int b_last)
+{
+	const struct cli_out_column_s *p_col;
+	unsigned int cell_len, pad;
+
+	if (p_b->col >= p_b->n_cols)
+		return;
+
+	p_col = &p_b->p_cols[p_b->col];
+	cell_len = p_b->len - p_b->cell_start;
+	if (cell_len >= p_col->width)
+		return;
+	/* no trailing spaces at the end of the row */
+	if (b_last && !p_col->b_right)
+		return;
+
+	pad = p_col->width - cell_len;
+	if (!builder_reserve(p_b, pad))
+		return;
+
+	/* builder_reserve() keeps the cell, but cell_start may move */
+	if (p_col->b_right)
+	{
+		clios_memmove(p_b->p_buf + p_b->cell_start + pad,
+			p_b->p_buf + p_b->cell_start, p_b->len - p_b->cell_start);
+		clios_memset(p_b->p_buf + p_b->cell_start, ' ', pad);
+	}
+	else
+	{
+		clios_memset(p_b->p_buf + p_b->len, ' ', pad);
+	}
+	p_b->len += pad;
+}
+
+void cli_out_cell_end(
+	struct cli_out_builder_s *p_b)
+{
+	builder_cell_pad(p_b, 0);
+	cli_out_char(p_b, ' ');
+	p_b->col++;
+	p_b->cell_start = p_b->len;
+}
+
+void cli_out_row_end(
+	struct cli_out_builder_s *p_b)
+{
+	builder_cell_pad(p_b, 1);
+	cli_out_strn(p_b, CLI_CRLF, sizeof(CLI_CRLF) - 1);
+	p_b->col = 0;
+	p_b->cell_start = p_b->len;
+}
+
+#endif	/* #if (CLI_SUPPORT_OUT_BUILDER == 1) */
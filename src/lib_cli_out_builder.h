@@ -0,0 +1,276 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_OUT_BUILDER_H
+#define _LIB_CLI_OUT_BUILDER_H
+
+/**
+   \file lib_cli_out_builder.h
+   Command Line Interface - typed output builder
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_OUT_BUILDER CLI Output Builder
+
+   Output functions for the command handlers without format string parsing:
+   integers in decimal (2 digits per step) or hex with a fixed width,
+   strings and tables with aligned columns.
+
+   The builder of a buffer mode handler writes directly into the output
+   buffer. The builder of a file mode handler collects the output in an
+   embedded buffer and writes it to the output sink of the execution (see
+   \ref cli_out_sink_get) or to the file if it is full and on
+   \ref cli_out_builder_finish.
+
+   Example (file mode handler):
+   \code
+   static const struct cli_out_column_s cols[] = {{4, 1}, {10, 0}};
+   struct cli_out_builder_s b;
+
+   (void)cli_out_builder_init__file(&b, p_file);
+   cli_out_table_set(&b, cols, 2);
+   for (i = 0; i < n; i++) {
+      cli_out_row_start(&b);
+      cli_out_dec(&b, i, 0);
+      cli_out_cell_end(&b);
+      cli_out_hex(&b, reg[i], 8);
+      cli_out_row_end(&b);
+   }
+   return cli_out_builder_finish(&b);
+   \endcode
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Column of a table */
+struct cli_out_column_s
+{
+	/** width of the column (cells are padded with spaces) */
+	unsigned int width;
+	/** 1: right aligned, 0: left aligned */
+	unsigned int b_right;
+};
+
+/** Output builder, set up with \ref cli_out_builder_init__buffer or
+   \ref cli_out_builder_init__file */
+struct cli_out_builder_s
+{
+	/** output buffer (user buffer or the embedded one) */
+	char *p_buf;
+	/** size of the output buffer */
+	unsigned int size;
+	/** used bytes of the output buffer */
+	unsigned int len;
+	/** written bytes (file mode) */
+	unsigned int n_written;
+	/** output was truncated (buffer full, write error) */
+	unsigned int b_truncated;
+	/** file of the file mode handler */
+	clios_file_io_t *p_file;
+	/** output sink of the file mode execution (see \ref cli_out_sink_get) */
+	struct cli_out_sink_s *p_sink;
+	/** table columns */
+	const struct cli_out_column_s *p_cols;
+	/** number of table columns */
+	unsigned int n_cols;
+	/** current column */
+	unsigned int col;
+	/** start of the current cell in the output buffer */
+	unsigned int cell_start;
+	/** embedded buffer (file mode) */
+	char stage[CLI_OUT_BUILDER_STAGE_SIZE];
+};
+
+/** Set up a builder for a buffer mode handler.
+
+\param
+   p_b  builder to set up.
+\param
+   p_out  output buffer of the handler.
+\param
+   bufsize_max  size of the output buffer.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_out_builder_init__buffer(
+	struct cli_out_builder_s *p_b,
+	char *p_out,
+	unsigned int bufsize_max);
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+/** Set up a builder for a file mode handler.
+
+\param
+   p_b  builder to set up.
+\param
+   p_file  file of the handler.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_out_builder_init__file(
+	struct cli_out_builder_s *p_b,
+	clios_file_io_t *p_file);
+#endif
+
+/** Complete the output (write the remaining output of a file mode builder).
+
+\param
+   p_b  output builder.
+
+\return
+   number of output bytes (return value of the handler)
+*/
+extern int cli_out_builder_finish(
+	struct cli_out_builder_s *p_b);
+
+/** Append an unsigned integer in decimal.
+
+\param
+   p_b  output builder.
+\param
+   val  value.
+\param
+   width  min width, right aligned with spaces (0: no padding).
+*/
+extern void cli_out_dec(
+	struct cli_out_builder_s *p_b,
+	unsigned long long val,
+	unsigned int width);
+
+/** Append a signed integer in decimal.
+
+\param
+   p_b  output builder.
+\param
+   val  value.
+\param
+   width  min width, right aligned with spaces (0: no padding).
+*/
+extern void cli_out_dec_s(
+	struct cli_out_builder_s *p_b,
+	long long val,
+	unsigned int width);
+
+/** Append an unsigned integer in hex (lower case, without prefix).
+
+\param
+   p_b  output builder.
+\param
+   val  value.
+\param
+   digits  number of digits (zero padded, 1 .. 16).
+*/
+extern void cli_out_hex(
+	struct cli_out_builder_s *p_b,
+	unsigned long long val,
+	unsigned int digits);
+
+/** Append a u8 in hex with 2 digits */
+#define cli_out_hex8(P_B, VAL)	cli_out_hex((P_B), (unsigned char)(VAL), 2)
+/** Append a u16 in hex with 4 digits */
+#define cli_out_hex16(P_B, VAL)	cli_out_hex((P_B), (unsigned short)(VAL), 4)
+/** Append a u32 in hex with 8 digits */
+#define cli_out_hex32(P_B, VAL)	cli_out_hex((P_B), (unsigned int)(VAL), 8)
+/** Append a u64 in hex with 16 digits */
+#define cli_out_hex64(P_B, VAL)	cli_out_hex((P_B), (unsigned long long)(VAL), 16)
+
+/** Append a string.
+
+\param
+   p_b  output builder.
+\param
+   p_str  zero terminated string.
+*/
+extern void cli_out_str(
+	struct cli_out_builder_s *p_b,
+	const char *p_str);
+
+/** Append a string of the given length.
+
+\param
+   p_b  output builder.
+\param
+   p_str  string.
+\param
+   len  length of the string.
+*/
+extern void cli_out_strn(
+	struct cli_out_builder_s *p_b,
+	const char *p_str,
+	unsigned int len);
+
+/** Append a character.
+
+\param
+   p_b  output builder.
+\param
+   c  character.
+*/
+extern void cli_out_char(
+	struct cli_out_builder_s *p_b,
+	char c);
+
+/** Set the columns of a table (see \ref cli_out_row_start).
+
+\param
+   p_b  output builder.
+\param
+   p_cols  columns (must be valid until the end of the table).
+\param
+   n_cols  number of columns.
+*/
+extern void cli_out_table_set(
+	struct cli_out_builder_s *p_b,
+	const struct cli_out_column_s *p_cols,
+	unsigned int n_cols);
+
+/** Start a table row, the following output is the first cell.
+
+\param
+   p_b  output builder.
+*/
+extern void cli_out_row_start(
+	struct cli_out_builder_s *p_b);
+
+/** End the current cell (padding / alignment), the following output is the
+   next cell. The cells are separated by one space.
+
+\param
+   p_b  output builder.
+*/
+extern void cli_out_cell_end(
+	struct cli_out_builder_s *p_b);
+
+/** End the current cell and the row (line end).
+
+\param
+   p_b  output builder.
+*/
+extern void cli_out_row_end(
+	struct cli_out_builder_s *p_b);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_OUT_BUILDER_H */
@@ -0,0 +1,521 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_out_sink.c
+   Command Line Interface - buffered output sink
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_OUT_SINK == 1)
+#include "lib_cli_out_sink.h"
+
+#include <stdarg.h>
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** max number of chunks per writev / sendmsg call */
+#define CLI_OUT_SINK_IOV_MAX	64
+
+/** sink of the command handler running in this thread */
+static clios_thread_local struct cli_out_sink_s *g_p_cli_out_sink_active = IFX_NULL;
+
+CLI_STATIC int out_sink_setup(
+	struct cli_out_sink_s *p_sink,
+	enum cli_out_sink_target_e target)
+{
+	if (p_sink == IFX_NULL)
+		return IFX_ERROR;
+
+	clios_memset(p_sink, 0x00, sizeof(*p_sink));
+	p_sink->target = target;
+	p_sink->fd = -1;
+	p_sink->first.p_data = p_sink->first_data;
+	p_sink->first.size = sizeof(p_sink->first_data);
+	p_sink->p_tail = &p_sink->first;
+
+	return IFX_SUCCESS;
+}
+
+/** Free the allocated chunks, the sink is empty afterwards */
+CLI_STATIC void out_sink_reset(
+	struct cli_out_sink_s *p_sink)
+{
+	struct cli_out_sink_chunk_s *p_chunk, *p_next;
+
+	for (p_chunk = p_sink->first.p_next; p_chunk != IFX_NULL; p_chunk = p_next)
+	{
+		p_next = p_chunk->p_next;
+		clios_memfree(p_chunk);
+	}
+	p_sink->first.p_next = IFX_NULL;
+	p_sink->first.len = 0;
+	p_sink->p_tail = &p_sink->first;
+	p_sink->len = 0;
+}
+
+/** Append a new chunk with at least min_size bytes */
+CLI_STATIC struct cli_out_sink_chunk_s *out_sink_chunk_add(
+	struct cli_out_sink_s *p_sink,
+	unsigned int min_size)
+{
+	struct cli_out_sink_chunk_s *p_chunk;
+	unsigned int size;
+
+	/* grow with the output, a chunk is at least twice the previous one */
+	size = p_sink->p_tail->size * 2;
+	if (size > CLI_OUT_SINK_CHUNK_MAX)
+		size = CLI_OUT_SINK_CHUNK_MAX;
+	if (size < min_size)
+		size = min_size;
+
+	p_chunk = (struct cli_out_sink_chunk_s *)clios_memalloc(sizeof(*p_chunk) + size);
+	if (p_chunk == IFX_NULL)
+		return IFX_NULL;
+
+	p_chunk->p_next = IFX_NULL;
+	p_chunk->p_data = (char *)(p_chunk + 1);
+	p_chunk->size = size;
+	p_chunk->len = 0;
+
+	p_sink->p_tail->p_next = p_chunk;
+	p_sink->p_tail = p_chunk;
+
+	return p_chunk;
+}
+
+int cli_out_sink_init(
+	struct cli_out_sink_s *p_sink)
+{
+	return out_sink_setup(p_sink, cli_out_sink_target_none);
+}
+
+int cli_out_sink_init__file(
+	struct cli_out_sink_s *p_sink,
+	clios_file_io_t *p_file)
+{
+	if ((p_file == IFX_NULL) ||
+	    (out_sink_setup(p_sink, cli_out_sink_target_file) != IFX_SUCCESS))
+		return IFX_ERROR;
+
+	p_sink->p_file = p_file;
+
+	return IFX_SUCCESS;
+}
+
+int cli_out_sink_init__fd(
+	struct cli_out_sink_s *p_sink,
+	int fd)
+{
+	if ((fd < 0) || (out_sink_setup(p_sink, cli_out_sink_target_fd) != IFX_SUCCESS))
+		return IFX_ERROR;
+
+	p_sink->fd = fd;
+
+	return IFX_SUCCESS;
+}
+
+int cli_out_sink_init__socket(
+	struct cli_out_sink_s *p_sink,
+	int fd)
+{
+	if ((fd < 0) || (out_sink_setup(p_sink, cli_out_sink_target_socket) != IFX_SUCCESS))
+		return IFX_ERROR;
+
+	p_sink->fd = fd;
+
+	return IFX_SUCCESS;
+}
+
+int cli_out_sink_init__buffer(
+	struct cli_out_sink_s *p_sink,
+	char *p_buf,
+	unsigned int buf_size)
+{
+	if ((p_buf == IFX_NULL) || (buf_size == 0) ||
+	    (out_sink_setup(p_sink, cli_out_sink_target_buffer) != IFX_SUCCESS))
+		return IFX_ERROR;
+
+	p_sink->p_buf = p_buf;
+	p_sink->buf_size = buf_size;
+	p_buf[0] = '\0';
+
+	return IFX_SUCCESS;
+}
+
+void cli_out_sink_release(
+	struct cli_out_sink_s *p_sink)
+{
+	if (p_sink == IFX_NULL)
+		return;
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	if (p_sink->p_stream != IFX_NULL)
+	{
+		(void)clios_fclose((clios_file_t *)p_sink->p_stream);
+		p_sink->p_stream = IFX_NULL;
+	}
+#endif
+	out_sink_reset(p_sink);
+}
+
+int cli_out_sink_write(
+	struct cli_out_sink_s *p_sink,
+	const char *p_data,
+	unsigned int len)
+{
+	struct cli_out_sink_chunk_s *p_chunk = p_sink->p_tail;
+	unsigned int n, done = 0;
+
+	while (done < len)
+	{
+		if (p_chunk->len == p_chunk->size)
+		{
+			p_chunk = out_sink_chunk_add(p_sink, 0);
+			if (p_chunk == IFX_NULL)
+			{
+				p_sink->n_dropped += len - done;
+				return IFX_ERROR;
+			}
+		}
+		n = p_chunk->size - p_chunk->len;
+		if (n > len - done)
+			n = len - done;
+		clios_memcpy(p_chunk->p_data + p_chunk->len, p_data + done, n);
+		p_chunk->len += n;
+		done += n;
+	}
+	p_sink->len += len;
+
+	return (int)len;
+}
+
+int cli_out_sink_fill(
+	struct cli_out_sink_s *p_sink,
+	char c,
+	unsigned int n)
+{
+	struct cli_out_sink_chunk_s *p_chunk = p_sink->p_tail;
+
+	if (p_chunk->size - p_chunk->len < n)
+	{
+		p_chunk = out_sink_chunk_add(p_sink, n);
+		if (p_chunk == IFX_NULL)
+		{
+			p_sink->n_dropped += n;
+			return IFX_ERROR;
+		}
+	}
+	clios_memset(p_chunk->p_data + p_chunk->len, c, n);
+	p_chunk->len += n;
+	p_sink->len += n;
+
+	return (int)n;
+}
+
+int cli_out_sink_vprintf(
+	struct cli_out_sink_s *p_sink,
+	const char *p_format,
+	va_list ap)
+{
+	struct cli_out_sink_chunk_s *p_chunk = p_sink->p_tail;
+	unsigned int avail = p_chunk->size - p_chunk->len;
+	va_list ap_copy;
+	int ret;
+
+	/* format in place, on overflow once more into a new chunk */
+	va_copy(ap_copy, ap);
+	ret = clios_vsnprintf(p_chunk->p_data + p_chunk->len, avail, p_format, ap_copy);
+	va_end(ap_copy);
+	if (ret < 0)
+		return IFX_ERROR;
+
+	if ((unsigned int)ret >= avail)
+	{
+		p_chunk = out_sink_chunk_add(p_sink, (unsigned int)ret + 1);
+		if (p_chunk == IFX_NULL)
+		{
+			p_sink->n_dropped += (unsigned int)ret;
+			return IFX_ERROR;
+		}
+		ret = clios_vsnprintf(p_chunk->p_data, p_chunk->size, p_format, ap);
+		if (ret < 0)
+			return IFX_ERROR;
+	}
+	p_chunk->len += (unsigned int)ret;
+	p_sink->len += (unsigned int)ret;
+
+	return ret;
+}
+
+int cli_out_sink_printf(
+	struct cli_out_sink_s *p_sink,
+	const char *p_format,
+	...)
+{
+	va_list ap;
+	int ret;
+
+	va_start(ap, p_format);
+	ret = cli_out_sink_vprintf(p_sink, p_format, ap);
+	va_end(ap);
+
+	return ret;
+}
+
+/** Write the chunks with writev (fd) or sendmsg (socket) */
+CLI_STATIC int out_sink_flush__fd(
+	struct cli_out_sink_s *p_sink)
+{
+	struct iovec iov[CLI_OUT_SINK_IOV_MAX];
+	struct msghdr msg;
+	struct cli_out_sink_chunk_s *p_chunk;
+	unsigned int done = 0, skip, n_iov;
+	ssize_t n;
+
+	while (done < p_sink->len)
+	{
+		/* gather the chunks behind the written part (partial writes) */
+		skip = done;
+		n_iov = 0;
+		for (p_chunk = &p_sink->first;
+		     (p_chunk != IFX_NULL) && (n_iov < CLI_OUT_SINK_IOV_MAX);
+		     p_chunk = p_chunk->p_next)
+		{
+			if (p_chunk->len <= skip)
+			{
+				skip -= p_chunk->len;
+				continue;
+			}
+			iov[n_iov].iov_base = p_chunk->p_data + skip;
+			iov[n_iov].iov_len = p_chunk->len - skip;
+			skip = 0;
+			n_iov++;
+		}
+
+		if (p_sink->target == cli_out_sink_target_socket)
+		{
+			clios_memset(&msg, 0x00, sizeof(msg));
+			msg.msg_iov = iov;
+			msg.msg_iovlen = n_iov;
+			n = clios_sendmsg(p_sink->fd, &msg, MSG_NOSIGNAL);
+		}
+		else
+		{
+			n = clios_writev(p_sink->fd, iov, (int)n_iov);
+		}
+		if (n < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			return IFX_ERROR;
+		}
+		done += (unsigned int)n;
+	}
+
+	return IFX_SUCCESS;
+}
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+/** Write the chunks to a stdio file */
+CLI_STATIC int out_sink_flush__file(
+	struct cli_out_sink_s *p_sink)
+{
+	struct cli_out_sink_chunk_s *p_chunk;
+
+	for (p_chunk = &p_sink->first; p_chunk != IFX_NULL; p_chunk = p_chunk->p_next)
+	{
+		if ((p_chunk->len > 0) &&
+		    (clios_fwrite(p_chunk->p_data, 1, p_chunk->len,
+				(clios_file_t *)p_sink->p_file) != p_chunk->len))
+			return IFX_ERROR;
+	}
+
+	return (clios_fflush((clios_file_t *)p_sink->p_file) == 0) ? IFX_SUCCESS : IFX_ERROR;
+}
+#endif
+
+/** Append the chunks to the caller buffer, truncated to the buffer size */
+CLI_STATIC int out_sink_flush__buffer(
+	struct cli_out_sink_s *p_sink)
+{
+	struct cli_out_sink_chunk_s *p_chunk;
+	unsigned int n;
+
+	for (p_chunk = &p_sink->first; p_chunk != IFX_NULL; p_chunk = p_chunk->p_next)
+	{
+		n = p_sink->buf_size - 1 - p_sink->buf_len;
+		if (n > p_chunk->len)
+			n = p_chunk->len;
+		clios_memcpy(p_sink->p_buf + p_sink->buf_len, p_chunk->p_data, n);
+		p_sink->buf_len += n;
+		p_sink->n_dropped += p_chunk->len - n;
+	}
+	p_sink->p_buf[p_sink->buf_len] = '\0';
+
+	return IFX_SUCCESS;
+}
+
+int cli_out_sink_flush(
+	struct cli_out_sink_s *p_sink)
+{
+	int ret, len;
+
+	if (p_sink == IFX_NULL)
+		return IFX_ERROR;
+
+	len = (int)p_sink->len;
+	if (len == 0)
+		return 0;
+
+	switch (p_sink->target)
+	{
+	case cli_out_sink_target_fd:
+	case cli_out_sink_target_socket:
+		ret = out_sink_flush__fd(p_sink);
+		break;
+#if (CLI_SUPPORT_FILE_OUT == 1)
+	case cli_out_sink_target_file:
+		ret = out_sink_flush__file(p_sink);
+		break;
+#endif
+	case cli_out_sink_target_buffer:
+		ret = out_sink_flush__buffer(p_sink);
+		break;
+	case cli_out_sink_target_none:
+		/* nothing to write, keep the output for cli_out_sink_detach */
+		return 0;
+	default:
+		return IFX_ERROR;
+	}
+
+	if (ret == IFX_SUCCESS)
+		p_sink->n_flushed += (unsigned int)len;
+	else
+		p_sink->n_dropped += (unsigned int)len;
+	out_sink_reset(p_sink);
+
+	return (ret == IFX_SUCCESS) ? len : IFX_ERROR;
+}
+
+int cli_out_sink_detach(
+	struct cli_out_sink_s *p_sink,
+	char **pp_buf,
+	unsigned int *p_len)
+{
+	struct cli_out_sink_chunk_s *p_chunk;
+	char *p_buf;
+	unsigned int len = 0;
+
+	if ((p_sink == IFX_NULL) || (pp_buf == IFX_NULL))
+		return IFX_ERROR;
+
+	p_buf = (char *)clios_memalloc(p_sink->len + 1);
+	if (p_buf == IFX_NULL)
+		return IFX_ERROR;
+
+	for (p_chunk = &p_sink->first; p_chunk != IFX_NULL; p_chunk = p_chunk->p_next)
+	{
+		clios_memcpy(p_buf + len, p_chunk->p_data, p_chunk->len);
+		len += p_chunk->len;
+	}
+	p_buf[len] = '\0';
+	out_sink_reset(p_sink);
+
+	*pp_buf = p_buf;
+	if (p_len != IFX_NULL)
+		*p_len = len;
+
+	return IFX_SUCCESS;
+}
+
+void cli_out_sink_buf_free(
+	char *p_buf)
+{
+	if (p_buf != IFX_NULL)
+		clios_memfree(p_buf);
+}
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+/** Stream write function, appends to the sink */
+CLI_STATIC ssize_t out_sink_stream_write(
+	void *p_cookie,
+	const char *p_data,
+	size_t len)
+{
+	if (cli_out_sink_write((struct cli_out_sink_s *)p_cookie, p_data,
+		(unsigned int)len) < 0)
+		return 0;
+
+	return (ssize_t)len;
+}
+
+clios_file_io_t *cli_out_sink_file_get(
+	struct cli_out_sink_s *p_sink)
+{
+	cookie_io_functions_t io_fct = {IFX_NULL, out_sink_stream_write, IFX_NULL, IFX_NULL};
+	clios_file_t *p_stream;
+
+	if (p_sink == IFX_NULL)
+		return IFX_NULL;
+
+	if (p_sink->p_stream != IFX_NULL)
+		return p_sink->p_stream;
+
+	p_stream = clios_fopencookie(p_sink, "w", io_fct);
+	if (p_stream == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Sink: cannot create the stream" CLI_CRLF));
+		return IFX_NULL;
+	}
+	/* unbuffered: the direct writes (cli_out_sink_get) keep the order */
+	(void)clios_setvbuf(p_stream, IFX_NULL, _IONBF, 0);
+	p_sink->p_stream = (clios_file_io_t *)p_stream;
+
+	return p_sink->p_stream;
+}
+
+struct cli_out_sink_s *cli_out_sink_get(
+	clios_file_io_t *p_file)
+{
+	struct cli_out_sink_s *p_sink = g_p_cli_out_sink_active;
+
+	if ((p_sink != IFX_NULL) && (p_file != IFX_NULL) && (p_sink->p_stream == p_file))
+		return p_sink;
+
+	return IFX_NULL;
+}
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+
+struct cli_out_sink_s *cli_out_sink_active_set(
+	struct cli_out_sink_s *p_sink)
+{
+	struct cli_out_sink_s *p_prev = g_p_cli_out_sink_active;
+
+	g_p_cli_out_sink_active = p_sink;
+
+	return p_prev;
+}
+
+struct cli_out_sink_s *cli_out_sink_active_get(void)
+{
+	return g_p_cli_out_sink_active;
+}
+
+#endif	/* #if (CLI_SUPPORT_OUT_SINK == 1) */
@@ -0,0 +1,418 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_OUT_SINK_H
+#define _LIB_CLI_OUT_SINK_H
+
+/**
+   \file lib_cli_out_sink.h
+   Command Line Interface - buffered output sink
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_OUT_SINK CLI Output Sink
+
+   The output of a command is appended to a chain of chunks (the first one
+   is part of the sink, further ones are allocated with growing size) and
+   written at once with \ref cli_out_sink_flush: a single writev / sendmsg
+   for a file descriptor or socket, one fwrite per chunk for a file, a copy
+   for a caller buffer.
+
+   File mode command handlers write through the sink via the stream returned
+   by \ref cli_out_sink_file_get, or directly with \ref cli_out_sink_get and
+   \ref cli_out_sink_write / \ref cli_out_sink_printf.
+
+   Example (embedding, output into an allocated buffer):
+   \code
+   char *p_out = IFX_NULL;
+   unsigned int out_len = 0;
+
+   if (cli_core_cmd_exec__alloc(p_core_ctx, cmd, &p_out, &out_len) >= 0)
+      ... use p_out ...
+   cli_out_sink_buf_free(p_out);
+   \endcode
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Target of the sink flush */
+enum cli_out_sink_target_e
+{
+	/** no target, the output is collected (see \ref cli_out_sink_detach) */
+	cli_out_sink_target_none = 0,
+	/** stdio file */
+	cli_out_sink_target_file = 1,
+	/** file descriptor (writev) */
+	cli_out_sink_target_fd = 2,
+	/** socket (sendmsg) */
+	cli_out_sink_target_socket = 3,
+	/** caller buffer, the output is truncated to the buffer size */
+	cli_out_sink_target_buffer = 4
+};
+
+/** Storage chunk of the sink */
+struct cli_out_sink_chunk_s
+{
+	/** next chunk */
+	struct cli_out_sink_chunk_s *p_next;
+	/** chunk data */
+	char *p_data;
+	/** size of the chunk data */
+	unsigned int size;
+	/** used bytes of the chunk data */
+	unsigned int len;
+};
+
+/** Output sink, set up with one of the cli_out_sink_init functions */
+struct cli_out_sink_s
+{
+	/** flush target */
+	enum cli_out_sink_target_e target;
+	/** target file (\ref cli_out_sink_target_file) */
+	clios_file_io_t *p_file;
+	/** target file descriptor (\ref cli_out_sink_target_fd, _socket) */
+	int fd;
+	/** target buffer (\ref cli_out_sink_target_buffer) */
+	char *p_buf;
+	/** size of the target buffer */
+	unsigned int buf_size;
+	/** append cursor of the target buffer */
+	unsigned int buf_len;
+	/** first chunk (embedded storage) */
+	struct cli_out_sink_chunk_s first;
+	/** last chunk, appended to */
+	struct cli_out_sink_chunk_s *p_tail;
+	/** number of buffered bytes */
+	unsigned int len;
+	/** number of flushed bytes */
+	unsigned long long n_flushed;
+	/** number of dropped bytes (no memory, truncated target buffer) */
+	unsigned long long n_dropped;
+	/** stream for the command handlers (see \ref cli_out_sink_file_get) */
+	clios_file_io_t *p_stream;
+	/** embedded storage of the first chunk */
+	char first_data[CLI_OUT_SINK_INLINE_SIZE];
+};
+
+/** Set up a sink which collects the output (no flush target).
+
+\param
+   p_sink  sink to set up.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_out_sink_init(
+	struct cli_out_sink_s *p_sink);
+
+/** Set up a sink which is flushed to a stdio file.
+
+\param
+   p_sink  sink to set up.
+\param
+   p_file  target file.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_out_sink_init__file(
+	struct cli_out_sink_s *p_sink,
+	clios_file_io_t *p_file);
+
+/** Set up a sink which is flushed to a file descriptor (pipe, tty, file).
+
+\param
+   p_sink  sink to set up.
+\param
+   fd  target file descriptor.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_out_sink_init__fd(
+	struct cli_out_sink_s *p_sink,
+	int fd);
+
+/** Set up a sink which is flushed to a connected socket.
+
+\param
+   p_sink  sink to set up.
+\param
+   fd  target socket.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_out_sink_init__socket(
+	struct cli_out_sink_s *p_sink,
+	int fd);
+
+/** Set up a sink which is flushed to a caller buffer. Each flush appends to
+   the buffer, the content is always zero terminated.
+
+\param
+   p_sink  sink to set up.
+\param
+   p_buf  target buffer.
+\param
+   buf_size  size of the target buffer.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_out_sink_init__buffer(
+	struct cli_out_sink_s *p_sink,
+	char *p_buf,
+	unsigned int buf_size);
+
+/** Release the sink, the buffered output is discarded.
+
+\param
+   p_sink  sink to release.
+*/
+extern void cli_out_sink_release(
+	struct cli_out_sink_s *p_sink);
+
+/** Append data to the sink.
+
+\param
+   p_sink  output sink.
+\param
+   p_data  data to append.
+\param
+   len  length of the data.
+
+\return
+   number of appended bytes
+   IFX_ERROR - failed (no memory).
+*/
+extern int cli_out_sink_write(
+	struct cli_out_sink_s *p_sink,
+	const char *p_data,
+	unsigned int len);
+
+/** Append a character n times (padding).
+
+\param
+   p_sink  output sink.
+\param
+   c  character to append.
+\param
+   n  number of characters.
+
+\return
+   number of appended bytes
+   IFX_ERROR - failed (no memory).
+*/
+extern int cli_out_sink_fill(
+	struct cli_out_sink_s *p_sink,
+	char c,
+	unsigned int n);
+
+/** Append formatted output to the sink.
+
+\param
+   p_sink  output sink.
+\param
+   p_format  printf format.
+
+\return
+   number of appended bytes
+   IFX_ERROR - failed (no memory).
+*/
+extern int cli_out_sink_printf(
+	struct cli_out_sink_s *p_sink,
+	const char *p_format,
+	...)
+#ifdef __GNUC__
+	__attribute__ ((format (printf, 2, 3)))
+#endif
+	;
+
+/** Append formatted output to the sink (variable argument list).
+
+\param
+   p_sink  output sink.
+\param
+   p_format  printf format.
+\param
+   ap  arguments.
+
+\return
+   number of appended bytes
+   IFX_ERROR - failed (no memory).
+*/
+extern int cli_out_sink_vprintf(
+	struct cli_out_sink_s *p_sink,
+	const char *p_format,
+	va_list ap);
+
+/** Write the buffered output to the flush target, the sink is emptied
+   (except for \ref cli_out_sink_target_none).
+
+\param
+   p_sink  output sink.
+
+\return
+   number of written bytes
+   IFX_ERROR - failed (write error, the buffered output is discarded).
+*/
+extern int cli_out_sink_flush(
+	struct cli_out_sink_s *p_sink);
+
+/** Take the buffered output as one allocated, zero terminated buffer.
+   The sink is emptied.
+
+\param
+   p_sink  output sink.
+\param
+   pp_buf  returns the buffer (free with \ref cli_out_sink_buf_free).
+\param
+   p_len  returns the length of the output (optional).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (no memory).
+*/
+extern int cli_out_sink_detach(
+	struct cli_out_sink_s *p_sink,
+	char **pp_buf,
+	unsigned int *p_len);
+
+/** Free a buffer returned by \ref cli_out_sink_detach or
+   \ref cli_core_cmd_exec__alloc.
+
+\param
+   p_buf  buffer to free (IFX_NULL: ignored).
+*/
+extern void cli_out_sink_buf_free(
+	char *p_buf);
+
+#if (CLI_SUPPORT_FILE_OUT == 1)
+/** Get a stream which writes into the sink (unbuffered), to be passed to
+   the file mode command handlers. The stream is closed with the release
+   of the sink.
+
+\param
+   p_sink  output sink.
+
+\return
+   stream of the sink
+   IFX_NULL - failed.
+*/
+extern clios_file_io_t *cli_out_sink_file_get(
+	struct cli_out_sink_s *p_sink);
+
+/** Get the sink of the given stream, valid within a command handler called
+   via \ref cli_core_cmd_exec__sink.
+
+\param
+   p_file  file given to the command handler.
+
+\return
+   sink of the stream
+   IFX_NULL - the stream does not belong to a sink.
+*/
+extern struct cli_out_sink_s *cli_out_sink_get(
+	clios_file_io_t *p_file);
+#endif	/* #if (CLI_SUPPORT_FILE_OUT == 1) */
+
+/** Set the sink of the command handler running in the calling thread
+   (used by the CLI core, see \ref cli_out_sink_get).
+
+\param
+   p_sink  active sink, IFX_NULL: none.
+
+\return
+   previous active sink
+*/
+extern struct cli_out_sink_s *cli_out_sink_active_set(
+	struct cli_out_sink_s *p_sink);
+
+/** Get the sink of the command handler running in the calling thread.
+
+\return
+   active sink
+   IFX_NULL - none.
+*/
+extern struct cli_out_sink_s *cli_out_sink_active_get(void);
+
+/** Execute a command line, the output is appended to the given sink.
+
+\remarks
+   In buffer mode the handlers write into a buffer of
+   \ref CLI_OUT_SINK_EXEC_BUFFER_SIZE bytes, which is appended to the sink
+   afterwards. The buffer mode output is bounded by this size, it is not
+   streamed. Handlers using the sink of the execution context
+   (\ref cli_exec_ctx_s) are not limited.
+   The output counts as cut if a write was refused: by the sink (no memory),
+   by a built-in command or by a handler (see \ref cli_exec_overflow_set).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_cmd_arg_buf  command line (modified).
+\param
+   p_sink  output sink (not flushed).
+
+\return
+   return value of the command execution
+   CLI_EXEC_TRUNCATED - executed, the output was cut (a write was refused).
+   IFX_ERROR - failed.
+*/
+extern int cli_core_cmd_exec__sink(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	struct cli_out_sink_s *p_sink);
+
+/** Execute a command line, the output is returned in an allocated buffer.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_cmd_arg_buf  command line (modified).
+\param
+   pp_out  returns the zero terminated output
+           (free with \ref cli_out_sink_buf_free).
+\param
+   p_out_len  returns the length of the output (optional).
+
+\return
+   return value of the command execution
+   CLI_EXEC_TRUNCATED - executed, the output was cut (a write was refused).
+   IFX_ERROR - failed.
+*/
+extern int cli_core_cmd_exec__alloc(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	char **pp_out,
+	unsigned int *p_out_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_OUT_SINK_H */
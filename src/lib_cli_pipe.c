@@ -14,6 +14,22 @@
 
 #if (CLI_SUPPORT_PIPE == 1)
 #include "lib_cli_pipe.h"
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+#	include "lib_cli_event_limit.h"
+#endif
+#if (CLI_SUPPORT_TRACE == 1)
+#	include "lib_cli_trace.h"
+#endif
+#if (CLI_SUPPORT_METRICS == 1)
+#	include "lib_cli_metrics.h"
+#endif
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+#	include "lib_cli_out_sink.h"
+#	include "lib_cli_struct_out.h"
+#endif
+#if (CLI_SUPPORT_POOL == 1)
+#	include "lib_cli_pool.h"
+#endif
 
 #ifdef CLI_STATIC
 #	undef CLI_STATIC
@@ -46,6 +62,14 @@
 #define CLI_LOG_FIFOSIZE	(4096 * 2)
 #define CLI_LOG_MAX_ELEM_SIZE	1024
 
+#if (CLI_SUPPORT_METRICS == 1)
+/** count a log FIFO message (event / dump) */
+#	define CLI_PIPE_METRICS_COUNT(P_CTX, COUNTER, USER_ID) \
+		clios_atomic_add_relaxed(&(P_CTX)->COUNTER[((USER_ID) == CLI_PIPE_DUMP) ? 1 : 0], 1ULL)
+#else
+#	define CLI_PIPE_METRICS_COUNT(P_CTX, COUNTER, USER_ID)	do {} while (0)
+#endif
+
 
 #define CLI_PIPE_NAME_LEN	32
 #define CLI_PIPE_CMD_BUFFER_LEN	64000
@@ -82,8 +106,31 @@ struct cli_pipe_env_s {
 	clios_pipe_t *p_pipe_in;
 	/** pipe out fd */
 	clios_pipe_t *p_pipe_out;
+#if (CLI_SUPPORT_METRICS == 1)
+	/** number of received command requests (sessions) */
+	unsigned long long n_sessions;
+	/** set while a command request is executed */
+	unsigned int b_session_active;
+#endif
+#if (CLI_SUPPORT_POOL == 1) && (CLI_SUPPORT_STRUCT_OUT == 1)
+	/** output format of the pipe (session), kept for the pool workers */
+	enum cli_struct_format_e struct_format;
+#endif
 };
 
+#if (CLI_SUPPORT_POOL == 1)
+/** Command request of a pipe, executed by the executor pool */
+struct cli_pipe_pool_req_s
+{
+	/** pipe */
+	struct cli_pipe_env_s *p_pipe_env;
+	/** output */
+	clios_pipe_t *p_out;
+	/** command length */
+	int len;
+};
+#endif
+
 
 
 /**
@@ -129,7 +176,9 @@ CLI_STATIC int pipe_cb(
 		clios_memcpy(&p_element[1], p_msg, len);
 		ptr = (char *)&p_element[1];
 		ptr[len - 1] = 0;
+		CLI_PIPE_METRICS_COUNT(p_cli_pipe_context, n_fifo_written, user_id);
 	} else {
+		CLI_PIPE_METRICS_COUNT(p_cli_pipe_context, n_fifo_dropped, user_id);
 		CLI_USR_DBG(LIB_CLI, CLI_PRN_HIGH,
 			("WRN CLI Pipe: callback fifo overflow" CLI_CRLF));
 	}
@@ -165,6 +214,42 @@ CLI_STATIC int pipe_exit(void *p_cb_ctx)
 	return -1;
 }
 
+#if (CLI_SUPPORT_STRUCT_OUT == 1) && \
+    !(defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1))
+/**
+   Execute a command with the structured output format of the session
+   (see \ref cli_struct_session_format_set)
+
+   \param[in] context Context
+   \param[in] cmd Command
+   \param[in] arg Arguments (IFX_NULL: none)
+   \param[in] out  Output pipe
+*/
+CLI_STATIC int pipe_exec__struct(
+	struct cli_core_context_s *p_cli_core_ctx,
+	char *p_cmd,
+	char *p_arg,
+	clios_pipe_t *p_out)
+{
+	struct cli_out_sink_s sink;
+	int ret, status;
+
+	/* rejoin the command line, split behind the command name */
+	if ((p_arg != IFX_NULL) && (p_arg == p_cmd + clios_strlen(p_cmd) + 1))
+		p_cmd[clios_strlen(p_cmd)] = ' ';
+
+	if (cli_out_sink_init__file(&sink, (clios_file_io_t *)p_out) != IFX_SUCCESS)
+		return IFX_ERROR;
+
+	ret = cli_core_cmd_exec__struct(p_cli_core_ctx, p_cmd,
+		cli_struct_session_format_get(), &sink, &status);
+	(void)cli_out_sink_flush(&sink);
+	cli_out_sink_release(&sink);
+
+	return ret;
+}
+#endif
+
 /**
    Split the command buffer in single lines and execute them
 
@@ -179,7 +264,7 @@ CLI_STATIC int pipe_exec(
 	int len,
 	clios_pipe_t *p_out)
 {
-	int ret = 0;
+	int ret = 0, exec_ret;
 	char *p_arg = IFX_NULL;
 
 	char *p_line;
@@ -197,8 +282,15 @@ CLI_STATIC int pipe_exec(
 				goto pipe_exec_skip;
 			p_arg = clios_strtok_r(IFX_NULL, "" CLI_CRLF, &p_cmd_tok);
 
-			if (cli_core_cmd_arg_exec__file(
-				p_cli_core_ctx, p_cmd_part, p_arg, p_out) == 1) {
+#if (CLI_SUPPORT_STRUCT_OUT == 1) && \
+    !(defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1))
+			if (cli_struct_session_format_get() != cli_struct_format_text)
+				exec_ret = pipe_exec__struct(p_cli_core_ctx, p_cmd_part, p_arg, p_out);
+			else
+#endif
+			exec_ret = cli_core_cmd_arg_exec__file(
+				p_cli_core_ctx, p_cmd_part, p_arg, p_out);
+			if (exec_ret == 1) {
 				/* "quit" was found, ignore following commands */
 				return 1;
 			}
@@ -210,6 +302,81 @@ CLI_STATIC int pipe_exec(
 	return ret;
 }
 
+#if (CLI_SUPPORT_POOL == 1)
+/**
+   Execute a command request within a pool worker, with the session
+   settings of the pipe (flight recorder tag, structured output format)
+
+   \param[in] p_data Command request
+*/
+CLI_STATIC int pipe_pool_job(void *p_data)
+{
+	struct cli_pipe_pool_req_s *p_req = (struct cli_pipe_pool_req_s *)p_data;
+	struct cli_pipe_env_s *p_pipe_env = p_req->p_pipe_env;
+#if (CLI_SUPPORT_TRACE == 1)
+	int session = cli_trace_session_get();
+#endif
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+	enum cli_struct_format_e format = cli_struct_session_format_get();
+#endif
+
+#if (CLI_SUPPORT_TRACE == 1)
+	cli_trace_session_set((int)p_pipe_env->number);
+#endif
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+	cli_struct_session_format_set(p_pipe_env->struct_format);
+#endif
+
+	(void)pipe_exec(p_pipe_env->p_cli_core_ctx,
+		p_pipe_env->cmd_buffer, p_req->len, p_req->p_out);
+
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+	p_pipe_env->struct_format = cli_struct_session_format_get();
+	cli_struct_session_format_set(format);
+#endif
+#if (CLI_SUPPORT_TRACE == 1)
+	cli_trace_session_set(session);
+#endif
+
+	return IFX_SUCCESS;
+}
+
+/**
+   Execute a command request by the executor pool (if set)
+
+   \param[in] p_pipe_env Pipe
+   \param[in] p_out Output
+   \param[in] len Command length
+
+   \return IFX_SUCCESS if executed, else the pipe thread executes it
+*/
+CLI_STATIC int pipe_pool_exec(
+	struct cli_pipe_env_s *p_pipe_env,
+	clios_pipe_t *p_out,
+	int len)
+{
+	struct cli_pool_s *p_pool;
+	struct cli_pipe_pool_req_s req;
+
+	p_pool = clios_atomic_load(&p_pipe_env->p_cli_pipe_context->p_pool);
+	if (p_pool == IFX_NULL)
+		return IFX_ERROR;
+
+	req.p_pipe_env = p_pipe_env;
+	req.p_out = p_out;
+	req.len = len;
+
+	/* session: pipe number, help requests by the interactive lane */
+	return cli_pool_run(p_pool,
+		(cli_core_cmd_interactive_get(p_pipe_env->p_cli_core_ctx,
+			p_pipe_env->cmd_buffer) == IFX_TRUE) ?
+			CLI_POOL_SESSION_INTERACTIVE : (unsigned int)p_pipe_env->number,
+		pipe_pool_job, &req,
+		cli_core_cmd_concurrent_get(
+			p_pipe_env->p_cli_core_ctx, p_pipe_env->cmd_buffer));
+}
+#endif	/* #if (CLI_SUPPORT_POOL == 1) */
+
 /**
    Task for handling the commands received in the ..._cmd pipe
 
@@ -222,10 +389,16 @@ CLI_STATIC int pipe_thread(IFXOS_ThreadParams_t *thr_params)
 
 	char pipe_name_cmd[50];
 	char pipe_name_ack[50];
+	clios_pipe_t *p_out;
 	int len = 0;
 	int ret = 0;
 #if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
-	struct cli_spec_file_io_s pipe_file_out = {IFX_NULL, IFX_NULL, 0};
+	struct cli_spec_file_io_s pipe_file_out = {IFX_NULL, IFX_NULL, 0, 0, IFX_NULL};
+#endif
+
+#if (CLI_SUPPORT_TRACE == 1)
+	/* the flight recorder tags the commands of this thread with the pipe number */
+	cli_trace_session_set((int)p_pipe_env->number);
 #endif
 
 	clios_snprintf(pipe_name_cmd, sizeof(pipe_name_cmd),
@@ -277,19 +450,27 @@ CLI_STATIC int pipe_thread(IFXOS_ThreadParams_t *thr_params)
 					ret = -1;
 					goto CLI_PIPE_THREAD_ERROR;
 				}
+#if (CLI_SUPPORT_METRICS == 1)
+				clios_atomic_add_relaxed(&p_pipe_env->n_sessions, 1ULL);
+				clios_atomic_store_relaxed(&p_pipe_env->b_session_active, 1U);
+#endif
 #if defined(CLI_SPECIAL_IO_FILE_TYPE) && (CLI_SPECIAL_IO_FILE_TYPE == 1)
 				pipe_file_out.p_file = p_pipe_env->p_pipe_out;
-				pipe_exec(p_pipe_env->p_cli_core_ctx,
-					p_pipe_env->cmd_buffer,  len,
-					(void*)&pipe_file_out);
+				p_out = (clios_pipe_t *)(void *)&pipe_file_out;
 #else
-				pipe_exec(p_pipe_env->p_cli_core_ctx,
-					p_pipe_env->cmd_buffer,  len,
-					p_pipe_env->p_pipe_out);
+				p_out = p_pipe_env->p_pipe_out;
 #endif
+#if (CLI_SUPPORT_POOL == 1)
+				if (pipe_pool_exec(p_pipe_env, p_out, len) != IFX_SUCCESS)
+#endif
+				pipe_exec(p_pipe_env->p_cli_core_ctx,
+					p_pipe_env->cmd_buffer,  len, p_out);
 
 				clios_pipe_close(p_pipe_env->p_pipe_out);
 				p_pipe_env->p_pipe_out = IFX_NULL;
+#if (CLI_SUPPORT_METRICS == 1)
+				clios_atomic_store_relaxed(&p_pipe_env->b_session_active, 0U);
+#endif
 			} else {
 				clios_sleep_msec(50);
 			}
@@ -321,6 +502,7 @@ CLI_STATIC int pipe_log_thread(
 	unsigned long *p_msg;
 	unsigned int el_size;
 	unsigned long *p_buffer;
+	unsigned int wait_ms;
 
 	/*
 	   int errno = 0;
@@ -340,9 +522,25 @@ CLI_STATIC int pipe_log_thread(
 		    || (thr_params->bShutDown == IFX_TRUE))
 			break;
 
+		wait_ms = CLI_PIPE_EVENT_WAIT_TIMEOUT;
+#if (CLI_SUPPORT_EVENT_LIMIT == 1)
+		/* deliver the collapsed events which are due, also while the
+		   FIFO is busy, and wake up in time for the next one */
+		if (p_cli_pipe_context->p_cli_pipe_env[0] != IFX_NULL) {
+			struct cli_core_context_s *p_core_ctx =
+				p_cli_pipe_context->p_cli_pipe_env[0]->p_cli_core_ctx;
+			unsigned int due_ms;
+
+			(void)cli_core_event_limit_flush(p_core_ctx);
+			if ((cli_core_event_limit_due_get(p_core_ctx, &due_ms) > 0) &&
+			    (due_ms < wait_ms))
+				wait_ms = (due_ms > 0) ? due_ms : 1;
+		}
+#endif
+
 		if (clios_vfifo_is_empty(&p_cli_pipe_context->log_fifo)) {
 			if (clios_event_wait(&p_cli_pipe_context->event_fifo,
-					    CLI_PIPE_EVENT_WAIT_TIMEOUT, IFX_NULL) < IFX_SUCCESS)
+					    wait_ms, IFX_NULL) < IFX_SUCCESS)
 				continue;
 		}
 
@@ -388,6 +586,8 @@ CLI_STATIC int pipe_log_thread(
 								("ERR CLI Pipe: log thr - dump pipe[%02d], errno = %d" CLI_CRLF,
 								p_pipe_env->number, errno));
 						clios_pipe_close(p_pipe);
+					} else {
+						CLI_PIPE_METRICS_COUNT(p_cli_pipe_context, n_not_delivered, CLI_PIPE_DUMP);
 					}
 					break;
 
@@ -400,6 +600,8 @@ CLI_STATIC int pipe_log_thread(
 								("ERR CLI Pipe: log thr - event pipe[%02d], errno = %d" CLI_CRLF,
 								p_pipe_env->number, errno));
 						clios_pipe_close(p_pipe);
+					} else {
+						CLI_PIPE_METRICS_COUNT(p_cli_pipe_context, n_not_delivered, CLI_PIPE_EVENT);
 					}
 					break;
 				}
@@ -412,6 +614,80 @@ CLI_STATIC int pipe_log_thread(
 	return 0;
 }
 
+#if (CLI_SUPPORT_METRICS == 1)
+/** Metrics source - log FIFO and pipe sessions
+
+   \param[in] p_data  pipe context
+   \param[in] p_metrics  metrics render context
+*/
+CLI_STATIC int pipe_metrics(
+	void *p_data,
+	struct cli_metrics_s *p_metrics)
+{
+	static const char * const type[2] = {"event", "dump"};
+	struct cli_pipe_context_s *p_cli_pipe_context = (struct cli_pipe_context_s *)p_data;
+	struct cli_pipe_env_s *p_pipe_env;
+	char labels[64];
+	unsigned short i;
+
+	(void)cli_metrics_family(p_metrics, "cli_pipe_interfaces", "gauge",
+		"Number of pipe interfaces");
+	(void)cli_metrics_sample(p_metrics, "cli_pipe_interfaces", IFX_NULL,
+		p_cli_pipe_context->n_pipes);
+
+	(void)cli_metrics_family(p_metrics, "cli_pipe_sessions", "counter",
+		"Number of command requests received via the pipe");
+	for (i = 0; i < p_cli_pipe_context->n_pipes; i++) {
+		p_pipe_env = &p_cli_pipe_context->p_pipe_env_mem[i];
+		(void)clios_snprintf(labels, sizeof(labels), "pipe=\"%u\"", p_pipe_env->number);
+		(void)cli_metrics_sample(p_metrics, "cli_pipe_sessions_total", labels,
+			clios_atomic_load_relaxed(&p_pipe_env->n_sessions));
+	}
+
+	(void)cli_metrics_family(p_metrics, "cli_pipe_session_active", "gauge",
+		"Command request in execution");
+	for (i = 0; i < p_cli_pipe_context->n_pipes; i++) {
+		p_pipe_env = &p_cli_pipe_context->p_pipe_env_mem[i];
+		(void)clios_snprintf(labels, sizeof(labels), "pipe=\"%u\"", p_pipe_env->number);
+		(void)cli_metrics_sample(p_metrics, "cli_pipe_session_active", labels,
+			clios_atomic_load_relaxed(&p_pipe_env->b_session_active));
+	}
+
+	(void)cli_metrics_family(p_metrics, "cli_pipe_fifo_size_bytes", "gauge",
+		"Size of the event / dump FIFO");
+	(void)cli_metrics_sample(p_metrics, "cli_pipe_fifo_size_bytes", IFX_NULL,
+		CLI_LOG_FIFOSIZE * sizeof(unsigned long));
+	(void)cli_metrics_family(p_metrics, "cli_pipe_fifo_elements", "gauge",
+		"Number of messages within the event / dump FIFO");
+	(void)cli_metrics_sample(p_metrics, "cli_pipe_fifo_elements", IFX_NULL,
+		clios_vfifo_get_count(&p_cli_pipe_context->log_fifo));
+
+	(void)cli_metrics_family(p_metrics, "cli_pipe_fifo_messages", "counter",
+		"Number of messages written to the FIFO");
+	for (i = 0; i < 2; i++) {
+		(void)clios_snprintf(labels, sizeof(labels), "type=\"%s\"", type[i]);
+		(void)cli_metrics_sample(p_metrics, "cli_pipe_fifo_messages_total", labels,
+			clios_atomic_load_relaxed(&p_cli_pipe_context->n_fifo_written[i]));
+	}
+	(void)cli_metrics_family(p_metrics, "cli_pipe_fifo_dropped", "counter",
+		"Number of messages dropped, FIFO full");
+	for (i = 0; i < 2; i++) {
+		(void)clios_snprintf(labels, sizeof(labels), "type=\"%s\"", type[i]);
+		(void)cli_metrics_sample(p_metrics, "cli_pipe_fifo_dropped_total", labels,
+			clios_atomic_load_relaxed(&p_cli_pipe_context->n_fifo_dropped[i]));
+	}
+	(void)cli_metrics_family(p_metrics, "cli_pipe_not_delivered", "counter",
+		"Number of messages not delivered, pipe not opened by a reader");
+	for (i = 0; i < 2; i++) {
+		(void)clios_snprintf(labels, sizeof(labels), "type=\"%s\"", type[i]);
+		(void)cli_metrics_sample(p_metrics, "cli_pipe_not_delivered_total", labels,
+			clios_atomic_load_relaxed(&p_cli_pipe_context->n_not_delivered[i]));
+	}
+
+	return IFX_SUCCESS;
+}
+#endif	/* #if (CLI_SUPPORT_METRICS == 1) */
+
 /** Init pipe
 
    \param p_cli_core_ctx  context CLI core context pointer
@@ -532,6 +808,9 @@ CLI_STATIC int pipe_init(
 			pipe_exit, pipe_event, pipe_dump,
 			&p_pipe_env->p_user_ctx);
 	}
+#if (CLI_SUPPORT_METRICS == 1)
+	(void)cli_core_metrics_source_add(p_cli_core_ctx, pipe_metrics, p_cli_pipe_context);
+#endif
 	*pp_cli_pipe_context = p_cli_pipe_context;
 
 	return IFX_SUCCESS;
@@ -572,6 +851,29 @@ int cli_single_pipe_init(
 	return pipe_init(p_cli_core_ctx, pipe_num, 1, p_pipe_name, pp_cli_pipe_context);
 }
 
+/** Set the executor pool of the command requests
+
+   \param p_cli_pipe_context  pipe context
+   \param p_pool  executor pool, IFX_NULL: executed by the pipe threads
+*/
+int cli_pipe_pool_set(
+	struct cli_pipe_context_s *p_cli_pipe_context,
+	struct cli_pool_s *p_pool)
+{
+#if (CLI_SUPPORT_POOL == 1)
+	if (p_cli_pipe_context == IFX_NULL)
+		return IFX_ERROR;
+
+	clios_atomic_store(&p_cli_pipe_context->p_pool, p_pool);
+
+	return IFX_SUCCESS;
+#else
+	(void)p_cli_pipe_context;
+	(void)p_pool;
+	return IFX_ERROR;
+#endif
+}
+
 /** Exit pipe
 
    \param[in] context OMCI context pointer
@@ -588,6 +890,12 @@ int cli_pipe_release(
 		p_cli_pipe_context = *pp_cli_pipe_context;
 		*pp_cli_pipe_context = IFX_NULL;
 
+#if (CLI_SUPPORT_METRICS == 1)
+		if (p_cli_core_ctx != IFX_NULL)
+			(void)cli_core_metrics_source_remove(
+				p_cli_core_ctx, pipe_metrics, p_cli_pipe_context);
+#endif
+
 		if (IFXOS_LOCK_INIT_VALID(&p_cli_pipe_context->lock_cb)) {
 			clios_lockget(&p_cli_pipe_context->lock_cb);
 		}
@@ -35,6 +35,8 @@ extern "C" {
 
 /* forward declaration */
 struct cli_pipe_env_s;
+/* forward declaration */
+struct cli_pool_s;
 
 /** CLI Pipe Context */
 struct cli_pipe_context_s
@@ -57,6 +59,21 @@ struct cli_pipe_context_s
 	struct cli_pipe_env_s *p_pipe_env_mem;
 	/** collect available pipe interfaces */
 	struct cli_pipe_env_s *p_cli_pipe_env[MAX_CLI_PIPES];
+
+#if (CLI_SUPPORT_METRICS == 1)
+	/** Log thread - number of messages written to the FIFO [event, dump] */
+	unsigned long long n_fifo_written[2];
+	/** Log thread - number of messages dropped, FIFO full [event, dump] */
+	unsigned long long n_fifo_dropped[2];
+	/** Log thread - number of messages not delivered, pipe not open [event, dump] */
+	unsigned long long n_not_delivered[2];
+#endif
+
+#if (CLI_SUPPORT_POOL == 1)
+	/** executor pool of the command requests, IFX_NULL: executed by the
+	    pipe threads */
+	struct cli_pool_s *p_pool;
+#endif
 };
 
 extern int cli_pipe_init(
@@ -75,6 +92,29 @@ extern int cli_pipe_release(
 	struct cli_core_context_s *p_cli_core_ctx,
 	struct cli_pipe_context_s **pp_cli_pipe_context);
 
+/** Execute the command requests of the pipes by an executor pool
+   (see \ref LIB_CLI_POOL), a request runs concurrently if all its commands
+   are registered with \ref CLI_CMD_MASK_CONCURRENT. Each pipe is a session
+   of the pool (pipe number), help requests use the interactive lane.
+
+\param
+   p_cli_pipe_context  pipe context.
+\param
+   p_pool  executor pool, IFX_NULL: executed by the pipe threads.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (not supported).
+
+\remarks
+   The pipe threads keep the protocol (one request per pipe at a time) and
+   wait for the execution. The pool must be reset (or the pipes released)
+   before the pool is released.
+*/
+extern int cli_pipe_pool_set(
+	struct cli_pipe_context_s *p_cli_pipe_context,
+	struct cli_pool_s *p_pool);
+
 
 #ifdef __cplusplus
 }
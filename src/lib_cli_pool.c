@@ -0,0 +1,694 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_pool.c
+   Command Line Interface - executor pool
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_POOL == 1)
+#include "lib_cli_pool.h"
+#if (CLI_SUPPORT_METRICS == 1)
+#	include "lib_cli_metrics.h"
+#endif
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** Worker task stack size */
+#ifndef CLI_OS_POOL_STACK_SIZE
+#	define CLI_OS_POOL_STACK_SIZE	(8192)
+#endif
+
+/** Default thread priority.
+   This setting is a relative value. */
+#ifndef CLI_OS_THREAD_PRIO
+#	define CLI_OS_THREAD_PRIO	40
+#endif
+
+/** max wait time of an idle worker [ms] (the wakeups are not counted) */
+#define CLI_POOL_WAIT_TIMEOUT	100
+
+/** worker shutdown timeout [ms] */
+#define CLI_POOL_SHUTDOWN_TIMEOUT	3000
+
+/** virtual time of a job start with weight 1 (stride scheduling) */
+#define CLI_POOL_STRIDE	100000ULL
+
+/** number of queues, index 0: interactive lane */
+#define CLI_POOL_NUM_QUEUES	(CLI_POOL_MAX_SESSIONS + 1)
+
+/** Job queue of a session */
+struct cli_pool_queue_s
+{
+	/** queue assigned to a session */
+	IFX_boolean_t b_used;
+	/** first queued job */
+	struct cli_pool_job_s *p_head;
+	/** last queued job */
+	struct cli_pool_job_s *p_tail;
+	/** virtual time of the next job start */
+	unsigned long long pass;
+	/** queue metrics, including session and weight */
+	struct cli_pool_queue_stats_s stats;
+};
+
+/** Executor pool */
+struct cli_pool_s
+{
+	/** protects the queues and the run state */
+	IFXOS_lock_t lock;
+	/** wakes up an idle worker */
+	IFXOS_event_t event_work;
+	/** pool running */
+	IFX_boolean_t b_run;
+	/** job queues, index 0: interactive lane */
+	struct cli_pool_queue_s queue[CLI_POOL_NUM_QUEUES];
+	/** virtual time, pass of the last started session job */
+	unsigned long long vtime;
+	/** number of queued jobs */
+	unsigned int n_queued;
+	/** number of running jobs */
+	unsigned int n_running;
+	/** an exclusive job is running */
+	IFX_boolean_t b_exclusive;
+	/** number of worker threads */
+	unsigned int n_workers;
+	/** thread control of the workers */
+	clios_thr_ctrl_t thr_ctrl[CLI_POOL_MAX_WORKERS];
+};
+
+/** Synchronous job (see cli_pool_run) */
+struct cli_pool_run_s
+{
+	/** job */
+	struct cli_pool_job_s job;
+	/** job function of the caller */
+	cli_pool_job_fct_t job_fct;
+	/** user data of the caller */
+	void *p_data;
+	/** signaled on completion */
+	IFXOS_event_t event_done;
+	/** result of the job */
+	int ret;
+};
+
+/** Command line job (see cli_pool_cmd_exec__file) */
+struct cli_pool_cmd_s
+{
+	/** CLI core */
+	struct cli_core_context_s *p_core_ctx;
+	/** command lines */
+	char *p_cmd_lines;
+	/** output file */
+	clios_file_io_t *p_file_io;
+};
+
+/** Current time [us] (monotonic), used for the wait time */
+CLI_STATIC unsigned long long pool_time_us_get(void)
+{
+#if defined(LINUX) && !defined(__KERNEL__)
+	struct timespec ts;
+
+	if (clios_clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+		return 0;
+
+	return (unsigned long long)ts.tv_sec * 1000000ULL +
+		(unsigned long long)(ts.tv_nsec / 1000);
+#else
+	return (unsigned long long)clios_elapsed_time_msec_get(0) * 1000ULL;
+#endif
+}
+
+/** Queue of a session, assigned on the first use (lock held)
+
+   \param[in] b_assign  assign a free queue if the session has none
+*/
+CLI_STATIC struct cli_pool_queue_s *pool_queue_get(
+	struct cli_pool_s *p_pool,
+	unsigned int session,
+	IFX_boolean_t b_assign)
+{
+	struct cli_pool_queue_s *p_free = IFX_NULL;
+	unsigned int i;
+
+	if (session == CLI_POOL_SESSION_INTERACTIVE)
+		return &p_pool->queue[0];
+
+	for (i = 1; i < CLI_POOL_NUM_QUEUES; i++)
+	{
+		if (!p_pool->queue[i].b_used)
+		{
+			if (p_free == IFX_NULL)
+				p_free = &p_pool->queue[i];
+			continue;
+		}
+		if (p_pool->queue[i].stats.session == session)
+			return &p_pool->queue[i];
+	}
+
+	if (!b_assign)
+		return IFX_NULL;
+
+	if (p_free == IFX_NULL)
+	{
+		/* all queues assigned - shared queue */
+		return &p_pool->queue[1 + (session % CLI_POOL_MAX_SESSIONS)];
+	}
+
+	p_free->b_used = IFX_TRUE;
+	p_free->stats.session = session;
+	p_free->stats.weight = CLI_POOL_WEIGHT_DEFAULT;
+	p_free->pass = p_pool->vtime;
+
+	return p_free;
+}
+
+/** Queue of the next job: interactive lane first, then the session with
+   the lowest virtual time (lock held) */
+CLI_STATIC struct cli_pool_queue_s *pool_queue_next(
+	struct cli_pool_s *p_pool)
+{
+	struct cli_pool_queue_s *p_next = IFX_NULL;
+	unsigned int i;
+
+	if (p_pool->queue[0].p_head != IFX_NULL)
+		return &p_pool->queue[0];
+
+	for (i = 1; i < CLI_POOL_NUM_QUEUES; i++)
+	{
+		if ((p_pool->queue[i].p_head != IFX_NULL) &&
+		    ((p_next == IFX_NULL) || (p_pool->queue[i].pass < p_next->pass)))
+			p_next = &p_pool->queue[i];
+	}
+
+	return p_next;
+}
+
+/** Check if a job can be started (lock held) */
+CLI_STATIC IFX_boolean_t pool_job_startable(
+	struct cli_pool_s *p_pool,
+	const struct cli_pool_job_s *p_job)
+{
+	if (p_pool->b_exclusive)
+		return IFX_FALSE;
+	if (!p_job->b_concurrent && (p_pool->n_running > 0))
+		return IFX_FALSE;
+
+	return IFX_TRUE;
+}
+
+/** Take the next job of the scheduler if it can be started (lock held) */
+CLI_STATIC struct cli_pool_job_s *pool_job_take(
+	struct cli_pool_s *p_pool)
+{
+	struct cli_pool_queue_s *p_queue = pool_queue_next(p_pool);
+	struct cli_pool_job_s *p_job;
+	unsigned long long wait_us;
+
+	if (p_queue == IFX_NULL)
+		return IFX_NULL;
+	p_job = p_queue->p_head;
+	if (!pool_job_startable(p_pool, p_job))
+		return IFX_NULL;
+
+	p_queue->p_head = p_job->p_next;
+	if (p_queue->p_head == IFX_NULL)
+		p_queue->p_tail = IFX_NULL;
+	p_queue->stats.n_queued--;
+	p_pool->n_queued--;
+	p_pool->n_running++;
+	if (!p_job->b_concurrent)
+		p_pool->b_exclusive = IFX_TRUE;
+	p_job->p_next = IFX_NULL;
+
+	if (p_queue != &p_pool->queue[0])
+	{
+		p_pool->vtime = p_queue->pass;
+		p_queue->pass += CLI_POOL_STRIDE / p_queue->stats.weight;
+	}
+
+	wait_us = pool_time_us_get() - p_job->submit_us;
+	p_queue->stats.n_jobs++;
+	p_queue->stats.wait_sum_us += wait_us;
+	if (wait_us > p_queue->stats.wait_max_us)
+		p_queue->stats.wait_max_us = wait_us;
+
+	return p_job;
+}
+
+/** Check if the next job of the scheduler can be started (lock held) */
+CLI_STATIC IFX_boolean_t pool_job_more(
+	struct cli_pool_s *p_pool)
+{
+	struct cli_pool_queue_s *p_queue = pool_queue_next(p_pool);
+
+	if (p_queue == IFX_NULL)
+		return IFX_FALSE;
+
+	return pool_job_startable(p_pool, p_queue->p_head);
+}
+
+/** Worker thread */
+CLI_STATIC int pool_worker(
+	IFXOS_ThreadParams_t *thr_params)
+{
+	struct cli_pool_s *p_pool = (struct cli_pool_s *)thr_params->nArg1;
+	struct cli_pool_job_s *p_job;
+	cli_pool_done_fct_t done_fct;
+	IFX_boolean_t b_concurrent, b_more;
+	void *p_data;
+	int ret;
+
+	while (thr_params->bShutDown != IFX_TRUE)
+	{
+		(void)clios_lockget(&p_pool->lock);
+		if (!p_pool->b_run)
+		{
+			(void)clios_lockrelease(&p_pool->lock);
+			break;
+		}
+		p_job = pool_job_take(p_pool);
+		/* the next job can be started as well */
+		b_more = (p_job != IFX_NULL) ? pool_job_more(p_pool) : IFX_FALSE;
+		(void)clios_lockrelease(&p_pool->lock);
+
+		if (p_job == IFX_NULL)
+		{
+			(void)clios_event_wait(&p_pool->event_work, CLI_POOL_WAIT_TIMEOUT, IFX_NULL);
+			continue;
+		}
+		if (b_more)
+			(void)clios_event_wakeup(&p_pool->event_work);
+
+		/* the job is owned by the caller after the completion */
+		b_concurrent = p_job->b_concurrent;
+		done_fct = p_job->done_fct;
+		p_data = p_job->p_data;
+		ret = p_job->job_fct(p_data);
+
+		(void)clios_lockget(&p_pool->lock);
+		p_pool->n_running--;
+		if (!b_concurrent)
+			p_pool->b_exclusive = IFX_FALSE;
+		b_more = (p_pool->n_queued > 0) ? IFX_TRUE : IFX_FALSE;
+		(void)clios_lockrelease(&p_pool->lock);
+
+		if (b_more)
+			(void)clios_event_wakeup(&p_pool->event_work);
+		if (done_fct != IFX_NULL)
+			done_fct(p_data, ret);
+	}
+
+	/* pass the shutdown to the next worker */
+	(void)clios_event_wakeup(&p_pool->event_work);
+
+	return IFX_SUCCESS;
+}
+
+int cli_pool_init(
+	struct cli_pool_s **pp_pool,
+	unsigned int n_workers)
+{
+	struct cli_pool_s *p_pool;
+	char name[16];
+	unsigned int i;
+
+	if ((pp_pool == IFX_NULL) || (*pp_pool != IFX_NULL) ||
+	    (n_workers == 0) || (n_workers > CLI_POOL_MAX_WORKERS))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Pool: init - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_pool = (struct cli_pool_s *)clios_memalloc(sizeof(struct cli_pool_s));
+	if (p_pool == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Pool: init - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_pool, 0x00, sizeof(struct cli_pool_s));
+
+	(void)clios_lockinit(&p_pool->lock, "cli_pool", 0);
+	(void)clios_event_init(&p_pool->event_work);
+	p_pool->b_run = IFX_TRUE;
+	p_pool->queue[0].b_used = IFX_TRUE;
+	p_pool->queue[0].stats.session = CLI_POOL_SESSION_INTERACTIVE;
+	p_pool->queue[0].stats.weight = CLI_POOL_WEIGHT_MAX;
+
+	for (i = 0; i < n_workers; i++)
+	{
+		clios_snprintf(name, sizeof(name), "tCliPool_%u", i);
+		if (clios_thr_init(&p_pool->thr_ctrl[i], name, pool_worker,
+			CLI_OS_POOL_STACK_SIZE, CLI_OS_THREAD_PRIO,
+			(unsigned long)p_pool, (unsigned long)i) != IFX_SUCCESS)
+		{
+			CLI_USR_ERR(LIB_CLI, ("ERR CLI Pool: init - worker %u start" CLI_CRLF, i));
+			break;
+		}
+		p_pool->n_workers++;
+	}
+
+	if (p_pool->n_workers == 0)
+	{
+		(void)cli_pool_release(&p_pool);
+		return IFX_ERROR;
+	}
+
+	*pp_pool = p_pool;
+	return IFX_SUCCESS;
+}
+
+int cli_pool_release(
+	struct cli_pool_s **pp_pool)
+{
+	struct cli_pool_s *p_pool;
+	struct cli_pool_job_s *p_job, *p_next;
+	unsigned int i, q;
+
+	if ((pp_pool == IFX_NULL) || (*pp_pool == IFX_NULL))
+		return IFX_ERROR;
+
+	p_pool = *pp_pool;
+	*pp_pool = IFX_NULL;
+
+	(void)clios_lockget(&p_pool->lock);
+	p_pool->b_run = IFX_FALSE;
+	(void)clios_lockrelease(&p_pool->lock);
+	(void)clios_event_wakeup(&p_pool->event_work);
+
+	for (i = 0; i < p_pool->n_workers; i++)
+	{
+		if (clios_thr_shutdown(&p_pool->thr_ctrl[i], CLI_POOL_SHUTDOWN_TIMEOUT) != IFX_SUCCESS)
+			(void)clios_thr_delete(&p_pool->thr_ctrl[i], CLI_POOL_SHUTDOWN_TIMEOUT);
+	}
+
+	/* the queued jobs are not executed */
+	for (q = 0; q < CLI_POOL_NUM_QUEUES; q++)
+	{
+		p_job = p_pool->queue[q].p_head;
+		p_pool->queue[q].p_head = p_pool->queue[q].p_tail = IFX_NULL;
+		while (p_job != IFX_NULL)
+		{
+			p_next = p_job->p_next;
+			if (p_job->done_fct != IFX_NULL)
+				p_job->done_fct(p_job->p_data, IFX_ERROR);
+			p_job = p_next;
+		}
+	}
+
+	(void)clios_event_delete(&p_pool->event_work);
+	(void)clios_lockdelete(&p_pool->lock);
+	clios_memfree(p_pool);
+
+	return IFX_SUCCESS;
+}
+
+int cli_pool_submit(
+	struct cli_pool_s *p_pool,
+	struct cli_pool_job_s *p_job)
+{
+	struct cli_pool_queue_s *p_queue;
+
+	if ((p_pool == IFX_NULL) || (p_job == IFX_NULL) || (p_job->job_fct == IFX_NULL))
+		return IFX_ERROR;
+
+	p_job->p_next = IFX_NULL;
+	p_job->submit_us = pool_time_us_get();
+
+	(void)clios_lockget(&p_pool->lock);
+	if (!p_pool->b_run)
+	{
+		(void)clios_lockrelease(&p_pool->lock);
+		return IFX_ERROR;
+	}
+	p_queue = pool_queue_get(p_pool, p_job->session, IFX_TRUE);
+	if (p_queue->p_tail != IFX_NULL)
+	{
+		p_queue->p_tail->p_next = p_job;
+	}
+	else
+	{
+		p_queue->p_head = p_job;
+		/* an idle session starts at the current virtual time (no credit) */
+		if (p_queue->pass < p_pool->vtime)
+			p_queue->pass = p_pool->vtime;
+	}
+	p_queue->p_tail = p_job;
+	if (++p_queue->stats.n_queued > p_queue->stats.n_queued_max)
+		p_queue->stats.n_queued_max = p_queue->stats.n_queued;
+	p_pool->n_queued++;
+	(void)clios_lockrelease(&p_pool->lock);
+
+	(void)clios_event_wakeup(&p_pool->event_work);
+
+	return IFX_SUCCESS;
+}
+
+/** Job function of a synchronous job */
+CLI_STATIC int pool_run_job(
+	void *p_data)
+{
+	struct cli_pool_run_s *p_run = (struct cli_pool_run_s *)p_data;
+
+	return p_run->job_fct(p_run->p_data);
+}
+
+/** Completion of a synchronous job */
+CLI_STATIC void pool_run_done(
+	void *p_data,
+	int ret)
+{
+	struct cli_pool_run_s *p_run = (struct cli_pool_run_s *)p_data;
+
+	p_run->ret = ret;
+	(void)clios_event_wakeup(&p_run->event_done);
+}
+
+int cli_pool_run(
+	struct cli_pool_s *p_pool,
+	unsigned int session,
+	cli_pool_job_fct_t job_fct,
+	void *p_data,
+	int b_concurrent)
+{
+	struct cli_pool_run_s run;
+
+	if (job_fct == IFX_NULL)
+		return IFX_ERROR;
+
+	clios_memset(&run, 0x00, sizeof(run));
+	run.job.job_fct = pool_run_job;
+	run.job.done_fct = pool_run_done;
+	run.job.p_data = &run;
+	run.job.b_concurrent = b_concurrent;
+	run.job.session = session;
+	run.job_fct = job_fct;
+	run.p_data = p_data;
+	run.ret = IFX_ERROR;
+
+	(void)clios_event_init(&run.event_done);
+	if (cli_pool_submit(p_pool, &run.job) != IFX_SUCCESS)
+	{
+		(void)clios_event_delete(&run.event_done);
+		return IFX_ERROR;
+	}
+
+	while (clios_event_wait(&run.event_done, CLI_POOL_WAIT_TIMEOUT, IFX_NULL) != IFX_SUCCESS)
+		;
+	(void)clios_event_delete(&run.event_done);
+
+	return run.ret;
+}
+
+/** Job function of a command line job */
+CLI_STATIC int pool_cmd_job(
+	void *p_data)
+{
+	struct cli_pool_cmd_s *p_cmd = (struct cli_pool_cmd_s *)p_data;
+	char *p_line, *p_tokbuf = IFX_NULL;
+	int ret = IFX_SUCCESS;
+
+	p_line = clios_strtok_r(p_cmd->p_cmd_lines, CLI_CRLF, &p_tokbuf);
+	while (p_line != IFX_NULL)
+	{
+		if (*p_line != '\0')
+		{
+			ret = cli_core_cmd_exec__file(p_cmd->p_core_ctx, p_line, p_cmd->p_file_io);
+			/* "quit" - ignore the following commands */
+			if (ret == 1)
+				break;
+		}
+		p_line = clios_strtok_r(IFX_NULL, CLI_CRLF, &p_tokbuf);
+	}
+
+	return ret;
+}
+
+int cli_pool_cmd_exec__file(
+	struct cli_pool_s *p_pool,
+	unsigned int session,
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_lines,
+	clios_file_io_t *p_file_io)
+{
+	struct cli_pool_cmd_s cmd;
+
+	if ((p_core_ctx == IFX_NULL) || (p_cmd_lines == IFX_NULL))
+		return IFX_ERROR;
+
+	cmd.p_core_ctx = p_core_ctx;
+	cmd.p_cmd_lines = p_cmd_lines;
+	cmd.p_file_io = p_file_io;
+
+	if (cli_core_cmd_interactive_get(p_core_ctx, p_cmd_lines) == IFX_TRUE)
+		session = CLI_POOL_SESSION_INTERACTIVE;
+
+	return cli_pool_run(p_pool, session, pool_cmd_job, &cmd,
+		cli_core_cmd_concurrent_get(p_core_ctx, p_cmd_lines));
+}
+
+int cli_pool_session_weight_set(
+	struct cli_pool_s *p_pool,
+	unsigned int session,
+	unsigned int weight)
+{
+	struct cli_pool_queue_s *p_queue;
+
+	if ((p_pool == IFX_NULL) || (session == CLI_POOL_SESSION_INTERACTIVE) ||
+	    (weight == 0) || (weight > CLI_POOL_WEIGHT_MAX))
+		return IFX_ERROR;
+
+	(void)clios_lockget(&p_pool->lock);
+	p_queue = pool_queue_get(p_pool, session, IFX_TRUE);
+	p_queue->stats.weight = weight;
+	(void)clios_lockrelease(&p_pool->lock);
+
+	return IFX_SUCCESS;
+}
+
+int cli_pool_queue_walk(
+	struct cli_pool_s *p_pool,
+	cli_pool_queue_walk_fct_t walk_fct,
+	void *p_data)
+{
+	struct cli_pool_queue_stats_s stats[CLI_POOL_NUM_QUEUES];
+	unsigned int i, n = 0;
+
+	if ((p_pool == IFX_NULL) || (walk_fct == IFX_NULL))
+		return IFX_ERROR;
+
+	(void)clios_lockget(&p_pool->lock);
+	for (i = 0; i < CLI_POOL_NUM_QUEUES; i++)
+	{
+		if (p_pool->queue[i].b_used)
+			stats[n++] = p_pool->queue[i].stats;
+	}
+	(void)clios_lockrelease(&p_pool->lock);
+
+	for (i = 0; i < n; i++)
+	{
+		if (walk_fct(p_data, &stats[i]) != 0)
+			break;
+	}
+
+	return IFX_SUCCESS;
+}
+
+#if (CLI_SUPPORT_METRICS == 1)
+int cli_pool_metrics(
+	void *p_data,
+	struct cli_metrics_s *p_metrics)
+{
+	static const char * const family[][3] = {
+		{"cli_pool_queue_depth", "gauge", "Number of queued jobs per session"},
+		{"cli_pool_queue_depth_max", "gauge", "Max number of queued jobs per session"},
+		{"cli_pool_queue_weight", "gauge", "Weight of the session queue"},
+		{"cli_pool_queue_wait_seconds", "summary", "Wait time from submission to start"},
+		{"cli_pool_queue_wait_max_seconds", "gauge", "Max wait time from submission to start"}};
+	struct cli_pool_s *p_pool = (struct cli_pool_s *)p_data;
+	struct cli_pool_queue_stats_s stats[CLI_POOL_NUM_QUEUES];
+	const struct cli_pool_queue_stats_s *p_stats;
+	unsigned int i, f, n = 0, n_running;
+	char labels[32];
+
+	if ((p_pool == IFX_NULL) || (p_metrics == IFX_NULL))
+		return IFX_ERROR;
+
+	(void)clios_lockget(&p_pool->lock);
+	n_running = p_pool->n_running;
+	for (i = 0; i < CLI_POOL_NUM_QUEUES; i++)
+	{
+		if (p_pool->queue[i].b_used)
+			stats[n++] = p_pool->queue[i].stats;
+	}
+	(void)clios_lockrelease(&p_pool->lock);
+
+	(void)cli_metrics_family(p_metrics, "cli_pool_workers", "gauge",
+		"Number of worker threads of the executor pool");
+	(void)cli_metrics_sample(p_metrics, "cli_pool_workers", IFX_NULL,
+		p_pool->n_workers);
+	(void)cli_metrics_family(p_metrics, "cli_pool_jobs_running", "gauge",
+		"Number of running jobs");
+	(void)cli_metrics_sample(p_metrics, "cli_pool_jobs_running", IFX_NULL,
+		n_running);
+
+	for (f = 0; f < sizeof(family) / sizeof(family[0]); f++)
+	{
+		(void)cli_metrics_family(p_metrics, family[f][0], family[f][1], family[f][2]);
+		for (i = 0; i < n; i++)
+		{
+			p_stats = &stats[i];
+			if (p_stats->session == CLI_POOL_SESSION_INTERACTIVE)
+				(void)clios_snprintf(labels, sizeof(labels), "session=\"interactive\"");
+			else
+				(void)clios_snprintf(labels, sizeof(labels), "session=\"%u\"", p_stats->session);
+
+			switch (f)
+			{
+			case 0:
+				(void)cli_metrics_sample(p_metrics, family[f][0], labels, p_stats->n_queued);
+				break;
+			case 1:
+				(void)cli_metrics_sample(p_metrics, family[f][0], labels, p_stats->n_queued_max);
+				break;
+			case 2:
+				(void)cli_metrics_sample(p_metrics, family[f][0], labels, p_stats->weight);
+				break;
+			case 3:
+				(void)cli_metrics_printf(p_metrics,
+					"cli_pool_queue_wait_seconds_count{%s} %llu\n"
+					"cli_pool_queue_wait_seconds_sum{%s} %llu.%06llu\n",
+					labels, p_stats->n_jobs, labels,
+					p_stats->wait_sum_us / 1000000ULL, p_stats->wait_sum_us % 1000000ULL);
+				break;
+			default:
+				(void)cli_metrics_printf(p_metrics,
+					"cli_pool_queue_wait_max_seconds{%s} %llu.%06llu\n",
+					labels, p_stats->wait_max_us / 1000000ULL, p_stats->wait_max_us % 1000000ULL);
+				break;
+			}
+		}
+	}
+
+	return IFX_SUCCESS;
+}
+#endif	/* #if (CLI_SUPPORT_METRICS == 1) */
+
+#endif	/* #if (CLI_SUPPORT_POOL == 1) */
@@ -0,0 +1,313 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_POOL_H
+#define _LIB_CLI_POOL_H
+
+/**
+   \file lib_cli_pool.h
+   Command Line Interface - executor pool
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_POOL CLI Executor Pool
+
+   A fixed number of worker threads which execute the commands of the
+   transports (pipes, see cli_pipe_pool_set, the console, see
+   cli_console_pool_set, or the application).
+
+   Each job belongs to a session (for example the pipe number), the jobs
+   of a session are queued in the order of submission. The next job is
+   selected by the scheduler:
+   - the interactive lane (\ref CLI_POOL_SESSION_INTERACTIVE, console and
+     help requests) is served first.
+   - the session queues are served by weighted fair queueing (stride
+     scheduling): each job advances the virtual time of its session by
+     the inverse of the weight (\ref cli_pool_session_weight_set). A
+     session which becomes active starts at the current virtual time, a
+     bulk script of one session does not delay the other sessions by more
+     than one job per round.
+
+   The selected job is started according to the command class:
+   - concurrent jobs (read only commands, see \ref CLI_CMD_MASK_CONCURRENT)
+     run in parallel on all workers.
+   - an exclusive job waits until the running jobs are done, no other job
+     is started while it runs (mutating commands are serialized).
+
+   A job which cannot be started blocks the following jobs, an exclusive
+   job is not starved by a stream of concurrent jobs.
+
+   The queue depth and the wait time of each session are available via
+   \ref cli_pool_queue_walk and as metrics source (\ref cli_pool_metrics).
+
+\remarks
+   - The pool only serializes its own jobs, commands executed directly
+     (console, pipes without pool) are not covered.
+   - The session queues are assigned on the first use and kept (metrics),
+     more than \ref CLI_POOL_MAX_SESSIONS sessions share the queues.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Session of the interactive lane (console, help requests) */
+#define CLI_POOL_SESSION_INTERACTIVE	0xFFFFFFFF
+
+/** Default weight of a session queue */
+#define CLI_POOL_WEIGHT_DEFAULT	10
+
+/** Max weight of a session queue */
+#define CLI_POOL_WEIGHT_MAX	100
+
+/** Forward declaration, executor pool */
+struct cli_pool_s;
+
+/** Job function, called by a worker thread.
+
+\param
+   p_data  user data of the job.
+
+\return
+   result of the job, passed to the completion callback
+*/
+typedef int (*cli_pool_job_fct_t)(
+	void *p_data);
+
+/** Completion callback, called by the worker thread after the job
+   (IFX_ERROR: job not executed, pool released).
+
+\param
+   p_data  user data of the job.
+\param
+   ret  result of the job function.
+*/
+typedef void (*cli_pool_done_fct_t)(
+	void *p_data,
+	int ret);
+
+/** Job of the executor pool, provided by the caller (no allocation), must
+   be valid until the completion callback */
+struct cli_pool_job_s
+{
+	/** job function */
+	cli_pool_job_fct_t job_fct;
+	/** completion callback, IFX_NULL: none */
+	cli_pool_done_fct_t done_fct;
+	/** user data of the job */
+	void *p_data;
+	/** the job may run concurrently with other concurrent jobs */
+	int b_concurrent;
+	/** session of the job (queue), \ref CLI_POOL_SESSION_INTERACTIVE:
+	    interactive lane */
+	unsigned int session;
+	/** internal - submission time [us] */
+	unsigned long long submit_us;
+	/** internal - next job of the queue */
+	struct cli_pool_job_s *p_next;
+};
+
+/** Queue metrics of a session */
+struct cli_pool_queue_stats_s
+{
+	/** session, \ref CLI_POOL_SESSION_INTERACTIVE: interactive lane */
+	unsigned int session;
+	/** weight of the session queue */
+	unsigned int weight;
+	/** number of queued jobs */
+	unsigned int n_queued;
+	/** max number of queued jobs */
+	unsigned int n_queued_max;
+	/** number of started jobs */
+	unsigned long long n_jobs;
+	/** sum of the wait times (submission to start) [us] */
+	unsigned long long wait_sum_us;
+	/** max wait time [us] */
+	unsigned long long wait_max_us;
+};
+
+/** Callback of \ref cli_pool_queue_walk.
+
+\param
+   p_data  user data.
+\param
+   p_stats  queue metrics of a session.
+
+\return
+   0 - continue
+   else - stop
+*/
+typedef int (*cli_pool_queue_walk_fct_t)(
+	void *p_data,
+	const struct cli_pool_queue_stats_s *p_stats);
+
+/** Create an executor pool and start the worker threads.
+
+\param
+   pp_pool  returns the pool.
+\param
+   n_workers  number of worker threads (1 .. \ref CLI_POOL_MAX_WORKERS).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_pool_init(
+	struct cli_pool_s **pp_pool,
+	unsigned int n_workers);
+
+/** Stop the worker threads and release the pool, queued jobs are
+   completed with IFX_ERROR (not executed).
+
+\param
+   pp_pool  pool to release.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_pool_release(
+	struct cli_pool_s **pp_pool);
+
+/** Queue a job.
+
+\param
+   p_pool  executor pool.
+\param
+   p_job  job, the completion callback reports the result.
+
+\return
+   IFX_SUCCESS - job queued
+   IFX_ERROR - failed (pool released).
+*/
+extern int cli_pool_submit(
+	struct cli_pool_s *p_pool,
+	struct cli_pool_job_s *p_job);
+
+/** Queue a job and wait for the completion.
+
+\param
+   p_pool  executor pool.
+\param
+   session  session of the job, \ref CLI_POOL_SESSION_INTERACTIVE:
+      interactive lane.
+\param
+   job_fct  job function.
+\param
+   p_data  user data of the job.
+\param
+   b_concurrent  the job may run concurrently with other concurrent jobs.
+
+\return
+   result of the job function
+   IFX_ERROR - not executed.
+*/
+extern int cli_pool_run(
+	struct cli_pool_s *p_pool,
+	unsigned int session,
+	cli_pool_job_fct_t job_fct,
+	void *p_data,
+	int b_concurrent);
+
+/** Execute command lines by the pool, printout to a file (file out mode).
+   The lines run concurrently if all commands are registered with
+   \ref CLI_CMD_MASK_CONCURRENT, help requests are executed by the
+   interactive lane (see \ref cli_core_cmd_interactive_get).
+
+\param
+   p_pool  executor pool.
+\param
+   session  session of the job.
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_cmd_lines  command lines (separated by line ends), modified.
+\param
+   p_file_io  output file.
+
+\return
+   see \ref cli_core_cmd_exec__file (last line)
+*/
+extern int cli_pool_cmd_exec__file(
+	struct cli_pool_s *p_pool,
+	unsigned int session,
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_lines,
+	clios_file_io_t *p_file_io);
+
+/** Set the weight of a session queue (weighted fair queueing).
+
+\param
+   p_pool  executor pool.
+\param
+   session  session.
+\param
+   weight  weight (1 .. \ref CLI_POOL_WEIGHT_MAX), a session with the
+      double weight gets twice the number of job starts.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (invalid weight, interactive lane).
+*/
+extern int cli_pool_session_weight_set(
+	struct cli_pool_s *p_pool,
+	unsigned int session,
+	unsigned int weight);
+
+/** Walk through the queue metrics (interactive lane, then the sessions).
+
+\param
+   p_pool  executor pool.
+\param
+   walk_fct  callback, called for each queue without the pool lock.
+\param
+   p_data  user data for the callback.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_pool_queue_walk(
+	struct cli_pool_s *p_pool,
+	cli_pool_queue_walk_fct_t walk_fct,
+	void *p_data);
+
+#if (CLI_SUPPORT_METRICS == 1)
+struct cli_metrics_s;
+
+/** Metrics source of the pool: workers, running jobs, queue depth and
+   wait time per session (see cli_core_metrics_source_add).
+
+\param
+   p_data  executor pool.
+\param
+   p_metrics  render context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_pool_metrics(
+	void *p_data,
+	struct cli_metrics_s *p_metrics);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_POOL_H */
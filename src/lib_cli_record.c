@@ -0,0 +1,495 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_record.c
+   Command Line Interface - command recording (binary log)
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_RECORD == 1)
+#include "lib_cli_record.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** max size of a LEB128 varint (64 bit) */
+#define CLI_RECORD_VARINT_MAX	10
+
+/** max size of an entry: 4 varints, key length + key, args length + args */
+#define CLI_RECORD_ENTRY_MAX \
+	(3 * CLI_RECORD_VARINT_MAX + 2 * CLI_RECORD_VARINT_MAX + \
+	 CLI_RECORD_KEY_MAX + CLI_RECORD_ARGS_MAX)
+
+/** Recorder context */
+struct cli_record_s
+{
+	/** protects the buffer and the time base */
+	IFXOS_lock_t lock;
+	/** log file */
+	int fd;
+	/** start time [us since epoch] */
+	unsigned long long start_us;
+	/** start time [us] (monotonic), base of the time deltas */
+	unsigned long long start_mono_us;
+	/** time of the previous entry [us] (monotonic) */
+	unsigned long long last_mono_us;
+	/** number of recorded entries */
+	unsigned long long n_entries;
+	/** number of lost entries */
+	unsigned long long n_lost;
+	/** number of written bytes (without the buffer) */
+	unsigned long long n_written;
+	/** number of buffered bytes */
+	unsigned int len;
+	/** entry buffer, CLI_RECORD_BUFFER_SIZE bytes */
+	unsigned char *p_buf;
+};
+
+CLI_STATIC unsigned long long record_time_us_get(
+	clockid_t clock_id)
+{
+	struct timespec ts;
+
+	if (clios_clock_gettime(clock_id, &ts) != 0)
+		return 0;
+
+	return (unsigned long long)ts.tv_sec * 1000000ULL +
+		(unsigned long long)(ts.tv_nsec / 1000);
+}
+
+CLI_STATIC unsigned int record_varint_put(
+	unsigned char *p_dst,
+	unsigned long long val)
+{
+	unsigned int n = 0;
+
+	while (val >= 0x80)
+	{
+		p_dst[n++] = (unsigned char)(val | 0x80);
+		val >>= 7;
+	}
+	p_dst[n++] = (unsigned char)val;
+
+	return n;
+}
+
+/* returns the number of used bytes, 0 if incomplete or invalid */
+CLI_STATIC unsigned int record_varint_get(
+	const unsigned char *p_src,
+	unsigned int len,
+	unsigned long long *p_val)
+{
+	unsigned long long val = 0;
+	unsigned int n;
+
+	for (n = 0; (n < len) && (n < CLI_RECORD_VARINT_MAX); n++)
+	{
+		val |= (unsigned long long)(p_src[n] & 0x7F) << (7 * n);
+		if ((p_src[n] & 0x80) == 0)
+		{
+			*p_val = val;
+			return n + 1;
+		}
+	}
+
+	return 0;
+}
+
+CLI_STATIC int record_write(
+	int fd,
+	const unsigned char *p_data,
+	unsigned int len)
+{
+	int ret;
+
+	while (len > 0)
+	{
+		ret = (int)clios_write(fd, p_data, len);
+		if (ret <= 0)
+		{
+			if ((ret < 0) && (errno == EINTR))
+				continue;
+			return IFX_ERROR;
+		}
+		p_data += ret;
+		len -= (unsigned int)ret;
+	}
+
+	return IFX_SUCCESS;
+}
+
+/* caller holds the lock */
+CLI_STATIC int record_buffer_flush(
+	struct cli_record_s *p_record)
+{
+	int ret;
+
+	if (p_record->len == 0)
+		return IFX_SUCCESS;
+
+	ret = record_write(p_record->fd, p_record->p_buf, p_record->len);
+	if (ret == IFX_SUCCESS)
+		p_record->n_written += p_record->len;
+	p_record->len = 0;
+
+	return ret;
+}
+
+int cli_record_open(
+	const char *p_path,
+	struct cli_record_s **pp_record)
+{
+	struct cli_record_s *p_record;
+	unsigned char header[CLI_RECORD_HEADER_SIZE];
+	unsigned int i;
+
+	if ((p_path == IFX_NULL) || (pp_record == IFX_NULL) || (*pp_record != IFX_NULL))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Record: open - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	p_record = (struct cli_record_s *)clios_memalloc(
+		sizeof(struct cli_record_s) + CLI_RECORD_BUFFER_SIZE);
+	if (p_record == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Record: open - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_record, 0x00, sizeof(struct cli_record_s));
+	p_record->p_buf = (unsigned char *)(p_record + 1);
+
+	p_record->fd = clios_open(p_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (p_record->fd < 0)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Record: open - cannot create %s" CLI_CRLF, p_path));
+		clios_memfree(p_record);
+		return IFX_ERROR;
+	}
+
+	p_record->start_us = record_time_us_get(CLOCK_REALTIME);
+	p_record->start_mono_us = record_time_us_get(CLOCK_MONOTONIC);
+	p_record->last_mono_us = p_record->start_mono_us;
+
+	clios_memset(header, 0x00, sizeof(header));
+	clios_memcpy(header, CLI_RECORD_MAGIC, 6);
+	header[6] = CLI_RECORD_VERSION;
+	for (i = 0; i < 8; i++)
+		header[8 + i] = (unsigned char)(p_record->start_us >> (8 * i));
+
+	if (record_write(p_record->fd, header, sizeof(header)) != IFX_SUCCESS)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Record: open - write %s" CLI_CRLF, p_path));
+		(void)clios_close(p_record->fd);
+		clios_memfree(p_record);
+		return IFX_ERROR;
+	}
+	p_record->n_written = sizeof(header);
+
+	(void)clios_lockinit(&p_record->lock, "cli_record", 0);
+
+	*pp_record = p_record;
+	return IFX_SUCCESS;
+}
+
+int cli_record_close(
+	struct cli_record_s **pp_record)
+{
+	struct cli_record_s *p_record;
+	int ret;
+
+	if ((pp_record == IFX_NULL) || (*pp_record == IFX_NULL))
+		return IFX_ERROR;
+	p_record = *pp_record;
+
+	(void)clios_lockget(&p_record->lock);
+	ret = record_buffer_flush(p_record);
+	(void)clios_lockrelease(&p_record->lock);
+
+	if (clios_close(p_record->fd) != 0)
+		ret = IFX_ERROR;
+	(void)clios_lockdelete(&p_record->lock);
+	clios_memfree(p_record);
+	*pp_record = IFX_NULL;
+
+	return ret;
+}
+
+int cli_record_append(
+	struct cli_record_s *p_record,
+	int session,
+	unsigned int inst,
+	const char *p_key,
+	const char *p_args)
+{
+	unsigned char *p_dst;
+	unsigned long long now_us;
+	unsigned int key_len, args_len;
+	int ret = IFX_SUCCESS;
+
+	if ((p_record == IFX_NULL) || (p_key == IFX_NULL))
+		return IFX_ERROR;
+
+	key_len = (unsigned int)clios_strlen(p_key);
+	if (key_len > CLI_RECORD_KEY_MAX)
+		key_len = CLI_RECORD_KEY_MAX;
+	args_len = (p_args != IFX_NULL) ? (unsigned int)clios_strlen(p_args) : 0;
+	if (args_len > CLI_RECORD_ARGS_MAX)
+		args_len = CLI_RECORD_ARGS_MAX;
+
+	(void)clios_lockget(&p_record->lock);
+
+	if (p_record->len + CLI_RECORD_ENTRY_MAX > CLI_RECORD_BUFFER_SIZE)
+		ret = record_buffer_flush(p_record);
+
+	if (ret != IFX_SUCCESS)
+	{
+		p_record->n_lost++;
+		(void)clios_lockrelease(&p_record->lock);
+		return IFX_ERROR;
+	}
+
+	/* the time is taken under the lock, the deltas are never negative */
+	now_us = record_time_us_get(CLOCK_MONOTONIC);
+	if (now_us < p_record->last_mono_us)
+		now_us = p_record->last_mono_us;
+
+	p_dst = p_record->p_buf + p_record->len;
+	p_dst += record_varint_put(p_dst, now_us - p_record->last_mono_us);
+	p_dst += record_varint_put(p_dst, (session < 0) ? 0ULL : (unsigned long long)session + 1);
+	p_dst += record_varint_put(p_dst, inst);
+	p_dst += record_varint_put(p_dst, key_len);
+	clios_memcpy(p_dst, p_key, key_len);
+	p_dst += key_len;
+	p_dst += record_varint_put(p_dst, args_len);
+	if (args_len > 0)
+		clios_memcpy(p_dst, p_args, args_len);
+	p_dst += args_len;
+
+	p_record->len = (unsigned int)(p_dst - p_record->p_buf);
+	p_record->last_mono_us = now_us;
+	p_record->n_entries++;
+
+	(void)clios_lockrelease(&p_record->lock);
+
+	return IFX_SUCCESS;
+}
+
+int cli_record_flush(
+	struct cli_record_s *p_record)
+{
+	int ret;
+
+	if (p_record == IFX_NULL)
+		return IFX_ERROR;
+
+	(void)clios_lockget(&p_record->lock);
+	ret = record_buffer_flush(p_record);
+	(void)clios_lockrelease(&p_record->lock);
+
+	return ret;
+}
+
+int cli_record_counters_get(
+	struct cli_record_s *p_record,
+	unsigned long long *p_entries,
+	unsigned long long *p_lost,
+	unsigned long long *p_bytes)
+{
+	if (p_record == IFX_NULL)
+		return IFX_ERROR;
+
+	(void)clios_lockget(&p_record->lock);
+	if (p_entries != IFX_NULL)
+		*p_entries = p_record->n_entries;
+	if (p_lost != IFX_NULL)
+		*p_lost = p_record->n_lost;
+	if (p_bytes != IFX_NULL)
+		*p_bytes = p_record->n_written + p_record->len;
+	(void)clios_lockrelease(&p_record->lock);
+
+	return IFX_SUCCESS;
+}
+
+/**
+   Decode one entry.
+
+\return
+   number of used bytes, 0: incomplete, IFX_ERROR: invalid entry
+*/
+CLI_STATIC int record_entry_decode(
+	unsigned char *p_src,
+	unsigned int len,
+	unsigned long long *p_delta_us,
+	struct cli_record_entry_s *p_entry,
+	char *p_key,
+	char *p_args)
+{
+	unsigned long long val[4];
+	unsigned int pos = 0, n, i;
+
+	for (i = 0; i < 4; i++)
+	{
+		n = record_varint_get(p_src + pos, len - pos, &val[i]);
+		if (n == 0)
+			return (len - pos >= CLI_RECORD_VARINT_MAX) ? IFX_ERROR : 0;
+		pos += n;
+	}
+	if (val[3] > CLI_RECORD_KEY_MAX)
+		return IFX_ERROR;
+	if (len - pos < val[3])
+		return 0;
+	clios_memcpy(p_key, p_src + pos, (unsigned int)val[3]);
+	p_key[val[3]] = '\0';
+	pos += (unsigned int)val[3];
+
+	n = record_varint_get(p_src + pos, len - pos, &val[3]);
+	if (n == 0)
+		return (len - pos >= CLI_RECORD_VARINT_MAX) ? IFX_ERROR : 0;
+	pos += n;
+	if (val[3] > CLI_RECORD_ARGS_MAX)
+		return IFX_ERROR;
+	if (len - pos < val[3])
+		return 0;
+	clios_memcpy(p_args, p_src + pos, (unsigned int)val[3]);
+	p_args[val[3]] = '\0';
+	pos += (unsigned int)val[3];
+
+	*p_delta_us = val[0];
+	p_entry->session = (val[1] == 0) ? -1 : (int)(val[1] - 1);
+	p_entry->inst = (unsigned int)val[2];
+
+	return (int)pos;
+}
+
+int cli_record_read(
+	const char *p_path,
+	cli_record_read_fct_t read_fct,
+	void *p_data)
+{
+	struct cli_record_entry_s entry;
+	unsigned char *p_buf;
+	char *p_key, *p_args;
+	unsigned long long start_us = 0, delta_us = 0;
+	unsigned int len = 0, pos, i;
+	int fd, n = 0, n_entries = 0, b_eof = 0;
+
+	if ((p_path == IFX_NULL) || (read_fct == IFX_NULL))
+		return IFX_ERROR;
+
+	fd = clios_open(p_path, O_RDONLY);
+	if (fd < 0)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Record: read - cannot open %s" CLI_CRLF, p_path));
+		return IFX_ERROR;
+	}
+
+	p_buf = (unsigned char *)clios_memalloc(
+		CLI_RECORD_BUFFER_SIZE + CLI_RECORD_KEY_MAX + CLI_RECORD_ARGS_MAX + 2);
+	if (p_buf == IFX_NULL)
+	{
+		(void)clios_close(fd);
+		return IFX_ERROR;
+	}
+	p_key = (char *)p_buf + CLI_RECORD_BUFFER_SIZE;
+	p_args = p_key + CLI_RECORD_KEY_MAX + 1;
+
+	clios_memset(&entry, 0x00, sizeof(entry));
+	entry.p_key = p_key;
+	entry.p_args = p_args;
+
+	/* header */
+	if ((clios_read(fd, p_buf, CLI_RECORD_HEADER_SIZE) != CLI_RECORD_HEADER_SIZE) ||
+	    (clios_memcmp(p_buf, CLI_RECORD_MAGIC, 6) != 0) || (p_buf[6] != CLI_RECORD_VERSION))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Record: read - %s is no record log" CLI_CRLF, p_path));
+		n_entries = IFX_ERROR;
+		b_eof = 1;
+	}
+	for (i = 0; i < 8; i++)
+		start_us |= (unsigned long long)p_buf[8 + i] << (8 * i);
+
+	while (!b_eof || (len > 0))
+	{
+		/* refill, an entry never exceeds the buffer */
+		if (!b_eof && (len < CLI_RECORD_ENTRY_MAX))
+		{
+			n = (int)clios_read(fd, p_buf + len, CLI_RECORD_BUFFER_SIZE - len);
+			if (n < 0)
+			{
+				if (errno == EINTR)
+					continue;
+				n_entries = IFX_ERROR;
+				break;
+			}
+			if (n == 0)
+				b_eof = 1;
+			len += (unsigned int)n;
+		}
+
+		for (pos = 0; pos < len; pos += (unsigned int)n)
+		{
+			n = record_entry_decode(p_buf + pos, len - pos, &delta_us, &entry, p_key, p_args);
+			if (n <= 0)
+				break;
+
+			entry.offset_us += delta_us;
+			entry.time_us = start_us + entry.offset_us;
+			n_entries++;
+			if (read_fct(p_data, &entry) != 0)
+			{
+				b_eof = 1;
+				len = 0;
+				break;
+			}
+		}
+		if (n < 0)
+		{
+			CLI_USR_ERR(LIB_CLI, ("ERR CLI Record: read - invalid entry %d" CLI_CRLF, n_entries));
+			n_entries = IFX_ERROR;
+			break;
+		}
+		if (len == 0)
+			break;
+
+		/* keep the incomplete entry */
+		if (pos > 0)
+		{
+			clios_memmove(p_buf, p_buf + pos, len - pos);
+			len -= pos;
+		}
+		else if (b_eof)
+		{
+			/* truncated log (for example not stopped), take the complete entries */
+			break;
+		}
+		else if (len >= CLI_RECORD_ENTRY_MAX)
+		{
+			n_entries = IFX_ERROR;
+			break;
+		}
+	}
+
+	clios_memfree(p_buf);
+	(void)clios_close(fd);
+
+	return n_entries;
+}
+
+#endif	/* #if (CLI_SUPPORT_RECORD == 1) */
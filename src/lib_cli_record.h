@@ -0,0 +1,257 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_RECORD_H
+#define _LIB_CLI_RECORD_H
+
+/**
+   \file lib_cli_record.h
+   Command Line Interface - command recording and replay
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_RECORD CLI Command Recording
+
+   All command lines executed by a CLI core are written to a compact binary
+   log, together with the time and the session (pipe number, see
+   \ref cli_trace_session_set). The log is replayed against a freshly set-up
+   CLI core with \ref cli_core_record_replay (or the tool "cli_replay"),
+   either with the original pacing or as fast as possible.
+
+   Log format (all numbers little endian):
+   - header (16 bytes): "CLIREC", version (1 byte), reserved (1 byte),
+     start time [us since epoch] (8 bytes)
+   - per entry, the numbers as LEB128 varints:
+     time delta to the previous entry [us], session + 1 (0: none),
+     core instance, key length, key, argument length, arguments
+
+\remarks
+   - The entries are collected in a buffer and written if the buffer is
+     full, on \ref cli_core_record_stop and on release of the CLI core.
+   - Arguments longer than \ref CLI_RECORD_ARGS_MAX are truncated.
+   - The built-in command "record start <name>" writes only within the
+     directory set by \ref cli_core_file_dir_set.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** record log file magic */
+#define CLI_RECORD_MAGIC	"CLIREC"
+/** record log file format version */
+#define CLI_RECORD_VERSION	1
+/** record log file header size */
+#define CLI_RECORD_HEADER_SIZE	16
+
+/** Forward declaration, recorder context */
+struct cli_record_s;
+
+/** Recorded command line */
+struct cli_record_entry_s
+{
+	/** execution time [us since epoch] */
+	unsigned long long time_us;
+	/** execution time relative to the start of the recording [us] */
+	unsigned long long offset_us;
+	/** session number (pipe number), -1: none */
+	int session;
+	/** CLI core instance */
+	unsigned int inst;
+	/** command key */
+	const char *p_key;
+	/** command arguments */
+	const char *p_args;
+};
+
+/** Record read callback, called for each entry of the log.
+
+\param
+   p_data  user data, given with the read call.
+\param
+   p_entry  recorded command line.
+
+\return
+   0 - continue
+   else - stop reading
+*/
+typedef int (*cli_record_read_fct_t)(
+	void *p_data,
+	const struct cli_record_entry_s *p_entry);
+
+/** Create a record log file.
+
+\param
+   p_path  path of the log file (an existing file is replaced).
+\param
+   pp_record  returns the recorder context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_record_open(
+	const char *p_path,
+	struct cli_record_s **pp_record);
+
+/** Write the buffered entries and close the record log file.
+
+\param
+   pp_record  recorder context, set to IFX_NULL.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (write error).
+*/
+extern int cli_record_close(
+	struct cli_record_s **pp_record);
+
+/** Add a command line to the record log.
+
+\param
+   p_record  recorder context.
+\param
+   session  session number, -1: none.
+\param
+   inst  CLI core instance.
+\param
+   p_key  command key.
+\param
+   p_args  command arguments (IFX_NULL: none).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (write error, the entry is lost).
+*/
+extern int cli_record_append(
+	struct cli_record_s *p_record,
+	int session,
+	unsigned int inst,
+	const char *p_key,
+	const char *p_args);
+
+/** Write the buffered entries to the log file.
+
+\param
+   p_record  recorder context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_record_flush(
+	struct cli_record_s *p_record);
+
+/** Get the counters of the recorder.
+
+\param
+   p_record  recorder context.
+\param
+   p_entries  returns the number of recorded entries.
+\param
+   p_lost  returns the number of lost entries (write error).
+\param
+   p_bytes  returns the size of the log (including the buffered entries).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_record_counters_get(
+	struct cli_record_s *p_record,
+	unsigned long long *p_entries,
+	unsigned long long *p_lost,
+	unsigned long long *p_bytes);
+
+/** Read a record log file.
+
+\param
+   p_path  path of the log file.
+\param
+   read_fct  callback, called for each entry.
+\param
+   p_data  user data for the callback.
+
+\return
+   number of read entries
+   IFX_ERROR - failed (no record log file or corrupted entry).
+*/
+extern int cli_record_read(
+	const char *p_path,
+	cli_record_read_fct_t read_fct,
+	void *p_data);
+
+/** Start the recording of all command lines executed by the given CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_path  path of the log file (an existing file is replaced).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (already recording or file error).
+*/
+extern int cli_core_record_start(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_path);
+
+/** Stop the recording, the buffered entries are written.
+
+\param
+   p_core_ctx  CLI context pointer.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_core_record_stop(
+	struct cli_core_context_s *p_core_ctx);
+
+/** Replay a record log against the given CLI core, in the calling thread.
+
+\remarks
+   The entries are executed in the recorded order. The session number of
+   an entry is set for the calling thread (see \ref cli_trace_session_set).
+   The built-in command "quit" is skipped.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_path  path of the log file.
+\param
+   speed  pacing in percent of the original speed (100: original pacing,
+          200: twice as fast), 0: as fast as possible.
+\param
+   p_out  output of the commands (file printout mode only, IFX_NULL: the
+          output is discarded).
+
+\return
+   number of executed entries
+   IFX_ERROR - failed.
+*/
+extern int cli_core_record_replay(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_path,
+	unsigned int speed,
+	clios_file_io_t *p_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_RECORD_H */
@@ -0,0 +1,242 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_SESSION_H
+#define _LIB_CLI_SESSION_H
+
+/**
+   \file lib_cli_session.h
+   Command Line Interface - sessions on a shared command table
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_SESSION CLI Sessions
+
+   A session is a small per client object on an active CLI core: handler
+   user data, instance number and event subscription. All sessions share
+   the command table of the CLI core (search tree, groups, indexes), the
+   table is not changed while sessions exist (no lock on the dispatch).
+   A \ref cli_core_clone creates a complete CLI core per instance instead
+   (own lock, statistics, hooks, flight recorder).
+
+   - the handlers of the user commands are called with the user data of
+     the session, the built-in commands get the CLI core as before.
+   - the session of a command execution is part of the execution context
+     (\ref cli_exec_ctx_s, \ref cli_session_get).
+   - each session holds a reference to the CLI core, the release of the
+     CLI core (\ref cli_core_release) is deferred until the last session
+     is closed. Sessions and CLI core can be released in any order.
+
+\remarks
+   - The statistics, the flight recorder and the hooks of the CLI core
+     cover the executions of all its sessions.
+   - The event callbacks are called without a lock of the CLI core, a
+     callback may subscribe, open or close sessions. The unsubscribe and
+     the close wait until the running callbacks of the session are done
+     (except for a call from within the callback).
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+#	include "lib_cli_struct_out.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Event callback of a session.
+
+\param
+   p_data  user data, given with \ref cli_session_subscribe.
+\param
+   p_event  event text.
+
+\return
+   ignored
+*/
+typedef int (*cli_session_event_fct_t)(
+	void *p_data,
+	char *p_event);
+
+/** Open a session on an active CLI core.
+
+\param
+   p_core_ctx  CLI context pointer (CLI core or clone).
+\param
+   inst_num  instance number of the session.
+\param
+   p_user_fct_data  user data, provided with each user command call of
+      the session.
+\param
+   pp_session  returns the session.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (CLI core not active or released, no memory).
+*/
+extern int cli_session_open(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int inst_num,
+	void *p_user_fct_data,
+	struct cli_session_s **pp_session);
+
+/** Close a session, a deferred release of the CLI core is done with the
+   last session.
+
+\param
+   pp_session  session to close.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_session_close(
+	struct cli_session_s **pp_session);
+
+/** Subscribe a session to the events of the CLI core (see cli_user_if_event).
+
+\param
+   p_session  session.
+\param
+   event_fct  event callback, IFX_NULL: unsubscribe.
+\param
+   p_data  user data for the callback.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_session_subscribe(
+	struct cli_session_s *p_session,
+	cli_session_event_fct_t event_fct,
+	void *p_data);
+
+/** Execute a command line within a session, printout to a buffer.
+
+\param
+   p_session  session.
+\param
+   p_cmd_arg_buf  command line, overwritten by the printout.
+\param
+   buffer_size  size of the buffer.
+
+\return
+   see \ref cli_core_cmd_exec__buffer
+*/
+extern int cli_session_cmd_exec__buffer(
+	struct cli_session_s *p_session,
+	char *p_cmd_arg_buf,
+	const unsigned int buffer_size);
+
+/** Execute a command line within a session, printout to a file.
+
+\param
+   p_session  session.
+\param
+   p_cmd_arg_buf  command line.
+\param
+   p_file_io  output file.
+
+\return
+   see \ref cli_core_cmd_exec__file
+*/
+extern int cli_session_cmd_exec__file(
+	struct cli_session_s *p_session,
+	char *p_cmd_arg_buf,
+	clios_file_io_t *p_file_io);
+
+/** Session of the command handler running in the calling thread.
+
+\return
+   session
+   IFX_NULL - no session execution.
+*/
+extern struct cli_session_s *cli_session_get(void);
+
+/** Instance number of a session.
+
+\param
+   p_session  session.
+
+\return
+   instance number given with \ref cli_session_open.
+*/
+extern unsigned int cli_session_inst_num_get(
+	const struct cli_session_s *p_session);
+
+/** User data of a session.
+
+\param
+   p_session  session.
+
+\return
+   user data given with \ref cli_session_open.
+*/
+extern void *cli_session_user_data_get(
+	const struct cli_session_s *p_session);
+
+/** Number of open sessions of a CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+
+\return
+   number of sessions
+*/
+extern unsigned int cli_core_num_of_sessions_get(
+	struct cli_core_context_s *p_core_ctx);
+
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+/** Set the output format of a session, applies to the following command
+   executions of the session (also set by the built-in command "format"
+   within the session). Without text format the commands are executed with
+   \ref cli_core_cmd_exec__struct, the records are written to the output
+   file or buffer of the execution.
+
+\remarks
+   A buffer mode execution returns the records which fit into the buffer,
+   the TLV records contain zero bytes.
+
+\param
+   p_session  session.
+\param
+   format  output format.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_session_format_set(
+	struct cli_session_s *p_session,
+	enum cli_struct_format_e format);
+
+/** Output format of a session.
+
+\param
+   p_session  session.
+
+\return
+   output format (see \ref cli_session_format_set).
+*/
+extern enum cli_struct_format_e cli_session_format_get(
+	const struct cli_session_s *p_session);
+#endif	/* #if (CLI_SUPPORT_STRUCT_OUT == 1) */
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_SESSION_H */
@@ -0,0 +1,206 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_stats.c
+   Command Line Interface - per command statistics
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_STATS == 1)
+#include "lib_cli_stats.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** Statistics context */
+struct cli_stats_s
+{
+	/** number of command entries per shard */
+	unsigned int n_cmds;
+	/** command entries, CLI_STATS_SHARDS x n_cmds */
+	struct cli_cmd_stats_s *p_shards;
+};
+
+/** shard of the current thread (-1: not assigned yet) */
+static clios_thread_local int g_cli_stats_shard = -1;
+/** next shard to assign (round robin) */
+static unsigned int g_cli_stats_shard_next = 0;
+
+CLI_STATIC unsigned int stats_shard_get(void)
+{
+	if (g_cli_stats_shard < 0)
+		g_cli_stats_shard = (int)(clios_atomic_fetch_add(
+			&g_cli_stats_shard_next, 1U) % CLI_STATS_SHARDS);
+
+	return (unsigned int)g_cli_stats_shard;
+}
+
+CLI_STATIC unsigned int stats_bucket_get(
+	unsigned long long time_us)
+{
+	unsigned int bucket = 0;
+
+	while ((time_us != 0) && (bucket < (CLI_STATS_HIST_BUCKETS - 1)))
+	{
+		time_us >>= 1;
+		bucket++;
+	}
+
+	return bucket;
+}
+
+int cli_stats_init(
+	struct cli_stats_s **pp_stats,
+	unsigned int n_cmds)
+{
+	struct cli_stats_s *p_stats;
+	size_t size;
+
+	if ((pp_stats == IFX_NULL) || (*pp_stats != IFX_NULL) || (n_cmds == 0))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Stats: init - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	size = sizeof(struct cli_stats_s) +
+		(size_t)CLI_STATS_SHARDS * n_cmds * sizeof(struct cli_cmd_stats_s);
+	p_stats = (struct cli_stats_s *)clios_memalloc(size);
+	if (p_stats == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Stats: init - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_stats, 0x00, size);
+
+	p_stats->n_cmds = n_cmds;
+	p_stats->p_shards = (struct cli_cmd_stats_s *)(p_stats + 1);
+
+	*pp_stats = p_stats;
+	return IFX_SUCCESS;
+}
+
+int cli_stats_release(
+	struct cli_stats_s **pp_stats)
+{
+	if ((pp_stats == IFX_NULL) || (*pp_stats == IFX_NULL))
+		return IFX_ERROR;
+
+	clios_memfree(*pp_stats);
+	*pp_stats = IFX_NULL;
+
+	return IFX_SUCCESS;
+}
+
+unsigned long cli_stats_mem_size_get(
+	const struct cli_stats_s *p_stats)
+{
+	if (p_stats == IFX_NULL)
+		return 0;
+
+	return (unsigned long)(sizeof(struct cli_stats_s) +
+		(size_t)CLI_STATS_SHARDS * p_stats->n_cmds * sizeof(struct cli_cmd_stats_s));
+}
+
+void cli_stats_record(
+	struct cli_stats_s *p_stats,
+	unsigned int cmd_idx,
+	unsigned long long time_us,
+	int ret)
+{
+	struct cli_cmd_stats_s *p_entry;
+
+	if ((p_stats == IFX_NULL) || (cmd_idx >= p_stats->n_cmds))
+		return;
+
+	p_entry = &p_stats->p_shards[stats_shard_get() * p_stats->n_cmds + cmd_idx];
+
+	clios_atomic_add_relaxed(&p_entry->n_calls, 1ULL);
+	if (ret < 0)
+		clios_atomic_add_relaxed(&p_entry->n_errors, 1ULL);
+	else
+		clios_atomic_add_relaxed(&p_entry->out_bytes, (unsigned long long)ret);
+	clios_atomic_add_relaxed(&p_entry->time_sum_us, time_us);
+	clios_atomic_add_relaxed(&p_entry->hist[stats_bucket_get(time_us)], 1U);
+}
+
+int cli_stats_read(
+	struct cli_stats_s *p_stats,
+	unsigned int cmd_idx,
+	struct cli_cmd_stats_s *p_cmd_stats)
+{
+	struct cli_cmd_stats_s *p_entry;
+	unsigned int shard, bucket;
+
+	if ((p_stats == IFX_NULL) || (p_cmd_stats == IFX_NULL) ||
+	    (cmd_idx >= p_stats->n_cmds))
+		return IFX_ERROR;
+
+	clios_memset(p_cmd_stats, 0x00, sizeof(struct cli_cmd_stats_s));
+
+	for (shard = 0; shard < CLI_STATS_SHARDS; shard++)
+	{
+		p_entry = &p_stats->p_shards[shard * p_stats->n_cmds + cmd_idx];
+
+		p_cmd_stats->n_calls += clios_atomic_load_relaxed(&p_entry->n_calls);
+		p_cmd_stats->n_errors += clios_atomic_load_relaxed(&p_entry->n_errors);
+		p_cmd_stats->out_bytes += clios_atomic_load_relaxed(&p_entry->out_bytes);
+		p_cmd_stats->time_sum_us += clios_atomic_load_relaxed(&p_entry->time_sum_us);
+		for (bucket = 0; bucket < CLI_STATS_HIST_BUCKETS; bucket++)
+			p_cmd_stats->hist[bucket] += clios_atomic_load_relaxed(&p_entry->hist[bucket]);
+	}
+
+	return IFX_SUCCESS;
+}
+
+int cli_stats_reset(
+	struct cli_stats_s *p_stats)
+{
+	if (p_stats == IFX_NULL)
+		return IFX_ERROR;
+
+	clios_memset(p_stats->p_shards, 0x00,
+		(size_t)CLI_STATS_SHARDS * p_stats->n_cmds * sizeof(struct cli_cmd_stats_s));
+
+	return IFX_SUCCESS;
+}
+
+unsigned long long cli_stats_percentile_us(
+	const struct cli_cmd_stats_s *p_cmd_stats,
+	unsigned int permille)
+{
+	unsigned long long n_calls = 0, limit, sum = 0;
+	unsigned int bucket;
+
+	for (bucket = 0; bucket < CLI_STATS_HIST_BUCKETS; bucket++)
+		n_calls += p_cmd_stats->hist[bucket];
+	if (n_calls == 0)
+		return 0;
+
+	limit = (n_calls * permille + 999) / 1000;
+	for (bucket = 0; bucket < (CLI_STATS_HIST_BUCKETS - 1); bucket++)
+	{
+		sum += p_cmd_stats->hist[bucket];
+		if (sum >= limit)
+			return CLI_STATS_HIST_BOUND_US(bucket);
+	}
+
+	return CLI_STATS_HIST_BOUND_US(CLI_STATS_HIST_BUCKETS - 2);
+}
+
+#endif	/* #if (CLI_SUPPORT_STATS == 1) */
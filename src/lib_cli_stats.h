@@ -0,0 +1,246 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_STATS_H
+#define _LIB_CLI_STATS_H
+
+/**
+   \file lib_cli_stats.h
+   Command Line Interface - per command statistics
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_STATS CLI Command Statistics
+
+   The CLI core counts for each command the number of calls, the number of
+   failed calls (return value < 0), the number of output bytes (return value
+   >= 0) and the execution time within a log2 histogram.
+
+   The counters are kept within several shards, each thread updates "its"
+   shard with relaxed atomic operations - no lock is taken while a command
+   is executed. The shards are summed up on read.
+
+   The statistics are available via \ref cli_core_stats_get,
+   \ref cli_core_stats_walk and the built-in command "stats".
+
+\remarks
+   A reset during command execution may lose single counts.
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Upper bound (exclusive) of a latency histogram bucket [us].
+   Bucket 0 counts executions below 1 us, bucket i the range
+   [2^(i-1), 2^i) us, the last bucket has no upper bound. */
+#define CLI_STATS_HIST_BOUND_US(bucket)	(1ULL << (bucket))
+
+/** Statistics of a single command */
+struct cli_cmd_stats_s
+{
+	/** number of calls */
+	unsigned long long n_calls;
+	/** number of failed calls */
+	unsigned long long n_errors;
+	/** number of output bytes */
+	unsigned long long out_bytes;
+	/** sum of the execution times [us] */
+	unsigned long long time_sum_us;
+	/** execution time histogram, see \ref CLI_STATS_HIST_BOUND_US */
+	unsigned int hist[CLI_STATS_HIST_BUCKETS];
+};
+
+/** Forward declaration, statistics context */
+struct cli_stats_s;
+
+/** Statistics walk callback, called for each command.
+
+\param
+   p_data  user data, given with the walk call.
+\param
+   p_short_name  short name of the command.
+\param
+   p_long_name  long name of the command.
+\param
+   p_stats  statistics of the command.
+
+\return
+   0 - continue
+   else - stop
+*/
+typedef int (*cli_stats_walk_fct_t)(
+	void *p_data,
+	const char *p_short_name,
+	const char *p_long_name,
+	const struct cli_cmd_stats_s *p_stats);
+
+/** Create a statistics context.
+
+\param
+   pp_stats  returns the statistics context.
+\param
+   n_cmds  number of command entries (index 0 counts unknown commands).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_stats_init(
+	struct cli_stats_s **pp_stats,
+	unsigned int n_cmds);
+
+/** Release a statistics context.
+
+\param
+   pp_stats  contains the statistics context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_stats_release(
+	struct cli_stats_s **pp_stats);
+
+/** Get the memory size of a statistics context.
+
+\param
+   p_stats  statistics context.
+
+\return
+   allocated size [byte]
+*/
+extern unsigned long cli_stats_mem_size_get(
+	const struct cli_stats_s *p_stats);
+
+/** Count a command execution (lock-free).
+
+\param
+   p_stats  statistics context.
+\param
+   cmd_idx  command index.
+\param
+   time_us  execution time [us].
+\param
+   ret  return value of the command (< 0: error, else number of output bytes).
+*/
+extern void cli_stats_record(
+	struct cli_stats_s *p_stats,
+	unsigned int cmd_idx,
+	unsigned long long time_us,
+	int ret);
+
+/** Read the statistics of a command (sum of all shards).
+
+\param
+   p_stats  statistics context.
+\param
+   cmd_idx  command index.
+\param
+   p_cmd_stats  returns the statistics.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - invalid index.
+*/
+extern int cli_stats_read(
+	struct cli_stats_s *p_stats,
+	unsigned int cmd_idx,
+	struct cli_cmd_stats_s *p_cmd_stats);
+
+/** Reset all statistics.
+
+\param
+   p_stats  statistics context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_stats_reset(
+	struct cli_stats_s *p_stats);
+
+/** Estimate a percentile of the execution time from the histogram.
+
+\param
+   p_cmd_stats  command statistics.
+\param
+   permille  requested percentile [1/1000], for example 990 for p99.
+
+\return
+   upper bound of the histogram bucket [us] which contains the percentile
+   (0 if no calls, the lower bound of the last bucket if the percentile
+   falls into the open bucket)
+*/
+extern unsigned long long cli_stats_percentile_us(
+	const struct cli_cmd_stats_s *p_cmd_stats,
+	unsigned int permille);
+
+/** Get the statistics of a command of the given CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_name  short or long command name, IFX_NULL: unknown commands.
+\param
+   p_cmd_stats  returns the statistics.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (unknown command, statistics not active).
+*/
+extern int cli_core_stats_get(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_name,
+	struct cli_cmd_stats_s *p_cmd_stats);
+
+/** Walk over the statistics of all commands of the given CLI core
+   (in alphabetical order of the short names).
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   walk_fct  callback, called for each command.
+\param
+   p_data  user data for the callback.
+
+\return
+   number of walked commands
+   IFX_ERROR - failed (statistics not active).
+*/
+extern int cli_core_stats_walk(
+	struct cli_core_context_s *p_core_ctx,
+	cli_stats_walk_fct_t walk_fct,
+	void *p_data);
+
+/** Reset the statistics of all commands of the given CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_core_stats_reset(
+	struct cli_core_context_s *p_core_ctx);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_STATS_H */
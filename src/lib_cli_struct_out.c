@@ -0,0 +1,587 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_struct_out.c
+   Command Line Interface - structured machine output
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_STRUCT_OUT == 1)
+#include "lib_cli_out_sink.h"
+#include "lib_cli_struct_out.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** structured output of the command handler running in this thread */
+static clios_thread_local struct cli_struct_out_s *g_p_cli_struct_out_active = IFX_NULL;
+
+/** output format of the session running in this thread */
+static clios_thread_local enum cli_struct_format_e g_cli_struct_session_format =
+	cli_struct_format_text;
+
+static const char g_cli_struct_hex[] = "0123456789abcdef";
+
+CLI_STATIC void struct_be32_put(
+	char *p_dst,
+	unsigned int val)
+{
+	p_dst[0] = (char)(val >> 24);
+	p_dst[1] = (char)(val >> 16);
+	p_dst[2] = (char)(val >> 8);
+	p_dst[3] = (char)val;
+}
+
+CLI_STATIC void struct_be64_put(
+	char *p_dst,
+	unsigned long long val)
+{
+	struct_be32_put(p_dst, (unsigned int)(val >> 32));
+	struct_be32_put(p_dst + 4, (unsigned int)val);
+}
+
+/** Decimal conversion, returns the number of digits (buffer >= 20 bytes) */
+CLI_STATIC unsigned int struct_dec_put(
+	char *p_dst,
+	unsigned long long val)
+{
+	char tmp[20];
+	unsigned int n = 0, i;
+
+	do {
+		tmp[n++] = (char)('0' + (val % 10));
+		val /= 10;
+	} while (val != 0);
+
+	for (i = 0; i < n; i++)
+		p_dst[i] = tmp[n - 1 - i];
+
+	return n;
+}
+
+/** Append to the record buffer, 2 bytes are kept for the end of a JSON
+   record */
+CLI_STATIC int struct_rec_put(
+	struct cli_struct_out_s *p_so,
+	const char *p_data,
+	unsigned int len)
+{
+	if (len > sizeof(p_so->rec) - 2 - p_so->rec_len)
+		return IFX_ERROR;
+
+	clios_memcpy(p_so->rec + p_so->rec_len, p_data, len);
+	p_so->rec_len += len;
+
+	return IFX_SUCCESS;
+}
+
+/** Append a TLV header to the record buffer */
+CLI_STATIC int struct_rec_tlv_put(
+	struct cli_struct_out_s *p_so,
+	unsigned char type,
+	unsigned int len)
+{
+	char hdr[CLI_STRUCT_TLV_HDR_SIZE];
+
+	hdr[0] = (char)type;
+	struct_be32_put(hdr + 1, len);
+
+	return struct_rec_put(p_so, hdr, sizeof(hdr));
+}
+
+/** Append a JSON string (quoted, escaped) to the record buffer */
+CLI_STATIC int struct_rec_json_str_put(
+	struct cli_struct_out_s *p_so,
+	const char *p_str,
+	unsigned int len)
+{
+	char esc[6] = {'\\', 'u', '0', '0', 0, 0};
+	unsigned int i, start = 0;
+	unsigned char c;
+
+	if (struct_rec_put(p_so, "\"", 1) != IFX_SUCCESS)
+		return IFX_ERROR;
+
+	for (i = 0; i < len; i++)
+	{
+		c = (unsigned char)p_str[i];
+		if ((c >= 0x20) && (c != '"') && (c != '\\'))
+			continue;
+
+		if (struct_rec_put(p_so, p_str + start, i - start) != IFX_SUCCESS)
+			return IFX_ERROR;
+		start = i + 1;
+
+		if ((c == '"') || (c == '\\'))
+		{
+			esc[1] = (char)c;
+			if (struct_rec_put(p_so, esc, 2) != IFX_SUCCESS)
+				return IFX_ERROR;
+			esc[1] = 'u';
+			continue;
+		}
+		esc[4] = g_cli_struct_hex[c >> 4];
+		esc[5] = g_cli_struct_hex[c & 0xF];
+		if (struct_rec_put(p_so, esc, sizeof(esc)) != IFX_SUCCESS)
+			return IFX_ERROR;
+	}
+
+	if (struct_rec_put(p_so, p_str + start, len - start) != IFX_SUCCESS)
+		return IFX_ERROR;
+
+	return struct_rec_put(p_so, "\"", 1);
+}
+
+/** Append a JSON string (escaped, without quotes) to the sink */
+CLI_STATIC int struct_sink_json_str_put(
+	struct cli_out_sink_s *p_sink,
+	const char *p_str,
+	unsigned int len)
+{
+	char esc[6] = {'\\', 'u', '0', '0', 0, 0};
+	unsigned int i, start = 0;
+	unsigned char c;
+
+	for (i = 0; i < len; i++)
+	{
+		c = (unsigned char)p_str[i];
+		if ((c >= 0x20) && (c != '"') && (c != '\\'))
+			continue;
+
+		if ((i > start) && (cli_out_sink_write(p_sink, p_str + start, i - start) < 0))
+			return IFX_ERROR;
+		start = i + 1;
+
+		switch (c)
+		{
+		case '"':
+		case '\\':
+			esc[1] = (char)c;
+			break;
+		case '\n':
+			esc[1] = 'n';
+			break;
+		case '\r':
+			esc[1] = 'r';
+			break;
+		case '\t':
+			esc[1] = 't';
+			break;
+		default:
+			esc[4] = g_cli_struct_hex[c >> 4];
+			esc[5] = g_cli_struct_hex[c & 0xF];
+			if (cli_out_sink_write(p_sink, esc, sizeof(esc)) < 0)
+				return IFX_ERROR;
+			continue;
+		}
+		if (cli_out_sink_write(p_sink, esc, 2) < 0)
+			return IFX_ERROR;
+		esc[1] = 'u';
+	}
+
+	if ((len > start) && (cli_out_sink_write(p_sink, p_str + start, len - start) < 0))
+		return IFX_ERROR;
+
+	return IFX_SUCCESS;
+}
+
+/** Add a field, JSON: ,"<key>":<value>, TLV: type, length, key length,
+   key, data. A field which does not fit is dropped. */
+CLI_STATIC void struct_field_add(
+	struct cli_struct_out_s *p_so,
+	unsigned char type,
+	const char *p_key,
+	const char *p_data,
+	unsigned int len)
+{
+	unsigned int rec_len, key_len;
+	char key_len_u8;
+	int ret;
+
+	if ((p_so == IFX_NULL) || (p_so->b_rec == 0) || (p_key == IFX_NULL))
+		return;
+
+	rec_len = p_so->rec_len;
+	key_len = (unsigned int)clios_strlen(p_key);
+	if (key_len > 255)
+		key_len = 255;
+
+	if (p_so->format == cli_struct_format_jsonl)
+	{
+		ret = struct_rec_put(p_so, ",", 1);
+		if (ret == IFX_SUCCESS)
+			ret = struct_rec_json_str_put(p_so, p_key, key_len);
+		if (ret == IFX_SUCCESS)
+			ret = struct_rec_put(p_so, ":", 1);
+		if (ret == IFX_SUCCESS)
+			ret = (type == CLI_STRUCT_TLV_STR) ?
+				struct_rec_json_str_put(p_so, p_data, len) :
+				struct_rec_put(p_so, p_data, len);
+	}
+	else
+	{
+		key_len_u8 = (char)key_len;
+		ret = struct_rec_tlv_put(p_so, type, 1 + key_len + len);
+		if (ret == IFX_SUCCESS)
+			ret = struct_rec_put(p_so, &key_len_u8, 1);
+		if (ret == IFX_SUCCESS)
+			ret = struct_rec_put(p_so, p_key, key_len);
+		if (ret == IFX_SUCCESS)
+			ret = struct_rec_put(p_so, p_data, len);
+	}
+
+	if (ret != IFX_SUCCESS)
+	{
+		p_so->rec_len = rec_len;
+		p_so->n_dropped++;
+	}
+}
+
+struct cli_struct_out_s *cli_struct_out_get(void)
+{
+	struct cli_struct_out_s *p_so = g_p_cli_struct_out_active;
+
+	/* text format: the status is taken, the handlers print text */
+	if ((p_so != IFX_NULL) && (p_so->format == cli_struct_format_text))
+		return IFX_NULL;
+
+	return p_so;
+}
+
+int cli_struct_rec_start(
+	struct cli_struct_out_s *p_so,
+	const char *p_name)
+{
+	unsigned int len;
+
+	if ((p_so == IFX_NULL) || (p_name == IFX_NULL) ||
+	    (p_so->format == cli_struct_format_text))
+		return IFX_ERROR;
+
+	len = (unsigned int)clios_strlen(p_name);
+	p_so->rec_len = 0;
+	p_so->b_rec = 0;
+
+	if (p_so->format == cli_struct_format_jsonl)
+	{
+		if ((struct_rec_put(p_so, "{\"rec\":", 7) != IFX_SUCCESS) ||
+		    (struct_rec_json_str_put(p_so, p_name, len) != IFX_SUCCESS))
+			return IFX_ERROR;
+	}
+	else
+	{
+		/* the record length is set on the end of the record */
+		if ((struct_rec_tlv_put(p_so, CLI_STRUCT_TLV_RECORD, 0) != IFX_SUCCESS) ||
+		    (struct_rec_tlv_put(p_so, CLI_STRUCT_TLV_NAME, len) != IFX_SUCCESS) ||
+		    (struct_rec_put(p_so, p_name, len) != IFX_SUCCESS))
+			return IFX_ERROR;
+	}
+	p_so->b_rec = 1;
+
+	return IFX_SUCCESS;
+}
+
+void cli_struct_u64(
+	struct cli_struct_out_s *p_so,
+	const char *p_key,
+	unsigned long long val)
+{
+	char data[20];
+
+	if (p_so == IFX_NULL)
+		return;
+
+	if (p_so->format == cli_struct_format_jsonl)
+	{
+		struct_field_add(p_so, CLI_STRUCT_TLV_U64, p_key, data, struct_dec_put(data, val));
+	}
+	else
+	{
+		struct_be64_put(data, val);
+		struct_field_add(p_so, CLI_STRUCT_TLV_U64, p_key, data, 8);
+	}
+}
+
+void cli_struct_s64(
+	struct cli_struct_out_s *p_so,
+	const char *p_key,
+	long long val)
+{
+	char data[21];
+
+	if (p_so == IFX_NULL)
+		return;
+
+	if (p_so->format == cli_struct_format_jsonl)
+	{
+		if (val < 0)
+		{
+			data[0] = '-';
+			struct_field_add(p_so, CLI_STRUCT_TLV_S64, p_key, data,
+				1 + struct_dec_put(data + 1, 0ULL - (unsigned long long)val));
+		}
+		else
+		{
+			struct_field_add(p_so, CLI_STRUCT_TLV_S64, p_key, data,
+				struct_dec_put(data, (unsigned long long)val));
+		}
+	}
+	else
+	{
+		struct_be64_put(data, (unsigned long long)val);
+		struct_field_add(p_so, CLI_STRUCT_TLV_S64, p_key, data, 8);
+	}
+}
+
+void cli_struct_str(
+	struct cli_struct_out_s *p_so,
+	const char *p_key,
+	const char *p_str)
+{
+	if (p_str == IFX_NULL)
+		p_str = "";
+
+	struct_field_add(p_so, CLI_STRUCT_TLV_STR, p_key, p_str,
+		(unsigned int)clios_strlen(p_str));
+}
+
+int cli_struct_rec_end(
+	struct cli_struct_out_s *p_so)
+{
+	if ((p_so == IFX_NULL) || (p_so->b_rec == 0))
+		return IFX_ERROR;
+	p_so->b_rec = 0;
+
+	if (p_so->format == cli_struct_format_jsonl)
+	{
+		p_so->rec[p_so->rec_len++] = '}';
+		p_so->rec[p_so->rec_len++] = '\n';
+	}
+	else
+	{
+		struct_be32_put(p_so->rec + 1, p_so->rec_len - CLI_STRUCT_TLV_HDR_SIZE);
+	}
+
+	if (cli_out_sink_write(p_so->p_sink, p_so->rec, p_so->rec_len) < 0)
+		return IFX_ERROR;
+	p_so->rec_len = 0;
+	p_so->n_records++;
+
+	return IFX_SUCCESS;
+}
+
+void cli_struct_status_set(
+	struct cli_struct_out_s *p_so,
+	int status)
+{
+	if (p_so == IFX_NULL)
+		return;
+
+	p_so->status = status;
+	p_so->b_status = 1;
+}
+
+int cli_struct_out_init(
+	struct cli_struct_out_s *p_so,
+	enum cli_struct_format_e format,
+	struct cli_out_sink_s *p_sink)
+{
+	if ((p_so == IFX_NULL) || (p_sink == IFX_NULL))
+		return IFX_ERROR;
+
+	p_so->format = format;
+	p_so->p_sink = p_sink;
+	p_so->status = 0;
+	p_so->b_status = 0;
+	p_so->n_records = 0;
+	p_so->n_dropped = 0;
+	p_so->b_rec = 0;
+	p_so->rec_len = 0;
+
+	return IFX_SUCCESS;
+}
+
+/** Get the errorcode of the text output ("errorcode=<n> ...") and the
+   offset of the remaining text */
+CLI_STATIC int struct_text_errorcode_get(
+	const struct cli_out_sink_s *p_text,
+	unsigned int *p_offset)
+{
+	const char *p_data = p_text->first.p_data;
+	unsigned int len = p_text->first.len, i = 10;
+	int sign = 1, errorcode = 0;
+
+	*p_offset = 0;
+	if ((len < 11) || (clios_strncmp(p_data, "errorcode=", 10) != 0))
+		return 0;
+
+	if (p_data[i] == '-')
+	{
+		sign = -1;
+		i++;
+	}
+	while ((i < len) && (p_data[i] >= '0') && (p_data[i] <= '9'))
+	{
+		errorcode = errorcode * 10 + (p_data[i] - '0');
+		i++;
+	}
+	while ((i < len) && ((p_data[i] == ' ') || (p_data[i] == '\r') || (p_data[i] == '\n')))
+		i++;
+
+	*p_offset = i;
+
+	return sign * errorcode;
+}
+
+int cli_struct_out_finish(
+	struct cli_struct_out_s *p_so,
+	const struct cli_out_sink_s *p_text,
+	int ret,
+	int *p_status)
+{
+	const struct cli_out_sink_chunk_s *p_chunk;
+	unsigned int offset, len;
+	int errorcode, status;
+	char hdr[CLI_STRUCT_TLV_HDR_SIZE + 4];
+	char line[24];
+
+	if ((p_so == IFX_NULL) || (p_text == IFX_NULL) || (p_status == IFX_NULL))
+		return IFX_ERROR;
+
+	errorcode = struct_text_errorcode_get(p_text, &offset);
+	if (p_so->b_status != 0)
+		status = p_so->status;
+	else
+		status = (ret < 0) ? ret : errorcode;
+	*p_status = status;
+
+	if (p_so->format == cli_struct_format_text)
+	{
+		for (p_chunk = &p_text->first; p_chunk != IFX_NULL; p_chunk = p_chunk->p_next)
+		{
+			if ((p_chunk->len != 0) &&
+			    (cli_out_sink_write(p_so->p_sink, p_chunk->p_data, p_chunk->len) < 0))
+				return IFX_ERROR;
+		}
+		return IFX_SUCCESS;
+	}
+
+	/* text record with the output behind the errorcode */
+	if (p_text->len > offset)
+	{
+		len = p_text->len - offset;
+		if (p_so->format == cli_struct_format_jsonl)
+		{
+			if (cli_out_sink_write(p_so->p_sink, "{\"text\":\"", 9) < 0)
+				return IFX_ERROR;
+		}
+		else
+		{
+			hdr[0] = (char)CLI_STRUCT_TLV_TEXT;
+			struct_be32_put(hdr + 1, len);
+			if (cli_out_sink_write(p_so->p_sink, hdr, CLI_STRUCT_TLV_HDR_SIZE) < 0)
+				return IFX_ERROR;
+		}
+
+		for (p_chunk = &p_text->first; p_chunk != IFX_NULL; p_chunk = p_chunk->p_next)
+		{
+			if (p_chunk->len <= offset)
+			{
+				offset -= p_chunk->len;
+				continue;
+			}
+			if (p_so->format == cli_struct_format_jsonl)
+			{
+				if (struct_sink_json_str_put(p_so->p_sink,
+					p_chunk->p_data + offset, p_chunk->len - offset) != IFX_SUCCESS)
+					return IFX_ERROR;
+			}
+			else
+			{
+				if (cli_out_sink_write(p_so->p_sink,
+					p_chunk->p_data + offset, p_chunk->len - offset) < 0)
+					return IFX_ERROR;
+			}
+			offset = 0;
+		}
+
+		if ((p_so->format == cli_struct_format_jsonl) &&
+		    (cli_out_sink_write(p_so->p_sink, "\"}\n", 3) < 0))
+			return IFX_ERROR;
+	}
+
+	/* status record */
+	if (p_so->format == cli_struct_format_jsonl)
+	{
+		clios_memcpy(line, "{\"status\":", 10);
+		len = 10;
+		if (status < 0)
+		{
+			line[len++] = '-';
+			len += struct_dec_put(line + len, 0ULL - (unsigned long long)(long long)status);
+		}
+		else
+		{
+			len += struct_dec_put(line + len, (unsigned long long)status);
+		}
+		line[len++] = '}';
+		line[len++] = '\n';
+		if (cli_out_sink_write(p_so->p_sink, line, len) < 0)
+			return IFX_ERROR;
+	}
+	else
+	{
+		hdr[0] = (char)CLI_STRUCT_TLV_STATUS;
+		struct_be32_put(hdr + 1, 4);
+		struct_be32_put(hdr + CLI_STRUCT_TLV_HDR_SIZE, (unsigned int)status);
+		if (cli_out_sink_write(p_so->p_sink, hdr, sizeof(hdr)) < 0)
+			return IFX_ERROR;
+	}
+
+	return IFX_SUCCESS;
+}
+
+struct cli_struct_out_s *cli_struct_out_active_set(
+	struct cli_struct_out_s *p_so)
+{
+	struct cli_struct_out_s *p_prev = g_p_cli_struct_out_active;
+
+	g_p_cli_struct_out_active = p_so;
+
+	return p_prev;
+}
+
+void cli_struct_out_error_set(
+	int status)
+{
+	cli_struct_status_set(g_p_cli_struct_out_active, status);
+}
+
+void cli_struct_session_format_set(
+	enum cli_struct_format_e format)
+{
+	g_cli_struct_session_format = format;
+}
+
+enum cli_struct_format_e cli_struct_session_format_get(void)
+{
+	return g_cli_struct_session_format;
+}
+
+#endif	/* #if (CLI_SUPPORT_STRUCT_OUT == 1) */
@@ -0,0 +1,323 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_STRUCT_OUT_H
+#define _LIB_CLI_STRUCT_OUT_H
+
+/**
+   \file lib_cli_struct_out.h
+   Command Line Interface - structured machine output
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_STRUCT_OUT CLI Structured Output
+
+   Machine readable output of a command execution: the numeric status is
+   returned separately from the payload, the payload is a sequence of typed
+   records serialized as JSON lines or as binary TLV.
+
+   A command handler checks for a structured output of the execution with
+   \ref cli_struct_out_get and emits its records instead of the text:
+   \code
+   struct cli_struct_out_s *p_so = cli_struct_out_get();
+
+   if (p_so != IFX_NULL) {
+      (void)cli_struct_rec_start(p_so, "counter");
+      cli_struct_u64(p_so, "rx", rx);
+      cli_struct_str(p_so, "name", name);
+      (void)cli_struct_rec_end(p_so);
+      cli_struct_status_set(p_so, 0);
+      return 0;
+   }
+   return fprintf(p_file, "errorcode=0 rx=%llu name=%s\n", rx, name);
+   \endcode
+
+   The text output of a handler without structured support is passed as a
+   "text" record, the leading "errorcode=<n>" is taken as status.
+   Every execution ends with a status record.
+
+   JSON lines, one object per line:
+   - record: {"rec":"<name>","<key>":<value>,...}
+   - text: {"text":"<output>"}
+   - status: {"status":<n>}
+
+   TLV, type (1 byte), length (4 byte, big endian), value:
+   - \ref CLI_STRUCT_TLV_RECORD, the value is a sequence of field TLVs,
+     the first one is \ref CLI_STRUCT_TLV_NAME
+   - \ref CLI_STRUCT_TLV_TEXT, the value is the text output
+   - \ref CLI_STRUCT_TLV_STATUS, the value is the status (4 byte, big endian)
+   - field values (except the name): key length (1 byte), key, data
+     (integers 8 byte, big endian)
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** TLV type - record */
+#define CLI_STRUCT_TLV_RECORD	0x01
+/** TLV type - text output */
+#define CLI_STRUCT_TLV_TEXT	0x02
+/** TLV type - status of the execution */
+#define CLI_STRUCT_TLV_STATUS	0x03
+/** TLV type - field: record name */
+#define CLI_STRUCT_TLV_NAME	0x10
+/** TLV type - field: unsigned integer */
+#define CLI_STRUCT_TLV_U64	0x11
+/** TLV type - field: signed integer */
+#define CLI_STRUCT_TLV_S64	0x12
+/** TLV type - field: string */
+#define CLI_STRUCT_TLV_STR	0x13
+
+/** size of a TLV header (type, length) */
+#define CLI_STRUCT_TLV_HDR_SIZE	5
+
+struct cli_out_sink_s;
+
+/** Output format of a session */
+enum cli_struct_format_e
+{
+	/** text output (default) */
+	cli_struct_format_text = 0,
+	/** binary TLV records */
+	cli_struct_format_tlv = 1,
+	/** JSON lines */
+	cli_struct_format_jsonl = 2
+};
+
+/** Structured output of a command execution */
+struct cli_struct_out_s
+{
+	/** output format (TLV or JSON lines) */
+	enum cli_struct_format_e format;
+	/** target of the records */
+	struct cli_out_sink_s *p_sink;
+	/** status set by the handler */
+	int status;
+	/** status was set */
+	unsigned int b_status;
+	/** number of emitted records */
+	unsigned int n_records;
+	/** number of dropped fields (record too large) */
+	unsigned int n_dropped;
+	/** a record is open */
+	unsigned int b_rec;
+	/** used bytes of the record buffer */
+	unsigned int rec_len;
+	/** record buffer */
+	char rec[CLI_STRUCT_OUT_RECORD_SIZE];
+};
+
+/** Get the structured output of the command execution in the calling
+   thread.
+
+\return
+   structured output
+   IFX_NULL - text output.
+*/
+extern struct cli_struct_out_s *cli_struct_out_get(void);
+
+/** Start a record.
+
+\param
+   p_so  structured output.
+\param
+   p_name  name (type) of the record.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_struct_rec_start(
+	struct cli_struct_out_s *p_so,
+	const char *p_name);
+
+/** Add an unsigned integer field to the current record.
+
+\param
+   p_so  structured output.
+\param
+   p_key  key of the field (max 255 characters).
+\param
+   val  value.
+*/
+extern void cli_struct_u64(
+	struct cli_struct_out_s *p_so,
+	const char *p_key,
+	unsigned long long val);
+
+/** Add a signed integer field to the current record.
+
+\param
+   p_so  structured output.
+\param
+   p_key  key of the field (max 255 characters).
+\param
+   val  value.
+*/
+extern void cli_struct_s64(
+	struct cli_struct_out_s *p_so,
+	const char *p_key,
+	long long val);
+
+/** Add a string field to the current record.
+
+\param
+   p_so  structured output.
+\param
+   p_key  key of the field (max 255 characters).
+\param
+   p_str  zero terminated string.
+*/
+extern void cli_struct_str(
+	struct cli_struct_out_s *p_so,
+	const char *p_key,
+	const char *p_str);
+
+/** End the current record and append it to the output.
+
+\param
+   p_so  structured output.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (no record, no memory).
+*/
+extern int cli_struct_rec_end(
+	struct cli_struct_out_s *p_so);
+
+/** Set the status of the execution (default: taken from the text output).
+
+\param
+   p_so  structured output.
+\param
+   status  status (errorcode).
+*/
+extern void cli_struct_status_set(
+	struct cli_struct_out_s *p_so,
+	int status);
+
+/** Set up a structured output (used by the CLI core).
+
+\param
+   p_so  structured output to set up.
+\param
+   format  output format (TLV or JSON lines).
+\param
+   p_sink  target of the records.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_struct_out_init(
+	struct cli_struct_out_s *p_so,
+	enum cli_struct_format_e format,
+	struct cli_out_sink_s *p_sink);
+
+/** Complete the structured output of an execution (used by the CLI core):
+   append the text output as text record and the status record.
+
+\param
+   p_so  structured output, format \ref cli_struct_format_text: the text
+         output is copied to the target.
+\param
+   p_text  collected text output of the execution.
+\param
+   ret  return value of the execution.
+\param
+   p_status  returns the status (handler status, negative return value or
+             the errorcode of the text output).
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (no memory).
+*/
+extern int cli_struct_out_finish(
+	struct cli_struct_out_s *p_so,
+	const struct cli_out_sink_s *p_text,
+	int ret,
+	int *p_status);
+
+/** Set the structured output of the calling thread (used by the CLI core).
+
+\param
+   p_so  active structured output, IFX_NULL: text output.
+
+\return
+   previous active structured output
+*/
+extern struct cli_struct_out_s *cli_struct_out_active_set(
+	struct cli_struct_out_s *p_so);
+
+/** Set the status of the execution in the calling thread, also for the
+   text format (used by the CLI core for its errors).
+
+\param
+   status  status (errorcode).
+*/
+extern void cli_struct_out_error_set(
+	int status);
+
+/** Set the output format of the session running in the calling thread
+   (see \ref cli_struct_session_format_get).
+
+\param
+   format  output format.
+*/
+extern void cli_struct_session_format_set(
+	enum cli_struct_format_e format);
+
+/** Get the output format of the session running in the calling thread.
+   The transports (pipe) execute the commands with
+   \ref cli_core_cmd_exec__struct if it is not text.
+
+\return
+   output format
+*/
+extern enum cli_struct_format_e cli_struct_session_format_get(void);
+
+/** Execute a command line with structured output.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_cmd_arg_buf  command line (modified).
+\param
+   format  output format, \ref cli_struct_format_text: text output
+           (as \ref cli_core_cmd_exec__sink).
+\param
+   p_sink  target of the records (not flushed).
+\param
+   p_status  returns the status of the execution (errorcode).
+
+\return
+   return value of the command execution
+   IFX_ERROR - failed.
+*/
+extern int cli_core_cmd_exec__struct(
+	struct cli_core_context_s *p_core_ctx,
+	char *p_cmd_arg_buf,
+	enum cli_struct_format_e format,
+	struct cli_out_sink_s *p_sink,
+	int *p_status);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_STRUCT_OUT_H */
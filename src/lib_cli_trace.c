@@ -0,0 +1,230 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+/**
+   \file lib_cli_trace.c
+   Command Line Interface - flight recorder (trace of the last executions)
+*/
+
+#include "ifx_types.h"
+#include "lib_cli_config.h"
+#include "lib_cli_osmap.h"
+#include "lib_cli_debug.h"
+#include "lib_cli_core.h"
+
+#if (CLI_SUPPORT_TRACE == 1)
+#include "lib_cli_trace.h"
+
+#ifdef CLI_STATIC
+#	undef CLI_STATIC
+#endif
+
+#ifdef CLI_DEBUG
+#	define CLI_STATIC
+#else
+#	define CLI_STATIC   static
+#endif
+
+/** slot marker - a writer fills the slot */
+#define CLI_TRACE_SLOT_BUSY	(~0ULL)
+
+/** Flight recorder slot
+
+\remarks
+   The commit field works as a sequence lock:
+   - 0: slot is invalid
+   - \ref CLI_TRACE_SLOT_BUSY: slot is under construction
+   - <seq + 1>: slot contains the entry with the given sequence number
+*/
+struct cli_trace_slot_s
+{
+	/** sequence number + 1 of the entry, 0 if invalid */
+	unsigned long long commit;
+	/** the entry */
+	struct cli_trace_entry_s entry;
+};
+
+/** Flight recorder context */
+struct cli_trace_s
+{
+	/** number of slots */
+	unsigned int n_slots;
+	/** next sequence number to write (atomic) */
+	unsigned long long next_seq;
+	/** the ring */
+	struct cli_trace_slot_s *p_slots;
+};
+
+/** session number of the current thread */
+static clios_thread_local int g_cli_trace_session = -1;
+
+int cli_trace_init(
+	struct cli_trace_s **pp_trace,
+	unsigned int n_entries)
+{
+	struct cli_trace_s *p_trace;
+	size_t size;
+
+	if ((pp_trace == IFX_NULL) || (*pp_trace != IFX_NULL) || (n_entries == 0))
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Trace: init - invalid args" CLI_CRLF));
+		return IFX_ERROR;
+	}
+
+	size = sizeof(struct cli_trace_s) + (size_t)n_entries * sizeof(struct cli_trace_slot_s);
+	p_trace = (struct cli_trace_s *)clios_memalloc(size);
+	if (p_trace == IFX_NULL)
+	{
+		CLI_USR_ERR(LIB_CLI, ("ERR CLI Trace: init - no memory" CLI_CRLF));
+		return IFX_ERROR;
+	}
+	clios_memset(p_trace, 0x00, size);
+
+	p_trace->n_slots = n_entries;
+	p_trace->p_slots = (struct cli_trace_slot_s *)(p_trace + 1);
+
+	*pp_trace = p_trace;
+	return IFX_SUCCESS;
+}
+
+int cli_trace_release(
+	struct cli_trace_s **pp_trace)
+{
+	if ((pp_trace == IFX_NULL) || (*pp_trace == IFX_NULL))
+		return IFX_ERROR;
+
+	clios_memfree(*pp_trace);
+	*pp_trace = IFX_NULL;
+
+	return IFX_SUCCESS;
+}
+
+unsigned long cli_trace_mem_size_get(
+	const struct cli_trace_s *p_trace)
+{
+	if (p_trace == IFX_NULL)
+		return 0;
+
+	return (unsigned long)(sizeof(struct cli_trace_s) +
+		(size_t)p_trace->n_slots * sizeof(struct cli_trace_slot_s));
+}
+
+void cli_trace_record(
+	struct cli_trace_s *p_trace,
+	const struct cli_trace_entry_s *p_entry)
+{
+	struct cli_trace_slot_s *p_slot;
+	unsigned long long seq, commit;
+
+	if ((p_trace == IFX_NULL) || (p_entry == IFX_NULL))
+		return;
+
+	/* reserve the slot */
+	seq = clios_atomic_fetch_add(&p_trace->next_seq, 1ULL);
+	p_slot = &p_trace->p_slots[seq % p_trace->n_slots];
+
+	/* claim the slot - after a wrap a writer one lap behind may still fill
+	   it, the writers of a slot are serialized */
+	commit = clios_atomic_load(&p_slot->commit);
+	for (;;)
+	{
+		if (commit == CLI_TRACE_SLOT_BUSY)
+		{
+			commit = clios_atomic_load(&p_slot->commit);
+			continue;
+		}
+		/* already overwritten by a writer one lap ahead */
+		if (commit > seq + 1)
+			return;
+		if (clios_atomic_cas(&p_slot->commit, &commit, CLI_TRACE_SLOT_BUSY))
+			break;
+	}
+
+	/* fill and commit the slot */
+	clios_atomic_fence_release();
+	clios_memcpy(&p_slot->entry, p_entry, sizeof(struct cli_trace_entry_s));
+	p_slot->entry.seq = seq;
+	clios_atomic_store(&p_slot->commit, seq + 1);
+}
+
+int cli_trace_read(
+	struct cli_trace_s *p_trace,
+	unsigned int n_last,
+	cli_trace_read_fct_t read_fct,
+	void *p_data)
+{
+	struct cli_trace_slot_s *p_slot;
+	struct cli_trace_entry_s entry;
+	unsigned long long seq, next_seq, commit;
+	int n_entries = 0;
+
+	if ((p_trace == IFX_NULL) || (read_fct == IFX_NULL))
+		return IFX_ERROR;
+
+	if ((n_last == 0) || (n_last > p_trace->n_slots))
+		n_last = p_trace->n_slots;
+
+	next_seq = clios_atomic_load(&p_trace->next_seq);
+	seq = (next_seq > n_last) ? (next_seq - n_last) : 0;
+
+	for (; seq < next_seq; seq++)
+	{
+		p_slot = &p_trace->p_slots[seq % p_trace->n_slots];
+
+		/* copy the slot, drop it if not committed or overwritten meanwhile */
+		commit = clios_atomic_load(&p_slot->commit);
+		if (commit != seq + 1)
+			continue;
+		clios_memcpy(&entry, &p_slot->entry, sizeof(struct cli_trace_entry_s));
+		clios_atomic_fence_acquire();
+		if (clios_atomic_load_relaxed(&p_slot->commit) != commit)
+			continue;
+
+		entry.key[CLI_TRACE_KEY_SIZE - 1] = '\0';
+		entry.args[CLI_TRACE_ARGS_SIZE - 1] = '\0';
+		n_entries++;
+		if (read_fct(p_data, &entry) != 0)
+			break;
+	}
+
+	return n_entries;
+}
+
+int cli_trace_clear(
+	struct cli_trace_s *p_trace)
+{
+	unsigned long long commit;
+	unsigned int i;
+
+	if (p_trace == IFX_NULL)
+		return IFX_ERROR;
+
+	/* a slot under construction is kept, the writer commits it */
+	for (i = 0; i < p_trace->n_slots; i++)
+	{
+		commit = clios_atomic_load(&p_trace->p_slots[i].commit);
+		while ((commit != CLI_TRACE_SLOT_BUSY) && (commit != 0))
+		{
+			if (clios_atomic_cas(&p_trace->p_slots[i].commit, &commit, 0ULL))
+				break;
+		}
+	}
+
+	return IFX_SUCCESS;
+}
+
+void cli_trace_session_set(
+	int session)
+{
+	g_cli_trace_session = session;
+}
+
+int cli_trace_session_get(void)
+{
+	return g_cli_trace_session;
+}
+
+#endif	/* #if (CLI_SUPPORT_TRACE == 1) */
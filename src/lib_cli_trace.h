@@ -0,0 +1,242 @@
+/******************************************************************************
+ * Copyright (c) 2026 MaxLinear, Inc.
+ *
+ * For licensing information, see the file 'LICENSE' in the root folder of
+ * this software module.
+ ******************************************************************************/
+#ifndef _LIB_CLI_TRACE_H
+#define _LIB_CLI_TRACE_H
+
+/**
+   \file lib_cli_trace.h
+   Command Line Interface - flight recorder (trace of the last executions)
+*/
+
+/** \addtogroup LIB_CLI
+   @{
+*/
+
+/** \defgroup LIB_CLI_TRACE CLI Flight Recorder
+
+   The flight recorder keeps the last command executions of a CLI core
+   within an in-memory ring: time stamp, session (pipe number), command key,
+   truncated arguments, duration, return value and error code.
+
+   The ring can be printed with the built-in command "trace" and is written
+   to a file on \ref cli_core_release if a file has been set with
+   \ref cli_core_trace_file_set.
+
+\remarks
+   - Recording is lock-free (one atomic increment + copy into the slot),
+     only writers which meet on the same slot after a wrap of the ring wait
+     for each other.
+   - The ring is allocated with the command tree
+     (\ref CLI_TRACE_DEFAULT_ENTRIES entries, 0: no flight recorder).
+  @{
+*/
+
+#include "lib_cli_config.h"
+#include "lib_cli_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Flight recorder entry */
+struct cli_trace_entry_s
+{
+	/** sequence number */
+	unsigned long long seq;
+	/** start time [ms since epoch] */
+	unsigned long long time_ms;
+	/** execution time [us] */
+	unsigned int duration_us;
+	/** session number (pipe number), -1: not set */
+	int session;
+	/** CLI core instance number */
+	unsigned int inst;
+	/** return value of the command (< 0: error, else output size) */
+	int ret;
+	/** error code, taken from the "errorcode=" output (buffer mode) */
+	int errorcode;
+	/** command key */
+	char key[CLI_TRACE_KEY_SIZE];
+	/** command arguments (truncated) */
+	char args[CLI_TRACE_ARGS_SIZE];
+};
+
+/** Forward declaration, flight recorder context */
+struct cli_trace_s;
+
+/** Flight recorder read callback, called for each entry (oldest first).
+
+\param
+   p_data  user data, given with the read call.
+\param
+   p_entry  points to the entry.
+
+\return
+   0 - continue
+   else - stop reading
+*/
+typedef int (*cli_trace_read_fct_t)(
+	void *p_data,
+	const struct cli_trace_entry_s *p_entry);
+
+/** Create a flight recorder ring.
+
+\param
+   pp_trace  returns the flight recorder context.
+\param
+   n_entries  number of entries.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_trace_init(
+	struct cli_trace_s **pp_trace,
+	unsigned int n_entries);
+
+/** Release a flight recorder ring.
+
+\param
+   pp_trace  contains the flight recorder context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_trace_release(
+	struct cli_trace_s **pp_trace);
+
+/** Get the memory size of a flight recorder ring.
+
+\param
+   p_trace  flight recorder context.
+
+\return
+   allocated size [byte]
+*/
+extern unsigned long cli_trace_mem_size_get(
+	const struct cli_trace_s *p_trace);
+
+/** Add an entry (lock-free), the sequence number is set here.
+
+\param
+   p_trace  flight recorder context.
+\param
+   p_entry  entry to add.
+*/
+extern void cli_trace_record(
+	struct cli_trace_s *p_trace,
+	const struct cli_trace_entry_s *p_entry);
+
+/** Read the last entries (oldest first).
+
+\param
+   p_trace  flight recorder context.
+\param
+   n_last  number of entries to deliver (0: all).
+\param
+   read_fct  callback, called for each entry.
+\param
+   p_data  user data for the callback.
+
+\return
+   number of delivered entries
+   IFX_ERROR - failed.
+*/
+extern int cli_trace_read(
+	struct cli_trace_s *p_trace,
+	unsigned int n_last,
+	cli_trace_read_fct_t read_fct,
+	void *p_data);
+
+/** Drop all entries.
+
+\param
+   p_trace  flight recorder context.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_trace_clear(
+	struct cli_trace_s *p_trace);
+
+/** Set the session number of the calling thread (recorded with each entry).
+
+\param
+   session  session number (pipe number), -1: not set.
+*/
+extern void cli_trace_session_set(
+	int session);
+
+/** Get the session number of the calling thread.
+
+\return
+   session number, -1: not set.
+*/
+extern int cli_trace_session_get(void);
+
+/** Enable / disable the flight recorder of the given CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   b_enable  IFX_TRUE: record the command executions.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed (no flight recorder).
+*/
+extern int cli_core_trace_enable(
+	struct cli_core_context_s *p_core_ctx,
+	IFX_boolean_t b_enable);
+
+/** Read the last entries of the flight recorder of the given CLI core.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   n_last  number of entries to deliver (0: all).
+\param
+   read_fct  callback, called for each entry.
+\param
+   p_data  user data for the callback.
+
+\return
+   number of delivered entries
+   IFX_ERROR - failed (no flight recorder).
+*/
+extern int cli_core_trace_read(
+	struct cli_core_context_s *p_core_ctx,
+	unsigned int n_last,
+	cli_trace_read_fct_t read_fct,
+	void *p_data);
+
+/** Set the file the flight recorder is written to on \ref cli_core_release.
+
+\param
+   p_core_ctx  CLI context pointer.
+\param
+   p_path  file path, IFX_NULL: do not write a file.
+
+\return
+   IFX_SUCCESS - operation done
+   IFX_ERROR - failed.
+*/
+extern int cli_core_trace_file_set(
+	struct cli_core_context_s *p_core_ctx,
+	const char *p_path);
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+/** @} */
+
+#endif	/* #ifndef _LIB_CLI_TRACE_H */